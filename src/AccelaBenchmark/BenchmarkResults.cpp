@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "BenchmarkResults.h"
+
+#include <algorithm>
+#include <numeric>
+#include <format>
+
+namespace Accela
+{
+
+static double Percentile(const std::vector<double>& sorted, double percentile)
+{
+    if (sorted.empty()) { return 0.0; }
+
+    const auto index = static_cast<std::size_t>(percentile * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+
+void PrintBenchmarkResults(std::ostream& out, const BenchmarkResults& results)
+{
+    out << std::format("--- {} entities{} ---\n", results.entityCount, results.completed ? "" : " (INCOMPLETE)");
+    out << std::format("Entity creation: {:.3f} ms\n", results.entityCreationTimeMs);
+    out << std::format("{:<36}{:>10}{:>10}{:>10}{:>10}{:>10}\n", "Metric (ms)", "min", "avg", "p50", "p99", "max");
+
+    for (const auto& it : results.stepSamples)
+    {
+        auto samples = it.second;
+        if (samples.empty()) { continue; }
+
+        std::ranges::sort(samples);
+
+        const double avg = std::accumulate(samples.cbegin(), samples.cend(), 0.0) / static_cast<double>(samples.size());
+
+        out << std::format("{:<36}{:>10.3f}{:>10.3f}{:>10.3f}{:>10.3f}{:>10.3f}\n",
+            it.first,
+            samples.front(),
+            avg,
+            Percentile(samples, 0.50),
+            Percentile(samples, 0.99),
+            samples.back()
+        );
+    }
+}
+
+}
@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef ACCELABENCHMARK_BENCHMARKRESULTS_H
+#define ACCELABENCHMARK_BENCHMARKRESULTS_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+#include <cstddef>
+
+namespace Accela
+{
+    /**
+     * Samples recorded over the course of one benchmark run
+     */
+    struct BenchmarkResults
+    {
+        /** Whether the run completed all its steps */
+        bool completed{false};
+
+        /** Number of entities the run was configured with */
+        std::size_t entityCount{0};
+
+        /** Time taken to create all the entities, in milliseconds */
+        double entityCreationTimeMs{0.0};
+
+        /** Metric name -> one sample per measured simulation step, in milliseconds */
+        std::map<std::string, std::vector<double>> stepSamples;
+    };
+
+    /**
+     * Writes a human-readable min/avg/p50/p99/max summary of the results to the provided stream
+     */
+    void PrintBenchmarkResults(std::ostream& out, const BenchmarkResults& results);
+}
+
+#endif //ACCELABENCHMARK_BENCHMARKRESULTS_H
@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "BenchmarkScene.h"
+#include "CubeMesh.h"
+
+#include <Accela/Engine/Component/Components.h>
+
+#include <Accela/Common/Timer.h>
+
+#include <cmath>
+#include <array>
+
+namespace Accela
+{
+
+/** The engine metrics which are sampled every measured simulation step */
+static const std::array<std::string, 4> SAMPLED_METRICS = {
+    "Engine_SimulationStep_Time",
+    "Engine_SceneSimulationStep_Time",
+    "Engine_RendererSyncSystem_Time",
+    "Engine_PhysicsSyncSystem_Time"
+};
+
+static constexpr float ENTITY_SPACING = 2.0f;
+
+BenchmarkScene::BenchmarkScene(BenchmarkParams params, Common::IMetrics::Ptr metrics, BenchmarkResults& results)
+    : m_params(params)
+    , m_metrics(std::move(metrics))
+    , m_results(results)
+{
+    m_results.entityCount = m_params.entityCount;
+}
+
+void BenchmarkScene::OnSceneStart(const Engine::IEngineRuntime::Ptr& engine)
+{
+    Scene::OnSceneStart(engine);
+
+    if (!LoadResources())
+    {
+        engine->StopEngine();
+        return;
+    }
+
+    if (m_params.physics)
+    {
+        (void)engine->GetWorldState()->GetPhysics()->CreateScene(Engine::DEFAULT_PHYSICS_SCENE, Engine::PhysicsSceneParams{});
+    }
+
+    Common::Timer creationTimer("EntityCreation");
+    CreateEntities();
+    m_results.entityCreationTimeMs = creationTimer.StopTimer().count();
+}
+
+bool BenchmarkScene::LoadResources()
+{
+    m_cubeMeshId = engine->GetWorldResources()->Meshes()->LoadStaticMesh(
+        Engine::CRI("Cube"),
+        CubeVertices,
+        CubeIndices,
+        Render::MeshUsage::Immutable,
+        Engine::ResultWhen::Ready).get();
+    if (!m_cubeMeshId.IsValid()) { return false; }
+
+    Engine::ObjectMaterialProperties material{};
+    material.isAffectedByLighting = true;
+    material.ambientColor = {1,0,0,1};
+    material.diffuseColor = {1,0,0,1};
+    material.specularColor = {1,0,0,1};
+    material.shininess = 32.0f;
+    material.alphaMode = Render::AlphaMode::Opaque;
+
+    m_materialId = engine->GetWorldResources()->Materials()->LoadObjectMaterial(
+        Engine::CRI("Red"),
+        material,
+        Engine::ResultWhen::Ready).get();
+    if (!m_materialId.IsValid()) { return false; }
+
+    return true;
+}
+
+void BenchmarkScene::CreateEntities()
+{
+    m_entities.reserve(m_params.entityCount);
+
+    for (std::size_t x = 0; x < m_params.entityCount; ++x)
+    {
+        m_entities.push_back(CreateEntity());
+    }
+}
+
+Engine::EntityId BenchmarkScene::CreateEntity()
+{
+    // Lay entities out on a cube-shaped grid, centered around the origin
+    const auto gridSide = static_cast<std::size_t>(std::ceil(std::cbrt(static_cast<double>(m_params.entityCount))));
+    const auto gridOffset = (static_cast<float>(gridSide) * ENTITY_SPACING) / 2.0f;
+
+    std::uniform_int_distribution<std::size_t> cellDist(0, (gridSide * gridSide * gridSide) - 1);
+    const auto cell = cellDist(m_mt);
+
+    const glm::vec3 position{
+        (static_cast<float>(cell % gridSide) * ENTITY_SPACING) - gridOffset,
+        (static_cast<float>((cell / gridSide) % gridSide) * ENTITY_SPACING) - gridOffset,
+        (static_cast<float>(cell / (gridSide * gridSide)) * ENTITY_SPACING) - gridOffset
+    };
+
+    const auto eid = engine->GetWorldState()->CreateEntity();
+
+    auto objectRenderableComponent = Engine::ObjectRenderableComponent{};
+    objectRenderableComponent.sceneName = Engine::DEFAULT_SCENE;
+    objectRenderableComponent.meshId = m_cubeMeshId;
+    objectRenderableComponent.materialId = m_materialId;
+    Engine::AddOrUpdateComponent(engine->GetWorldState(), eid, objectRenderableComponent);
+
+    auto transformComponent = Engine::TransformComponent{};
+    transformComponent.SetPosition(position);
+    Engine::AddOrUpdateComponent(engine->GetWorldState(), eid, transformComponent);
+
+    if (m_params.physics)
+    {
+        const auto shape = Engine::PhysicsShape(
+            Engine::PhysicsMaterial(),
+            Engine::Bounds_AABB(
+            glm::vec3{-0.5f, -0.5f, -0.5f},
+            glm::vec3{0.5f, 0.5f, 0.5f}
+        ));
+
+        auto physicsComponent = Engine::PhysicsComponent::DynamicBody(Engine::DEFAULT_PHYSICS_SCENE, {shape}, 1.0f);
+        Engine::AddOrUpdateComponent(engine->GetWorldState(), eid, physicsComponent);
+    }
+
+    return eid;
+}
+
+void BenchmarkScene::OnSimulationStep(unsigned int timeStep)
+{
+    Scene::OnSimulationStep(timeStep);
+
+    m_stepCount++;
+
+    // Engine metrics are reported at the end of a step, so the values available now are
+    // those of the previous step
+    if (m_stepCount > m_params.warmUpSteps + 1)
+    {
+        RecordStepMetrics();
+    }
+
+    if (m_stepCount > m_params.warmUpSteps + m_params.measuredSteps)
+    {
+        m_results.completed = true;
+        engine->StopEngine();
+        return;
+    }
+
+    MoveEntities();
+    ChurnEntities();
+}
+
+void BenchmarkScene::MoveEntities()
+{
+    if (m_entities.empty()) { return; }
+
+    const auto numToMove = static_cast<std::size_t>(static_cast<float>(m_entities.size()) * m_params.movingFraction);
+
+    std::uniform_real_distribution<float> offsetDist(-0.01f, 0.01f);
+
+    for (std::size_t x = 0; x < numToMove; ++x)
+    {
+        const auto eid = m_entities[m_moveCursor];
+        m_moveCursor = (m_moveCursor + 1) % m_entities.size();
+
+        auto transformComponent = Engine::GetComponent<Engine::TransformComponent>(engine->GetWorldState(), eid);
+        if (!transformComponent) { continue; }
+
+        transformComponent->SetPosition(
+            transformComponent->GetPosition() + glm::vec3(offsetDist(m_mt), offsetDist(m_mt), offsetDist(m_mt))
+        );
+
+        Engine::AddOrUpdateComponent(engine->GetWorldState(), eid, *transformComponent);
+    }
+}
+
+void BenchmarkScene::ChurnEntities()
+{
+    if (m_entities.empty()) { return; }
+
+    const auto numToChurn = static_cast<std::size_t>(static_cast<float>(m_entities.size()) * m_params.churnFraction);
+
+    for (std::size_t x = 0; x < numToChurn; ++x)
+    {
+        engine->GetWorldState()->DestroyEntity(m_entities[m_churnCursor]);
+        m_entities[m_churnCursor] = CreateEntity();
+
+        m_churnCursor = (m_churnCursor + 1) % m_entities.size();
+    }
+}
+
+void BenchmarkScene::RecordStepMetrics()
+{
+    for (const auto& metricName : SAMPLED_METRICS)
+    {
+        const auto value = m_metrics->GetDoubleValue(metricName);
+        if (!value) { continue; }
+
+        m_results.stepSamples[metricName].push_back(*value);
+    }
+}
+
+}
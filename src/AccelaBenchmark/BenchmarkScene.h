@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef ACCELABENCHMARK_BENCHMARKSCENE_H
+#define ACCELABENCHMARK_BENCHMARKSCENE_H
+
+#include "BenchmarkResults.h"
+
+#include <Accela/Engine/Scene/Scene.h>
+#include <Accela/Engine/Common.h>
+
+#include <Accela/Common/Metrics/IMetrics.h>
+
+#include <vector>
+#include <random>
+
+namespace Accela
+{
+    struct BenchmarkParams
+    {
+        /** Number of synthetic entities to create */
+        std::size_t entityCount{1000};
+
+        /** Number of simulation steps to measure, after warm-up */
+        unsigned int measuredSteps{500};
+
+        /** Number of simulation steps to run before measurements start */
+        unsigned int warmUpSteps{50};
+
+        /** Whether entities are given dynamic physics bodies */
+        bool physics{false};
+
+        /** Fraction [0..1] of entities whose transform is modified every step */
+        float movingFraction{0.1f};
+
+        /** Fraction [0..1] of entities which are destroyed and re-created every step */
+        float churnFraction{0.01f};
+    };
+
+    /**
+     * Scene which populates the world with a configurable number of synthetic entities, drives
+     * changes to them every simulation step, and records the engine's per-step timing metrics.
+     *
+     * Stops the engine once the configured number of steps have been measured.
+     */
+    class BenchmarkScene : public Engine::Scene
+    {
+        public:
+
+            BenchmarkScene(BenchmarkParams params, Common::IMetrics::Ptr metrics, BenchmarkResults& results);
+
+            [[nodiscard]] std::string GetName() const override { return "BenchmarkScene"; };
+
+            void OnSceneStart(const Engine::IEngineRuntime::Ptr& engine) override;
+            void OnSimulationStep(unsigned int timeStep) override;
+
+        private:
+
+            [[nodiscard]] bool LoadResources();
+            void CreateEntities();
+            [[nodiscard]] Engine::EntityId CreateEntity();
+
+            void MoveEntities();
+            void ChurnEntities();
+
+            void RecordStepMetrics();
+
+        private:
+
+            BenchmarkParams m_params;
+            Common::IMetrics::Ptr m_metrics;
+            BenchmarkResults& m_results;
+
+            Render::MeshId m_cubeMeshId{};
+            Render::MaterialId m_materialId{};
+
+            std::vector<Engine::EntityId> m_entities;
+
+            unsigned int m_stepCount{0};
+            std::size_t m_moveCursor{0};
+            std::size_t m_churnCursor{0};
+
+            std::mt19937 m_mt{1234};
+    };
+}
+
+#endif //ACCELABENCHMARK_BENCHMARKSCENE_H
@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "HeadlessPlatform.h"
+#include "BenchmarkScene.h"
+#include "BenchmarkResults.h"
+
+#include <Accela/Engine/Builder.h>
+#include <Accela/Engine/IEngine.h>
+
+#include <Accela/Render/NullRenderer.h>
+
+#include <Accela/Common/Log/StdLogger.h>
+#include <Accela/Common/Metrics/InMemoryMetrics.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <charconv>
+#include <optional>
+
+using namespace Accela;
+
+static void PrintUsage()
+{
+    std::cerr << "Usage: AccelaBenchmark [--steps N] [--warmup N] [--physics] [--move F] [--churn F] [entityCount ...]\n"
+              << "  --steps N    Number of simulation steps to measure (default 500)\n"
+              << "  --warmup N   Number of simulation steps to run before measuring (default 50)\n"
+              << "  --physics    Give every entity a dynamic physics body\n"
+              << "  --move F     Fraction of entities whose transform changes every step (default 0.1)\n"
+              << "  --churn F    Fraction of entities destroyed and re-created every step (default 0.01)\n"
+              << "  entityCount  One or more entity counts to benchmark (default 1000 10000 100000)\n";
+}
+
+template <typename T>
+static std::optional<T> ParseNumber(const std::string& str)
+{
+    T value{};
+    const auto result = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (result.ec != std::errc{} || result.ptr != str.data() + str.size()) { return std::nullopt; }
+    return value;
+}
+
+static std::optional<std::pair<BenchmarkParams, std::vector<std::size_t>>> ParseArgs(int argc, char** argv)
+{
+    BenchmarkParams params{};
+    std::vector<std::size_t> entityCounts;
+
+    for (int x = 1; x < argc; ++x)
+    {
+        const std::string arg = argv[x];
+        const bool hasValue = x + 1 < argc;
+
+        if (arg == "--physics")
+        {
+            params.physics = true;
+        }
+        else if (arg == "--steps" && hasValue)
+        {
+            const auto value = ParseNumber<unsigned int>(argv[++x]);
+            if (!value) { return std::nullopt; }
+            params.measuredSteps = *value;
+        }
+        else if (arg == "--warmup" && hasValue)
+        {
+            const auto value = ParseNumber<unsigned int>(argv[++x]);
+            if (!value) { return std::nullopt; }
+            params.warmUpSteps = *value;
+        }
+        else if (arg == "--move" && hasValue)
+        {
+            const auto value = ParseNumber<float>(argv[++x]);
+            if (!value) { return std::nullopt; }
+            params.movingFraction = *value;
+        }
+        else if (arg == "--churn" && hasValue)
+        {
+            const auto value = ParseNumber<float>(argv[++x]);
+            if (!value) { return std::nullopt; }
+            params.churnFraction = *value;
+        }
+        else
+        {
+            const auto value = ParseNumber<std::size_t>(arg);
+            if (!value) { return std::nullopt; }
+            entityCounts.push_back(*value);
+        }
+    }
+
+    if (entityCounts.empty())
+    {
+        entityCounts = {1000, 10000, 100000};
+    }
+
+    return std::make_pair(params, entityCounts);
+}
+
+static BenchmarkResults RunBenchmark(const Common::ILogger::Ptr& logger, const BenchmarkParams& params)
+{
+    BenchmarkResults results{};
+
+    // Fresh platform, renderer and metrics per run so that runs don't affect each other
+    auto metrics = std::make_shared<Common::InMemoryMetrics>();
+
+    auto platform = std::make_shared<HeadlessPlatform>(logger);
+    if (!platform->Startup())
+    {
+        return results;
+    }
+
+    auto renderer = std::make_shared<Render::NullRenderer>(logger, metrics);
+
+    auto engine = Engine::Builder::Build(logger, metrics, platform, renderer);
+
+    engine->Run(
+        std::make_unique<BenchmarkScene>(params, metrics, results),
+        Render::OutputMode::Display,
+        [](){}
+    );
+
+    platform->Shutdown();
+
+    return results;
+}
+
+int main(int argc, char** argv)
+{
+    const auto args = ParseArgs(argc, argv);
+    if (!args)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    auto logger = std::make_shared<Common::StdLogger>(Common::LogLevel::Warning);
+
+    bool allCompleted = true;
+
+    for (const auto& entityCount : args->second)
+    {
+        auto params = args->first;
+        params.entityCount = entityCount;
+
+        const auto results = RunBenchmark(logger, params);
+
+        PrintBenchmarkResults(std::cout, results);
+
+        allCompleted = allCompleted && results.completed;
+    }
+
+    return allCompleted ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "HeadlessPlatform.h"
+
+namespace Accela
+{
+
+HeadlessWindow::HeadlessWindow(std::pair<unsigned int, unsigned int> size)
+    : m_size(std::move(size))
+{
+
+}
+
+std::expected<std::pair<unsigned int, unsigned int>, bool> HeadlessWindow::GetWindowSize() const
+{
+    return m_size;
+}
+
+std::expected<std::pair<unsigned int, unsigned int>, bool> HeadlessWindow::GetWindowDisplaySize() const
+{
+    return m_size;
+}
+
+bool HeadlessWindow::LockCursorToWindow(bool) const
+{
+    return true;
+}
+
+bool HeadlessWindow::SetFullscreen(bool) const
+{
+    return true;
+}
+
+bool HeadlessWindow::SetWindowSize(const std::pair<unsigned int, unsigned int>&) const
+{
+    // The virtual window is always the size it was created with
+    return false;
+}
+
+bool HeadlessWindow::GetVulkanRequiredExtensions(std::vector<std::string>&) const
+{
+    // No surface can be created, so there's nothing for Vulkan to require
+    return false;
+}
+
+bool HeadlessWindow::CreateVulkanSurface(void*, void*) const
+{
+    return false;
+}
+
+HeadlessPlatform::HeadlessPlatform(Common::ILogger::Ptr logger)
+    : PlatformDesktop(std::move(logger))
+    , m_events(std::make_shared<HeadlessEvents>())
+    , m_window(std::make_shared<HeadlessWindow>(std::make_pair(1920U, 1080U)))
+{
+
+}
+
+bool HeadlessPlatform::Startup()
+{
+    // Note that we purposefully don't call PlatformDesktop::Startup, as there's no display
+    // for SDL's video subsystem to initialize against, and nothing the benchmark does needs
+    // it. The files subsystem works without SDL having been initialized.
+    m_logger->Log(Common::LogLevel::Info, "HeadlessPlatform: Starting");
+
+    return true;
+}
+
+void HeadlessPlatform::Shutdown()
+{
+    m_logger->Log(Common::LogLevel::Info, "HeadlessPlatform: Shutting down");
+}
+
+Platform::IEvents::Ptr HeadlessPlatform::GetEvents() const noexcept { return m_events; }
+Platform::IWindow::Ptr HeadlessPlatform::GetWindow() const noexcept { return m_window; }
+
+}
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef ACCELABENCHMARK_HEADLESSPLATFORM_H
+#define ACCELABENCHMARK_HEADLESSPLATFORM_H
+
+#include <Accela/Platform/PlatformDesktop.h>
+#include <Accela/Platform/Event/IEvents.h>
+#include <Accela/Platform/Event/IKeyboardState.h>
+#include <Accela/Platform/Event/IMouseState.h>
+#include <Accela/Platform/Window/IWindow.h>
+
+namespace Accela
+{
+    /**
+     * Keyboard/mouse state which never reports any input
+     */
+    class HeadlessInputState : public Platform::IKeyboardState, public Platform::IMouseState
+    {
+        public:
+
+            [[nodiscard]] bool IsPhysicalKeyPressed(const Platform::PhysicalKey&) const override { return false; }
+            [[nodiscard]] bool IsPhysicalKeyPressed(const Platform::ScanCode&) const override { return false; }
+            [[nodiscard]] bool IsModifierPressed(const Platform::KeyMod&) const override { return false; }
+            void ForceResetState() override { }
+
+            [[nodiscard]] bool IsMouseButtonPressed(const Platform::MouseButton&) const override { return false; }
+    };
+
+    /**
+     * Events subsystem which never produces any events
+     */
+    class HeadlessEvents : public Platform::IEvents
+    {
+        public:
+
+            [[nodiscard]] std::queue<Platform::SystemEvent> PopLocalEvents() override { return {}; }
+
+            [[nodiscard]] std::shared_ptr<const Platform::IKeyboardState> GetKeyboardState() override { return m_inputState; }
+            [[nodiscard]] std::shared_ptr<const Platform::IMouseState> GetMouseState() override { return m_inputState; }
+
+        private:
+
+            std::shared_ptr<HeadlessInputState> m_inputState{std::make_shared<HeadlessInputState>()};
+    };
+
+    /**
+     * Window subsystem for a fixed-size virtual window which doesn't exist on screen
+     */
+    class HeadlessWindow : public Platform::IWindow
+    {
+        public:
+
+            explicit HeadlessWindow(std::pair<unsigned int, unsigned int> size);
+
+            [[nodiscard]] std::expected<std::pair<unsigned int, unsigned int>, bool> GetWindowSize() const override;
+            [[nodiscard]] std::expected<std::pair<unsigned int, unsigned int>, bool> GetWindowDisplaySize() const override;
+            [[nodiscard]] bool LockCursorToWindow(bool lock) const override;
+            [[nodiscard]] bool SetFullscreen(bool fullscreen) const override;
+            [[nodiscard]] bool SetWindowSize(const std::pair<unsigned int, unsigned int>& size) const override;
+            [[nodiscard]] bool GetVulkanRequiredExtensions(std::vector<std::string>& extensions) const override;
+            [[nodiscard]] bool CreateVulkanSurface(void* pVkInstance, void* pVkSurface) const override;
+
+        private:
+
+            std::pair<unsigned int, unsigned int> m_size;
+    };
+
+    /**
+     * Desktop platform which uses the normal desktop files subsystem, but which has no window
+     * or input devices, allowing the engine to be run on machines without a display.
+     */
+    class HeadlessPlatform : public Platform::PlatformDesktop
+    {
+        public:
+
+            explicit HeadlessPlatform(Common::ILogger::Ptr logger);
+
+            [[nodiscard]] bool Startup() override;
+            void Shutdown() override;
+
+            [[nodiscard]] Platform::IEvents::Ptr GetEvents() const noexcept override;
+            [[nodiscard]] Platform::IWindow::Ptr GetWindow() const noexcept override;
+
+        private:
+
+            Platform::IEvents::Ptr m_events;
+            Platform::IWindow::Ptr m_window;
+    };
+}
+
+#endif //ACCELABENCHMARK_HEADLESSPLATFORM_H
@@ -53,15 +53,20 @@ void EditorScene::OnMouseButtonEvent(const Platform::MouseButtonEvent& event)
 
     if (event.button == Platform::MouseButton::Left)
     {
-        const auto clickedEntityId = engine->GetWorldState()->GetTopObjectEntityAt({event.xPos, event.yPos});
-        if (clickedEntityId)
-        {
-            const auto multipleSelectRequested = engine->GetKeyboardState()->IsModifierPressed(Platform::KeyMod::Shift);
-            SendMessageToListener(std::make_shared<EntityClicked>(*clickedEntityId, multipleSelectRequested));
-            return;
-        }
-
-        SendMessageToListener(std::make_shared<NothingClicked>());
+        // Capture the modifier state as of the click, as the pick's result arrives in a later simulation step
+        const auto multipleSelectRequested = engine->GetKeyboardState()->IsModifierPressed(Platform::KeyMod::Shift);
+
+        // Note: capturing this is safe, as pending picks are dropped when the engine switches away from this scene
+        engine->GetWorldState()->GetTopObjectEntityAt({event.xPos, event.yPos},
+            [this, multipleSelectRequested](const std::optional<Engine::EntityId>& clickedEntityId){
+                if (clickedEntityId)
+                {
+                    SendMessageToListener(std::make_shared<EntityClicked>(*clickedEntityId, multipleSelectRequested));
+                    return;
+                }
+
+                SendMessageToListener(std::make_shared<NothingClicked>());
+            });
     }
 }
 
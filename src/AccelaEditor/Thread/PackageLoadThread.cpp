@@ -147,7 +147,7 @@ std::expected<Engine::Manifest, unsigned int> PackageLoadThread::LoadManifestFil
         return std::unexpected(1);
     }
 
-    const auto manifest = Engine::Manifest::FromBytes(*packageFileData);
+    const auto manifest = Engine::Manifest::FromBytes(packageFileData->GetBytes());
     if (!manifest)
     {
         return std::unexpected(2);
@@ -165,7 +165,7 @@ std::expected<Engine::Construct::Ptr, unsigned int> PackageLoadThread::LoadConst
         return std::unexpected(1);
     }
 
-    const auto construct = Engine::Construct::FromBytes(*constructData);
+    const auto construct = Engine::Construct::FromBytes(constructData->GetBytes());
     if (!construct)
     {
         return std::unexpected(2);
@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_IMAGE_KTX2_H
+#define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_IMAGE_KTX2_H
+
+#include <Accela/Common/SharedLib.h>
+#include <Accela/Common/ImageData.h>
+
+#include <expected>
+#include <vector>
+#include <span>
+#include <cstddef>
+
+namespace Accela::Common
+{
+    /**
+     * Reads and writes images in the KTX2 texture container format.
+     *
+     * Supports the subset of the format which maps onto ImageData: 2D textures (optionally arrays and/or
+     * cube maps) in RGBA32 or BC1/BC3/BC5/BC7 pixel formats, with any number of pre-baked mip levels, and
+     * without supercompression. Key/value and supercompression global data is ignored when reading and
+     * never written.
+     */
+    class ACCELA_PUBLIC KTX2
+    {
+        public:
+
+            enum class ParseError
+            {
+                NotKTX2,                // The data doesn't start with the KTX2 file identifier
+                Truncated,              // The data ends before the data the header references
+                UnsupportedFormat,      // The data's vkFormat has no ImageData::PixelFormat equivalent
+                UnsupportedFeature      // The data is a 3D texture or uses supercompression
+            };
+
+            enum class WriteError
+            {
+                UnsupportedFormat       // The image's pixel format has no KTX2 equivalent
+            };
+
+        public:
+
+            /**
+             * @return Whether the provided data starts with the KTX2 file identifier
+             */
+            [[nodiscard]] static bool IsKTX2(std::span<const std::byte> data);
+
+            /**
+             * Parses KTX2 file data into an ImageData. Cube map faces become consecutive image layers.
+             *
+             * @param data The KTX2 file's data
+             *
+             * @return The parsed image, or ParseError on error
+             */
+            [[nodiscard]] static std::expected<ImageData::Ptr, ParseError> Parse(std::span<const std::byte> data);
+
+            /**
+             * Writes an ImageData, including all of its mip levels, as KTX2 file data.
+             *
+             * @param imageData The image to be written
+             * @param srgb Whether the image's color data is sRGB encoded. Ignored for BC5, which is always linear.
+             *
+             * @return The KTX2 file data, or WriteError on error
+             */
+            [[nodiscard]] static std::expected<std::vector<std::byte>, WriteError> Write(const ImageData& imageData, bool srgb = true);
+    };
+}
+
+#endif //LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_IMAGE_KTX2_H
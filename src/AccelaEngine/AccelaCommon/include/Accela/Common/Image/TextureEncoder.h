@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_IMAGE_TEXTUREENCODER_H
+#define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_IMAGE_TEXTUREENCODER_H
+
+#include <Accela/Common/SharedLib.h>
+#include <Accela/Common/ImageData.h>
+
+#include <expected>
+
+namespace Accela::Common
+{
+    /**
+     * CPU encoder which bakes mip chains for, and block-compresses, RGBA32 images.
+     *
+     * Intended for offline use (e.g. when packing a package), so that textures can be loaded onto the
+     * GPU as-is, rather than having their mips generated at load time.
+     *
+     * Encoding notes:
+     * - BC1 and BC3 color endpoints are fit along the principal axis of the block's colors and then refined
+     *   with a least squares pass. BC1 uses its 3-color + transparent mode for blocks with alpha < 128.
+     * - BC3 alpha and both BC5 channels are encoded as BC4 blocks from their min/max values.
+     * - BC7 blocks are always encoded in mode 6 (a single RGBA subset with 4-bit indices), which gives good
+     *   quality for typical textures while keeping the encoder simple and fast.
+     */
+    class ACCELA_PUBLIC TextureEncoder
+    {
+        public:
+
+            enum class EncodeError
+            {
+                UnsupportedSourceFormat,    // The source image isn't RGBA32
+                UnsupportedTargetFormat     // The target format isn't a block-compressed format
+            };
+
+        public:
+
+            /**
+             * Generates a full mip chain, down to 1x1, for an image, by repeatedly box filtering its first mip level.
+             *
+             * @param source The RGBA32 image to generate mips for. Any mips it already has are ignored.
+             * @param srgb Whether the image's color data is sRGB encoded, in which case filtering is done in linear space
+             *
+             * @return A copy of the image which contains a full mip chain, or EncodeError on error
+             */
+            [[nodiscard]] static std::expected<ImageData::Ptr, EncodeError> GenerateMipChain(const ImageData& source, bool srgb);
+
+            /**
+             * Block-compresses every layer of every mip level of an image.
+             *
+             * @param source The RGBA32 image to be compressed
+             * @param targetFormat The block-compressed format to compress to
+             *
+             * @return The compressed image, or EncodeError on error
+             */
+            [[nodiscard]] static std::expected<ImageData::Ptr, EncodeError> Encode(const ImageData& source, ImageData::PixelFormat targetFormat);
+
+            /**
+             * @return Whether any pixel of the RGBA32 image's first mip level is not fully opaque
+             */
+            [[nodiscard]] static bool HasTransparency(const ImageData& source);
+    };
+}
+
+#endif //LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_IMAGE_TEXTUREENCODER_H
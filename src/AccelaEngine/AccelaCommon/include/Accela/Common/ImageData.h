@@ -11,6 +11,7 @@
 
 #include <vector>
 #include <memory>
+#include <functional>
 #include <cstdint>
 #include <cstddef>
 
@@ -18,6 +19,10 @@ namespace Accela::Common
 {
     /**
      * Contains the data associated with a 2D image: pixels, a pixel format, and a width/height.
+     *
+     * Optionally contains a pre-baked mip chain. The data is laid out mip-major: all layers of mip
+     * level 0, followed by all layers of mip level 1, and so on. Block-compressed formats store each
+     * layer of each mip level as rows of 4x4 pixel blocks, with partial blocks padded out at the edges.
      */
     class ACCELA_PUBLIC ImageData
     {
@@ -25,11 +30,21 @@ namespace Accela::Common
 
             using Ptr = std::shared_ptr<ImageData>;
 
+            /**
+             * Invoked with the image's pixel bytes when the image is destroyed, allowing the caller
+             * which provided the bytes to take them back and recycle them.
+             */
+            using ReleaseFunc = std::function<void(std::vector<std::byte>&&)>;
+
             enum class PixelFormat
             {
                 RGB24,          // 3 bytes per pixel, for R, G, and B values
                 R32G32,         // 8 bytes per pixel, for R and G values
-                RGBA32          // 4 bytes per pixel, for R, G, B, and A values
+                RGBA32,         // 4 bytes per pixel, for R, G, B, and A values
+                BC1,            // 8 bytes per 4x4 block, for R, G, B, and 1-bit A values
+                BC3,            // 16 bytes per 4x4 block, for R, G, B, and A values
+                BC5,            // 16 bytes per 4x4 block, for R and G values
+                BC7             // 16 bytes per 4x4 block, for R, G, B, and A values
             };
 
         public:
@@ -48,6 +63,43 @@ namespace Accela::Common
                 std::size_t pixelHeight,
                 PixelFormat pixelFormat);
 
+            /**
+             * @param pixelBytes        The image's raw byte data
+             * @param numLayers         Number of width x height layers in the data
+             * @param pixelWidth        The pixel width of the image
+             * @param pixelHeight       The pixel height of the image
+             * @param pixelFormat       The pixel format the image data uses
+             * @param releaseFunc       Receives the pixel bytes back when the image is destroyed
+             */
+            ImageData(
+                std::vector<std::byte> pixelBytes,
+                uint32_t numLayers,
+                std::size_t pixelWidth,
+                std::size_t pixelHeight,
+                PixelFormat pixelFormat,
+                ReleaseFunc releaseFunc);
+
+            /**
+             * @param pixelBytes        The image's raw byte data, for all mip levels
+             * @param numLayers         Number of width x height layers in the data
+             * @param numMipLevels      Number of mip levels in the data (>= 1)
+             * @param pixelWidth        The pixel width of the image's first mip level
+             * @param pixelHeight       The pixel height of the image's first mip level
+             * @param pixelFormat       The pixel format the image data uses
+             */
+            ImageData(
+                std::vector<std::byte> pixelBytes,
+                uint32_t numLayers,
+                uint32_t numMipLevels,
+                std::size_t pixelWidth,
+                std::size_t pixelHeight,
+                PixelFormat pixelFormat);
+
+            ~ImageData();
+
+            ImageData(const ImageData&) = delete;
+            ImageData& operator=(const ImageData&) = delete;
+
             [[nodiscard]] Common::ImageData::Ptr Clone() const;
 
             /**
@@ -60,6 +112,11 @@ namespace Accela::Common
             */
             [[nodiscard]] uint32_t GetNumLayers() const noexcept { return m_numLayers; }
 
+            /**
+             * @return The number of mip levels the image data contains
+             */
+            [[nodiscard]] uint32_t GetNumMipLevels() const noexcept { return m_numMipLevels; }
+
             /**
              * @return The width, in pixels, of the image
              */
@@ -75,15 +132,40 @@ namespace Accela::Common
              */
             [[nodiscard]] PixelFormat GetPixelFormat() const noexcept { return m_pixelFormat; }
 
+            /**
+             * @return Whether the image's pixel format is a 4x4 block-compressed format
+             */
+            [[nodiscard]] bool IsBlockCompressed() const noexcept { return IsBlockCompressed(m_pixelFormat); }
+
             /**
              * @return The total number of pixels in one layer of the image
              */
             [[nodiscard]] std::size_t GetLayerNumPixels() const noexcept { return m_pixelWidth * m_pixelHeight; }
 
             /**
-             * @return The total byte size of one layer of the image
+             * @return The total byte size of one layer of the image's first mip level
+             */
+            [[nodiscard]] uint64_t GetLayerByteSize() const noexcept { return GetImageByteSize(m_pixelFormat, m_pixelWidth, m_pixelHeight); }
+
+            /**
+             * @return The pixel width of the specified mip level
+             */
+            [[nodiscard]] std::size_t GetMipLevelPixelWidth(uint32_t mipLevel) const noexcept;
+
+            /**
+             * @return The pixel height of the specified mip level
+             */
+            [[nodiscard]] std::size_t GetMipLevelPixelHeight(uint32_t mipLevel) const noexcept;
+
+            /**
+             * @return The byte offset, within the image's bytes, at which the specified mip level's layers start
+             */
+            [[nodiscard]] uint64_t GetMipLevelByteOffset(uint32_t mipLevel) const noexcept;
+
+            /**
+             * @return The total byte size of all layers of the specified mip level
              */
-            [[nodiscard]] uint64_t GetLayerByteSize() const noexcept { return GetLayerNumPixels() * GetBytesPerPixel(); }
+            [[nodiscard]] uint64_t GetMipLevelByteSize(uint32_t mipLevel) const noexcept;
 
             /**
              * @return The total byte size of the image
@@ -91,13 +173,13 @@ namespace Accela::Common
             [[nodiscard]] uint64_t GetTotalByteSize() const noexcept { return m_pixelBytes.size(); }
 
             /**
-             * @return The number of bytes which make up one pixel
+             * @return The number of bytes which make up one pixel, or 0 for block-compressed formats
              */
             [[nodiscard]] uint8_t GetBytesPerPixel() const;
 
             /**
              * Return the bytes associated with a given pixel index. Will return a vector with GetBytesPerPixel()
-             * number of elements.
+             * number of elements. Not valid for block-compressed formats, which have no per-pixel bytes.
              *
              * @param layerIndex The layer index to retrieve the pixel bytes from [0 .. GetNumLayers() - 1]
              * @param pixelIndex The pixel index in question [0 .. GetLayerNumPixels() - 1]
@@ -106,6 +188,16 @@ namespace Accela::Common
              */
             [[nodiscard]] std::vector<std::byte> GetPixelBytes(const uint32_t& layerIndex, const uintmax_t& pixelIndex) const;
 
+            /**
+             * @return Whether the provided pixel format is a 4x4 block-compressed format
+             */
+            [[nodiscard]] static bool IsBlockCompressed(PixelFormat pixelFormat) noexcept;
+
+            /**
+             * @return The byte size of one width x height layer of the provided pixel format
+             */
+            [[nodiscard]] static uint64_t GetImageByteSize(PixelFormat pixelFormat, std::size_t pixelWidth, std::size_t pixelHeight) noexcept;
+
         private:
 
             [[nodiscard]] bool SanityCheckValues() const;
@@ -114,9 +206,11 @@ namespace Accela::Common
 
             std::vector<std::byte> m_pixelBytes;        // Sequence of bytes representing individual RGB/RGBA/etc components
             uint32_t m_numLayers;                       // Number of width x height layers in the data
+            uint32_t m_numMipLevels{1};                 // Number of mip levels in the data
             std::size_t m_pixelWidth;                   // Width of the image, in pixels
             std::size_t m_pixelHeight;                  // Height of the image, in pixels
             PixelFormat m_pixelFormat;                  // Pixel format of the image.
+            ReleaseFunc m_releaseFunc;                  // Optional receiver of the pixel bytes on destruction
     };
 }
 
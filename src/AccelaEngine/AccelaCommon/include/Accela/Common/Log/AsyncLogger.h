@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_ASYNCLOGGER_H
+#define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_ASYNCLOGGER_H
+
+#include "ILogger.h"
+#include "ILogSink.h"
+#include "LogRecord.h"
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Common
+{
+    class LogRing;
+
+    /**
+     * What an AsyncLogger does when a thread logs while its log buffer is full
+     */
+    enum class LogOverflowPolicy
+    {
+        Block,  // The logging thread waits until the writer thread has freed up space. No logs are lost.
+        Drop    // The log is discarded. The writer reports how many logs each thread had dropped.
+    };
+
+    /**
+     * Concrete ILogger which moves all log output off of the logging threads.
+     *
+     * Each thread which logs is given its own fixed-size, lock-free, single producer ring buffer, so
+     * logging never takes a lock (after a thread's first log) and never contends with other logging
+     * threads. Logging only captures a timestamp and copies the message into the ring.
+     *
+     * A background writer thread drains all of the rings, orders the drained records by timestamp,
+     * and writes them to the logger's sinks, flushing the sinks once per batch. All formatting and
+     * output (and any blocking on slow consumers of that output) happens on the writer thread.
+     *
+     * Fatal logs block until they, and everything logged before them, have been written and flushed.
+     */
+    class ACCELA_PUBLIC AsyncLogger : public ILogger
+    {
+        public:
+
+            /**
+             * @param sinks The sinks to write logs to
+             * @param minLogLevel The minimum level of logs which are captured
+             * @param overflowPolicy What to do when a thread's ring buffer is full
+             * @param ringByteSize Byte size of each thread's ring buffer. Rounded up to a power of two.
+             * Messages longer than the ring are truncated.
+             */
+            explicit AsyncLogger(std::vector<ILogSink::Ptr> sinks,
+                                 const LogLevel& minLogLevel = LogLevel::Debug,
+                                 LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block,
+                                 std::size_t ringByteSize = 64 * 1024);
+            ~AsyncLogger() override;
+
+            AsyncLogger(const AsyncLogger&) = delete;
+            AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+            void Log(LogLevel loglevel, std::string_view str) override;
+
+            /**
+             * Blocks until everything logged before the call has been written to the sinks and the sinks
+             * have been flushed.
+             */
+            void Flush();
+
+        private:
+
+            [[nodiscard]] LogRing* GetThreadRing();
+
+            void WriterThreadFunc();
+            [[nodiscard]] bool WriteAvailableRecords();
+
+        private:
+
+            std::vector<ILogSink::Ptr> m_sinks;
+            LogLevel m_minLogLevel;
+            LogOverflowPolicy m_overflowPolicy;
+            std::size_t m_ringByteSize;
+
+            // Unique (across all AsyncLogger instances) id used to look up threads' rings for this logger
+            std::uint64_t m_instanceId;
+
+            std::mutex m_ringsMutex;
+            std::vector<std::shared_ptr<LogRing>> m_rings;
+
+            std::thread m_writerThread;
+            std::atomic<bool> m_run{true};
+
+            std::mutex m_wakeMutex;
+            std::condition_variable m_wakeCv;
+            std::atomic<bool> m_wakeRequested{false};
+
+            std::mutex m_flushMutex;
+            std::condition_variable m_flushCv;
+            std::atomic<std::uint64_t> m_flushRequested{0};
+            std::uint64_t m_flushCompleted{0};
+
+            // Writer thread working state, reused between batches
+            std::vector<LogRecord> m_batch;
+    };
+}
+
+#endif //LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_ASYNCLOGGER_H
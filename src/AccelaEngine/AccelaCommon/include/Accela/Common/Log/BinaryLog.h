@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_BINARYLOG_H
+#define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_BINARYLOG_H
+
+#include "LogRecord.h"
+
+#include <Accela/Common/SharedLib.h>
+
+#include <string>
+#include <istream>
+#include <optional>
+#include <cstddef>
+
+namespace Accela::Common
+{
+    /**
+     * Compact binary log file format.
+     *
+     * A file starts with an 8 byte header (the 6 byte "ACCLOG" identifier followed by a little-endian
+     * uint16 version), followed by any number of records. Each record is:
+     *
+     *  - uint8  log level
+     *  - int64  timestamp, in nanoseconds since the unix epoch
+     *  - uint32 message byte length, at most MAX_MESSAGE_BYTE_SIZE
+     *  - the message's bytes, without a terminator
+     *
+     * With all integers little-endian. Writing a record is a handful of memcpys, with no formatting.
+     */
+    class ACCELA_PUBLIC BinaryLog
+    {
+        public:
+
+            /** Size of the file header, in bytes */
+            static constexpr std::size_t HEADER_BYTE_SIZE = 8;
+
+            /** Maximum byte size of a record's message; longer messages are truncated when appended */
+            static constexpr std::size_t MAX_MESSAGE_BYTE_SIZE = 1024 * 1024;
+
+        public:
+
+            /**
+             * Appends the file header to the provided buffer
+             */
+            static void AppendHeader(std::string& buffer);
+
+            /**
+             * Appends an encoded record to the provided buffer
+             *
+             * @return The number of bytes appended
+             */
+            static std::size_t AppendRecord(std::string& buffer, const LogRecord& record);
+
+            /**
+             * Reads and validates a file header from the provided stream
+             *
+             * @return Whether a valid header, of a supported version, was read
+             */
+            [[nodiscard]] static bool ReadHeader(std::istream& stream);
+
+            /**
+             * Reads the next record from the provided stream
+             *
+             * @return The record, or std::nullopt at the end of the stream or if the stream holds a truncated or
+             * invalid record, such as one whose message is longer than MAX_MESSAGE_BYTE_SIZE
+             */
+            [[nodiscard]] static std::optional<LogRecord> ReadRecord(std::istream& stream);
+    };
+}
+
+#endif //LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_BINARYLOG_H
@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_ILOGSINK_H
+#define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_ILOGSINK_H
+
+#include "LogRecord.h"
+
+#include <Accela/Common/SharedLib.h>
+
+#include <memory>
+
+namespace Accela::Common
+{
+    /**
+     * Destination which an AsyncLogger writes log records to.
+     *
+     * Sinks are only ever called from the logger's writer thread, so don't need to be thread safe,
+     * and are free to perform slow/blocking output.
+     */
+    class ACCELA_PUBLIC ILogSink
+    {
+        public:
+
+            using Ptr = std::shared_ptr<ILogSink>;
+
+        public:
+
+            virtual ~ILogSink() = default;
+
+            /**
+             * Write a record to the sink. The sink may buffer the output until Flush is called.
+             */
+            virtual void Write(const LogRecord& record) = 0;
+
+            /**
+             * Flush any buffered output. Called after each batch of records has been written.
+             */
+            virtual void Flush() = 0;
+    };
+}
+
+#endif //LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_ILOGSINK_H
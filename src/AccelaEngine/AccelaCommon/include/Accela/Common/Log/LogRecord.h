@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_LOGRECORD_H
+#define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_LOGRECORD_H
+
+#include "ILogger.h"
+
+#include <Accela/Common/SharedLib.h>
+
+#include <string>
+#include <chrono>
+
+namespace Accela::Common
+{
+    /**
+     * A single log message, as captured at the time it was logged
+     */
+    struct ACCELA_PUBLIC LogRecord
+    {
+        LogLevel logLevel{LogLevel::Debug};
+        std::chrono::system_clock::time_point timestamp;
+        std::string message;
+    };
+
+    /**
+     * @return The display name of the provided log level
+     */
+    [[nodiscard]] ACCELA_PUBLIC std::string LogLevelToStr(LogLevel logLevel);
+
+    /**
+     * Formats a log record as a single line of text (without a trailing newline), in the
+     * same "[timestamp] [level] message" format that StdLogger outputs.
+     */
+    [[nodiscard]] ACCELA_PUBLIC std::string FormatLogRecord(const LogRecord& record);
+}
+
+#endif //LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_LOGRECORD_H
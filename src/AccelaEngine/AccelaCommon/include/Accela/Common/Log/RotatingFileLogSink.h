@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_ROTATINGFILELOGSINK_H
+#define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_ROTATINGFILELOGSINK_H
+
+#include "ILogSink.h"
+
+#include <filesystem>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Common
+{
+    /**
+     * ILogSink which writes logs to a file, rotating it once it grows past a maximum size.
+     *
+     * When the file at filePath is full it's renamed to filePath.1, the previous filePath.1 is renamed
+     * to filePath.2, and so on, with the oldest file beyond maxFileCount being deleted. Logging then
+     * continues into a new, empty, filePath.
+     *
+     * Records are written either as text lines, or in the compact binary log format (see BinaryLog.h),
+     * which skips timestamp/text formatting entirely and can be converted to text offline with the
+     * AccelaLogDecoder tool.
+     */
+    class ACCELA_PUBLIC RotatingFileLogSink : public ILogSink
+    {
+        public:
+
+            enum class Format
+            {
+                Text,
+                Binary
+            };
+
+        public:
+
+            /**
+             * @param filePath Path of the file to log to. Rotated files are written next to it.
+             * @param format The format to write records in
+             * @param maxFileByteSize Size a file can grow to before it's rotated
+             * @param maxFileCount Total number of files, including the current one, to keep. Minimum of 1.
+             */
+            RotatingFileLogSink(std::filesystem::path filePath,
+                                Format format,
+                                std::uintmax_t maxFileByteSize = 16 * 1024 * 1024,
+                                unsigned int maxFileCount = 4);
+
+            void Write(const LogRecord& record) override;
+            void Flush() override;
+
+        private:
+
+            void OpenFile();
+            void RotateFiles();
+
+            [[nodiscard]] std::filesystem::path GetRotatedFilePath(unsigned int index) const;
+
+        private:
+
+            std::filesystem::path m_filePath;
+            Format m_format;
+            std::uintmax_t m_maxFileByteSize;
+            unsigned int m_maxFileCount;
+
+            std::ofstream m_file;
+            std::uintmax_t m_fileByteSize{0};
+
+            std::string m_buffer;
+    };
+}
+
+#endif //LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_ROTATINGFILELOGSINK_H
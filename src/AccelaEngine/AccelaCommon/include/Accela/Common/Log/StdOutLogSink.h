@@ -0,0 +1,26 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_STDOUTLOGSINK_H
+#define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_STDOUTLOGSINK_H
+
+#include "ILogSink.h"
+
+namespace Accela::Common
+{
+    /**
+     * ILogSink which writes text log lines to std::cout, flushing once per batch rather than per line
+     */
+    class ACCELA_PUBLIC StdOutLogSink : public ILogSink
+    {
+        public:
+
+            void Write(const LogRecord& record) override;
+            void Flush() override;
+    };
+}
+
+#endif //LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_LOG_STDOUTLOGSINK_H
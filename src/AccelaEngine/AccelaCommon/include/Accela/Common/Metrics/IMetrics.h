@@ -7,20 +7,43 @@
 #ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_METRICS_IMETRICS_H
 #define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_METRICS_IMETRICS_H
 
+#include "MetricsSnapshot.h"
+
 #include <Accela/Common/SharedLib.h>
 
 #include <memory>
 #include <string>
 #include <optional>
+#include <limits>
+#include <cstdint>
 
 namespace Accela::Common
 {
     enum class MetricType
     {
         Counter,
-        Double
+        Double,
+        Histogram
+    };
+
+    /**
+     * Handle to a pre-registered metric. Recording through a handle avoids the metric
+     * name lookup which the string-based methods perform.
+     */
+    template <MetricType Type>
+    struct MetricHandle
+    {
+        static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index{INVALID_INDEX};
+
+        [[nodiscard]] bool IsValid() const noexcept { return index != INVALID_INDEX; }
     };
 
+    using CounterHandle = MetricHandle<MetricType::Counter>;
+    using DoubleHandle = MetricHandle<MetricType::Double>;
+    using HistogramHandle = MetricHandle<MetricType::Histogram>;
+
     class ACCELA_PUBLIC IMetrics
     {
         public:
@@ -31,12 +54,52 @@ namespace Accela::Common
 
             virtual ~IMetrics() = default;
 
+            //
+            // Registration. Registering a name which is already registered returns the existing
+            // metric's handle. Counters, doubles and histograms have separate namespaces.
+            //
+            [[nodiscard]] virtual CounterHandle RegisterCounter(const std::string& name) = 0;
+            [[nodiscard]] virtual DoubleHandle RegisterDouble(const std::string& name) = 0;
+            [[nodiscard]] virtual HistogramHandle RegisterHistogram(const std::string& name) = 0;
+
+            //
+            // Counters
+            //
             virtual void SetCounterValue(const std::string& name, uintmax_t value) = 0;
+            virtual void SetCounterValue(const CounterHandle& handle, uintmax_t value) = 0;
             virtual void IncrementCounterValue(const std::string& name) = 0;
+            virtual void IncrementCounterValue(const CounterHandle& handle, uintmax_t amount) = 0;
             [[nodiscard]] virtual std::optional<uintmax_t> GetCounterValue(const std::string& name) const = 0;
 
+            //
+            // Doubles
+            //
             virtual void SetDoubleValue(const std::string& name, double value) = 0;
+            virtual void SetDoubleValue(const DoubleHandle& handle, double value) = 0;
             [[nodiscard]] virtual std::optional<double> GetDoubleValue(const std::string& name) const = 0;
+
+            //
+            // Histograms
+            //
+            virtual void RecordHistogramValue(const std::string& name, double value) = 0;
+            virtual void RecordHistogramValue(const HistogramHandle& handle, double value) = 0;
+            [[nodiscard]] virtual std::optional<HistogramSummary> GetHistogramSummary(const std::string& name) const = 0;
+
+            /**
+             * Summarizes only the values recorded since the previous windowed summary of the histogram (or since
+             * it was registered), and starts a new window. Windows are tracked separately from the values which
+             * GetHistogramSummary and snapshots summarize, so they don't affect each other, but each histogram
+             * has a single window; it's meant for one periodic reader, such as a stats overlay.
+             */
+            [[nodiscard]] virtual std::optional<HistogramSummary> GetWindowedHistogramSummary(const std::string& name) = 0;
+
+            /**
+             * @param resetHistograms Whether histograms should be cleared after being read, so that
+             * the next snapshot only summarizes values recorded since this one.
+             *
+             * @return A copy of the current values of all registered metrics
+             */
+            [[nodiscard]] virtual MetricsSnapshot GetSnapshot(bool resetHistograms) = 0;
     };
 }
 
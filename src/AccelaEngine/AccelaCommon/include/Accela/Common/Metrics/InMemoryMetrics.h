@@ -10,25 +10,150 @@
 #include "IMetrics.h"
 
 #include <unordered_map>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <cstddef>
 
 namespace Accela::Common
 {
-    // TODO: Memory safety, add mutexes
+    /**
+     * Thread-safe, in-memory IMetrics implementation.
+     *
+     * Metric storage is allocated once, at registration time, and never moves or is freed until
+     * destruction, so recording a value through a metric handle is lock-free. Name-based calls
+     * additionally take a shared lock to look the name up (registering it on first use).
+     *
+     * Counters are sharded across cache lines, with each thread incrementing its own shard, so
+     * counters hammered from many worker threads don't contend on a single atomic.
+     *
+     * Histograms use log-linear (HDR-style) buckets: values are bucketed by their power of two,
+     * and each power of two is split into 64 linear sub-buckets, giving percentiles with a relative
+     * error of under 2% across the entire value range. Values are stored with three decimal places
+     * of precision; negative values are clamped to zero. Each histogram additionally keeps a second
+     * set of buckets for the values recorded within its current window.
+     */
     class ACCELA_PUBLIC InMemoryMetrics : public IMetrics
     {
         public:
 
+            InMemoryMetrics();
+            ~InMemoryMetrics() override;
+
+            InMemoryMetrics(const InMemoryMetrics&) = delete;
+            InMemoryMetrics& operator=(const InMemoryMetrics&) = delete;
+
+            [[nodiscard]] CounterHandle RegisterCounter(const std::string& name) override;
+            [[nodiscard]] DoubleHandle RegisterDouble(const std::string& name) override;
+            [[nodiscard]] HistogramHandle RegisterHistogram(const std::string& name) override;
+
             void SetCounterValue(const std::string& name, uintmax_t value) override;
+            void SetCounterValue(const CounterHandle& handle, uintmax_t value) override;
             void IncrementCounterValue(const std::string& name) override;
+            void IncrementCounterValue(const CounterHandle& handle, uintmax_t amount) override;
             [[nodiscard]] std::optional<uintmax_t> GetCounterValue(const std::string& name) const override;
 
             void SetDoubleValue(const std::string& name, double value) override;
+            void SetDoubleValue(const DoubleHandle& handle, double value) override;
             [[nodiscard]] std::optional<double> GetDoubleValue(const std::string& name) const override;
 
+            void RecordHistogramValue(const std::string& name, double value) override;
+            void RecordHistogramValue(const HistogramHandle& handle, double value) override;
+            [[nodiscard]] std::optional<HistogramSummary> GetHistogramSummary(const std::string& name) const override;
+            [[nodiscard]] std::optional<HistogramSummary> GetWindowedHistogramSummary(const std::string& name) override;
+
+            [[nodiscard]] MetricsSnapshot GetSnapshot(bool resetHistograms) override;
+
+        private:
+
+            /** Maximum number of metrics of each type which can be registered */
+            static constexpr uint32_t MAX_METRICS = 1024;
+
+            /** Number of shards each counter is split into */
+            static constexpr std::size_t COUNTER_SHARDS = 16;
+
+            /** log2 of the number of linear sub-buckets per power of two in a histogram */
+            static constexpr uint32_t HISTOGRAM_SUB_BITS = 6;
+            static constexpr uint32_t HISTOGRAM_SUB_BUCKETS = 1U << HISTOGRAM_SUB_BITS;
+            static constexpr uint32_t HISTOGRAM_BUCKETS = HISTOGRAM_SUB_BUCKETS * (64 - HISTOGRAM_SUB_BITS + 1);
+
+            /** Recorded histogram values are multiplied by this before being bucketed */
+            static constexpr double HISTOGRAM_VALUE_SCALE = 1000.0;
+
+            struct alignas(64) CounterShard
+            {
+                std::atomic<uintmax_t> value{0};
+            };
+
+            struct CounterMetric
+            {
+                std::array<CounterShard, COUNTER_SHARDS> shards;
+            };
+
+            struct DoubleMetric
+            {
+                std::atomic<double> value{0.0};
+            };
+
+            struct HistogramValues
+            {
+                std::atomic<uint64_t> count{0};
+                std::atomic<uint64_t> sum{0};
+                std::atomic<uint64_t> min{std::numeric_limits<uint64_t>::max()};
+                std::atomic<uint64_t> max{0};
+                std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS> buckets{};
+            };
+
+            struct HistogramMetric
+            {
+                HistogramValues values;         // Values recorded since registration, or since a resetting snapshot
+                HistogramValues windowValues;   // Values recorded since the last windowed summary
+            };
+
+            /**
+             * Fixed-capacity registry of one type of metric. Slot pointers are published with release
+             * semantics once their metric is constructed, and are never modified again.
+             */
+            template <typename T>
+            struct Registry
+            {
+                std::unordered_map<std::string, uint32_t> nameToIndex;
+                std::array<std::string, MAX_METRICS> names;
+                std::array<std::atomic<T*>, MAX_METRICS> metrics{};
+                std::atomic<uint32_t> size{0};
+            };
+
         private:
 
-            std::unordered_map<std::string, uintmax_t> m_counters;
-            std::unordered_map<std::string, double> m_doubles;
+            template <typename T>
+            [[nodiscard]] uint32_t Register(Registry<T>& registry, const std::string& name);
+
+            template <typename T>
+            [[nodiscard]] std::optional<uint32_t> Lookup(const Registry<T>& registry, const std::string& name) const;
+
+            template <typename T>
+            [[nodiscard]] static T* GetMetric(const Registry<T>& registry, uint32_t index);
+
+            template <typename T>
+            static void DestroyRegistry(Registry<T>& registry);
+
+            [[nodiscard]] static uintmax_t GetCounterValue(const CounterMetric& counter);
+            static void RecordHistogramValue(HistogramValues& values, uint64_t scaledValue);
+            [[nodiscard]] static HistogramSummary GetHistogramSummary(HistogramValues& values, bool reset);
+
+            [[nodiscard]] static uint32_t ValueToBucket(uint64_t value);
+            [[nodiscard]] static uint64_t BucketToValue(uint32_t bucket);
+
+        private:
+
+            // Guards registration and name lookups; not needed for handle-based recording
+            mutable std::shared_mutex m_registryMutex;
+
+            std::unique_ptr<Registry<CounterMetric>> m_counters;
+            std::unique_ptr<Registry<DoubleMetric>> m_doubles;
+            std::unique_ptr<Registry<HistogramMetric>> m_histograms;
     };
 }
 
@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_METRICS_METRICSSNAPSHOT_H
+#define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_METRICS_METRICSSNAPSHOT_H
+
+#include <Accela/Common/SharedLib.h>
+
+#include <string>
+#include <map>
+#include <cstdint>
+
+namespace Accela::Common
+{
+    /**
+     * Summary of the distribution of values which have been recorded into a histogram metric
+     */
+    struct HistogramSummary
+    {
+        uint64_t count{0};
+
+        double min{0.0};
+        double max{0.0};
+        double mean{0.0};
+
+        double p50{0.0};
+        double p90{0.0};
+        double p99{0.0};
+        double p999{0.0};
+    };
+
+    /**
+     * Point-in-time copy of the values of all registered metrics
+     */
+    struct MetricsSnapshot
+    {
+        std::map<std::string, uintmax_t> counters;
+        std::map<std::string, double> doubles;
+        std::map<std::string, HistogramSummary> histograms;
+    };
+
+    /**
+     * Formats a snapshot as human-readable text, one metric per line, sorted by metric name.
+     */
+    [[nodiscard]] ACCELA_PUBLIC std::string MetricsSnapshotToText(const MetricsSnapshot& snapshot);
+}
+
+#endif //LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_METRICS_METRICSSNAPSHOT_H
@@ -15,12 +15,26 @@ namespace Accela::Common
     {
         public:
 
+            [[nodiscard]] CounterHandle RegisterCounter(const std::string&) override { return {}; };
+            [[nodiscard]] DoubleHandle RegisterDouble(const std::string&) override { return {}; };
+            [[nodiscard]] HistogramHandle RegisterHistogram(const std::string&) override { return {}; };
+
             void SetCounterValue(const std::string&, uintmax_t) override {};
+            void SetCounterValue(const CounterHandle&, uintmax_t) override {};
             void IncrementCounterValue(const std::string&) override {};
+            void IncrementCounterValue(const CounterHandle&, uintmax_t) override {};
             [[nodiscard]] std::optional<uintmax_t> GetCounterValue(const std::string&) const override { return std::nullopt; };
 
             void SetDoubleValue(const std::string&, double) override {};
+            void SetDoubleValue(const DoubleHandle&, double) override {};
             [[nodiscard]] std::optional<double> GetDoubleValue(const std::string&) const override { return std::nullopt; };
+
+            void RecordHistogramValue(const std::string&, double) override {};
+            void RecordHistogramValue(const HistogramHandle&, double) override {};
+            [[nodiscard]] std::optional<HistogramSummary> GetHistogramSummary(const std::string&) const override { return std::nullopt; };
+            [[nodiscard]] std::optional<HistogramSummary> GetWindowedHistogramSummary(const std::string&) override { return std::nullopt; };
+
+            [[nodiscard]] MetricsSnapshot GetSnapshot(bool) override { return {}; };
     };
 }
 
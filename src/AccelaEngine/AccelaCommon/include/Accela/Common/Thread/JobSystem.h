@@ -0,0 +1,271 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_THREAD_JOBSYSTEM_H
+#define LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_THREAD_JOBSYSTEM_H
+
+#include <Accela/Common/SharedLib.h>
+
+#include <memory>
+#include <functional>
+#include <future>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <type_traits>
+#include <exception>
+#include <cstddef>
+#include <cstdint>
+
+namespace Accela::Common
+{
+    class JobSystem;
+
+    /**
+     * Handle to a unit of work which has been submitted to a JobSystem.
+     *
+     * Can be used to wait for the work to finish, or as a dependency of other
+     * submitted work.
+     */
+    class ACCELA_PUBLIC Job
+    {
+        public:
+
+            using Ptr = std::shared_ptr<Job>;
+            using Work = std::function<void()>;
+
+        public:
+
+            explicit Job(Work work)
+                : m_work(std::move(work))
+            { }
+
+            /**
+             * @return Whether the job's work has finished executing
+             */
+            [[nodiscard]] bool IsComplete() const noexcept { return m_complete.load(std::memory_order_acquire); }
+
+        private:
+
+            friend class JobSystem;
+
+            Work m_work;
+
+            // Number of unfinished dependencies. Starts at 1, representing the submitter, which
+            // is released once all dependencies have been registered.
+            std::atomic<uint32_t> m_pendingDependencies{1};
+
+            std::mutex m_continuationsMutex;
+            std::vector<Job::Ptr> m_continuations;
+
+            std::atomic<bool> m_complete{false};
+    };
+
+    /**
+     * Work-stealing job system.
+     *
+     * Spawns a fixed set of worker threads, each of which owns a deque of runnable jobs. Workers push and pop
+     * work from the back of their own deque, and steal work from the front of other workers' deques when
+     * their own runs dry. Work submitted from threads outside of the job system is distributed round-robin
+     * across the worker deques. As each deque has its own lock there's no single queue that all submitters
+     * and workers contend on.
+     *
+     * Jobs can depend on other jobs, forming a task graph; a job only becomes runnable once all of its
+     * dependencies have finished. Waiting on a job (or future) from a worker thread executes other pending
+     * jobs while waiting, so nested waits can't starve the pool.
+     *
+     * Intended to be created once and shared by all systems which need CPU parallelism, so that cores
+     * aren't oversubscribed by several independent thread pools.
+     */
+    class ACCELA_PUBLIC JobSystem
+    {
+        public:
+
+            using Ptr = std::shared_ptr<JobSystem>;
+
+            /** Function invoked by ParallelFor for a [begin, end) sub-range of the overall range */
+            using RangeFunc = std::function<void(std::size_t begin, std::size_t end)>;
+
+        public:
+
+            /**
+             * @param tag Tag to associate with the job system's threads
+             * @param numWorkers Number of worker threads to spawn. If 0, defaults to one less than the
+             * number of hardware threads (leaving a core for the thread which drives the simulation).
+             */
+            explicit JobSystem(std::string tag, unsigned int numWorkers = 0);
+
+            /**
+             * Stops the job system. Work which was already submitted, including work that becomes runnable
+             * as its dependencies finish, is run to completion first, so that no submitted work (or future)
+             * is left unfulfilled.
+             */
+            ~JobSystem();
+
+            JobSystem(const JobSystem&) = delete;
+            JobSystem& operator=(const JobSystem&) = delete;
+
+            /**
+             * @return The number of worker threads the job system is running
+             */
+            [[nodiscard]] unsigned int GetWorkerCount() const noexcept { return static_cast<unsigned int>(m_workers.size()); }
+
+            /**
+             * @return Whether the calling thread is one of this job system's worker threads
+             */
+            [[nodiscard]] bool IsWorkerThread() const noexcept;
+
+            /**
+             * Submit work to be run asynchronously.
+             *
+             * Full thread safety to be called from any thread, including from within jobs.
+             *
+             * @param work The work to be run
+             *
+             * @return A handle to the submitted job
+             */
+            Job::Ptr Submit(Job::Work work);
+
+            /**
+             * Submit work to be run asynchronously after all of the provided jobs have finished.
+             *
+             * Full thread safety to be called from any thread, including from within jobs.
+             *
+             * @param work The work to be run
+             * @param dependencies The jobs which must finish before the work is run
+             *
+             * @return A handle to the submitted job
+             */
+            Job::Ptr Submit(Job::Work work, const std::vector<Job::Ptr>& dependencies);
+
+            /**
+             * Submit work which produces a result, to be run asynchronously.
+             *
+             * If the work throws, the exception is stored in the returned future rather
+             * than escaping the worker thread.
+             *
+             * @tparam T The work's result type (may be void)
+             * @param work The work to be run
+             *
+             * @return A future which receives the work's result
+             */
+            template <typename T>
+            std::future<T> SubmitForResult(std::function<T()> work)
+            {
+                auto promise = std::make_shared<std::promise<T>>();
+                auto future = promise->get_future();
+
+                Submit([promise, work = std::move(work)](){
+                    try
+                    {
+                        if constexpr (std::is_void_v<T>)
+                        {
+                            work();
+                            promise->set_value();
+                        }
+                        else
+                        {
+                            promise->set_value(work());
+                        }
+                    }
+                    catch (...)
+                    {
+                        promise->set_exception(std::current_exception());
+                    }
+                });
+
+                return future;
+            }
+
+            /**
+             * Blocks until the provided job has finished. If called from a worker thread, the worker executes
+             * other pending jobs while waiting, on top of the caller's stack. A worker must therefore never wait
+             * on something that only the caller itself, further down its stack, can complete. Threads outside
+             * the job system simply block.
+             */
+            void Wait(const Job::Ptr& job);
+
+            /**
+             * Blocks until all the provided jobs have finished. Executes other jobs while waiting,
+             * as with Wait(job).
+             */
+            void Wait(const std::vector<Job::Ptr>& jobs);
+
+            /**
+             * Blocks until the provided future is ready and returns its value. Executes other jobs
+             * while waiting, as with Wait(job). Should be used instead of future::get() when waiting
+             * on a future from within a job.
+             */
+            template <typename T>
+            T Await(std::future<T> future)
+            {
+                WaitUntil([&](){ return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; });
+                return future.get();
+            }
+
+            /**
+             * Runs the provided function over the range [begin, end), split into sub-ranges which are run
+             * in parallel across the job system's workers. The calling thread participates in processing the
+             * range, and the call returns once the entire range has been processed.
+             *
+             * Note that a worker thread waits for the other sub-ranges as with Wait(job), so any queued job, related
+             * or not, can run on the caller's stack before this returns. Callers must not hold locks, or be in the
+             * middle of work, that such a job could need in order to finish.
+             *
+             * @param begin Start of the range (inclusive)
+             * @param end End of the range (exclusive)
+             * @param grainSize Maximum sub-range size. If 0, a size is chosen which gives each worker a few sub-ranges.
+             * @param func The function to run for each sub-range
+             */
+            void ParallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, const RangeFunc& func);
+
+        private:
+
+            struct WorkerQueue
+            {
+                std::mutex mutex;
+                std::deque<Job::Ptr> jobs;
+            };
+
+        private:
+
+            void WorkerThreadFunc(unsigned int workerIndex);
+
+            void Schedule(const Job::Ptr& job);
+            [[nodiscard]] Job::Ptr FindJob();
+            void Execute(const Job::Ptr& job);
+            void ReleaseDependency(const Job::Ptr& job);
+
+            void WaitUntil(const std::function<bool()>& isDone);
+
+            [[nodiscard]] std::string GetThreadIdentifier(unsigned int workerIndex) const;
+
+        private:
+
+            std::string m_tag;
+
+            std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+            std::vector<std::thread> m_workers;
+
+            std::atomic<bool> m_run{true};
+            std::atomic<std::size_t> m_nextQueue{0};
+
+            // Number of jobs sitting in worker queues, waiting to be run
+            std::atomic<std::size_t> m_queuedJobs{0};
+
+            // Number of threads (workers or waiters) blocked waiting for something to happen
+            std::atomic<std::size_t> m_sleepingThreads{0};
+            std::mutex m_sleepMutex;
+            std::condition_variable m_sleepCv;
+    };
+}
+
+#endif //LIBACCELACOMMON_INCLUDE_ACCELA_COMMON_THREAD_JOBSYSTEM_H
@@ -45,12 +45,21 @@ namespace Accela::Common
 
             /**
              * Stops the timer and returns the elapsed time. Also outputs the result
-             * of the timer as a metric
+             * of the timer as a metric; both as a double metric holding the latest
+             * result, and into a same-named histogram metric of all results
              *
-             * @param logger The metric to receive the timer output
+             * @param metrics The metrics to receive the timer output
              */
             std::chrono::duration<double, std::milli> StopTimer(const Common::IMetrics::Ptr& metrics);
 
+            /**
+             * As with StopTimer(metrics), but outputs through pre-registered metric handles rather
+             * than looking the metrics up by the timer's identifier
+             */
+            std::chrono::duration<double, std::milli> StopTimer(const Common::IMetrics::Ptr& metrics,
+                                                                const DoubleHandle& doubleHandle,
+                                                                const HistogramHandle& histogramHandle);
+
         private:
 
             std::string m_identifier;
@@ -0,0 +1,346 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Common/Image/KTX2.h>
+
+#include <array>
+#include <algorithm>
+#include <optional>
+#include <cstring>
+
+namespace Accela::Common
+{
+
+static constexpr std::array<uint8_t, 12> KTX2_IDENTIFIER = {
+    0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A // «KTX 20»\r\n\x1A\n
+};
+
+static constexpr std::size_t KTX2_HEADER_BYTE_SIZE = 80;
+static constexpr std::size_t KTX2_LEVEL_INDEX_ENTRY_BYTE_SIZE = 24;
+
+// VkFormat values, as stored in a KTX2 header. Common has no dependency on Vulkan headers.
+static constexpr uint32_t VK_FORMAT_R8G8B8A8_UNORM = 37;
+static constexpr uint32_t VK_FORMAT_R8G8B8A8_SRGB = 43;
+static constexpr uint32_t VK_FORMAT_BC1_RGB_UNORM_BLOCK = 131;
+static constexpr uint32_t VK_FORMAT_BC1_RGB_SRGB_BLOCK = 132;
+static constexpr uint32_t VK_FORMAT_BC1_RGBA_UNORM_BLOCK = 133;
+static constexpr uint32_t VK_FORMAT_BC1_RGBA_SRGB_BLOCK = 134;
+static constexpr uint32_t VK_FORMAT_BC3_UNORM_BLOCK = 137;
+static constexpr uint32_t VK_FORMAT_BC3_SRGB_BLOCK = 138;
+static constexpr uint32_t VK_FORMAT_BC5_UNORM_BLOCK = 141;
+static constexpr uint32_t VK_FORMAT_BC7_UNORM_BLOCK = 145;
+static constexpr uint32_t VK_FORMAT_BC7_SRGB_BLOCK = 146;
+
+// Data format descriptor values, from the Khronos Data Format Specification
+static constexpr uint8_t KHR_DF_MODEL_RGBSDA = 1;
+static constexpr uint8_t KHR_DF_MODEL_BC1A = 128;
+static constexpr uint8_t KHR_DF_MODEL_BC3 = 130;
+static constexpr uint8_t KHR_DF_MODEL_BC5 = 132;
+static constexpr uint8_t KHR_DF_MODEL_BC7 = 134;
+static constexpr uint8_t KHR_DF_PRIMARIES_BT709 = 1;
+static constexpr uint8_t KHR_DF_TRANSFER_LINEAR = 1;
+static constexpr uint8_t KHR_DF_TRANSFER_SRGB = 2;
+static constexpr uint8_t KHR_DF_SAMPLE_DATATYPE_LINEAR = 0x10;
+
+struct DFDSample
+{
+    uint16_t bitOffset;
+    uint8_t bitLength;
+    uint8_t channelType;
+    uint32_t sampleUpper;
+};
+
+template <typename T>
+static T ReadValue(std::span<const std::byte> data, std::size_t offset)
+{
+    T value{};
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    return value;
+}
+
+template <typename T>
+static void WriteValue(std::vector<std::byte>& data, std::size_t offset, T value)
+{
+    std::memcpy(data.data() + offset, &value, sizeof(T));
+}
+
+static std::optional<ImageData::PixelFormat> VkFormatToPixelFormat(uint32_t vkFormat)
+{
+    switch (vkFormat)
+    {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB: return ImageData::PixelFormat::RGBA32;
+        case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK: return ImageData::PixelFormat::BC1;
+        case VK_FORMAT_BC3_UNORM_BLOCK:
+        case VK_FORMAT_BC3_SRGB_BLOCK: return ImageData::PixelFormat::BC3;
+        case VK_FORMAT_BC5_UNORM_BLOCK: return ImageData::PixelFormat::BC5;
+        case VK_FORMAT_BC7_UNORM_BLOCK:
+        case VK_FORMAT_BC7_SRGB_BLOCK: return ImageData::PixelFormat::BC7;
+        default: return std::nullopt;
+    }
+}
+
+bool KTX2::IsKTX2(std::span<const std::byte> data)
+{
+    if (data.size() < KTX2_IDENTIFIER.size()) { return false; }
+
+    return std::memcmp(data.data(), KTX2_IDENTIFIER.data(), KTX2_IDENTIFIER.size()) == 0;
+}
+
+std::expected<ImageData::Ptr, KTX2::ParseError> KTX2::Parse(std::span<const std::byte> data)
+{
+    if (!IsKTX2(data)) { return std::unexpected(ParseError::NotKTX2); }
+    if (data.size() < KTX2_HEADER_BYTE_SIZE) { return std::unexpected(ParseError::Truncated); }
+
+    const auto vkFormat = ReadValue<uint32_t>(data, 12);
+    const auto pixelWidth = ReadValue<uint32_t>(data, 20);
+    const auto pixelHeight = ReadValue<uint32_t>(data, 24);
+    const auto pixelDepth = ReadValue<uint32_t>(data, 28);
+    const auto layerCount = ReadValue<uint32_t>(data, 32);
+    const auto faceCount = ReadValue<uint32_t>(data, 36);
+    const auto levelCount = ReadValue<uint32_t>(data, 40);
+    const auto supercompressionScheme = ReadValue<uint32_t>(data, 44);
+
+    const auto pixelFormat = VkFormatToPixelFormat(vkFormat);
+    if (!pixelFormat) { return std::unexpected(ParseError::UnsupportedFormat); }
+
+    if (pixelDepth != 0 || supercompressionScheme != 0)
+    {
+        return std::unexpected(ParseError::UnsupportedFeature);
+    }
+
+    if (pixelWidth == 0 || (faceCount != 1 && faceCount != 6))
+    {
+        return std::unexpected(ParseError::UnsupportedFeature);
+    }
+
+    // A height of 0 denotes a 1D texture, a layer count of 0 a non-array texture, and a level count
+    // of 0 a texture which wants its mips generated at load time; all of which are a single instance
+    const uint32_t numLayers = std::max(layerCount, 1U) * faceCount;
+    const uint32_t numMipLevels = std::max(levelCount, 1U);
+    const std::size_t imageWidth = pixelWidth;
+    const std::size_t imageHeight = std::max(pixelHeight, 1U);
+
+    if (numMipLevels > 32) { return std::unexpected(ParseError::UnsupportedFeature); }
+
+    const std::size_t levelIndexEndOffset = KTX2_HEADER_BYTE_SIZE + (numMipLevels * KTX2_LEVEL_INDEX_ENTRY_BYTE_SIZE);
+    if (data.size() < levelIndexEndOffset) { return std::unexpected(ParseError::Truncated); }
+
+    //
+    // Gather each level's data, which the file stores smallest level first, into ImageData's
+    // largest level first layout
+    //
+    std::vector<std::byte> pixelBytes;
+
+    for (uint32_t level = 0; level < numMipLevels; ++level)
+    {
+        const std::size_t levelIndexOffset = KTX2_HEADER_BYTE_SIZE + (level * KTX2_LEVEL_INDEX_ENTRY_BYTE_SIZE);
+        const auto byteOffset = ReadValue<uint64_t>(data, levelIndexOffset);
+        const auto byteLength = ReadValue<uint64_t>(data, levelIndexOffset + 8);
+
+        const auto levelWidth = std::max<std::size_t>(1, imageWidth >> level);
+        const auto levelHeight = std::max<std::size_t>(1, imageHeight >> level);
+        const auto expectedByteLength = ImageData::GetImageByteSize(*pixelFormat, levelWidth, levelHeight) * numLayers;
+
+        if (byteLength != expectedByteLength) { return std::unexpected(ParseError::Truncated); }
+        if (byteOffset > data.size() || byteLength > data.size() - byteOffset) { return std::unexpected(ParseError::Truncated); }
+
+        const auto levelData = data.subspan(byteOffset, byteLength);
+        pixelBytes.insert(pixelBytes.end(), levelData.begin(), levelData.end());
+    }
+
+    return std::make_shared<ImageData>(
+        std::move(pixelBytes),
+        numLayers,
+        numMipLevels,
+        imageWidth,
+        imageHeight,
+        *pixelFormat
+    );
+}
+
+std::expected<std::vector<std::byte>, KTX2::WriteError> KTX2::Write(const ImageData& imageData, bool srgb)
+{
+    uint32_t vkFormat{0};
+    uint8_t colorModel{0};
+    std::array<uint8_t, 4> texelBlockDimensions{0, 0, 0, 0};
+    uint8_t bytesPerBlock{0};
+    std::vector<DFDSample> samples;
+
+    switch (imageData.GetPixelFormat())
+    {
+        case ImageData::PixelFormat::RGBA32:
+        {
+            vkFormat = srgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+            colorModel = KHR_DF_MODEL_RGBSDA;
+            bytesPerBlock = 4;
+            samples = {
+                {0, 7, 0, 255},                                 // R
+                {8, 7, 1, 255},                                 // G
+                {16, 7, 2, 255},                                // B
+                {24, 7, 15 | KHR_DF_SAMPLE_DATATYPE_LINEAR, 255} // A
+            };
+        }
+        break;
+        case ImageData::PixelFormat::BC1:
+        {
+            vkFormat = srgb ? VK_FORMAT_BC1_RGBA_SRGB_BLOCK : VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+            colorModel = KHR_DF_MODEL_BC1A;
+            bytesPerBlock = 8;
+            samples = { {0, 63, 1, 0xFFFFFFFF} };              // Color + alpha present
+        }
+        break;
+        case ImageData::PixelFormat::BC3:
+        {
+            vkFormat = srgb ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+            colorModel = KHR_DF_MODEL_BC3;
+            bytesPerBlock = 16;
+            samples = {
+                {0, 63, 15 | KHR_DF_SAMPLE_DATATYPE_LINEAR, 0xFFFFFFFF},    // Alpha
+                {64, 63, 0, 0xFFFFFFFF}                                     // Color
+            };
+        }
+        break;
+        case ImageData::PixelFormat::BC5:
+        {
+            vkFormat = VK_FORMAT_BC5_UNORM_BLOCK;
+            srgb = false;
+            colorModel = KHR_DF_MODEL_BC5;
+            bytesPerBlock = 16;
+            samples = {
+                {0, 63, 0, 0xFFFFFFFF},                         // Red
+                {64, 63, 1, 0xFFFFFFFF}                         // Green
+            };
+        }
+        break;
+        case ImageData::PixelFormat::BC7:
+        {
+            vkFormat = srgb ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+            colorModel = KHR_DF_MODEL_BC7;
+            bytesPerBlock = 16;
+            samples = { {0, 127, 0, 0xFFFFFFFF} };             // Color
+        }
+        break;
+        default:
+            return std::unexpected(WriteError::UnsupportedFormat);
+    }
+
+    if (imageData.IsBlockCompressed())
+    {
+        texelBlockDimensions = {3, 3, 0, 0};
+    }
+
+    const uint32_t numMipLevels = imageData.GetNumMipLevels();
+
+    const std::size_t dfdByteOffset = KTX2_HEADER_BYTE_SIZE + (numMipLevels * KTX2_LEVEL_INDEX_ENTRY_BYTE_SIZE);
+    const std::size_t descriptorBlockByteSize = 24 + (samples.size() * 16);
+    const std::size_t dfdByteLength = 4 + descriptorBlockByteSize;
+
+    // Level data must be aligned to the least common multiple of the texel block size and 4
+    const std::size_t levelAlignment = std::max<std::size_t>(bytesPerBlock, 4);
+
+    //
+    // Lay out level data, smallest level first, after the data format descriptor
+    //
+    std::vector<std::size_t> levelFileOffsets(numMipLevels, 0);
+    std::size_t fileByteSize = dfdByteOffset + dfdByteLength;
+
+    for (uint32_t level = numMipLevels; level-- > 0;)
+    {
+        fileByteSize = ((fileByteSize + levelAlignment - 1) / levelAlignment) * levelAlignment;
+        levelFileOffsets[level] = fileByteSize;
+        fileByteSize += imageData.GetMipLevelByteSize(level);
+    }
+
+    std::vector<std::byte> fileData(fileByteSize, std::byte{0});
+
+    //
+    // Header
+    //
+    std::memcpy(fileData.data(), KTX2_IDENTIFIER.data(), KTX2_IDENTIFIER.size());
+    WriteValue<uint32_t>(fileData, 12, vkFormat);
+    WriteValue<uint32_t>(fileData, 16, 1);                                                      // typeSize
+    WriteValue<uint32_t>(fileData, 20, static_cast<uint32_t>(imageData.GetPixelWidth()));
+    WriteValue<uint32_t>(fileData, 24, static_cast<uint32_t>(imageData.GetPixelHeight()));
+    WriteValue<uint32_t>(fileData, 28, 0);                                                      // pixelDepth
+    WriteValue<uint32_t>(fileData, 32, imageData.GetNumLayers() > 1 ? imageData.GetNumLayers() : 0);
+    WriteValue<uint32_t>(fileData, 36, 1);                                                      // faceCount
+    WriteValue<uint32_t>(fileData, 40, numMipLevels);
+    WriteValue<uint32_t>(fileData, 44, 0);                                                      // supercompressionScheme
+    WriteValue<uint32_t>(fileData, 48, static_cast<uint32_t>(dfdByteOffset));
+    WriteValue<uint32_t>(fileData, 52, static_cast<uint32_t>(dfdByteLength));
+    WriteValue<uint32_t>(fileData, 56, 0);                                                      // kvdByteOffset
+    WriteValue<uint32_t>(fileData, 60, 0);                                                      // kvdByteLength
+    WriteValue<uint64_t>(fileData, 64, 0);                                                      // sgdByteOffset
+    WriteValue<uint64_t>(fileData, 72, 0);                                                      // sgdByteLength
+
+    //
+    // Level index
+    //
+    for (uint32_t level = 0; level < numMipLevels; ++level)
+    {
+        const std::size_t levelIndexOffset = KTX2_HEADER_BYTE_SIZE + (level * KTX2_LEVEL_INDEX_ENTRY_BYTE_SIZE);
+        const uint64_t levelByteSize = imageData.GetMipLevelByteSize(level);
+
+        WriteValue<uint64_t>(fileData, levelIndexOffset, levelFileOffsets[level]);
+        WriteValue<uint64_t>(fileData, levelIndexOffset + 8, levelByteSize);
+        WriteValue<uint64_t>(fileData, levelIndexOffset + 16, levelByteSize);
+    }
+
+    //
+    // Data format descriptor, containing a single basic descriptor block
+    //
+    WriteValue<uint32_t>(fileData, dfdByteOffset, static_cast<uint32_t>(dfdByteLength));
+
+    const std::size_t blockOffset = dfdByteOffset + 4;
+    WriteValue<uint32_t>(fileData, blockOffset, 0);                                             // vendorId + descriptorType
+    WriteValue<uint16_t>(fileData, blockOffset + 4, 2);                                         // versionNumber
+    WriteValue<uint16_t>(fileData, blockOffset + 6, static_cast<uint16_t>(descriptorBlockByteSize));
+    WriteValue<uint8_t>(fileData, blockOffset + 8, colorModel);
+    WriteValue<uint8_t>(fileData, blockOffset + 9, KHR_DF_PRIMARIES_BT709);
+    WriteValue<uint8_t>(fileData, blockOffset + 10, srgb ? KHR_DF_TRANSFER_SRGB : KHR_DF_TRANSFER_LINEAR);
+    WriteValue<uint8_t>(fileData, blockOffset + 11, 0);                                         // flags
+    std::memcpy(fileData.data() + blockOffset + 12, texelBlockDimensions.data(), texelBlockDimensions.size());
+    WriteValue<uint8_t>(fileData, blockOffset + 16, bytesPerBlock);                             // bytesPlane0
+
+    for (std::size_t x = 0; x < samples.size(); ++x)
+    {
+        const std::size_t sampleOffset = blockOffset + 24 + (x * 16);
+        const auto& sample = samples[x];
+
+        uint8_t channelType = sample.channelType;
+
+        // For sRGB data, the alpha channel is stored linearly
+        if ((channelType & 0x0F) == 15 && !srgb) { channelType &= 0x0F; }
+
+        WriteValue<uint16_t>(fileData, sampleOffset, sample.bitOffset);
+        WriteValue<uint8_t>(fileData, sampleOffset + 2, sample.bitLength);
+        WriteValue<uint8_t>(fileData, sampleOffset + 3, channelType);
+        WriteValue<uint32_t>(fileData, sampleOffset + 8, 0);                                    // sampleLower
+        WriteValue<uint32_t>(fileData, sampleOffset + 12, sample.sampleUpper);
+    }
+
+    //
+    // Level data
+    //
+    const auto& pixelBytes = imageData.GetPixelBytes();
+
+    for (uint32_t level = 0; level < numMipLevels; ++level)
+    {
+        std::memcpy(
+            fileData.data() + levelFileOffsets[level],
+            pixelBytes.data() + imageData.GetMipLevelByteOffset(level),
+            imageData.GetMipLevelByteSize(level)
+        );
+    }
+
+    return fileData;
+}
+
+}
@@ -0,0 +1,787 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Common/Image/TextureEncoder.h>
+
+#include <array>
+#include <algorithm>
+#include <optional>
+#include <limits>
+#include <utility>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+namespace Accela::Common
+{
+
+static constexpr std::array<uint32_t, 16> BC7_WEIGHTS_4 = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+template <std::size_t N>
+using Color = std::array<float, N>;
+
+using BlockPixels = std::array<std::array<uint8_t, 4>, 16>;
+
+//
+// Shared endpoint fitting
+//
+
+/**
+ * Fits a line through the provided colors along their principal axis, and returns the line's
+ * extents as a pair of endpoints
+ */
+template <std::size_t N>
+static std::pair<Color<N>, Color<N>> FitPrincipalAxis(const std::vector<Color<N>>& colors)
+{
+    Color<N> mean{};
+    for (const auto& color : colors)
+    {
+        for (std::size_t c = 0; c < N; ++c) { mean[c] += color[c]; }
+    }
+    for (std::size_t c = 0; c < N; ++c) { mean[c] /= (float)colors.size(); }
+
+    std::array<std::array<float, N>, N> covariance{};
+    for (const auto& color : colors)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = 0; j < N; ++j)
+            {
+                covariance[i][j] += (color[i] - mean[i]) * (color[j] - mean[j]);
+            }
+        }
+    }
+
+    // Power iteration for the covariance matrix's dominant eigenvector
+    Color<N> axis{};
+    axis.fill(1.0f);
+
+    for (unsigned int iteration = 0; iteration < 8; ++iteration)
+    {
+        Color<N> next{};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = 0; j < N; ++j) { next[i] += covariance[i][j] * axis[j]; }
+        }
+
+        float length = 0.0f;
+        for (std::size_t c = 0; c < N; ++c) { length += next[c] * next[c]; }
+        length = std::sqrt(length);
+
+        if (length < 1e-6f) { return {mean, mean}; }
+
+        for (std::size_t c = 0; c < N; ++c) { axis[c] = next[c] / length; }
+    }
+
+    float minProjection = std::numeric_limits<float>::max();
+    float maxProjection = std::numeric_limits<float>::lowest();
+
+    for (const auto& color : colors)
+    {
+        float projection = 0.0f;
+        for (std::size_t c = 0; c < N; ++c) { projection += (color[c] - mean[c]) * axis[c]; }
+
+        minProjection = std::min(minProjection, projection);
+        maxProjection = std::max(maxProjection, projection);
+    }
+
+    Color<N> start{};
+    Color<N> end{};
+
+    for (std::size_t c = 0; c < N; ++c)
+    {
+        start[c] = std::clamp(mean[c] + (axis[c] * minProjection), 0.0f, 255.0f);
+        end[c] = std::clamp(mean[c] + (axis[c] * maxProjection), 0.0f, 255.0f);
+    }
+
+    return {start, end};
+}
+
+/**
+ * Solves for the pair of endpoints which minimizes the squared error of the colors, given each color's
+ * fixed interpolation weight towards the second endpoint
+ */
+template <std::size_t N>
+static std::optional<std::pair<Color<N>, Color<N>>> FitLeastSquares(const std::vector<Color<N>>& colors,
+                                                                    const std::vector<float>& weights)
+{
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    Color<N> ax{};
+    Color<N> bx{};
+
+    for (std::size_t x = 0; x < colors.size(); ++x)
+    {
+        const float b = weights[x];
+        const float a = 1.0f - b;
+
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+
+        for (std::size_t c = 0; c < N; ++c)
+        {
+            ax[c] += a * colors[x][c];
+            bx[c] += b * colors[x][c];
+        }
+    }
+
+    const float determinant = (aa * bb) - (ab * ab);
+    if (std::abs(determinant) < 1e-6f) { return std::nullopt; }
+
+    Color<N> start{};
+    Color<N> end{};
+
+    for (std::size_t c = 0; c < N; ++c)
+    {
+        start[c] = std::clamp(((ax[c] * bb) - (bx[c] * ab)) / determinant, 0.0f, 255.0f);
+        end[c] = std::clamp(((bx[c] * aa) - (ax[c] * ab)) / determinant, 0.0f, 255.0f);
+    }
+
+    return std::make_pair(start, end);
+}
+
+template <std::size_t N>
+static uint32_t SquaredError(const std::array<uint8_t, 4>& a, const std::array<uint32_t, 4>& b)
+{
+    uint32_t error = 0;
+
+    for (std::size_t c = 0; c < N; ++c)
+    {
+        const int delta = (int)a[c] - (int)b[c];
+        error += (uint32_t)(delta * delta);
+    }
+
+    return error;
+}
+
+//
+// BC1
+//
+
+static uint16_t QuantizeRGB565(const Color<3>& color)
+{
+    const auto r = (uint16_t)std::lround(color[0] * 31.0f / 255.0f);
+    const auto g = (uint16_t)std::lround(color[1] * 63.0f / 255.0f);
+    const auto b = (uint16_t)std::lround(color[2] * 31.0f / 255.0f);
+
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static std::array<uint32_t, 4> ExpandRGB565(uint16_t color)
+{
+    const uint32_t r = (color >> 11) & 0x1F;
+    const uint32_t g = (color >> 5) & 0x3F;
+    const uint32_t b = color & 0x1F;
+
+    return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 255};
+}
+
+struct BC1Result
+{
+    uint16_t color0{0};
+    uint16_t color1{0};
+    uint32_t indices{0};
+    uint32_t error{std::numeric_limits<uint32_t>::max()};
+};
+
+/**
+ * Builds a BC1 color block from a pair of endpoints, choosing the best palette index for each pixel.
+ *
+ * @param threeColorMode Whether to use the 3-color + transparent mode, in which pixels flagged as
+ * transparent are assigned the transparent index.
+ */
+static BC1Result BuildBC1Block(const BlockPixels& pixels,
+                               const std::array<bool, 16>& transparent,
+                               const Color<3>& start,
+                               const Color<3>& end,
+                               bool threeColorMode)
+{
+    BC1Result result{};
+    result.color0 = QuantizeRGB565(start);
+    result.color1 = QuantizeRGB565(end);
+
+    // 4-color mode is selected by color0 > color1, 3-color mode by color0 <= color1
+    if (threeColorMode == (result.color0 > result.color1))
+    {
+        std::swap(result.color0, result.color1);
+    }
+
+    const auto c0 = ExpandRGB565(result.color0);
+    const auto c1 = ExpandRGB565(result.color1);
+
+    std::array<std::array<uint32_t, 4>, 4> palette{c0, c1, {}, {}};
+    unsigned int numPaletteColors = 4;
+
+    if (threeColorMode)
+    {
+        for (std::size_t c = 0; c < 3; ++c) { palette[2][c] = (c0[c] + c1[c]) / 2; }
+        numPaletteColors = 3;
+    }
+    else if (result.color0 == result.color1)
+    {
+        // Degenerate block; every pixel is the same color
+        numPaletteColors = 1;
+    }
+    else
+    {
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            palette[2][c] = ((2 * c0[c]) + c1[c]) / 3;
+            palette[3][c] = (c0[c] + (2 * c1[c])) / 3;
+        }
+    }
+
+    result.error = 0;
+
+    for (std::size_t x = 0; x < 16; ++x)
+    {
+        uint32_t bestIndex = 0;
+
+        if (threeColorMode && transparent[x])
+        {
+            bestIndex = 3;
+        }
+        else
+        {
+            uint32_t bestError = std::numeric_limits<uint32_t>::max();
+
+            for (uint32_t index = 0; index < numPaletteColors; ++index)
+            {
+                const auto error = SquaredError<3>(pixels[x], palette[index]);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestIndex = index;
+                }
+            }
+
+            result.error += bestError;
+        }
+
+        result.indices |= bestIndex << (x * 2);
+    }
+
+    return result;
+}
+
+static float BC1IndexWeight(uint32_t index, bool threeColorMode)
+{
+    if (threeColorMode)
+    {
+        static constexpr std::array<float, 4> weights = {0.0f, 1.0f, 0.5f, 0.0f};
+        return weights[index];
+    }
+
+    static constexpr std::array<float, 4> weights = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+    return weights[index];
+}
+
+/**
+ * Encodes a 4x4 block into an 8 byte BC1 color block.
+ *
+ * @param allowTransparency Whether pixels with alpha < 128 may be encoded as transparent. BC3's color
+ * block is always decoded in 4-color mode, so it must not use transparency.
+ */
+static void EncodeBC1Block(const BlockPixels& pixels, bool allowTransparency, std::byte* pOut)
+{
+    std::array<bool, 16> transparent{};
+    std::vector<Color<3>> opaqueColors;
+    std::vector<std::size_t> opaqueIndices;
+
+    for (std::size_t x = 0; x < 16; ++x)
+    {
+        transparent[x] = allowTransparency && pixels[x][3] < 128;
+
+        if (!transparent[x])
+        {
+            opaqueColors.push_back({(float)pixels[x][0], (float)pixels[x][1], (float)pixels[x][2]});
+            opaqueIndices.push_back(x);
+        }
+    }
+
+    const bool threeColorMode = opaqueColors.size() != 16;
+
+    BC1Result result{};
+
+    if (opaqueColors.empty())
+    {
+        result = BuildBC1Block(pixels, transparent, {}, {}, true);
+    }
+    else
+    {
+        const auto [start, end] = FitPrincipalAxis<3>(opaqueColors);
+        result = BuildBC1Block(pixels, transparent, start, end, threeColorMode);
+
+        // Refine the endpoints given the chosen indices, keeping the refinement only if it helps
+        std::vector<float> weights;
+        for (const auto& pixelIndex : opaqueIndices)
+        {
+            weights.push_back(BC1IndexWeight((result.indices >> (pixelIndex * 2)) & 0x3, threeColorMode));
+        }
+
+        // Weights are relative to the block's (possibly swapped) stored endpoints
+        if (const auto refined = FitLeastSquares<3>(opaqueColors, weights))
+        {
+            const auto refinedResult = BuildBC1Block(pixels, transparent, refined->first, refined->second, threeColorMode);
+            if (refinedResult.error < result.error)
+            {
+                result = refinedResult;
+            }
+        }
+    }
+
+    std::memcpy(pOut, &result.color0, 2);
+    std::memcpy(pOut + 2, &result.color1, 2);
+    std::memcpy(pOut + 4, &result.indices, 4);
+}
+
+//
+// BC4 (used for BC3 alpha and BC5 channels)
+//
+
+static void EncodeBC4Block(const std::array<uint8_t, 16>& values, std::byte* pOut)
+{
+    const auto [minIt, maxIt] = std::minmax_element(values.cbegin(), values.cend());
+    const uint32_t endpoint0 = *maxIt;
+    const uint32_t endpoint1 = *minIt;
+
+    uint64_t indices = 0;
+
+    // If endpoint0 == endpoint1 every value is the same, and all indices stay at 0 (endpoint0)
+    if (endpoint0 != endpoint1)
+    {
+        // endpoint0 > endpoint1 selects the 8-value mode: the endpoints followed by 6 interpolated values
+        std::array<uint32_t, 8> palette{endpoint0, endpoint1};
+        for (uint32_t x = 1; x <= 6; ++x)
+        {
+            palette[x + 1] = (((7 - x) * endpoint0) + (x * endpoint1)) / 7;
+        }
+
+        for (std::size_t x = 0; x < 16; ++x)
+        {
+            uint64_t bestIndex = 0;
+            int bestError = std::numeric_limits<int>::max();
+
+            for (uint64_t index = 0; index < 8; ++index)
+            {
+                const int error = std::abs((int)values[x] - (int)palette[index]);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestIndex = index;
+                }
+            }
+
+            indices |= bestIndex << (x * 3);
+        }
+    }
+
+    pOut[0] = (std::byte)endpoint0;
+    pOut[1] = (std::byte)endpoint1;
+
+    for (std::size_t x = 0; x < 6; ++x)
+    {
+        pOut[2 + x] = (std::byte)((indices >> (x * 8)) & 0xFF);
+    }
+}
+
+static void EncodeBC4Channel(const BlockPixels& pixels, std::size_t channel, std::byte* pOut)
+{
+    std::array<uint8_t, 16> values{};
+    for (std::size_t x = 0; x < 16; ++x) { values[x] = pixels[x][channel]; }
+
+    EncodeBC4Block(values, pOut);
+}
+
+//
+// BC7 (mode 6)
+//
+
+struct BC7Endpoint
+{
+    std::array<uint32_t, 4> quantized{};   // 7 bits per channel
+    uint32_t pBit{0};
+
+    [[nodiscard]] std::array<uint32_t, 4> Expand() const
+    {
+        return {
+            (quantized[0] << 1) | pBit,
+            (quantized[1] << 1) | pBit,
+            (quantized[2] << 1) | pBit,
+            (quantized[3] << 1) | pBit
+        };
+    }
+};
+
+static BC7Endpoint QuantizeBC7Endpoint(const Color<4>& color)
+{
+    BC7Endpoint best{};
+    float bestError = std::numeric_limits<float>::max();
+
+    // Mode 6 endpoints are 7 bits per channel, plus a p-bit shared by all of the endpoint's channels
+    for (uint32_t pBit = 0; pBit < 2; ++pBit)
+    {
+        BC7Endpoint candidate{};
+        candidate.pBit = pBit;
+
+        float error = 0.0f;
+
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            candidate.quantized[c] = (uint32_t)std::clamp(std::lround((color[c] - (float)pBit) / 2.0f), 0L, 127L);
+
+            const float delta = color[c] - (float)((candidate.quantized[c] << 1) | pBit);
+            error += delta * delta;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            best = candidate;
+        }
+    }
+
+    return best;
+}
+
+struct BC7Result
+{
+    BC7Endpoint endpoint0;
+    BC7Endpoint endpoint1;
+    std::array<uint32_t, 16> indices{};
+    uint32_t error{std::numeric_limits<uint32_t>::max()};
+};
+
+static BC7Result BuildBC7Block(const BlockPixels& pixels, const Color<4>& start, const Color<4>& end)
+{
+    BC7Result result{};
+    result.endpoint0 = QuantizeBC7Endpoint(start);
+    result.endpoint1 = QuantizeBC7Endpoint(end);
+
+    const auto e0 = result.endpoint0.Expand();
+    const auto e1 = result.endpoint1.Expand();
+
+    std::array<std::array<uint32_t, 4>, 16> palette{};
+    for (std::size_t index = 0; index < 16; ++index)
+    {
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            palette[index][c] = (((64 - BC7_WEIGHTS_4[index]) * e0[c]) + (BC7_WEIGHTS_4[index] * e1[c]) + 32) >> 6;
+        }
+    }
+
+    result.error = 0;
+
+    for (std::size_t x = 0; x < 16; ++x)
+    {
+        uint32_t bestIndex = 0;
+        uint32_t bestError = std::numeric_limits<uint32_t>::max();
+
+        for (uint32_t index = 0; index < 16; ++index)
+        {
+            const auto error = SquaredError<4>(pixels[x], palette[index]);
+            if (error < bestError)
+            {
+                bestError = error;
+                bestIndex = index;
+            }
+        }
+
+        result.indices[x] = bestIndex;
+        result.error += bestError;
+    }
+
+    return result;
+}
+
+class BitWriter
+{
+    public:
+
+        explicit BitWriter(std::byte* pOut)
+            : m_pOut(pOut)
+        { }
+
+        void Write(uint32_t value, uint32_t numBits)
+        {
+            for (uint32_t bit = 0; bit < numBits; ++bit)
+            {
+                if ((value >> bit) & 0x1)
+                {
+                    m_pOut[m_bitPosition / 8] |= (std::byte)(1U << (m_bitPosition % 8));
+                }
+
+                m_bitPosition++;
+            }
+        }
+
+    private:
+
+        std::byte* m_pOut;
+        uint32_t m_bitPosition{0};
+};
+
+static void EncodeBC7Block(const BlockPixels& pixels, std::byte* pOut)
+{
+    std::vector<Color<4>> colors;
+    for (const auto& pixel : pixels)
+    {
+        colors.push_back({(float)pixel[0], (float)pixel[1], (float)pixel[2], (float)pixel[3]});
+    }
+
+    const auto [start, end] = FitPrincipalAxis<4>(colors);
+    auto result = BuildBC7Block(pixels, start, end);
+
+    std::vector<float> weights;
+    for (const auto& index : result.indices)
+    {
+        weights.push_back((float)BC7_WEIGHTS_4[index] / 64.0f);
+    }
+
+    if (const auto refined = FitLeastSquares<4>(colors, weights))
+    {
+        const auto refinedResult = BuildBC7Block(pixels, refined->first, refined->second);
+        if (refinedResult.error < result.error)
+        {
+            result = refinedResult;
+        }
+    }
+
+    // The first pixel's index is stored with an implicit high bit of 0; swap the endpoints if needed
+    if (result.indices[0] >= 8)
+    {
+        std::swap(result.endpoint0, result.endpoint1);
+        for (auto& index : result.indices) { index = 15 - index; }
+    }
+
+    std::memset(pOut, 0, 16);
+    BitWriter writer(pOut);
+
+    writer.Write(1U << 6, 7); // Mode 6
+
+    for (std::size_t c = 0; c < 4; ++c)
+    {
+        writer.Write(result.endpoint0.quantized[c], 7);
+        writer.Write(result.endpoint1.quantized[c], 7);
+    }
+
+    writer.Write(result.endpoint0.pBit, 1);
+    writer.Write(result.endpoint1.pBit, 1);
+
+    writer.Write(result.indices[0], 3);
+    for (std::size_t x = 1; x < 16; ++x)
+    {
+        writer.Write(result.indices[x], 4);
+    }
+}
+
+//
+// Mip generation
+//
+
+static float SRGBToLinear(float value)
+{
+    return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+static float LinearToSRGB(float value)
+{
+    return value <= 0.0031308f ? value * 12.92f : (1.055f * std::pow(value, 1.0f / 2.4f)) - 0.055f;
+}
+
+std::expected<ImageData::Ptr, TextureEncoder::EncodeError> TextureEncoder::GenerateMipChain(const ImageData& source, bool srgb)
+{
+    if (source.GetPixelFormat() != ImageData::PixelFormat::RGBA32)
+    {
+        return std::unexpected(EncodeError::UnsupportedSourceFormat);
+    }
+
+    std::array<float, 256> toLinear{};
+    for (std::size_t x = 0; x < 256; ++x)
+    {
+        toLinear[x] = srgb ? SRGBToLinear((float)x / 255.0f) : (float)x / 255.0f;
+    }
+
+    const auto largestDimension = std::max(source.GetPixelWidth(), source.GetPixelHeight());
+    const auto numMipLevels = (uint32_t)std::bit_width(largestDimension);
+    const auto numLayers = source.GetNumLayers();
+
+    // Start with the source's first mip level
+    std::vector<std::byte> pixelBytes(
+        source.GetPixelBytes().cbegin(),
+        source.GetPixelBytes().cbegin() + (long)source.GetMipLevelByteSize(0)
+    );
+
+    std::size_t srcOffset = 0;
+
+    for (uint32_t level = 1; level < numMipLevels; ++level)
+    {
+        const auto srcWidth = std::max<std::size_t>(1, source.GetPixelWidth() >> (level - 1));
+        const auto srcHeight = std::max<std::size_t>(1, source.GetPixelHeight() >> (level - 1));
+        const auto dstWidth = std::max<std::size_t>(1, srcWidth / 2);
+        const auto dstHeight = std::max<std::size_t>(1, srcHeight / 2);
+
+        const auto dstOffset = pixelBytes.size();
+        pixelBytes.resize(dstOffset + (dstWidth * dstHeight * 4 * numLayers));
+
+        for (uint32_t layer = 0; layer < numLayers; ++layer)
+        {
+            const auto* pSrc = reinterpret_cast<const uint8_t*>(pixelBytes.data() + srcOffset + (layer * srcWidth * srcHeight * 4));
+            auto* pDst = reinterpret_cast<uint8_t*>(pixelBytes.data() + dstOffset + (layer * dstWidth * dstHeight * 4));
+
+            for (std::size_t y = 0; y < dstHeight; ++y)
+            {
+                for (std::size_t x = 0; x < dstWidth; ++x)
+                {
+                    const std::array<std::size_t, 2> srcXs = {std::min(x * 2, srcWidth - 1), std::min((x * 2) + 1, srcWidth - 1)};
+                    const std::array<std::size_t, 2> srcYs = {std::min(y * 2, srcHeight - 1), std::min((y * 2) + 1, srcHeight - 1)};
+
+                    std::array<float, 4> sum{};
+
+                    for (const auto& srcY : srcYs)
+                    {
+                        for (const auto& srcX : srcXs)
+                        {
+                            const auto* pPixel = pSrc + (((srcY * srcWidth) + srcX) * 4);
+
+                            for (std::size_t c = 0; c < 3; ++c) { sum[c] += toLinear[pPixel[c]]; }
+                            sum[3] += (float)pPixel[3] / 255.0f; // Alpha is always linear
+                        }
+                    }
+
+                    auto* pPixel = pDst + (((y * dstWidth) + x) * 4);
+
+                    for (std::size_t c = 0; c < 4; ++c)
+                    {
+                        float value = sum[c] / 4.0f;
+                        if (srgb && c < 3) { value = LinearToSRGB(value); }
+
+                        pPixel[c] = (uint8_t)std::clamp(std::lround(value * 255.0f), 0L, 255L);
+                    }
+                }
+            }
+        }
+
+        srcOffset = dstOffset;
+    }
+
+    return std::make_shared<ImageData>(
+        std::move(pixelBytes),
+        numLayers,
+        numMipLevels,
+        source.GetPixelWidth(),
+        source.GetPixelHeight(),
+        ImageData::PixelFormat::RGBA32
+    );
+}
+
+//
+// Encoding
+//
+
+std::expected<ImageData::Ptr, TextureEncoder::EncodeError> TextureEncoder::Encode(const ImageData& source, ImageData::PixelFormat targetFormat)
+{
+    if (source.GetPixelFormat() != ImageData::PixelFormat::RGBA32)
+    {
+        return std::unexpected(EncodeError::UnsupportedSourceFormat);
+    }
+
+    if (!ImageData::IsBlockCompressed(targetFormat))
+    {
+        return std::unexpected(EncodeError::UnsupportedTargetFormat);
+    }
+
+    const std::size_t blockByteSize = targetFormat == ImageData::PixelFormat::BC1 ? 8 : 16;
+
+    std::vector<std::byte> blockBytes;
+
+    for (uint32_t level = 0; level < source.GetNumMipLevels(); ++level)
+    {
+        const auto width = source.GetMipLevelPixelWidth(level);
+        const auto height = source.GetMipLevelPixelHeight(level);
+        const auto blocksWide = (width + 3) / 4;
+        const auto blocksHigh = (height + 3) / 4;
+
+        for (uint32_t layer = 0; layer < source.GetNumLayers(); ++layer)
+        {
+            const auto* pSrc = reinterpret_cast<const uint8_t*>(
+                source.GetPixelBytes().data() +
+                source.GetMipLevelByteOffset(level) +
+                (layer * ImageData::GetImageByteSize(ImageData::PixelFormat::RGBA32, width, height))
+            );
+
+            const auto dstOffset = blockBytes.size();
+            blockBytes.resize(dstOffset + (blocksWide * blocksHigh * blockByteSize));
+
+            for (std::size_t blockY = 0; blockY < blocksHigh; ++blockY)
+            {
+                for (std::size_t blockX = 0; blockX < blocksWide; ++blockX)
+                {
+                    // Gather the block's pixels, clamping at the image's edges for partial blocks
+                    BlockPixels pixels{};
+
+                    for (std::size_t y = 0; y < 4; ++y)
+                    {
+                        for (std::size_t x = 0; x < 4; ++x)
+                        {
+                            const auto srcX = std::min((blockX * 4) + x, width - 1);
+                            const auto srcY = std::min((blockY * 4) + y, height - 1);
+
+                            std::memcpy(pixels[(y * 4) + x].data(), pSrc + (((srcY * width) + srcX) * 4), 4);
+                        }
+                    }
+
+                    auto* pOut = blockBytes.data() + dstOffset + (((blockY * blocksWide) + blockX) * blockByteSize);
+
+                    switch (targetFormat)
+                    {
+                        case ImageData::PixelFormat::BC1:
+                            EncodeBC1Block(pixels, true, pOut);
+                        break;
+                        case ImageData::PixelFormat::BC3:
+                            EncodeBC4Channel(pixels, 3, pOut);
+                            EncodeBC1Block(pixels, false, pOut + 8);
+                        break;
+                        case ImageData::PixelFormat::BC5:
+                            EncodeBC4Channel(pixels, 0, pOut);
+                            EncodeBC4Channel(pixels, 1, pOut + 8);
+                        break;
+                        case ImageData::PixelFormat::BC7:
+                            EncodeBC7Block(pixels, pOut);
+                        break;
+                        default: break;
+                    }
+                }
+            }
+        }
+    }
+
+    return std::make_shared<ImageData>(
+        std::move(blockBytes),
+        source.GetNumLayers(),
+        source.GetNumMipLevels(),
+        source.GetPixelWidth(),
+        source.GetPixelHeight(),
+        targetFormat
+    );
+}
+
+bool TextureEncoder::HasTransparency(const ImageData& source)
+{
+    if (source.GetPixelFormat() != ImageData::PixelFormat::RGBA32) { return false; }
+
+    const auto& pixelBytes = source.GetPixelBytes();
+    const auto byteSize = source.GetMipLevelByteSize(0);
+
+    for (std::size_t x = 3; x < byteSize; x += 4)
+    {
+        if (pixelBytes[x] != std::byte{255}) { return true; }
+    }
+
+    return false;
+}
+
+}
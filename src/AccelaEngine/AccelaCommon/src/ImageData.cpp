@@ -6,6 +6,7 @@
  
 #include <Accela/Common/ImageData.h>
 
+#include <algorithm>
 #include <cassert>
 
 namespace Accela::Common
@@ -25,11 +26,47 @@ ImageData::ImageData(std::vector<std::byte> pixelBytes,
     assert(SanityCheckValues());
 }
 
+ImageData::ImageData(std::vector<std::byte> pixelBytes,
+                     uint32_t numLayers,
+                     std::size_t pixelWidth,
+                     std::size_t pixelHeight,
+                     ImageData::PixelFormat pixelFormat,
+                     ReleaseFunc releaseFunc)
+    : ImageData(std::move(pixelBytes), numLayers, pixelWidth, pixelHeight, pixelFormat)
+{
+    m_releaseFunc = std::move(releaseFunc);
+}
+
+ImageData::ImageData(std::vector<std::byte> pixelBytes,
+                     uint32_t numLayers,
+                     uint32_t numMipLevels,
+                     std::size_t pixelWidth,
+                     std::size_t pixelHeight,
+                     ImageData::PixelFormat pixelFormat)
+    : m_pixelBytes(std::move(pixelBytes))
+    , m_numLayers(numLayers)
+    , m_numMipLevels(numMipLevels)
+    , m_pixelWidth(pixelWidth)
+    , m_pixelHeight(pixelHeight)
+    , m_pixelFormat(pixelFormat)
+{
+    assert(SanityCheckValues());
+}
+
+ImageData::~ImageData()
+{
+    if (m_releaseFunc)
+    {
+        m_releaseFunc(std::move(m_pixelBytes));
+    }
+}
+
 Common::ImageData::Ptr ImageData::Clone() const
 {
     return std::make_shared<ImageData>(
         m_pixelBytes,
         m_numLayers,
+        m_numMipLevels,
         m_pixelWidth,
         m_pixelHeight,
         m_pixelFormat
@@ -43,14 +80,46 @@ uint8_t ImageData::GetBytesPerPixel() const
         case PixelFormat::RGB24: return 3;
         case PixelFormat::R32G32: return 8;
         case PixelFormat::RGBA32: return 4;
+        case PixelFormat::BC1:
+        case PixelFormat::BC3:
+        case PixelFormat::BC5:
+        case PixelFormat::BC7: return 0;
     }
 
     assert(false);
     return 0;
 }
 
+std::size_t ImageData::GetMipLevelPixelWidth(uint32_t mipLevel) const noexcept
+{
+    return std::max<std::size_t>(1, m_pixelWidth >> mipLevel);
+}
+
+std::size_t ImageData::GetMipLevelPixelHeight(uint32_t mipLevel) const noexcept
+{
+    return std::max<std::size_t>(1, m_pixelHeight >> mipLevel);
+}
+
+uint64_t ImageData::GetMipLevelByteOffset(uint32_t mipLevel) const noexcept
+{
+    uint64_t byteOffset = 0;
+
+    for (uint32_t level = 0; level < mipLevel; ++level)
+    {
+        byteOffset += GetMipLevelByteSize(level);
+    }
+
+    return byteOffset;
+}
+
+uint64_t ImageData::GetMipLevelByteSize(uint32_t mipLevel) const noexcept
+{
+    return GetImageByteSize(m_pixelFormat, GetMipLevelPixelWidth(mipLevel), GetMipLevelPixelHeight(mipLevel)) * m_numLayers;
+}
+
 std::vector<std::byte> ImageData::GetPixelBytes(const uint32_t& layerIndex, const uintmax_t& pixelIndex) const
 {
+    assert(!IsBlockCompressed());
     assert(layerIndex < GetNumLayers());
     assert(pixelIndex < GetLayerNumPixels());
 
@@ -63,9 +132,40 @@ std::vector<std::byte> ImageData::GetPixelBytes(const uint32_t& layerIndex, cons
     };
 }
 
+bool ImageData::IsBlockCompressed(PixelFormat pixelFormat) noexcept
+{
+    switch (pixelFormat)
+    {
+        case PixelFormat::BC1:
+        case PixelFormat::BC3:
+        case PixelFormat::BC5:
+        case PixelFormat::BC7: return true;
+        default: return false;
+    }
+}
+
+uint64_t ImageData::GetImageByteSize(PixelFormat pixelFormat, std::size_t pixelWidth, std::size_t pixelHeight) noexcept
+{
+    switch (pixelFormat)
+    {
+        case PixelFormat::RGB24: return pixelWidth * pixelHeight * 3;
+        case PixelFormat::R32G32: return pixelWidth * pixelHeight * 8;
+        case PixelFormat::RGBA32: return pixelWidth * pixelHeight * 4;
+        case PixelFormat::BC1: return ((pixelWidth + 3) / 4) * ((pixelHeight + 3) / 4) * 8;
+        case PixelFormat::BC3:
+        case PixelFormat::BC5:
+        case PixelFormat::BC7: return ((pixelWidth + 3) / 4) * ((pixelHeight + 3) / 4) * 16;
+    }
+
+    assert(false);
+    return 0;
+}
+
 bool ImageData::SanityCheckValues() const
 {
-    return m_pixelBytes.size() == m_pixelWidth * m_pixelHeight * m_numLayers * GetBytesPerPixel();
+    if (m_numMipLevels == 0) { return false; }
+
+    return m_pixelBytes.size() == GetMipLevelByteOffset(m_numMipLevels);
 }
 
 }
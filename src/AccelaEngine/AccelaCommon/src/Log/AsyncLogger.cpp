@@ -0,0 +1,295 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Common/Log/AsyncLogger.h>
+#include <Accela/Common/Thread/ThreadUtil.h>
+
+#include "LogRing.h"
+
+#include <algorithm>
+#include <format>
+#include <limits>
+
+namespace Accela::Common
+{
+
+// How long the writer thread sleeps for when there's nothing to write, if it's not woken
+static constexpr auto WRITER_IDLE_INTERVAL = std::chrono::milliseconds(10);
+
+// Max records written from a single ring per batch, so that one very chatty thread can't
+// delay other threads' records indefinitely
+static constexpr std::size_t MAX_RING_RECORDS_PER_BATCH = 1024;
+
+static std::atomic<std::uint64_t> NextInstanceId{1};
+
+/**
+ * The rings a thread has been given, across all the AsyncLoggers it has logged to. Retires
+ * the rings when the thread exits, so that the loggers' writer threads can release them.
+ */
+struct ThreadRings
+{
+    struct Entry
+    {
+        std::uint64_t loggerInstanceId;
+        std::shared_ptr<LogRing> ring;
+    };
+
+    ~ThreadRings()
+    {
+        for (const auto& entry : entries)
+        {
+            entry.ring->Retire();
+        }
+    }
+
+    std::vector<Entry> entries;
+};
+
+static thread_local ThreadRings ThisThreadRings;
+
+AsyncLogger::AsyncLogger(std::vector<ILogSink::Ptr> sinks,
+                         const LogLevel& minLogLevel,
+                         LogOverflowPolicy overflowPolicy,
+                         std::size_t ringByteSize)
+    : m_sinks(std::move(sinks))
+    , m_minLogLevel(minLogLevel)
+    , m_overflowPolicy(overflowPolicy)
+    , m_ringByteSize(ringByteSize)
+    , m_instanceId(NextInstanceId.fetch_add(1, std::memory_order_relaxed))
+{
+    m_writerThread = std::thread(&AsyncLogger::WriterThreadFunc, this);
+    SetThreadName(m_writerThread.native_handle(), "AsyncLogger");
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    {
+        const std::lock_guard<std::mutex> wakeLock(m_wakeMutex);
+        m_run = false;
+    }
+    m_wakeCv.notify_one();
+
+    m_writerThread.join();
+
+    // Let threads which logged to this logger know that they can release their rings
+    for (const auto& ring : m_rings)
+    {
+        ring->Orphan();
+    }
+}
+
+void AsyncLogger::Log(LogLevel loglevel, std::string_view str)
+{
+    if (loglevel < m_minLogLevel) { return; }
+
+    // Grab the log's timestamp before potentially waiting for ring space
+    const auto timestamp = std::chrono::system_clock::now();
+
+    auto pRing = GetThreadRing();
+
+    bool wakeWriter = loglevel >= LogLevel::Error;
+
+    while (!pRing->TryPush(loglevel, timestamp, str))
+    {
+        if (m_overflowPolicy == LogOverflowPolicy::Drop || !m_run.load(std::memory_order_relaxed))
+        {
+            pRing->RecordDropped();
+            break;
+        }
+
+        // Block policy; wake the writer so it frees up space in the ring, and wait for it to do so
+        if (!m_wakeRequested.exchange(true)) { m_wakeCv.notify_one(); }
+        std::this_thread::yield();
+    }
+
+    // Get the writer working on the ring well before it fills up
+    wakeWriter = wakeWriter || pRing->IsPastHalfFull();
+
+    if (wakeWriter && !m_wakeRequested.exchange(true))
+    {
+        m_wakeCv.notify_one();
+    }
+
+    if (loglevel == LogLevel::Fatal)
+    {
+        Flush();
+    }
+}
+
+void AsyncLogger::Flush()
+{
+    std::unique_lock<std::mutex> flushLock(m_flushMutex);
+
+    const auto flushTicket = m_flushRequested.fetch_add(1) + 1;
+
+    {
+        const std::lock_guard<std::mutex> wakeLock(m_wakeMutex);
+        m_wakeRequested = true;
+    }
+    m_wakeCv.notify_one();
+
+    m_flushCv.wait(flushLock, [&](){ return m_flushCompleted >= flushTicket; });
+}
+
+LogRing* AsyncLogger::GetThreadRing()
+{
+    for (const auto& entry : ThisThreadRings.entries)
+    {
+        if (entry.loggerInstanceId == m_instanceId)
+        {
+            return entry.ring.get();
+        }
+    }
+
+    //
+    // First log from this thread to this logger. Create a ring for the thread, and, while we're
+    // at it, release any rings belonging to loggers which no longer exist.
+    //
+    std::erase_if(ThisThreadRings.entries, [](const ThreadRings::Entry& entry){
+        return entry.ring->IsOrphaned();
+    });
+
+    auto ring = std::make_shared<LogRing>(m_ringByteSize);
+
+    {
+        const std::lock_guard<std::mutex> ringsLock(m_ringsMutex);
+        m_rings.push_back(ring);
+    }
+
+    ThisThreadRings.entries.push_back({m_instanceId, ring});
+
+    return ring.get();
+}
+
+void AsyncLogger::WriterThreadFunc()
+{
+    while (true)
+    {
+        const bool run = m_run.load(std::memory_order_acquire);
+        const auto flushRequested = m_flushRequested.load(std::memory_order_acquire);
+
+        m_wakeRequested = false;
+
+        const bool wroteRecords = WriteAvailableRecords();
+
+        std::unique_lock<std::mutex> flushLock(m_flushMutex);
+        const bool flushPending = m_flushCompleted < flushRequested;
+        flushLock.unlock();
+
+        if (wroteRecords || flushPending)
+        {
+            for (const auto& sink : m_sinks)
+            {
+                sink->Flush();
+            }
+        }
+
+        if (flushPending)
+        {
+            flushLock.lock();
+            m_flushCompleted = flushRequested;
+            flushLock.unlock();
+
+            m_flushCv.notify_all();
+        }
+
+        // Everything logged before shutdown has now been drained, written, and flushed
+        if (!run) { break; }
+
+        if (!wroteRecords)
+        {
+            std::unique_lock<std::mutex> wakeLock(m_wakeMutex);
+            m_wakeCv.wait_for(wakeLock, WRITER_IDLE_INTERVAL, [&](){
+                return m_wakeRequested.load() || !m_run.load();
+            });
+        }
+    }
+
+    // Release anyone who requested a flush after the final pass started
+    {
+        const std::lock_guard<std::mutex> flushLock(m_flushMutex);
+        m_flushCompleted = std::numeric_limits<std::uint64_t>::max();
+    }
+    m_flushCv.notify_all();
+}
+
+bool AsyncLogger::WriteAvailableRecords()
+{
+    std::vector<std::shared_ptr<LogRing>> rings;
+    {
+        const std::lock_guard<std::mutex> ringsLock(m_ringsMutex);
+        rings = m_rings;
+    }
+
+    //
+    // Drain the rings into the batch. Batch records are reused between batches so that their
+    // message strings' allocations are reused.
+    //
+    std::size_t batchSize = 0;
+
+    const auto nextBatchRecord = [&]() -> LogRecord& {
+        if (batchSize == m_batch.size()) { m_batch.emplace_back(); }
+        return m_batch[batchSize];
+    };
+
+    std::vector<std::shared_ptr<LogRing>> retiredRings;
+
+    for (const auto& ring : rings)
+    {
+        // Check for retirement before draining, as anything pushed before the ring was retired
+        // is then guaranteed to be drained
+        const bool isRetired = ring->IsRetired();
+
+        for (std::size_t x = 0; x < MAX_RING_RECORDS_PER_BATCH || isRetired; ++x)
+        {
+            if (!ring->TryPop(nextBatchRecord())) { break; }
+            batchSize++;
+        }
+
+        const auto droppedCount = ring->TakeDroppedCount();
+        if (droppedCount > 0)
+        {
+            auto& record = nextBatchRecord();
+            record.logLevel = LogLevel::Warning;
+            record.timestamp = std::chrono::system_clock::now();
+            record.message = std::format("AsyncLogger: Dropped {} logs from a thread whose log buffer was full", droppedCount);
+            batchSize++;
+        }
+
+        if (isRetired)
+        {
+            retiredRings.push_back(ring);
+        }
+    }
+
+    if (!retiredRings.empty())
+    {
+        const std::lock_guard<std::mutex> ringsLock(m_ringsMutex);
+        std::erase_if(m_rings, [&](const std::shared_ptr<LogRing>& ring){
+            return std::ranges::find(retiredRings, ring) != retiredRings.cend();
+        });
+    }
+
+    if (batchSize == 0) { return false; }
+
+    //
+    // Interleave the records from different threads in the order they were logged, and write them out
+    //
+    std::stable_sort(m_batch.begin(), m_batch.begin() + static_cast<std::ptrdiff_t>(batchSize),
+        [](const LogRecord& a, const LogRecord& b){ return a.timestamp < b.timestamp; });
+
+    for (std::size_t x = 0; x < batchSize; ++x)
+    {
+        for (const auto& sink : m_sinks)
+        {
+            sink->Write(m_batch[x]);
+        }
+    }
+
+    return true;
+}
+
+}
@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Common/Log/BinaryLog.h>
+
+#include <array>
+#include <algorithm>
+#include <cstdint>
+
+namespace Accela::Common
+{
+
+static constexpr char BINARY_LOG_IDENTIFIER[] = "ACCLOG";
+static constexpr std::size_t BINARY_LOG_IDENTIFIER_SIZE = sizeof(BINARY_LOG_IDENTIFIER) - 1;
+static constexpr uint16_t BINARY_LOG_VERSION = 1;
+
+static constexpr std::size_t RECORD_HEADER_BYTE_SIZE = 1 + 8 + 4;
+
+template <typename T>
+static void AppendLE(std::string& buffer, T value)
+{
+    const auto uValue = static_cast<std::make_unsigned_t<T>>(value);
+
+    for (std::size_t x = 0; x < sizeof(T); ++x)
+    {
+        buffer.push_back(static_cast<char>((uValue >> (x * 8U)) & 0xFFU));
+    }
+}
+
+template <typename T>
+static T ReadLE(const unsigned char* pData)
+{
+    std::make_unsigned_t<T> uValue = 0;
+
+    for (std::size_t x = 0; x < sizeof(T); ++x)
+    {
+        uValue |= static_cast<std::make_unsigned_t<T>>(static_cast<std::make_unsigned_t<T>>(pData[x]) << (x * 8U));
+    }
+
+    return static_cast<T>(uValue);
+}
+
+void BinaryLog::AppendHeader(std::string& buffer)
+{
+    buffer.append(BINARY_LOG_IDENTIFIER, BINARY_LOG_IDENTIFIER_SIZE);
+    AppendLE<uint16_t>(buffer, BINARY_LOG_VERSION);
+}
+
+std::size_t BinaryLog::AppendRecord(std::string& buffer, const LogRecord& record)
+{
+    const auto timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(record.timestamp.time_since_epoch()).count();
+
+    AppendLE<uint8_t>(buffer, static_cast<uint8_t>(record.logLevel));
+    AppendLE<int64_t>(buffer, static_cast<int64_t>(timestampNs));
+    const auto messageByteSize = std::min(record.message.size(), MAX_MESSAGE_BYTE_SIZE);
+
+    AppendLE<uint32_t>(buffer, static_cast<uint32_t>(messageByteSize));
+    buffer.append(record.message, 0, messageByteSize);
+
+    return RECORD_HEADER_BYTE_SIZE + messageByteSize;
+}
+
+bool BinaryLog::ReadHeader(std::istream& stream)
+{
+    std::array<unsigned char, HEADER_BYTE_SIZE> header{};
+
+    if (!stream.read(reinterpret_cast<char*>(header.data()), header.size()))
+    {
+        return false;
+    }
+
+    if (!std::equal(header.cbegin(), header.cbegin() + BINARY_LOG_IDENTIFIER_SIZE, BINARY_LOG_IDENTIFIER))
+    {
+        return false;
+    }
+
+    return ReadLE<uint16_t>(header.data() + BINARY_LOG_IDENTIFIER_SIZE) == BINARY_LOG_VERSION;
+}
+
+std::optional<LogRecord> BinaryLog::ReadRecord(std::istream& stream)
+{
+    std::array<unsigned char, RECORD_HEADER_BYTE_SIZE> recordHeader{};
+
+    if (!stream.read(reinterpret_cast<char*>(recordHeader.data()), recordHeader.size()))
+    {
+        return std::nullopt;
+    }
+
+    const auto timestampNs = ReadLE<int64_t>(recordHeader.data() + 1);
+    const auto messageByteSize = ReadLE<uint32_t>(recordHeader.data() + 9);
+
+    // The length comes from the file, so validate it before allocating space for the message
+    if (messageByteSize > MAX_MESSAGE_BYTE_SIZE)
+    {
+        return std::nullopt;
+    }
+
+    LogRecord record{};
+    record.logLevel = static_cast<LogLevel>(recordHeader[0]);
+    record.timestamp = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(timestampNs))
+    );
+    record.message.resize(messageByteSize);
+
+    if (!stream.read(record.message.data(), static_cast<std::streamsize>(messageByteSize)))
+    {
+        return std::nullopt;
+    }
+
+    return record;
+}
+
+}
@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Common/Log/LogRecord.h>
+
+#include <sstream>
+#include <iomanip>
+#include <ctime>
+
+namespace Accela::Common
+{
+
+std::string LogLevelToStr(LogLevel logLevel)
+{
+    switch (logLevel)
+    {
+        case LogLevel::Debug:   return "Debug";
+        case LogLevel::Info:    return "Info";
+        case LogLevel::Warning: return "Warning";
+        case LogLevel::Error:   return "Error";
+        case LogLevel::Fatal:   return "Fatal";
+        default:                return "Unknown";
+    }
+}
+
+std::string FormatLogRecord(const LogRecord& record)
+{
+    const std::time_t timestamp_time_t = std::chrono::system_clock::to_time_t(record.timestamp);
+
+    std::ostringstream ss;
+    ss
+        << "[" << std::put_time(std::localtime(&timestamp_time_t), "%Y-%m-%d %X") << "]"
+        << " "
+        << "[" << LogLevelToStr(record.logLevel) << "]"
+        << " "
+        << record.message;
+
+    return ss.str();
+}
+
+}
@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELACOMMON_SRC_LOG_LOGRING_H
+#define LIBACCELACOMMON_SRC_LOG_LOGRING_H
+
+#include <Accela/Common/Log/LogRecord.h>
+
+#include <vector>
+#include <atomic>
+#include <string_view>
+#include <chrono>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+namespace Accela::Common
+{
+    /**
+     * Single producer / single consumer byte ring buffer holding variable-length log records.
+     *
+     * The producer is the thread the ring belongs to, the consumer is the AsyncLogger writer thread.
+     * Read and write positions increase monotonically and are wrapped on access, so records may
+     * straddle the end of the buffer.
+     */
+    class LogRing
+    {
+        public:
+
+            explicit LogRing(std::size_t byteSize)
+                : m_buffer(std::bit_ceil(std::max(byteSize, MIN_BYTE_SIZE)))
+                , m_mask(m_buffer.size() - 1)
+            { }
+
+            /**
+             * Producer: Attempts to push a record into the ring. Messages which could never fit
+             * in the ring are truncated.
+             *
+             * @return False if there's currently not enough free space in the ring
+             */
+            [[nodiscard]] bool TryPush(LogLevel logLevel,
+                                       std::chrono::system_clock::time_point timestamp,
+                                       std::string_view message)
+            {
+                message = message.substr(0, m_buffer.size() - sizeof(RecordHeader));
+
+                const std::size_t recordByteSize = sizeof(RecordHeader) + message.size();
+
+                const auto writePos = m_writePos.load(std::memory_order_relaxed);
+                const auto readPos = m_readPos.load(std::memory_order_acquire);
+
+                if (m_buffer.size() - (writePos - readPos) < recordByteSize) { return false; }
+
+                const RecordHeader header{
+                    .timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch()).count(),
+                    .messageByteSize = static_cast<std::uint32_t>(message.size()),
+                    .logLevel = static_cast<std::uint32_t>(logLevel)
+                };
+
+                CopyIn(writePos, &header, sizeof(RecordHeader));
+                CopyIn(writePos + sizeof(RecordHeader), message.data(), message.size());
+
+                m_writePos.store(writePos + recordByteSize, std::memory_order_release);
+
+                return true;
+            }
+
+            /**
+             * Consumer: Pops the oldest record from the ring, if any.
+             *
+             * @return False if the ring is empty
+             */
+            [[nodiscard]] bool TryPop(LogRecord& record)
+            {
+                const auto readPos = m_readPos.load(std::memory_order_relaxed);
+                const auto writePos = m_writePos.load(std::memory_order_acquire);
+
+                if (readPos == writePos) { return false; }
+
+                RecordHeader header{};
+                CopyOut(readPos, &header, sizeof(RecordHeader));
+
+                record.logLevel = static_cast<LogLevel>(header.logLevel);
+                record.timestamp = std::chrono::system_clock::time_point(
+                    std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(header.timestampNs))
+                );
+                record.message.resize(header.messageByteSize);
+                CopyOut(readPos + sizeof(RecordHeader), record.message.data(), header.messageByteSize);
+
+                m_readPos.store(readPos + sizeof(RecordHeader) + header.messageByteSize, std::memory_order_release);
+
+                return true;
+            }
+
+            /**
+             * @return Whether more than half of the ring is in use
+             */
+            [[nodiscard]] bool IsPastHalfFull() const noexcept
+            {
+                return (m_writePos.load(std::memory_order_relaxed) - m_readPos.load(std::memory_order_relaxed)) > m_buffer.size() / 2;
+            }
+
+            /** Producer: Records that a log was dropped due to the ring being full */
+            void RecordDropped() noexcept { m_droppedCount.fetch_add(1, std::memory_order_relaxed); }
+
+            /** Consumer: Returns and resets the number of logs dropped since the last call */
+            [[nodiscard]] std::uint64_t TakeDroppedCount() noexcept { return m_droppedCount.exchange(0, std::memory_order_relaxed); }
+
+            /** Marks that the ring's producer thread has exited; it'll never be pushed to again */
+            void Retire() noexcept { m_retired.store(true, std::memory_order_release); }
+            [[nodiscard]] bool IsRetired() const noexcept { return m_retired.load(std::memory_order_acquire); }
+
+            /** Marks that the ring's logger has been destroyed; it'll never be popped from again */
+            void Orphan() noexcept { m_orphaned.store(true, std::memory_order_release); }
+            [[nodiscard]] bool IsOrphaned() const noexcept { return m_orphaned.load(std::memory_order_acquire); }
+
+        private:
+
+            struct RecordHeader
+            {
+                std::int64_t timestampNs;
+                std::uint32_t messageByteSize;
+                std::uint32_t logLevel;
+            };
+
+            static constexpr std::size_t MIN_BYTE_SIZE = 256;
+
+        private:
+
+            void CopyIn(std::uint64_t pos, const void* pSrc, std::size_t byteSize)
+            {
+                if (byteSize == 0) { return; }
+
+                const auto offset = static_cast<std::size_t>(pos & m_mask);
+                const auto firstByteSize = std::min(byteSize, m_buffer.size() - offset);
+
+                std::memcpy(m_buffer.data() + offset, pSrc, firstByteSize);
+                std::memcpy(m_buffer.data(), static_cast<const std::byte*>(pSrc) + firstByteSize, byteSize - firstByteSize);
+            }
+
+            void CopyOut(std::uint64_t pos, void* pDst, std::size_t byteSize) const
+            {
+                if (byteSize == 0) { return; }
+
+                const auto offset = static_cast<std::size_t>(pos & m_mask);
+                const auto firstByteSize = std::min(byteSize, m_buffer.size() - offset);
+
+                std::memcpy(pDst, m_buffer.data() + offset, firstByteSize);
+                std::memcpy(static_cast<std::byte*>(pDst) + firstByteSize, m_buffer.data(), byteSize - firstByteSize);
+            }
+
+        private:
+
+            std::vector<std::byte> m_buffer;
+            std::uint64_t m_mask;
+
+            // Written by the producer, read by the consumer
+            alignas(64) std::atomic<std::uint64_t> m_writePos{0};
+
+            // Written by the consumer, read by the producer
+            alignas(64) std::atomic<std::uint64_t> m_readPos{0};
+
+            alignas(64) std::atomic<std::uint64_t> m_droppedCount{0};
+            std::atomic<bool> m_retired{false};
+            std::atomic<bool> m_orphaned{false};
+    };
+}
+
+#endif //LIBACCELACOMMON_SRC_LOG_LOGRING_H
@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Common/Log/RotatingFileLogSink.h>
+#include <Accela/Common/Log/BinaryLog.h>
+
+#include <algorithm>
+#include <system_error>
+
+namespace Accela::Common
+{
+
+RotatingFileLogSink::RotatingFileLogSink(std::filesystem::path filePath,
+                                         Format format,
+                                         std::uintmax_t maxFileByteSize,
+                                         unsigned int maxFileCount)
+    : m_filePath(std::move(filePath))
+    , m_format(format)
+    , m_maxFileByteSize(maxFileByteSize)
+    , m_maxFileCount(std::max(maxFileCount, 1U))
+{
+    OpenFile();
+}
+
+void RotatingFileLogSink::Write(const LogRecord& record)
+{
+    const auto bufferStartByteSize = m_buffer.size();
+
+    switch (m_format)
+    {
+        case Format::Text:
+            m_buffer.append(FormatLogRecord(record));
+            m_buffer.push_back('\n');
+        break;
+        case Format::Binary:
+            (void)BinaryLog::AppendRecord(m_buffer, record);
+        break;
+    }
+
+    m_fileByteSize += m_buffer.size() - bufferStartByteSize;
+
+    // Rotate once a file is full, rather than before writing a record to it, so that a file
+    // always contains at least one record, even if that record is larger than the max file size
+    if (m_fileByteSize >= m_maxFileByteSize)
+    {
+        Flush();
+        RotateFiles();
+        OpenFile();
+    }
+}
+
+void RotatingFileLogSink::Flush()
+{
+    if (!m_buffer.empty())
+    {
+        m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+
+    m_file.flush();
+}
+
+void RotatingFileLogSink::OpenFile()
+{
+    m_file.close();
+    m_file.clear();
+
+    std::error_code ec;
+    const auto existingByteSize = std::filesystem::exists(m_filePath, ec) ? std::filesystem::file_size(m_filePath, ec) : 0;
+
+    // Continue an existing text log which has space left. Binary logs are always started fresh, as
+    // appending to a binary file of a different version, or which ends in a truncated record, would
+    // corrupt it, so any existing binary log is rotated out of the way.
+    if (m_format == Format::Text && !ec && existingByteSize < m_maxFileByteSize)
+    {
+        m_file.open(m_filePath, std::ios::out | std::ios::binary | std::ios::app);
+        m_fileByteSize = existingByteSize;
+        return;
+    }
+
+    if (!ec && existingByteSize > 0)
+    {
+        RotateFiles();
+    }
+
+    m_file.open(m_filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+    m_fileByteSize = 0;
+
+    if (m_format == Format::Binary)
+    {
+        BinaryLog::AppendHeader(m_buffer);
+        m_fileByteSize += BinaryLog::HEADER_BYTE_SIZE;
+    }
+}
+
+void RotatingFileLogSink::RotateFiles()
+{
+    m_file.close();
+
+    std::error_code ec;
+
+    if (m_maxFileCount == 1)
+    {
+        std::filesystem::remove(m_filePath, ec);
+        return;
+    }
+
+    std::filesystem::remove(GetRotatedFilePath(m_maxFileCount - 1), ec);
+
+    for (unsigned int index = m_maxFileCount - 1; index > 1; --index)
+    {
+        const auto fromPath = GetRotatedFilePath(index - 1);
+
+        if (std::filesystem::exists(fromPath, ec))
+        {
+            std::filesystem::rename(fromPath, GetRotatedFilePath(index), ec);
+        }
+    }
+
+    std::filesystem::rename(m_filePath, GetRotatedFilePath(1), ec);
+}
+
+std::filesystem::path RotatingFileLogSink::GetRotatedFilePath(unsigned int index) const
+{
+    auto rotatedPath = m_filePath;
+    rotatedPath += "." + std::to_string(index);
+    return rotatedPath;
+}
+
+}
@@ -5,6 +5,7 @@
  */
  
 #include <Accela/Common/Log/StdLogger.h>
+#include <Accela/Common/Log/LogRecord.h>
 
 #include <string>
 #include <iostream>
@@ -19,19 +20,6 @@ StdLogger::StdLogger(const LogLevel& minLogLevel)
 
 }
 
-std::string LogLevelToStr(LogLevel logLevel)
-{
-    switch (logLevel)
-    {
-        case LogLevel::Debug:   return "Debug";
-        case LogLevel::Info:    return "Info";
-        case LogLevel::Warning: return "Warning";
-        case LogLevel::Error:   return "Error";
-        case LogLevel::Fatal:   return "Fatal";
-        default:                return "Unknown";
-    }
-}
-
 void StdLogger::Log(LogLevel loglevel, std::string_view str)
 {
     if (loglevel < m_minLogLevel) { return; }
@@ -0,0 +1,24 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Common/Log/StdOutLogSink.h>
+
+#include <iostream>
+
+namespace Accela::Common
+{
+
+void StdOutLogSink::Write(const LogRecord& record)
+{
+    std::cout << FormatLogRecord(record) << '\n';
+}
+
+void StdOutLogSink::Flush()
+{
+    std::cout.flush();
+}
+
+}
@@ -6,46 +6,363 @@
  
 #include <Accela/Common/Metrics/InMemoryMetrics.h>
 
+#include <bit>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
 namespace Accela::Common
 {
 
+/**
+ * @return A per-thread index used to pick which shard of a counter the calling thread increments
+ */
+static std::size_t GetThreadShardIndex()
+{
+    static std::atomic<std::size_t> nextShardIndex{0};
+    thread_local const std::size_t shardIndex = nextShardIndex.fetch_add(1, std::memory_order_relaxed);
+    return shardIndex;
+}
+
+InMemoryMetrics::InMemoryMetrics()
+    : m_counters(std::make_unique<Registry<CounterMetric>>())
+    , m_doubles(std::make_unique<Registry<DoubleMetric>>())
+    , m_histograms(std::make_unique<Registry<HistogramMetric>>())
+{
+
+}
+
+InMemoryMetrics::~InMemoryMetrics()
+{
+    DestroyRegistry(*m_counters);
+    DestroyRegistry(*m_doubles);
+    DestroyRegistry(*m_histograms);
+}
+
+template <typename T>
+void InMemoryMetrics::DestroyRegistry(Registry<T>& registry)
+{
+    for (auto& metric : registry.metrics)
+    {
+        delete metric.exchange(nullptr);
+    }
+}
+
+template <typename T>
+uint32_t InMemoryMetrics::Register(Registry<T>& registry, const std::string& name)
+{
+    const auto existing = Lookup(registry, name);
+    if (existing) { return *existing; }
+
+    std::unique_lock<std::shared_mutex> lock(m_registryMutex);
+
+    // Another thread may have registered the name while we didn't hold the lock
+    const auto it = registry.nameToIndex.find(name);
+    if (it != registry.nameToIndex.cend())
+    {
+        return it->second;
+    }
+
+    const auto index = registry.size.load(std::memory_order_relaxed);
+    if (index == MAX_METRICS)
+    {
+        return MetricHandle<MetricType::Counter>::INVALID_INDEX;
+    }
+
+    registry.names[index] = name;
+    registry.metrics[index].store(new T(), std::memory_order_release);
+    registry.nameToIndex.insert({name, index});
+    registry.size.store(index + 1, std::memory_order_release);
+
+    return index;
+}
+
+template <typename T>
+std::optional<uint32_t> InMemoryMetrics::Lookup(const Registry<T>& registry, const std::string& name) const
+{
+    std::shared_lock<std::shared_mutex> lock(m_registryMutex);
+
+    const auto it = registry.nameToIndex.find(name);
+    if (it == registry.nameToIndex.cend())
+    {
+        return std::nullopt;
+    }
+
+    return it->second;
+}
+
+template <typename T>
+T* InMemoryMetrics::GetMetric(const Registry<T>& registry, uint32_t index)
+{
+    if (index >= MAX_METRICS)
+    {
+        return nullptr;
+    }
+
+    return registry.metrics[index].load(std::memory_order_acquire);
+}
+
+CounterHandle InMemoryMetrics::RegisterCounter(const std::string& name)
+{
+    return CounterHandle{.index = Register(*m_counters, name)};
+}
+
+DoubleHandle InMemoryMetrics::RegisterDouble(const std::string& name)
+{
+    return DoubleHandle{.index = Register(*m_doubles, name)};
+}
+
+HistogramHandle InMemoryMetrics::RegisterHistogram(const std::string& name)
+{
+    return HistogramHandle{.index = Register(*m_histograms, name)};
+}
+
 void InMemoryMetrics::SetCounterValue(const std::string& name, uintmax_t value)
 {
-    m_counters.insert_or_assign(name, value);
+    SetCounterValue(RegisterCounter(name), value);
+}
+
+void InMemoryMetrics::SetCounterValue(const CounterHandle& handle, uintmax_t value)
+{
+    auto pCounter = GetMetric(*m_counters, handle.index);
+    if (pCounter == nullptr) { return; }
+
+    // Not atomic with respect to concurrent increments of the same counter; counters which are
+    // set are expected to be gauges owned by a single thread, rather than being incremented.
+    pCounter->shards[0].value.store(value, std::memory_order_relaxed);
+
+    for (std::size_t x = 1; x < COUNTER_SHARDS; ++x)
+    {
+        pCounter->shards[x].value.store(0, std::memory_order_relaxed);
+    }
 }
 
 void InMemoryMetrics::IncrementCounterValue(const std::string& name)
 {
-    const auto curValue = GetCounterValue(name);
-    const auto newValue = curValue ? *curValue + 1 : 0;
-    SetCounterValue(name, newValue);
+    IncrementCounterValue(RegisterCounter(name), 1);
+}
+
+void InMemoryMetrics::IncrementCounterValue(const CounterHandle& handle, uintmax_t amount)
+{
+    auto pCounter = GetMetric(*m_counters, handle.index);
+    if (pCounter == nullptr) { return; }
+
+    pCounter->shards[GetThreadShardIndex() % COUNTER_SHARDS].value.fetch_add(amount, std::memory_order_relaxed);
 }
 
 std::optional<uintmax_t> InMemoryMetrics::GetCounterValue(const std::string& name) const
 {
-    const auto it = m_counters.find(name);
-    if (it == m_counters.cend())
+    const auto index = Lookup(*m_counters, name);
+    if (!index) { return std::nullopt; }
+
+    const auto pCounter = GetMetric(*m_counters, *index);
+    if (pCounter == nullptr) { return std::nullopt; }
+
+    return GetCounterValue(*pCounter);
+}
+
+uintmax_t InMemoryMetrics::GetCounterValue(const CounterMetric& counter)
+{
+    uintmax_t value = 0;
+
+    for (const auto& shard : counter.shards)
     {
-        return std::nullopt;
+        value += shard.value.load(std::memory_order_relaxed);
     }
 
-    return it->second;
+    return value;
 }
 
 void InMemoryMetrics::SetDoubleValue(const std::string& name, double value)
 {
-    m_doubles.insert_or_assign(name, value);
+    SetDoubleValue(RegisterDouble(name), value);
+}
+
+void InMemoryMetrics::SetDoubleValue(const DoubleHandle& handle, double value)
+{
+    auto pDouble = GetMetric(*m_doubles, handle.index);
+    if (pDouble == nullptr) { return; }
+
+    pDouble->value.store(value, std::memory_order_relaxed);
 }
 
 std::optional<double> InMemoryMetrics::GetDoubleValue(const std::string& name) const
 {
-    const auto it = m_doubles.find(name);
-    if (it == m_doubles.cend())
+    const auto index = Lookup(*m_doubles, name);
+    if (!index) { return std::nullopt; }
+
+    const auto pDouble = GetMetric(*m_doubles, *index);
+    if (pDouble == nullptr) { return std::nullopt; }
+
+    return pDouble->value.load(std::memory_order_relaxed);
+}
+
+void InMemoryMetrics::RecordHistogramValue(const std::string& name, double value)
+{
+    RecordHistogramValue(RegisterHistogram(name), value);
+}
+
+void InMemoryMetrics::RecordHistogramValue(const HistogramHandle& handle, double value)
+{
+    auto pHistogram = GetMetric(*m_histograms, handle.index);
+    if (pHistogram == nullptr) { return; }
+
+    // Note: negated comparison so that NaNs are also clamped to zero
+    const double scaled = !(value > 0.0) ? 0.0 : std::min(value * HISTOGRAM_VALUE_SCALE, 1.8e19);
+    const auto scaledValue = static_cast<uint64_t>(scaled);
+
+    RecordHistogramValue(pHistogram->values, scaledValue);
+    RecordHistogramValue(pHistogram->windowValues, scaledValue);
+}
+
+void InMemoryMetrics::RecordHistogramValue(HistogramValues& values, uint64_t scaledValue)
+{
+    values.buckets[ValueToBucket(scaledValue)].fetch_add(1, std::memory_order_relaxed);
+    values.count.fetch_add(1, std::memory_order_relaxed);
+    values.sum.fetch_add(scaledValue, std::memory_order_relaxed);
+
+    auto curMin = values.min.load(std::memory_order_relaxed);
+    while (scaledValue < curMin && !values.min.compare_exchange_weak(curMin, scaledValue, std::memory_order_relaxed)) { }
+
+    auto curMax = values.max.load(std::memory_order_relaxed);
+    while (scaledValue > curMax && !values.max.compare_exchange_weak(curMax, scaledValue, std::memory_order_relaxed)) { }
+}
+
+std::optional<HistogramSummary> InMemoryMetrics::GetHistogramSummary(const std::string& name) const
+{
+    const auto index = Lookup(*m_histograms, name);
+    if (!index) { return std::nullopt; }
+
+    const auto pHistogram = GetMetric(*m_histograms, *index);
+    if (pHistogram == nullptr) { return std::nullopt; }
+
+    return GetHistogramSummary(pHistogram->values, false);
+}
+
+std::optional<HistogramSummary> InMemoryMetrics::GetWindowedHistogramSummary(const std::string& name)
+{
+    const auto index = Lookup(*m_histograms, name);
+    if (!index) { return std::nullopt; }
+
+    const auto pHistogram = GetMetric(*m_histograms, *index);
+    if (pHistogram == nullptr) { return std::nullopt; }
+
+    return GetHistogramSummary(pHistogram->windowValues, true);
+}
+
+HistogramSummary InMemoryMetrics::GetHistogramSummary(HistogramValues& values, bool reset)
+{
+    //
+    // Read (and optionally clear) the histogram's state. Values recorded concurrently with this
+    // may or may not be included, but are never lost when resetting, as buckets are exchanged.
+    //
+    std::vector<uint64_t> bucketCounts(HISTOGRAM_BUCKETS, 0);
+    uint64_t totalCount = 0;
+
+    for (uint32_t x = 0; x < HISTOGRAM_BUCKETS; ++x)
     {
-        return std::nullopt;
+        bucketCounts[x] = reset ? values.buckets[x].exchange(0, std::memory_order_relaxed)
+                                : values.buckets[x].load(std::memory_order_relaxed);
+        totalCount += bucketCounts[x];
     }
 
-    return it->second;
+    const auto sum = reset ? values.sum.exchange(0, std::memory_order_relaxed)
+                           : values.sum.load(std::memory_order_relaxed);
+    const auto min = reset ? values.min.exchange(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed)
+                           : values.min.load(std::memory_order_relaxed);
+    const auto max = reset ? values.max.exchange(0, std::memory_order_relaxed)
+                           : values.max.load(std::memory_order_relaxed);
+    if (reset) { values.count.store(0, std::memory_order_relaxed); }
+
+    if (totalCount == 0)
+    {
+        return {};
+    }
+
+    const auto percentile = [&](double p){
+        const auto targetCount = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p * static_cast<double>(totalCount))));
+
+        uint64_t cumulativeCount = 0;
+
+        for (uint32_t x = 0; x < HISTOGRAM_BUCKETS; ++x)
+        {
+            cumulativeCount += bucketCounts[x];
+
+            if (cumulativeCount >= targetCount)
+            {
+                // Bucket values are approximate; never report a value outside the actual recorded range
+                const auto value = std::clamp(BucketToValue(x), std::min(min, max), max);
+                return static_cast<double>(value) / HISTOGRAM_VALUE_SCALE;
+            }
+        }
+
+        return static_cast<double>(max) / HISTOGRAM_VALUE_SCALE;
+    };
+
+    HistogramSummary summary{};
+    summary.count = totalCount;
+    summary.min = static_cast<double>(std::min(min, max)) / HISTOGRAM_VALUE_SCALE;
+    summary.max = static_cast<double>(max) / HISTOGRAM_VALUE_SCALE;
+    summary.mean = (static_cast<double>(sum) / static_cast<double>(totalCount)) / HISTOGRAM_VALUE_SCALE;
+    summary.p50 = percentile(0.50);
+    summary.p90 = percentile(0.90);
+    summary.p99 = percentile(0.99);
+    summary.p999 = percentile(0.999);
+
+    return summary;
+}
+
+uint32_t InMemoryMetrics::ValueToBucket(uint64_t value)
+{
+    // Values below the sub-bucket count each get their own bucket
+    if (value < HISTOGRAM_SUB_BUCKETS)
+    {
+        return static_cast<uint32_t>(value);
+    }
+
+    // Otherwise, shift the value down until it fits in [SUB_BUCKETS, 2 * SUB_BUCKETS), and use
+    // the shift amount to select the power of two, and the shifted value the sub-bucket within it
+    const auto shift = static_cast<uint32_t>(std::bit_width(value)) - (HISTOGRAM_SUB_BITS + 1);
+
+    return (shift * HISTOGRAM_SUB_BUCKETS) + static_cast<uint32_t>(value >> shift);
+}
+
+uint64_t InMemoryMetrics::BucketToValue(uint32_t bucket)
+{
+    if (bucket < HISTOGRAM_SUB_BUCKETS)
+    {
+        return bucket;
+    }
+
+    const uint32_t shift = (bucket / HISTOGRAM_SUB_BUCKETS) - 1;
+    const uint64_t lowerBound = static_cast<uint64_t>(bucket - (shift * HISTOGRAM_SUB_BUCKETS)) << shift;
+
+    // Midpoint of the range of values which fall into the bucket
+    return lowerBound + ((uint64_t{1} << shift) >> 1);
+}
+
+MetricsSnapshot InMemoryMetrics::GetSnapshot(bool resetHistograms)
+{
+    MetricsSnapshot snapshot{};
+
+    std::shared_lock<std::shared_mutex> lock(m_registryMutex);
+
+    for (uint32_t x = 0; x < m_counters->size.load(std::memory_order_acquire); ++x)
+    {
+        snapshot.counters.insert({m_counters->names[x], GetCounterValue(*GetMetric(*m_counters, x))});
+    }
+
+    for (uint32_t x = 0; x < m_doubles->size.load(std::memory_order_acquire); ++x)
+    {
+        snapshot.doubles.insert({m_doubles->names[x], GetMetric(*m_doubles, x)->value.load(std::memory_order_relaxed)});
+    }
+
+    for (uint32_t x = 0; x < m_histograms->size.load(std::memory_order_acquire); ++x)
+    {
+        snapshot.histograms.insert({m_histograms->names[x], GetHistogramSummary(GetMetric(*m_histograms, x)->values, resetHistograms)});
+    }
+
+    return snapshot;
 }
 
 }
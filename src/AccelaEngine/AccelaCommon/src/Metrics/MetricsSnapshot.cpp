@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Common/Metrics/MetricsSnapshot.h>
+
+#include <format>
+
+namespace Accela::Common
+{
+
+std::string MetricsSnapshotToText(const MetricsSnapshot& snapshot)
+{
+    std::string text;
+
+    for (const auto& it : snapshot.counters)
+    {
+        text += std::format("[Counter] {} = {}\n", it.first, it.second);
+    }
+
+    for (const auto& it : snapshot.doubles)
+    {
+        text += std::format("[Double] {} = {:.3f}\n", it.first, it.second);
+    }
+
+    for (const auto& it : snapshot.histograms)
+    {
+        const auto& h = it.second;
+
+        text += std::format(
+            "[Histogram] {} count={} min={:.3f} mean={:.3f} p50={:.3f} p90={:.3f} p99={:.3f} p999={:.3f} max={:.3f}\n",
+            it.first, h.count, h.min, h.mean, h.p50, h.p90, h.p99, h.p999, h.max
+        );
+    }
+
+    return text;
+}
+
+}
@@ -0,0 +1,333 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Common/Thread/JobSystem.h>
+#include <Accela/Common/Thread/ThreadUtil.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace Accela::Common
+{
+
+// The job system, if any, that the current thread is a worker of, and its worker index
+static thread_local const JobSystem* tl_pWorkerOf{nullptr};
+static thread_local unsigned int tl_workerIndex{0};
+
+// How long a waiting thread sleeps before re-checking a wait condition which has no
+// completion notification (e.g. a future)
+static constexpr auto WAIT_POLL_INTERVAL = std::chrono::milliseconds(1);
+
+JobSystem::JobSystem(std::string tag, unsigned int numWorkers)
+    : m_tag(std::move(tag))
+{
+    if (numWorkers == 0)
+    {
+        // hardware_concurrency() may return 0 if the core count can't be determined
+        const auto hardwareConcurrency = std::thread::hardware_concurrency();
+        numWorkers = hardwareConcurrency > 1 ? hardwareConcurrency - 1 : 1;
+    }
+
+    for (unsigned int x = 0; x < numWorkers; ++x)
+    {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    for (unsigned int x = 0; x < numWorkers; ++x)
+    {
+        auto thread = std::thread(&JobSystem::WorkerThreadFunc, this, x);
+
+        Common::SetThreadName(thread.native_handle(), GetThreadIdentifier(x));
+
+        m_workers.emplace_back(std::move(thread));
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    // Negate the run flag, prompting all workers to finish once they've drained all queued work
+    m_run = false;
+
+    // Wake up any sleeping workers so they can see the new run state
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_sleepCv.notify_all();
+    }
+
+    // Now wait for all workers to finish
+    for (auto& thread : m_workers)
+    {
+        thread.join();
+    }
+}
+
+bool JobSystem::IsWorkerThread() const noexcept
+{
+    return tl_pWorkerOf == this;
+}
+
+Job::Ptr JobSystem::Submit(Job::Work work)
+{
+    auto job = std::make_shared<Job>(std::move(work));
+
+    ReleaseDependency(job);
+
+    return job;
+}
+
+Job::Ptr JobSystem::Submit(Job::Work work, const std::vector<Job::Ptr>& dependencies)
+{
+    auto job = std::make_shared<Job>(std::move(work));
+
+    for (const auto& dependency : dependencies)
+    {
+        if (dependency == nullptr) { continue; }
+
+        std::lock_guard<std::mutex> lock(dependency->m_continuationsMutex);
+
+        // Dependency already finished; nothing to wait for
+        if (dependency->IsComplete()) { continue; }
+
+        job->m_pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+        dependency->m_continuations.push_back(job);
+    }
+
+    // Release the submitter's hold on the job; if all dependencies have already finished
+    // (or there were none), this schedules the job
+    ReleaseDependency(job);
+
+    return job;
+}
+
+void JobSystem::Wait(const Job::Ptr& job)
+{
+    if (job == nullptr) { return; }
+
+    WaitUntil([&](){ return job->IsComplete(); });
+}
+
+void JobSystem::Wait(const std::vector<Job::Ptr>& jobs)
+{
+    for (const auto& job : jobs)
+    {
+        Wait(job);
+    }
+}
+
+void JobSystem::ParallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, const RangeFunc& func)
+{
+    if (end <= begin) { return; }
+
+    const std::size_t rangeSize = end - begin;
+
+    if (grainSize == 0)
+    {
+        // Aim for a few sub-ranges per worker, so that uneven sub-range costs can balance out
+        grainSize = std::max<std::size_t>(1, rangeSize / (static_cast<std::size_t>(GetWorkerCount() + 1) * 4));
+    }
+
+    const std::size_t numChunks = (rangeSize + grainSize - 1) / grainSize;
+
+    // Small enough to not be worth distributing
+    if (numChunks == 1)
+    {
+        func(begin, end);
+        return;
+    }
+
+    // Rather than one job per chunk, a job per participating thread claims chunks from a
+    // shared counter until none remain
+    auto nextChunk = std::make_shared<std::atomic<std::size_t>>(0);
+
+    const auto processChunks = [=, &func](){
+        for (std::size_t chunk = nextChunk->fetch_add(1); chunk < numChunks; chunk = nextChunk->fetch_add(1))
+        {
+            const std::size_t chunkBegin = begin + (chunk * grainSize);
+            const std::size_t chunkEnd = std::min(end, chunkBegin + grainSize);
+
+            func(chunkBegin, chunkEnd);
+        }
+    };
+
+    const auto numHelpers = std::min<std::size_t>(GetWorkerCount(), numChunks - 1);
+
+    std::vector<Job::Ptr> helpers;
+    helpers.reserve(numHelpers);
+
+    for (std::size_t x = 0; x < numHelpers; ++x)
+    {
+        helpers.push_back(Submit(processChunks));
+    }
+
+    // The calling thread participates as well
+    processChunks();
+
+    Wait(helpers);
+}
+
+void JobSystem::WorkerThreadFunc(unsigned int workerIndex)
+{
+    tl_pWorkerOf = this;
+    tl_workerIndex = workerIndex;
+
+    while (true)
+    {
+        const auto job = FindJob();
+        if (job)
+        {
+            Execute(job);
+            continue;
+        }
+
+        // Only stop once there's no queued work left. Any continuations that a worker's last job scheduled
+        // are pushed onto that worker's own queue, so it finds them before it can stop.
+        if (!m_run) { break; }
+
+        // Nothing to run; sleep until work is scheduled or we're told to stop
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleepingThreads++;
+        m_sleepCv.wait(lock, [this](){ return !m_run || m_queuedJobs > 0; });
+        m_sleepingThreads--;
+    }
+}
+
+void JobSystem::Schedule(const Job::Ptr& job)
+{
+    // Workers push onto their own queue, everyone else distributes round-robin
+    const std::size_t queueIndex = IsWorkerThread() ?
+        tl_workerIndex : (m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size());
+
+    {
+        auto& queue = *m_queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(job);
+        m_queuedJobs++;
+    }
+
+    // Idle workers share the condition variable with threads blocked in WaitUntil, so all sleepers are woken;
+    // waking only one could wake a waiter rather than an idle worker, leaving the job unrun
+    if (m_sleepingThreads > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_sleepCv.notify_all();
+    }
+}
+
+Job::Ptr JobSystem::FindJob()
+{
+    const bool isWorker = IsWorkerThread();
+
+    // Workers first look at the back of their own queue, where their most recently
+    // scheduled (and most likely cache-hot) work is
+    if (isWorker)
+    {
+        auto& queue = *m_queues[tl_workerIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (!queue.jobs.empty())
+        {
+            auto job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            m_queuedJobs--;
+            return job;
+        }
+    }
+
+    // Otherwise, steal the oldest work from the front of another queue
+    const std::size_t startIndex = isWorker ? tl_workerIndex + 1 : 0;
+
+    for (std::size_t x = 0; x < m_queues.size(); ++x)
+    {
+        auto& queue = *m_queues[(startIndex + x) % m_queues.size()];
+
+        // Cheap early-out without taking the lock
+        if (m_queuedJobs == 0) { return nullptr; }
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (!queue.jobs.empty())
+        {
+            auto job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            m_queuedJobs--;
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void JobSystem::Execute(const Job::Ptr& job)
+{
+    job->m_work();
+
+    // Release whatever the work captured now rather than when the last handle is dropped
+    job->m_work = nullptr;
+
+    std::vector<Job::Ptr> continuations;
+
+    {
+        std::lock_guard<std::mutex> lock(job->m_continuationsMutex);
+        job->m_complete.store(true, std::memory_order_release);
+        std::swap(continuations, job->m_continuations);
+    }
+
+    for (const auto& continuation : continuations)
+    {
+        ReleaseDependency(continuation);
+    }
+
+    // Wake up any threads which might be waiting on the job
+    if (m_sleepingThreads > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_sleepCv.notify_all();
+    }
+}
+
+void JobSystem::ReleaseDependency(const Job::Ptr& job)
+{
+    if (job->m_pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        Schedule(job);
+    }
+}
+
+void JobSystem::WaitUntil(const std::function<bool()>& isDone)
+{
+    const bool isWorker = IsWorkerThread();
+
+    while (!isDone())
+    {
+        // Workers keep executing work while they wait; otherwise a worker waiting on work which is
+        // queued behind it could starve the pool
+        if (isWorker)
+        {
+            const auto job = FindJob();
+            if (job)
+            {
+                Execute(job);
+                continue;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleepingThreads++;
+        m_sleepCv.wait_for(lock, WAIT_POLL_INTERVAL, [&](){
+            return isDone() || (isWorker && m_queuedJobs > 0);
+        });
+        m_sleepingThreads--;
+    }
+}
+
+std::string JobSystem::GetThreadIdentifier(unsigned int workerIndex) const
+{
+    std::stringstream ss;
+    ss << "JS" << workerIndex << "-" << m_tag;
+    return ss.str();
+}
+
+}
@@ -39,6 +39,19 @@ std::chrono::duration<double, std::milli> Timer::StopTimer(const IMetrics::Ptr&
     const auto duration = StopTimer();
 
     metrics->SetDoubleValue(m_identifier, duration.count());
+    metrics->RecordHistogramValue(m_identifier, duration.count());
+
+    return duration;
+}
+
+std::chrono::duration<double, std::milli> Timer::StopTimer(const IMetrics::Ptr& metrics,
+                                                           const DoubleHandle& doubleHandle,
+                                                           const HistogramHandle& histogramHandle)
+{
+    const auto duration = StopTimer();
+
+    metrics->SetDoubleValue(doubleHandle, duration.count());
+    metrics->RecordHistogramValue(histogramHandle, duration.count());
 
     return duration;
 }
@@ -61,6 +61,9 @@ namespace Accela::Engine
         /** Whether the object is included in shadow passes */
         bool shadowPass{true};
 
+        /** Whether the model hides objects behind it from being rendered (see Render::ObjectRenderable::occluder) */
+        bool occluder{false};
+
         /**
          * Optional animation state to apply to the model. Note: the engine
          * will take care of stepping the animation forwards through time as appropriate.
@@ -33,6 +33,9 @@ namespace Accela::Engine
 
         /** Whether the object is included in shadow passes */
         bool shadowPass{true};
+
+        /** Whether the object hides objects behind it from being rendered (see Render::ObjectRenderable::occluder) */
+        bool occluder{false};
     };
 }
 
@@ -41,12 +41,14 @@ namespace Accela::Engine
                 Params& WithScale(const glm::vec3& _scale);
                 Params& WithOrientation(const glm::quat& _orientation);
                 Params& IncludedInShadowPass(bool _inShadowPass);
+                Params& AsOccluder(bool _occluder);
 
                 std::optional<ResourceIdentifier> resource;
                 std::optional<glm::vec3> position;
                 std::optional<glm::vec3> scale;
                 std::optional<glm::quat> orientation;
                 std::optional<bool> inShadowPass;
+                std::optional<bool> occluder;
             };
 
             [[nodiscard]] static Params Builder() { return {}; }
@@ -10,12 +10,18 @@
 #include "PerlinNoise.h"
 
 #include <Accela/Common/SharedLib.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 #include <glm/glm.hpp>
 
 #include <cstdint>
-#include <sstream>
+#include <cstddef>
 #include <unordered_map>
+#include <unordered_set>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <atomic>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -25,6 +31,16 @@ namespace Accela::Engine
     /**
      * Creates a source of infinite tiled perlin noise from which images
      * for specific sub-chunks can be queried for.
+     *
+     * Noise is deterministic for a given seed: chunk gradients are derived from their position in
+     * the world rather than from neighbouring chunks, so a chunk which is evicted and later re-created
+     * is identical to the original, and chunks can be generated independently of one another.
+     *
+     * Generated data is cached, bounded by an optional memory budget, with the least recently used
+     * chunks being evicted first. Sub-chunks around a moving focus point can be generated ahead of
+     * time, asynchronously, via PrefetchAround(..).
+     *
+     * Thread safe.
      */
     class ACCELA_PUBLIC InfinitePerlinNoise
     {
@@ -37,11 +53,19 @@ namespace Accela::Engine
 
                 bool operator==(const PosKey&) const = default;
 
+                [[nodiscard]] uint64_t Pack() const noexcept
+                {
+                    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+                }
+
                 struct HashFunction {
                     std::size_t operator()(const PosKey& o) const {
-                        std::stringstream ss;
-                        ss << o.x << "-" << o.y;
-                        return std::hash<std::string>{}(ss.str());
+                        // murmur3 finalizer over both packed coordinates
+                        auto v = o.Pack();
+                        v ^= v >> 33; v *= 0xff51afd7ed558ccdULL;
+                        v ^= v >> 33; v *= 0xc4ceb9fe1a85ec53ULL;
+                        v ^= v >> 33;
+                        return static_cast<std::size_t>(v);
                     }
                 };
             };
@@ -57,6 +81,15 @@ namespace Accela::Engine
                 std::vector<float> chunkData;
             };
 
+            struct Config
+            {
+                /** Max bytes of noise data to keep cached, or 0 for no limit */
+                std::size_t memoryBudgetBytes{0};
+
+                /** Seed the noise is generated from. If not provided, a random seed is chosen. */
+                std::optional<uint64_t> seed;
+            };
+
         public:
 
             /***
@@ -70,16 +103,35 @@ namespace Accela::Engine
              * All positions throughout the API are in X/Y space where X increases to the
              * right and Y increases downwards.
              *
+             * @param jobSystem The job system to run prefetches on, typically the engine's (IEngineRuntime::GetJobSystem())
              * @param perlinSize The size of perlin noise chunks to be generated
              * @param subSize The size of sub-chunks within chunks
              * @param imageSize The pixel size of images to generate from sub-chunks
              */
-            InfinitePerlinNoise(unsigned int perlinSize,
+            InfinitePerlinNoise(Common::JobSystem::Ptr jobSystem,
+                                unsigned int perlinSize,
                                 unsigned int subSize,
                                 unsigned int imageSize);
 
             /**
-             * @return Whether or not a sub-chunk has previously been created for a specific position.
+             * Same as the above constructor, but with caching configuration.
+             */
+            InfinitePerlinNoise(Common::JobSystem::Ptr jobSystem,
+                                unsigned int perlinSize,
+                                unsigned int subSize,
+                                unsigned int imageSize,
+                                Config config);
+
+            /**
+             * Blocks until any in-progress prefetch work has finished.
+             */
+            ~InfinitePerlinNoise();
+
+            InfinitePerlinNoise(const InfinitePerlinNoise&) = delete;
+            InfinitePerlinNoise& operator=(const InfinitePerlinNoise&) = delete;
+
+            /**
+             * @return Whether or not a sub-chunk is currently cached for a specific position.
              */
             [[nodiscard]] bool SubExists(const glm::vec2& pos) const;
 
@@ -94,11 +146,21 @@ namespace Accela::Engine
             [[nodiscard]] std::optional<SubChunk> GetSubChunk(const glm::vec2& pos);
 
             /**
-             * Same as GetSubChunk except will also return std::nullopt if the sub-chunk data
-             * is already cached internally.
+             * Same as GetSubChunk except will also return std::nullopt if the sub-chunk has
+             * already been returned by a previous call and is still cached. Sub-chunks which
+             * were only prefetched are still returned.
              */
             [[nodiscard]] std::optional<SubChunk> GetSubChunkIfNotExists(const glm::vec2& pos);
 
+            /**
+             * Asynchronously generates and caches all sub-chunks within a specific distance of a
+             * focus point which aren't already cached, nearest chunks first. Returns immediately.
+             *
+             * @param pos The focus point
+             * @param distance The distance around the focus point to prefetch sub-chunks within
+             */
+            void PrefetchAround(const glm::vec2& pos, float distance);
+
             /**
              * Gets a list of all chunks (not sub-chunks) which are more than a specific distance from a
              * specific point.
@@ -110,6 +172,12 @@ namespace Accela::Engine
              */
             [[nodiscard]] std::vector<ChunkKey> GetAllChunksOutsideDistance(const glm::vec2& pos, float distance) const;
 
+            /**
+             * Evicts all chunks (and their sub-chunks) which are more than a specific distance from a
+             * specific point.
+             */
+            void EvictChunksOutsideDistance(const glm::vec2& pos, float distance);
+
             /**
              * Frees image data associated with a particular sub-chunk
              *
@@ -117,33 +185,83 @@ namespace Accela::Engine
              */
             void FreeSubImage(const Keys& keys);
 
+            /**
+             * Returns (and forgets) the keys of sub-chunks which were previously returned from
+             * GetSubChunk(..) but have since been evicted from the cache, due to the memory budget
+             * or EvictChunksOutsideDistance(..), so that callers can release anything they built
+             * from them.
+             */
+            [[nodiscard]] std::vector<Keys> PopEvictedSubChunks();
+
+            /**
+             * @return The number of bytes of noise data currently cached
+             */
+            [[nodiscard]] std::size_t GetCachedByteSize() const;
+
         private:
 
+            struct KeysHashFunction {
+                std::size_t operator()(const Keys& o) const {
+                    return PosKey::HashFunction{}(o.first) ^ (PosKey::HashFunction{}(o.second) * 31);
+                }
+            };
+
+            struct Sub
+            {
+                std::vector<float> data;
+
+                // Whether the sub has been returned to the user via GetSubChunk
+                bool delivered{false};
+            };
+
             struct Chunk
             {
-                explicit Chunk(unsigned int perlinSize)
-                    : perlinNoise(perlinSize)
-                { }
+                std::shared_ptr<const PerlinNoise> perlinNoise;
+                std::unordered_map<SubKey, Sub, SubKey::HashFunction> subs;
 
-                PerlinNoise perlinNoise;
-                std::unordered_map<SubKey, SubChunk, SubKey::HashFunction> subs;
+                // Position of the chunk within the LRU list
+                std::list<ChunkKey>::iterator lruIt;
+
+                // Total bytes of the chunk's noise and sub data
+                std::size_t byteSize{0};
             };
 
         private:
 
             [[nodiscard]] Keys PosToKeys(const glm::vec2& pos) const;
 
-            void EnsureChunk(const ChunkKey& chunkKey);
+            [[nodiscard]] std::shared_ptr<const PerlinNoise> CreateChunkNoise(const ChunkKey& chunkKey) const;
+            [[nodiscard]] std::optional<std::vector<float>> GenerateSubData(const PerlinNoise& perlinNoise, const SubKey& subKey) const;
+            [[nodiscard]] bool IsChunkOutsideDistance(const ChunkKey& chunkKey, const glm::vec2& pos, float distance) const;
+
+            void PrefetchChunk(const ChunkKey& chunkKey, const std::vector<SubKey>& subKeys);
+
+            // Note: All of the below require m_mutex to be held
+            Sub& InsertSub_Locked(const Keys& keys, const std::shared_ptr<const PerlinNoise>& perlinNoise, std::vector<float> data);
+            void TouchChunk_Locked(Chunk& chunk);
+            void EvictChunk_Locked(const ChunkKey& chunkKey);
+            void EnforceMemoryBudget_Locked();
 
         private:
 
+            Common::JobSystem::Ptr m_jobSystem;
             unsigned int m_perlinSize;
             unsigned int m_subSize;
             unsigned int m_imageSize;
+            Config m_config;
 
             unsigned int m_subsPerDimension;
+            uint64_t m_seed;
 
+            mutable std::mutex m_mutex;
             std::unordered_map<ChunkKey, Chunk, ChunkKey::HashFunction> m_chunks;
+            std::list<ChunkKey> m_lru; // Front is most recently used
+            std::size_t m_cachedByteSize{0};
+            std::unordered_set<Keys, KeysHashFunction> m_pendingSubs;
+            std::vector<Keys> m_evictedSubs;
+
+            std::vector<Common::Job::Ptr> m_prefetchJobs;
+            std::atomic<bool> m_destroying{false};
     };
 }
 
@@ -15,6 +15,7 @@
 #include <vector>
 #include <utility>
 #include <optional>
+#include <cstdint>
 
 namespace Accela::Engine
 {
@@ -42,6 +43,20 @@ namespace Accela::Engine
              */
             explicit PerlinNoise(unsigned int size);
 
+            /**
+             * Create a new source of deterministic perlin noise, that's size units large in width and height,
+             * and which sits at a specific offset within an infinite lattice of gradients.
+             *
+             * Each gradient is derived from the seed and its lattice position, so two PerlinNoises with the
+             * same seed automatically agree on the gradients along any sides they share, and re-creating a
+             * PerlinNoise with the same parameters always results in the same noise.
+             *
+             * @param size The side length / size of the perlin noise.
+             * @param seed The seed that the lattice gradients are derived from
+             * @param latticeOffset The position of this noise's top left grid point within the lattice
+             */
+            PerlinNoise(unsigned int size, uint64_t seed, const std::pair<int64_t, int64_t>& latticeOffset);
+
             /**
             * @return The cell size of the perlin noise, as supplied to the constructor.
             */
@@ -124,6 +139,7 @@ namespace Accela::Engine
             [[nodiscard]] std::vector<glm::vec2> GetSideGradients(Side side) const;
 
             void GenerateGridVectors();
+            void GenerateGridVectors(uint64_t seed, const std::pair<int64_t, int64_t>& latticeOffset);
 
         private:
 
@@ -18,6 +18,7 @@
 #include <Accela/Common/SharedLib.h>
 #include <Accela/Common/Log/ILogger.h>
 #include <Accela/Common/Metrics/IMetrics.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 #include <memory>
 #include <string>
@@ -42,6 +43,13 @@ namespace Accela::Engine
 
             [[nodiscard]] virtual Common::ILogger::Ptr GetLogger() const noexcept = 0;
             [[nodiscard]] virtual Common::IMetrics::Ptr GetMetrics() const noexcept = 0;
+
+            /**
+             * @return The job system which the engine runs its parallel work on, for use by client code
+             * which has its own parallel work, rather than creating additional worker threads
+             */
+            [[nodiscard]] virtual Common::JobSystem::Ptr GetJobSystem() const noexcept = 0;
+
             [[nodiscard]] virtual IWorldState::Ptr GetWorldState() const noexcept = 0;
             [[nodiscard]] virtual IWorldResources::Ptr GetWorldResources() const noexcept = 0;
             [[nodiscard]] virtual Platform::IKeyboardState::CPtr GetKeyboardState() const noexcept = 0;
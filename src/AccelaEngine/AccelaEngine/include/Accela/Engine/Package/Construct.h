@@ -14,6 +14,7 @@
 #include <memory>
 #include <expected>
 #include <vector>
+#include <span>
 #include <cstddef>
 #include <string>
 
@@ -28,7 +29,7 @@ namespace Accela::Engine
 
         public:
 
-            [[nodiscard]] static std::expected<Ptr, bool> FromBytes(const std::vector<std::byte>& data);
+            [[nodiscard]] static std::expected<Ptr, bool> FromBytes(std::span<const std::byte> data);
 
             [[nodiscard]] std::expected<std::vector<std::byte>, bool> ToBytes() const;
 
@@ -12,6 +12,7 @@
 #include <memory>
 #include <expected>
 #include <vector>
+#include <span>
 #include <cstddef>
 #include <string>
 
@@ -32,7 +33,7 @@ namespace Accela::Engine
 
         public:
 
-            [[nodiscard]] static std::expected<Manifest, CreateError> FromBytes(const std::vector<std::byte>& data);
+            [[nodiscard]] static std::expected<Manifest, CreateError> FromBytes(std::span<const std::byte> data);
 
             [[nodiscard]] std::expected<std::vector<std::byte>, bool> ToBytes() const;
 
@@ -8,6 +8,7 @@
 #define LIBACCELAENGINE_INCLUDE_ACCELA_ENGINE_PHYSICS_IPHYSICSRUNTIME_H
 
 #include "RaycastResult.h"
+#include "SceneQuery.h"
 #include "PlayerController.h"
 
 #include <Accela/Engine/Common.h>
@@ -19,6 +20,9 @@
 
 #include <memory>
 #include <vector>
+#include <span>
+#include <optional>
+#include <cstddef>
 #include <expected>
 #include <string>
 
@@ -91,6 +95,64 @@ namespace Accela::Engine
                 const glm::vec3& rayStart_worldSpace,
                 const glm::vec3& rayEnd_worldSpace) const = 0;
 
+            /**
+             * Casts a batch of rays through a scene, reporting the closest hit of each. The queries are
+             * split across worker threads and their results written directly into the provided buffer,
+             * so large batches (e.g. line of sight checks for every AI agent) avoid per-query overhead.
+             *
+             * Must not be called concurrently with the physics simulation or modifications to the scene;
+             * the scene is only read from while the batch is executing.
+             *
+             * @param scene The scene in which to raycast
+             * @param queries The rays to cast
+             * @param results Receives, for each query, its closest hit, or std::nullopt if it hit nothing.
+             * Must be at least as large as queries.
+             *
+             * @return False if the scene doesn't exist or the results buffer is too small
+             */
+            [[nodiscard]] virtual bool RaycastBatch(
+                const PhysicsSceneName& scene,
+                std::span<const RaycastQuery> queries,
+                std::span<std::optional<SceneQueryHit>> results) const = 0;
+
+            /**
+             * Sweeps a batch of shapes through a scene, reporting the closest hit of each. Executes
+             * as described for RaycastBatch.
+             *
+             * @param scene The scene in which to sweep
+             * @param queries The shapes to sweep
+             * @param results Receives, for each query, its closest hit, or std::nullopt if it hit nothing.
+             * Must be at least as large as queries.
+             *
+             * @return False if the scene doesn't exist or the results buffer is too small
+             */
+            [[nodiscard]] virtual bool SweepBatch(
+                const PhysicsSceneName& scene,
+                std::span<const SweepQuery> queries,
+                std::span<std::optional<SceneQueryHit>> results) const = 0;
+
+            /**
+             * Tests a batch of shapes for overlap against a scene, reporting the objects each overlaps.
+             * Executes as described for RaycastBatch.
+             *
+             * The hits of query i are written to hits[i * maxHitsPerQuery], with the number written
+             * stored in hitCounts[i]. Overlaps beyond maxHitsPerQuery for a query are dropped.
+             *
+             * @param scene The scene in which to test for overlaps
+             * @param queries The shapes to test
+             * @param maxHitsPerQuery The maximum number of hits reported per query
+             * @param hits Receives the objects each query overlaps. Must be at least queries.size() * maxHitsPerQuery large.
+             * @param hitCounts Receives the number of hits reported for each query. Must be at least as large as queries.
+             *
+             * @return False if the scene doesn't exist or a buffer is too small
+             */
+            [[nodiscard]] virtual bool OverlapBatch(
+                const PhysicsSceneName& scene,
+                std::span<const OverlapQuery> queries,
+                std::size_t maxHitsPerQuery,
+                std::span<SceneQueryObject> hits,
+                std::span<std::size_t> hitCounts) const = 0;
+
             /**
              * Create a PlayerController within the physics system
              *
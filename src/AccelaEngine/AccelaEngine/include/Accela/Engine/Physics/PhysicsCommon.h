@@ -17,9 +17,19 @@
 
 #include <variant>
 #include <string>
+#include <cstdint>
 
 namespace Accela::Engine
 {
+    /**
+     * Bitmask of filter groups. Shapes belong to one or more filter groups, and scene queries only
+     * report shapes which belong to at least one of the groups the query is filtering for.
+     */
+    using PhysicsFilterGroups = uint32_t;
+
+    /** Mask which includes every filter group */
+    static constexpr PhysicsFilterGroups PHYSICS_FILTER_GROUPS_ALL = 0xFFFFFFFF;
+
     enum class RigidBodyType
     {
         /** Infinite mass, manually controlled */
@@ -96,6 +106,9 @@ namespace Accela::Engine
         /** Additional local orientation applied to the shape's bounds, relative to the entity's model
          * space (defaults to none) */
         glm::quat localOrientation;
+
+        /** The filter groups the shape belongs to, which scene queries can filter against (defaults to all) */
+        PhysicsFilterGroups filterGroups{PHYSICS_FILTER_GROUPS_ALL};
     };
 
     /**
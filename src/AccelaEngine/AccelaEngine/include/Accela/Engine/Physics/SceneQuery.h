@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAENGINE_INCLUDE_ACCELA_ENGINE_PHYSICS_SCENEQUERY_H
+#define LIBACCELAENGINE_INCLUDE_ACCELA_ENGINE_PHYSICS_SCENEQUERY_H
+
+#include "PhysicsCommon.h"
+
+#include <Accela/Engine/Common.h>
+#include <Accela/Engine/Bounds/Bounds_AABB.h>
+#include <Accela/Engine/Bounds/Bounds_Sphere.h>
+#include <Accela/Engine/Bounds/Bounds_Capsule.h>
+
+#include <Accela/Common/SharedLib.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <variant>
+#include <string>
+
+namespace Accela::Engine
+{
+    /** Something within the physics simulation that a scene query found, either an entity or a player controller */
+    using SceneQueryObject = std::variant<EntityId, PlayerControllerName>;
+
+    /**
+     * Shape which is swept through, or tested for overlap against, a physics scene. A capsule's height
+     * runs along its local y axis.
+     */
+    using SceneQueryShape = std::variant<Bounds_AABB, Bounds_Sphere, Bounds_Capsule>;
+
+    /**
+     * A ray to be cast through a physics scene, reporting the closest object it hits
+     */
+    struct ACCELA_PUBLIC RaycastQuery
+    {
+        glm::vec3 rayStart_worldSpace{0.0f};
+        glm::vec3 rayEnd_worldSpace{0.0f};
+
+        /** Only shapes which belong to at least one of these groups are reported */
+        PhysicsFilterGroups filterGroups{PHYSICS_FILTER_GROUPS_ALL};
+    };
+
+    /**
+     * A shape to be swept through a physics scene, reporting the closest object it hits
+     */
+    struct ACCELA_PUBLIC SweepQuery
+    {
+        explicit SweepQuery(SceneQueryShape _shape)
+            : shape(_shape)
+        { }
+
+        SceneQueryShape shape;
+
+        glm::vec3 sweepStart_worldSpace{0.0f};
+        glm::vec3 sweepEnd_worldSpace{0.0f};
+        glm::quat orientation{glm::identity<glm::quat>()};
+
+        /** Only shapes which belong to at least one of these groups are reported */
+        PhysicsFilterGroups filterGroups{PHYSICS_FILTER_GROUPS_ALL};
+    };
+
+    /**
+     * A shape to be tested for overlap against a physics scene, reporting every object it overlaps
+     */
+    struct ACCELA_PUBLIC OverlapQuery
+    {
+        explicit OverlapQuery(SceneQueryShape _shape)
+            : shape(_shape)
+        { }
+
+        SceneQueryShape shape;
+
+        glm::vec3 position_worldSpace{0.0f};
+        glm::quat orientation{glm::identity<glm::quat>()};
+
+        /** Only shapes which belong to at least one of these groups are reported */
+        PhysicsFilterGroups filterGroups{PHYSICS_FILTER_GROUPS_ALL};
+    };
+
+    /**
+     * Holds the details of the closest hit of a raycast or sweep query
+     */
+    struct ACCELA_PUBLIC SceneQueryHit
+    {
+        SceneQueryObject hit;  // What was hit, either an EntityId or a PlayerController
+
+        glm::vec3 hitPoint_worldSpace{0.0f};  // The world-space coordinate of the geometry that was hit
+        glm::vec3 hitNormal_worldSpace{0.0f}; // The world-space normal of the geometry that was hit
+        float distance{0.0f};                 // Distance along the ray/sweep at which the hit occurred
+    };
+}
+
+#endif //LIBACCELAENGINE_INCLUDE_ACCELA_ENGINE_PHYSICS_SCENEQUERY_H
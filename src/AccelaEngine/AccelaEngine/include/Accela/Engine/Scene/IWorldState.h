@@ -35,6 +35,7 @@
 #include <optional>
 #include <utility>
 #include <future>
+#include <functional>
 #include <unordered_set>
 
 namespace Accela::Engine
@@ -97,7 +98,33 @@ namespace Accela::Engine
             [[nodiscard]] virtual std::optional<EntityId> GetTopSpriteEntityAt(const glm::vec2& virtualPoint) const = 0;
 
             /**
-             * Return the entity id of the top-most entity with an object/model renderable, if any, underneath the provided virtual point
+             * Returns all sprite entities whose bounds overlap the provided virtual rect
+             *
+             * @param virtualMin The top left corner of the virtual rect
+             * @param virtualMax The bottom right corner of the virtual rect
+             *
+             * @return The list of EntityIds associated with sprites overlapping the rect, sorted from top to bottom
+             */
+            [[nodiscard]] virtual std::vector<EntityId> GetSpriteEntitiesIn(const glm::vec2& virtualMin,
+                                                                            const glm::vec2& virtualMax) const = 0;
+
+            /**
+             * Return the entity id of the sprite entity closest to the provided virtual point
+             *
+             * @param virtualPoint The virtual point in question
+             * @param maxVirtualDistance The maximum virtual distance from the point to search
+             *
+             * @return The EntityId of the closest sprite (the top-most, if several contain the point), or
+             * std::nullopt if no sprite is within the maximum distance
+             */
+            [[nodiscard]] virtual std::optional<EntityId> GetNearestSpriteEntity(const glm::vec2& virtualPoint,
+                                                                                 float maxVirtualDistance) const = 0;
+
+            /**
+             * Return the entity id of the top-most entity with an object/model renderable, if any, underneath the provided virtual point.
+             *
+             * Reads back the single pixel from the most recently presented frame. Blocks until the GPU work already in
+             * flight has finished; prefer the callback variant when called every frame or from a simulation step.
              *
              * @param virtualPoint The virtual point in question
              *
@@ -105,6 +132,50 @@ namespace Accela::Engine
              */
             [[nodiscard]] virtual std::optional<EntityId> GetTopObjectEntityAt(const glm::vec2& virtualPoint) const = 0;
 
+            /**
+             * Asynchronous variant of GetTopObjectEntityAt, which doesn't block. The result is available once the GPU
+             * work already in flight has finished, without waiting on further frames to be rendered.
+             *
+             * The callback is called from the engine thread, after the scene's simulation step in a later step. Requests still
+             * pending when the scene is switched are dropped without their callback being called.
+             *
+             * @param virtualPoint The virtual point in question
+             * @param onResult Called with the EntityId of the top-most object/model underneath the virtual point, or
+             * std::nullopt if no such entity
+             */
+            virtual void GetTopObjectEntityAt(const glm::vec2& virtualPoint,
+                                              std::function<void(const std::optional<EntityId>&)> onResult) = 0;
+
+            /**
+             * Finds all object/model entities visible within the provided virtual rect, read back from the most
+             * recently presented frame. Only the requested region is read back. The callback is called as with the
+             * asynchronous GetTopObjectEntityAt.
+             *
+             * @param virtualMin The top left corner of the virtual rect
+             * @param virtualMax The bottom right corner of the virtual rect
+             * @param onResult Called with the EntityIds of the objects/models visible within the rect, ordered by how
+             * much of the rect they cover, most first
+             */
+            virtual void GetObjectEntitiesIn(const glm::vec2& virtualMin,
+                                             const glm::vec2& virtualMax,
+                                             std::function<void(const std::vector<EntityId>&)> onResult) = 0;
+
+            /**
+             * Finds all object/model entities whose bounds a world-space ray passes through. Tests the ray against
+             * the renderer's object bounds on the CPU, so requires no GPU readback, but is only as precise as the
+             * objects' bounding boxes. (See CameraVirtualPointToWorldRay for creating a ray from a virtual point.)
+             * The callback is called as with the asynchronous GetTopObjectEntityAt.
+             *
+             * @param sceneName The scene to pick from
+             * @param rayStart_worldSpace The start point of the ray
+             * @param rayEnd_worldSpace The end point of the ray
+             * @param onResult Called with the EntityIds of the objects/models along the ray, ordered nearest first
+             */
+            virtual void GetObjectEntitiesAlongRay(const std::string& sceneName,
+                                                   const glm::vec3& rayStart_worldSpace,
+                                                   const glm::vec3& rayEnd_worldSpace,
+                                                   std::function<void(const std::vector<EntityId>&)> onResult) = 0;
+
             /**
              * Create entities/components for all of the entities listed in a provided Construct
              *
@@ -10,6 +10,7 @@
 #include <Accela/Engine/ResourceIdentifier.h>
 
 #include "../Model/ModelPose.h"
+#include "../Model/CompiledModel.h"
 
 #include <optional>
 
@@ -23,6 +24,9 @@ namespace Accela::Engine
 
         ResourceIdentifier modelResource;
         std::optional<ModelPose> modelPose;
+
+        // Keyframe cursor for the model's current animation
+        AnimationCursor animationCursor;
     };
 }
 
@@ -27,6 +27,7 @@
 #include <Accela/Render/Graph/RenderGraphNodes.h>
 
 #include <Accela/Common/Timer.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 namespace Accela::Engine
 {
@@ -39,6 +40,10 @@ Engine::Engine(Common::ILogger::Ptr logger,
     , m_metrics(std::move(metrics))
     , m_platform(std::move(platform))
     , m_renderer(std::move(renderer))
+    , m_simulationStepTime(m_metrics->RegisterDouble(Engine_SimulationStep_Time))
+    , m_simulationStepTimeHistogram(m_metrics->RegisterHistogram(Engine_SimulationStep_Time))
+    , m_sceneSimulationStepTime(m_metrics->RegisterDouble(Engine_SceneSimulationStep_Time))
+    , m_sceneSimulationStepTimeHistogram(m_metrics->RegisterHistogram(Engine_SceneSimulationStep_Time))
 {
 
 }
@@ -55,14 +60,18 @@ void Engine::Run(Scene::UPtr initialScene, Render::OutputMode renderOutputMode,
     renderSettings.presentScaling = Render::PresentScaling::CenterInside;
     renderSettings.resolution = renderResolution;
 
+    // Job system which is shared by every engine system that needs CPU parallelism
+    const auto jobSystem = std::make_shared<Common::JobSystem>("Engine");
+
     const auto audioManager = std::make_shared<AudioManager>(m_logger);
-    const auto worldResources = std::make_shared<WorldResources>(m_logger, m_renderer, m_platform->GetFiles(), m_platform->GetText(), audioManager);
-    const auto physics = std::make_shared<PhysXPhysics>(m_logger, m_metrics, worldResources);
+    const auto worldResources = std::make_shared<WorldResources>(m_logger, m_renderer, m_platform->GetFiles(), m_platform->GetText(), audioManager, jobSystem);
+    const auto cookedMeshCacheDirectory = m_platform->GetFiles()->GetAccelaSubdirectory(Platform::CACHE_SUBDIR);
+    const auto physics = std::make_shared<PhysXPhysics>(m_logger, m_metrics, worldResources, jobSystem, cookedMeshCacheDirectory);
     const auto mediaManager = std::make_shared<MediaManager>(m_logger, m_metrics, worldResources, audioManager, m_renderer);
     const auto worldState = std::make_shared<WorldState>(m_logger, m_metrics, worldResources, m_platform->GetWindow(), m_renderer, audioManager, mediaManager, physics, renderSettings, virtualResolution);
 
     const auto runState = std::make_shared<RunState>(std::move(initialScene), worldResources, worldState, m_platform, audioManager, mediaManager);
-    const auto runtime = std::make_shared<EngineRuntime>(m_logger, m_metrics, m_renderer, runState);
+    const auto runtime = std::make_shared<EngineRuntime>(m_logger, m_metrics, jobSystem, m_renderer, runState);
 
     if (!InitializeRun(runState, renderOutputMode))
     {
@@ -98,6 +107,7 @@ bool Engine::InitializeRun(const RunState::Ptr& runState, Render::OutputMode ren
     Render::RenderInit renderInit{};
     renderInit.outputMode = renderOutputMode;
     renderInit.shaders = *assetsShadersExpect;
+    renderInit.pipelineCacheFilePath = m_platform->GetFiles()->GetAccelaFilePath(Platform::CACHE_SUBDIR, "pipeline_cache.bin");
 
     if (!m_renderer->Startup(renderInit, worldState->GetRenderSettings()))
     {
@@ -148,6 +158,8 @@ void Engine::DestroyRun(const RunState::Ptr& runState)
     m_renderer->Shutdown();
 
     m_renderTargetId = {};
+
+    m_logger->Log(Common::LogLevel::Info, "AccelaEngine: Run metrics:\n{}", Common::MetricsSnapshotToText(m_metrics->GetSnapshot(false)));
 }
 
 void Engine::RunLoop(const EngineRuntime::Ptr& runtime, const RunState::Ptr& runState)
@@ -225,7 +237,7 @@ void Engine::SimulationStep(const EngineRuntime::Ptr& runtime, const RunState::P
     {
         Common::Timer sceneSimulationStepTimer(Engine_SceneSimulationStep_Time);
         runState->scene->OnSimulationStep(runState->timeStep);
-        sceneSimulationStepTimer.StopTimer(m_metrics);
+        sceneSimulationStepTimer.StopTimer(m_metrics, m_sceneSimulationStepTime, m_sceneSimulationStepTimeHistogram);
     }
 
     //
@@ -234,7 +246,7 @@ void Engine::SimulationStep(const EngineRuntime::Ptr& runtime, const RunState::P
     //
     PostSimulationStep(runtime, runState);
 
-    simulationStepTimer.StopTimer(m_metrics);
+    simulationStepTimer.StopTimer(m_metrics, m_simulationStepTime, m_simulationStepTimeHistogram);
 }
 
 void Engine::PostSimulationStep(const EngineRuntime::Ptr& runtime, const RunState::Ptr& runState)
@@ -264,6 +276,9 @@ void Engine::PostSimulationStep(const EngineRuntime::Ptr& runtime, const RunStat
     // Keep the audio listener's position synced to the world camera, if requested
     SyncAudioListenerToWorldCamera(runtime, runState);
 
+    // Deliver the results of any object picks which have finished
+    worldState->FulfillObjectPicks();
+
     // Execute ECS systems
     worldState->ExecuteSystems(runState);
 
@@ -306,6 +321,9 @@ void Engine::ReceiveSceneChange(const EngineRuntime::Ptr& runtime, const RunStat
     runState->scene->OnSceneStop();
     runState->scene = nullptr;
 
+    // Drop object picks the old scene requested, as their callbacks can reference it
+    std::dynamic_pointer_cast<WorldState>(runState->worldState)->CancelObjectPicks();
+
     // Clear out physics system state that the previous scene had created
     std::dynamic_pointer_cast<IPhysics>(runState->worldState->GetPhysics())->ClearAll();
 
@@ -72,6 +72,12 @@ namespace Accela::Engine
             std::shared_ptr<Platform::IPlatform> m_platform;
             std::shared_ptr<Render::IRenderer> m_renderer;
 
+            // Handles for the metrics recorded every simulation step
+            Common::DoubleHandle m_simulationStepTime;
+            Common::HistogramHandle m_simulationStepTimeHistogram;
+            Common::DoubleHandle m_sceneSimulationStepTime;
+            Common::HistogramHandle m_sceneSimulationStepTimeHistogram;
+
             Render::RenderTargetId m_renderTargetId;
     };
 }
@@ -17,10 +17,12 @@ namespace Accela::Engine
 
 EngineRuntime::EngineRuntime(Common::ILogger::Ptr logger,
                              Common::IMetrics::Ptr metrics,
+                             Common::JobSystem::Ptr jobSystem,
                              std::shared_ptr<Render::IRenderer> renderer,
                              std::shared_ptr<RunState> runState)
     : m_logger(std::move(logger))
     , m_metrics(std::move(metrics))
+    , m_jobSystem(std::move(jobSystem))
     , m_renderer(std::move(renderer))
     , m_runState(std::move(runState))
 {
@@ -29,6 +31,7 @@ EngineRuntime::EngineRuntime(Common::ILogger::Ptr logger,
 
 Common::ILogger::Ptr EngineRuntime::GetLogger() const noexcept { return m_logger; }
 Common::IMetrics::Ptr EngineRuntime::GetMetrics() const noexcept { return m_metrics; }
+Common::JobSystem::Ptr EngineRuntime::GetJobSystem() const noexcept { return m_jobSystem; }
 IWorldState::Ptr EngineRuntime::GetWorldState() const noexcept { return m_runState->worldState; }
 IWorldResources::Ptr EngineRuntime::GetWorldResources() const noexcept { return m_runState->worldResources; }
 Platform::IKeyboardState::CPtr EngineRuntime::GetKeyboardState() const noexcept { return m_runState->keyboardState; }
@@ -28,11 +28,13 @@ namespace Accela::Engine
 
             EngineRuntime(Common::ILogger::Ptr logger,
                           Common::IMetrics::Ptr metrics,
+                          Common::JobSystem::Ptr jobSystem,
                           std::shared_ptr<Render::IRenderer> renderer,
                           std::shared_ptr<RunState> runState);
 
             [[nodiscard]] Common::ILogger::Ptr GetLogger() const noexcept override;
             [[nodiscard]] Common::IMetrics::Ptr GetMetrics() const noexcept override;
+            [[nodiscard]] Common::JobSystem::Ptr GetJobSystem() const noexcept override;
             [[nodiscard]] IWorldState::Ptr GetWorldState() const noexcept override;
             [[nodiscard]] IWorldResources::Ptr GetWorldResources() const noexcept override;
             [[nodiscard]] Platform::IKeyboardState::CPtr GetKeyboardState() const noexcept override;
@@ -67,6 +69,7 @@ namespace Accela::Engine
 
             Common::ILogger::Ptr m_logger;
             Common::IMetrics::Ptr m_metrics;
+            Common::JobSystem::Ptr m_jobSystem;
             std::shared_ptr<Render::IRenderer> m_renderer;
 
             std::shared_ptr<RunState> m_runState;
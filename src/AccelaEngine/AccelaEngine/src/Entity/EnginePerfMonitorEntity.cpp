@@ -75,42 +75,42 @@ void EnginePerfMonitorEntity::CreateEntities()
     uint32_t currentYPos = 0;
 
     currentYPos += CreateEntity(
-        Common::MetricType::Double,
+        Common::MetricType::Histogram,
         "Engine: Simulation Step Time: ",
         "Engine_SimulationStep_Time",
         textProperties,
         currentYPos
     );
     currentYPos += CreateEntity(
-        Common::MetricType::Double,
+        Common::MetricType::Histogram,
         "Engine: Scene Simulation Step Time: ",
         "Engine_SceneSimulationStep_Time",
         textProperties,
         currentYPos
     );
     currentYPos += CreateEntity(
-        Common::MetricType::Double,
+        Common::MetricType::Histogram,
         "Engine: Renderer Sync System Time: ",
         "Engine_RendererSyncSystem_Time",
         textProperties,
         currentYPos
     );
     currentYPos += CreateEntity(
-        Common::MetricType::Double,
+        Common::MetricType::Histogram,
         "Engine: Physics Sync System Time: ",
         "Engine_PhysicsSyncSystem_Time",
         textProperties,
         currentYPos
     );
     currentYPos += CreateEntity(
-        Common::MetricType::Double,
+        Common::MetricType::Histogram,
         "Renderer: Frame Render Total Time: ",
         "Renderer_FrameRenderTotal_Time",
         textProperties,
         currentYPos
     );
     currentYPos += CreateEntity(
-        Common::MetricType::Double,
+        Common::MetricType::Histogram,
         "Renderer: Frame Render Work Time: ",
         "Renderer_FrameRenderWork_Time",
         textProperties,
@@ -387,6 +387,14 @@ void EnginePerfMonitorEntity::OnSimulationStep(unsigned int)
                 metricEntity.entity->SetText(metricEntity.description + std::format("{:.3f}", *metricValue));
             }
             break;
+            case Common::MetricType::Histogram:
+            {
+                // Summarizes the values recorded since the last refresh, rather than since startup
+                const auto summary = m_engine->GetMetrics()->GetWindowedHistogramSummary(metricEntity.metricName);
+                if (!summary || summary->count == 0) { continue; }
+                metricEntity.entity->SetText(metricEntity.description + std::format("{:.3f} (p99 {:.3f})", summary->p50, summary->p99));
+            }
+            break;
         }
     }
 }
@@ -16,6 +16,7 @@ ModelEntity::Params& ModelEntity::Params::WithPosition(const glm::vec3& _positio
 ModelEntity::Params& ModelEntity::Params::WithScale(const glm::vec3& _scale) { scale = _scale; return *this; }
 ModelEntity::Params& ModelEntity::Params::WithOrientation(const glm::quat& _orientation) { orientation = _orientation; return *this; }
 ModelEntity::Params& ModelEntity::Params::IncludedInShadowPass(bool _inShadowPass) { inShadowPass = _inShadowPass; return *this; }
+ModelEntity::Params& ModelEntity::Params::AsOccluder(bool _occluder) { occluder = _occluder; return *this; }
 
 ModelEntity::UPtr ModelEntity::Create(const std::shared_ptr<IEngineRuntime>& engine,
                                       const Params& params,
@@ -102,6 +103,7 @@ void ModelEntity::SyncModelComponent()
     modelRenderableComponent.modelResource = *m_params->resource;
 
     if (m_params->inShadowPass) { modelRenderableComponent.shadowPass = *m_params->inShadowPass; }
+    if (m_params->occluder) { modelRenderableComponent.occluder = *m_params->occluder; }
     if (m_animationState) { modelRenderableComponent.animationState = *m_animationState; }
 
     Engine::AddOrUpdateComponent(m_engine->GetWorldState(), *m_eid, modelRenderableComponent);
@@ -8,20 +8,62 @@
 
 #include <cassert>
 #include <algorithm>
+#include <random>
+#include <map>
 
 namespace Accela::Engine
 {
 
-InfinitePerlinNoise::InfinitePerlinNoise(unsigned int perlinSize,
+InfinitePerlinNoise::InfinitePerlinNoise(Common::JobSystem::Ptr jobSystem,
+                                         unsigned int perlinSize,
                                          unsigned int subSize,
                                          unsigned int imageSize)
-    : m_perlinSize(perlinSize)
+    : InfinitePerlinNoise(std::move(jobSystem), perlinSize, subSize, imageSize, Config{})
+{
+
+}
+
+InfinitePerlinNoise::InfinitePerlinNoise(Common::JobSystem::Ptr jobSystem,
+                                         unsigned int perlinSize,
+                                         unsigned int subSize,
+                                         unsigned int imageSize,
+                                         Config config)
+    : m_jobSystem(std::move(jobSystem))
+    , m_perlinSize(perlinSize)
     , m_subSize(subSize)
     , m_imageSize(imageSize)
+    , m_config(std::move(config))
 {
+    assert(m_jobSystem != nullptr);
     assert(m_perlinSize % m_subSize == 0);
 
     m_subsPerDimension = m_perlinSize / m_subSize;
+
+    if (m_config.seed)
+    {
+        m_seed = *m_config.seed;
+    }
+    else
+    {
+        std::random_device rd;
+        m_seed = (static_cast<uint64_t>(rd()) << 32) | rd();
+    }
+}
+
+InfinitePerlinNoise::~InfinitePerlinNoise()
+{
+    m_destroying = true;
+
+    std::vector<Common::Job::Ptr> prefetchJobs;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        prefetchJobs = m_prefetchJobs;
+    }
+
+    if (!prefetchJobs.empty())
+    {
+        m_jobSystem->Wait(prefetchJobs);
+    }
 }
 
 std::pair<InfinitePerlinNoise::ChunkKey, InfinitePerlinNoise::SubKey> InfinitePerlinNoise::PosToKeys(const glm::vec2& pos) const
@@ -48,69 +90,36 @@ std::pair<InfinitePerlinNoise::ChunkKey, InfinitePerlinNoise::SubKey> InfinitePe
     return {chunkKey, subKey};
 }
 
-void InfinitePerlinNoise::EnsureChunk(const ChunkKey& chunkKey)
+std::shared_ptr<const PerlinNoise> InfinitePerlinNoise::CreateChunkNoise(const ChunkKey& chunkKey) const
 {
-    // Nothing to do if the chunk already exists
-    if (m_chunks.contains(chunkKey))
-    {
-        return;
-    }
-
-    // Keys of the chunks that surround the chunk
-    const auto chunkLeft = ChunkKey(chunkKey.x - 1, chunkKey.y);
-    const auto chunkRight = ChunkKey(chunkKey.x + 1, chunkKey.y);
-    const auto chunkTop = ChunkKey(chunkKey.x, chunkKey.y - 1);
-    const auto chunkBottom = ChunkKey(chunkKey.x, chunkKey.y + 1);
-
-    // Create the chunk
-    Chunk chunk(m_perlinSize);
-
-    // Overwrite the chunk's edges to the edge values of any surrounding chunks
-    // that may exist
-    if (m_chunks.contains(chunkLeft))
-    {
-        (void)chunk.perlinNoise.SetSideGradients(
-            PerlinNoise::Side::Left,
-            m_chunks.at(chunkLeft).perlinNoise,
-            PerlinNoise::Side::Right
-        );
-    }
-
-    if (m_chunks.contains(chunkRight))
-    {
-        (void)chunk.perlinNoise.SetSideGradients(
-            PerlinNoise::Side::Right,
-            m_chunks.at(chunkRight).perlinNoise,
-            PerlinNoise::Side::Left
-        );
-    }
+    // The chunk's grid starts at its world position within the lattice, so the gradients along its
+    // sides match those of its neighbours, whether or not they currently exist
+    const auto latticeOffset = std::make_pair(
+        static_cast<int64_t>(chunkKey.x) * m_perlinSize,
+        static_cast<int64_t>(chunkKey.y) * m_perlinSize
+    );
 
-    if (m_chunks.contains(chunkTop))
-    {
-        (void)chunk.perlinNoise.SetSideGradients(
-            PerlinNoise::Side::Top,
-            m_chunks.at(chunkTop).perlinNoise,
-            PerlinNoise::Side::Bottom
-        );
-    }
+    return std::make_shared<const PerlinNoise>(m_perlinSize, m_seed, latticeOffset);
+}
 
-    if (m_chunks.contains(chunkBottom))
-    {
-        (void)chunk.perlinNoise.SetSideGradients(
-            PerlinNoise::Side::Bottom,
-            m_chunks.at(chunkBottom).perlinNoise,
-            PerlinNoise::Side::Top
-        );
-    }
+std::optional<std::vector<float>> InfinitePerlinNoise::GenerateSubData(const PerlinNoise& perlinNoise, const SubKey& subKey) const
+{
+    const float subXOffset = (float)subKey.x * (float)m_subSize;
+    const float subYOffset = (float)subKey.y * (float)m_subSize;
 
-    // Record the new chunk
-    m_chunks.insert({chunkKey, chunk});
+    return perlinNoise.Get(
+        {(unsigned int)subXOffset, (unsigned int)subYOffset},
+        m_subSize,
+        m_imageSize
+    );
 }
 
 bool InfinitePerlinNoise::SubExists(const glm::vec2& pos) const
 {
     const auto keys = PosToKeys(pos);
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     const auto it = m_chunks.find(keys.first);
     if (it == m_chunks.cend())
     {
@@ -132,62 +141,292 @@ std::optional<InfinitePerlinNoise::SubChunk> InfinitePerlinNoise::GetSubChunk(co
     const auto& chunkKey = keys.first;
     const auto& subKey = keys.second;
 
-    // Ensure that the query chunk exists
-    EnsureChunk(chunkKey);
-    auto& chunk = m_chunks.at(chunkKey);
+    std::shared_ptr<const PerlinNoise> perlinNoise;
 
-    // Check if the chunk already contains that sub, and return it if so
-    const auto it = chunk.subs.find(subKey);
-    if (it != chunk.subs.cend())
+    //
+    // Return the sub from cache, if it exists
+    //
     {
-        return it->second;
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const auto it = m_chunks.find(chunkKey);
+        if (it != m_chunks.cend())
+        {
+            TouchChunk_Locked(it->second);
+
+            const auto subIt = it->second.subs.find(subKey);
+            if (subIt != it->second.subs.cend())
+            {
+                subIt->second.delivered = true;
+                return SubChunk(keys, subIt->second.data);
+            }
+
+            perlinNoise = it->second.perlinNoise;
+        }
     }
 
-    // Otherwise, generate the sub image
-    const float subXOffset = (float)subKey.x * (float)m_subSize;
-    const float subYOffset = (float)subKey.y * (float)m_subSize;
+    //
+    // Otherwise, generate the sub (outside of the lock, as it's the expensive part)
+    //
+    if (!perlinNoise)
+    {
+        perlinNoise = CreateChunkNoise(chunkKey);
+    }
 
-    auto subData = chunk.perlinNoise.Get(
-        {(unsigned int)subXOffset, (unsigned int)subYOffset},
-        m_subSize,
-        m_imageSize
-    );
+    auto subData = GenerateSubData(*perlinNoise, subKey);
     if (subData == std::nullopt)
     {
         return std::nullopt;
     }
 
+    //
     // Record the sub and return
-    auto subChunk = SubChunk(keys, *subData);
+    //
+    std::lock_guard<std::mutex> lock(m_mutex);
 
-    chunk.subs.insert({subKey, subChunk});
+    auto& sub = InsertSub_Locked(keys, perlinNoise, std::move(*subData));
+    sub.delivered = true;
+
+    auto subChunk = SubChunk(keys, sub.data);
+
+    EnforceMemoryBudget_Locked();
 
     return subChunk;
 }
 
 std::optional<InfinitePerlinNoise::SubChunk> InfinitePerlinNoise::GetSubChunkIfNotExists(const glm::vec2& pos)
 {
-    if (SubExists(pos)) { return std::nullopt; }
+    const auto keys = PosToKeys(pos);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const auto it = m_chunks.find(keys.first);
+        if (it != m_chunks.cend())
+        {
+            const auto subIt = it->second.subs.find(keys.second);
+            if (subIt != it->second.subs.cend() && subIt->second.delivered)
+            {
+                return std::nullopt;
+            }
+        }
+    }
 
     return GetSubChunk(pos);
 }
 
+void InfinitePerlinNoise::PrefetchAround(const glm::vec2& pos, float distance)
+{
+    //
+    // Determine the sub-chunks that (at least partially) fall within range of the focus point,
+    // which aren't already cached or being generated, grouped by chunk
+    //
+    const auto subSize = (float)m_subSize;
+
+    const int minSubX = (int)std::floor((pos.x - distance) / subSize);
+    const int maxSubX = (int)std::floor((pos.x + distance) / subSize);
+    const int minSubY = (int)std::floor((pos.y - distance) / subSize);
+    const int maxSubY = (int)std::floor((pos.y + distance) / subSize);
+
+    std::unordered_map<ChunkKey, std::vector<SubKey>, ChunkKey::HashFunction> toPrefetch;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (int subY = minSubY; subY <= maxSubY; ++subY)
+        {
+            for (int subX = minSubX; subX <= maxSubX; ++subX)
+            {
+                const glm::vec2 subMin((float)subX * subSize, (float)subY * subSize);
+
+                // Distance from the focus point to the closest point of the sub's bounds
+                const auto closestPoint = glm::clamp(pos, subMin, subMin + glm::vec2(subSize));
+                if (glm::distance(closestPoint, pos) > distance) { continue; }
+
+                const auto keys = PosToKeys(subMin + glm::vec2(subSize / 2.0f));
+
+                const auto chunkIt = m_chunks.find(keys.first);
+                if (chunkIt != m_chunks.cend() && chunkIt->second.subs.contains(keys.second)) { continue; }
+                if (!m_pendingSubs.insert(keys).second) { continue; }
+
+                toPrefetch[keys.first].push_back(keys.second);
+            }
+        }
+
+        // Forget about prefetch jobs which have finished
+        std::erase_if(m_prefetchJobs, [](const auto& job){ return job->IsComplete(); });
+    }
+
+    if (toPrefetch.empty())
+    {
+        return;
+    }
+
+    //
+    // Kick off one prefetch job per chunk, nearest chunks first
+    //
+    std::multimap<float, ChunkKey> chunksByDistance;
+
+    for (const auto& it : toPrefetch)
+    {
+        const auto chunkCenter = (glm::vec2((float)it.first.x, (float)it.first.y) + 0.5f) * (float)m_perlinSize;
+        chunksByDistance.insert({glm::distance(chunkCenter, pos), it.first});
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& it : chunksByDistance)
+    {
+        m_prefetchJobs.push_back(m_jobSystem->Submit([this, chunkKey = it.second, subKeys = toPrefetch.at(it.second)](){
+            PrefetchChunk(chunkKey, subKeys);
+        }));
+    }
+}
+
+void InfinitePerlinNoise::PrefetchChunk(const ChunkKey& chunkKey, const std::vector<SubKey>& subKeys)
+{
+    std::shared_ptr<const PerlinNoise> perlinNoise;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const auto it = m_chunks.find(chunkKey);
+        if (it != m_chunks.cend())
+        {
+            perlinNoise = it->second.perlinNoise;
+        }
+    }
+
+    if (!perlinNoise && !m_destroying)
+    {
+        perlinNoise = CreateChunkNoise(chunkKey);
+    }
+
+    for (const auto& subKey : subKeys)
+    {
+        const auto keys = std::make_pair(chunkKey, subKey);
+
+        std::optional<std::vector<float>> subData;
+
+        if (!m_destroying)
+        {
+            subData = GenerateSubData(*perlinNoise, subKey);
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_pendingSubs.erase(keys);
+
+        if (subData)
+        {
+            (void)InsertSub_Locked(keys, perlinNoise, std::move(*subData));
+            EnforceMemoryBudget_Locked();
+        }
+    }
+}
+
+InfinitePerlinNoise::Sub& InfinitePerlinNoise::InsertSub_Locked(const Keys& keys,
+                                                                const std::shared_ptr<const PerlinNoise>& perlinNoise,
+                                                                std::vector<float> data)
+{
+    auto chunkIt = m_chunks.find(keys.first);
+
+    // Create the chunk if it doesn't exist (or was evicted while the sub was being generated)
+    if (chunkIt == m_chunks.cend())
+    {
+        Chunk chunk{};
+        chunk.perlinNoise = perlinNoise;
+        chunk.byteSize = (m_perlinSize + 1) * (m_perlinSize + 1) * sizeof(glm::vec2);
+
+        m_lru.push_front(keys.first);
+        chunk.lruIt = m_lru.begin();
+
+        m_cachedByteSize += chunk.byteSize;
+
+        chunkIt = m_chunks.insert({keys.first, std::move(chunk)}).first;
+    }
+
+    auto& chunk = chunkIt->second;
+
+    TouchChunk_Locked(chunk);
+
+    // Someone else may have generated the same sub in the meantime; keep theirs
+    auto subIt = chunk.subs.find(keys.second);
+    if (subIt != chunk.subs.cend())
+    {
+        return subIt->second;
+    }
+
+    const auto subByteSize = data.size() * sizeof(float);
+    chunk.byteSize += subByteSize;
+    m_cachedByteSize += subByteSize;
+
+    return chunk.subs.insert({keys.second, Sub{.data = std::move(data), .delivered = false}}).first->second;
+}
+
+void InfinitePerlinNoise::TouchChunk_Locked(Chunk& chunk)
+{
+    m_lru.splice(m_lru.begin(), m_lru, chunk.lruIt);
+}
+
+void InfinitePerlinNoise::EvictChunk_Locked(const ChunkKey& chunkKey)
+{
+    const auto it = m_chunks.find(chunkKey);
+    if (it == m_chunks.cend())
+    {
+        return;
+    }
+
+    // Let the user know about evicted subs they were previously given
+    for (const auto& subIt : it->second.subs)
+    {
+        if (subIt.second.delivered)
+        {
+            m_evictedSubs.emplace_back(chunkKey, subIt.first);
+        }
+    }
+
+    m_cachedByteSize -= it->second.byteSize;
+    m_lru.erase(it->second.lruIt);
+    m_chunks.erase(it);
+}
+
+void InfinitePerlinNoise::EnforceMemoryBudget_Locked()
+{
+    if (m_config.memoryBudgetBytes == 0) { return; }
+
+    // Evict least recently used chunks until we're within budget, but never the most recently
+    // used chunk, which is the one that was just accessed
+    while (m_cachedByteSize > m_config.memoryBudgetBytes && m_lru.size() > 1)
+    {
+        EvictChunk_Locked(m_lru.back());
+    }
+}
+
+bool InfinitePerlinNoise::IsChunkOutsideDistance(const ChunkKey& chunkKey, const glm::vec2& pos, float distance) const
+{
+    const glm::vec2 chunkPos = {(float)chunkKey.x * (float)m_perlinSize, (float)chunkKey.y * (float)m_perlinSize};
+
+    const std::vector<glm::vec2> chunkPoints = {
+        {chunkPos.x, chunkPos.y},
+        {chunkPos.x + m_perlinSize, chunkPos.y},
+        {chunkPos.x + m_perlinSize, chunkPos.y + m_perlinSize},
+        {chunkPos.x, chunkPos.y + m_perlinSize}
+    };
+
+    return std::ranges::all_of(chunkPoints, [&](const auto& chunkPoint){
+        return glm::distance(chunkPoint, pos) > distance;
+    });
+}
+
 std::vector<InfinitePerlinNoise::ChunkKey> InfinitePerlinNoise::GetAllChunksOutsideDistance(const glm::vec2& pos, float distance) const
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     std::vector<ChunkKey> chunks;
 
     for (const auto& chunk : m_chunks)
     {
-        const std::vector<glm::vec2> chunkPoints = {
-            {chunk.first.x, chunk.first.y},
-            {chunk.first.x + m_perlinSize, chunk.first.y},
-            {chunk.first.x + m_perlinSize, chunk.first.y + m_perlinSize},
-            {chunk.first.x, chunk.first.y + m_perlinSize}
-        };
-
-        if (std::ranges::all_of(chunkPoints, [&](const auto& chunkPoint){
-            return glm::distance(chunkPoint, pos) > distance;
-        }))
+        if (IsChunkOutsideDistance(chunk.first, pos, distance))
         {
             chunks.push_back(chunk.first);
         }
@@ -196,8 +435,22 @@ std::vector<InfinitePerlinNoise::ChunkKey> InfinitePerlinNoise::GetAllChunksOuts
     return chunks;
 }
 
+void InfinitePerlinNoise::EvictChunksOutsideDistance(const glm::vec2& pos, float distance)
+{
+    const auto chunkKeys = GetAllChunksOutsideDistance(pos, distance);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& chunkKey : chunkKeys)
+    {
+        EvictChunk_Locked(chunkKey);
+    }
+}
+
 void InfinitePerlinNoise::FreeSubImage(const Keys& keys)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     const auto it = m_chunks.find(keys.first);
     if (it == m_chunks.cend())
     {
@@ -205,13 +458,40 @@ void InfinitePerlinNoise::FreeSubImage(const Keys& keys)
     }
 
     // Erase the sub-chunk
-    it->second.subs.erase(keys.second);
+    const auto subIt = it->second.subs.find(keys.second);
+    if (subIt != it->second.subs.cend())
+    {
+        const auto subByteSize = subIt->second.data.size() * sizeof(float);
+        it->second.byteSize -= subByteSize;
+        m_cachedByteSize -= subByteSize;
+
+        it->second.subs.erase(subIt);
+    }
 
     // If the chunk itself is now empty, erase it too
     if (it->second.subs.empty())
     {
-        m_chunks.erase(keys.first);
+        m_cachedByteSize -= it->second.byteSize;
+        m_lru.erase(it->second.lruIt);
+        m_chunks.erase(it);
     }
 }
 
+std::vector<InfinitePerlinNoise::Keys> InfinitePerlinNoise::PopEvictedSubChunks()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<Keys> evicted;
+    std::swap(evicted, m_evictedSubs);
+
+    return evicted;
+}
+
+std::size_t InfinitePerlinNoise::GetCachedByteSize() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_cachedByteSize;
+}
+
 }
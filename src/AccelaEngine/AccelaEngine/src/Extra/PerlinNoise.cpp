@@ -7,6 +7,7 @@
 #include <Accela/Engine/Extra/PerlinNoise.h>
 
 #include <random>
+#include <numbers>
 
 namespace Accela::Engine
 {
@@ -20,6 +21,15 @@ static inline float SCurve(float t)
     return t*t*(3-2*t);
 }
 
+static inline uint64_t MixBits(uint64_t x)
+{
+    // splitmix64 finalizer
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
 PerlinNoise::PerlinNoise(unsigned int size)
     : m_size(size)
     , m_gridSize(m_size + 1)
@@ -27,6 +37,13 @@ PerlinNoise::PerlinNoise(unsigned int size)
     GenerateGridVectors();
 }
 
+PerlinNoise::PerlinNoise(unsigned int size, uint64_t seed, const std::pair<int64_t, int64_t>& latticeOffset)
+    : m_size(size)
+    , m_gridSize(m_size + 1)
+{
+    GenerateGridVectors(seed, latticeOffset);
+}
+
 float PerlinNoise::operator()(const glm::vec2& p) const
 {
     return Get(p);
@@ -54,6 +71,31 @@ void PerlinNoise::GenerateGridVectors()
     }
 }
 
+void PerlinNoise::GenerateGridVectors(uint64_t seed, const std::pair<int64_t, int64_t>& latticeOffset)
+{
+    //
+    // Generate an m_gridSize x m_gridSize grid of 2D unit vectors, each of which is a pure function
+    // of the seed and the grid point's position within the overall lattice
+    //
+    m_grid = std::vector<glm::vec2>(m_gridSize * m_gridSize, {0,0});
+
+    for (unsigned int y = 0; y < m_gridSize; ++y)
+    {
+        for (unsigned int x = 0; x < m_gridSize; ++x)
+        {
+            const auto latticeX = static_cast<uint64_t>(latticeOffset.first + static_cast<int64_t>(x));
+            const auto latticeY = static_cast<uint64_t>(latticeOffset.second + static_cast<int64_t>(y));
+
+            const auto hash = MixBits(MixBits(seed ^ latticeX) ^ (latticeY * 0x9e3779b97f4a7c15ULL));
+
+            // Top 24 bits of the hash -> angle in [0, 2pi)
+            const float angle = static_cast<float>(hash >> 40) / static_cast<float>(1U << 24) * 2.0f * std::numbers::pi_v<float>;
+
+            m_grid[x + (y * m_gridSize)] = glm::vec2(std::cos(angle), std::sin(angle));
+        }
+    }
+}
+
 float PerlinNoise::Get(const glm::vec2& p) const
 {
     if (p.x < 0.0f) { return 0.0f; }
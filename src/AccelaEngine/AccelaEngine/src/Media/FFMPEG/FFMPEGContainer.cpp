@@ -52,6 +52,10 @@ namespace Accela::Engine
 static constexpr auto MIN_SYNC_ADJUSTMENT_LEVEL = std::chrono::duration_cast<MediaDuration>(
     std::chrono::milliseconds(5));
 
+// Max number of unused video frame buffers to keep around for re-use. Should cover the number of
+// decoded frames which are typically queued up ahead of presentation.
+static constexpr std::size_t MAX_FREE_VIDEO_FRAME_BUFFERS = 16;
+
 static enum AVPixelFormat GetHWFormat(AVCodecContext *ctx, const enum AVPixelFormat *pix_fmts)
 {
     const AVPixelFormat *pHWPixelFormat = (AVPixelFormat *) ctx->opaque;
@@ -74,6 +78,7 @@ static enum AVPixelFormat GetHWFormat(AVCodecContext *ctx, const enum AVPixelFor
 FFMPEGContainer::FFMPEGContainer(Common::ILogger::Ptr logger, Config config)
     : m_logger(std::move(logger))
     , m_config(config)
+    , m_videoFramePool(std::make_shared<VideoFramePool>(MAX_FREE_VIDEO_FRAME_BUFFERS))
 {
 
 }
@@ -559,6 +564,8 @@ void FFMPEGContainer::Destroy()
         avformat_close_input(&m_pFormatContext);
     }
 
+    m_videoFramePool->Clear();
+
     //
     // Reset state
     //
@@ -1134,21 +1141,31 @@ std::vector<Common::ImageData::Ptr> FFMPEGContainer::ReceiveImageDatasFromFilter
         const auto imageWidth = pStream->pFiltFrame->width;
         const auto imageHeight = pStream->pFiltFrame->height;
         const auto bytesPerPixel = 4;
+        const auto rowByteSize = imageWidth * bytesPerPixel;
 
-        std::vector<std::byte> imageBytes(imageWidth * imageHeight * bytesPerPixel);
+        // Copy the filtered frame's pixels into a recycled buffer, which is then handed off to the
+        // ImageData (and from there to the renderer) without any further copies
+        auto imageBytes = m_videoFramePool->AcquireBuffer(rowByteSize * imageHeight);
 
-        for (int y = 0; y < std::abs(pStream->pFiltFrame->height); ++y)
+        if (pStream->pFiltFrame->linesize[0] == rowByteSize)
         {
-            memcpy(imageBytes.data() + (y * pStream->pFiltFrame->width * bytesPerPixel),
-                   pStream->pFiltFrame->data[0] + (y * pStream->pFiltFrame->linesize[0]),
-                   pStream->pFiltFrame->width * bytesPerPixel);
+            // Rows are tightly packed; copy the whole image at once
+            memcpy(imageBytes.data(), pStream->pFiltFrame->data[0], imageBytes.size());
+        }
+        else
+        {
+            for (int y = 0; y < std::abs(pStream->pFiltFrame->height); ++y)
+            {
+                memcpy(imageBytes.data() + (y * rowByteSize),
+                       pStream->pFiltFrame->data[0] + (y * pStream->pFiltFrame->linesize[0]),
+                       rowByteSize);
+            }
         }
 
         av_frame_unref(pStream->pFiltFrame);
 
-        imageDatas.push_back(std::make_shared<Common::ImageData>(
-            imageBytes,
-            1,
+        imageDatas.push_back(m_videoFramePool->CreateImage(
+            std::move(imageBytes),
             imageWidth,
             imageHeight,
             Common::ImageData::PixelFormat::RGBA32
@@ -11,6 +11,7 @@
 #include "FilterGraphConfig.h"
 
 #include "../MediaCommon.h"
+#include "../VideoFramePool.h"
 
 #include <Accela/Common/Log/ILogger.h>
 
@@ -181,6 +182,7 @@ namespace Accela::Engine
 
             // Pre-allocated work buffers
             AVPacket* m_pPacket{nullptr};
+            VideoFramePool::Ptr m_videoFramePool;
 
             bool m_eof{false};
 
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "VideoFramePool.h"
+
+namespace Accela::Engine
+{
+
+VideoFramePool::VideoFramePool(std::size_t maxFreeBuffersPerSize)
+    : m_maxFreeBuffersPerSize(maxFreeBuffersPerSize)
+{
+
+}
+
+std::vector<std::byte> VideoFramePool::AcquireBuffer(std::size_t byteSize)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const auto it = m_freeBuffers.find(byteSize);
+        if (it != m_freeBuffers.cend() && !it->second.empty())
+        {
+            auto buffer = std::move(it->second.back());
+            it->second.pop_back();
+            return buffer;
+        }
+    }
+
+    return std::vector<std::byte>(byteSize);
+}
+
+Common::ImageData::Ptr VideoFramePool::CreateImage(std::vector<std::byte> buffer,
+                                                   std::size_t pixelWidth,
+                                                   std::size_t pixelHeight,
+                                                   Common::ImageData::PixelFormat pixelFormat)
+{
+    return std::make_shared<Common::ImageData>(
+        std::move(buffer),
+        1,
+        pixelWidth,
+        pixelHeight,
+        pixelFormat,
+        [pool = weak_from_this()](std::vector<std::byte>&& pixelBytes){
+            if (const auto pPool = pool.lock())
+            {
+                pPool->ReturnBuffer(std::move(pixelBytes));
+            }
+        }
+    );
+}
+
+void VideoFramePool::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_freeBuffers.clear();
+}
+
+void VideoFramePool::ReturnBuffer(std::vector<std::byte>&& buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& freeBuffers = m_freeBuffers[buffer.size()];
+
+    if (freeBuffers.size() < m_maxFreeBuffersPerSize)
+    {
+        freeBuffers.push_back(std::move(buffer));
+    }
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef ACCELAENGINE_ACCELAENGINE_SRC_MEDIA_VIDEOFRAMEPOOL_H
+#define ACCELAENGINE_ACCELAENGINE_SRC_MEDIA_VIDEOFRAMEPOOL_H
+
+#include <Accela/Common/ImageData.h>
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <cstddef>
+
+namespace Accela::Engine
+{
+    /**
+     * Pool of recycled pixel buffers for decoded video frames.
+     *
+     * Buffers are pooled by byte size, which is fixed for a given video resolution and pixel format. Images
+     * created from the pool hand their buffer back to the pool when they're destroyed (typically after the
+     * renderer has consumed them), so that steady-state playback doesn't allocate a new buffer per frame.
+     *
+     * Thread safe; images may be released from any thread, and may outlive the pool, in which case their
+     * buffers are simply freed.
+     */
+    class VideoFramePool : public std::enable_shared_from_this<VideoFramePool>
+    {
+        public:
+
+            using Ptr = std::shared_ptr<VideoFramePool>;
+
+        public:
+
+            /**
+             * @param maxFreeBuffersPerSize The maximum number of unused buffers of any given size to hold on to
+             */
+            explicit VideoFramePool(std::size_t maxFreeBuffersPerSize);
+
+            /**
+             * @return A buffer of exactly byteSize bytes, either recycled or newly allocated. Contents are undefined.
+             */
+            [[nodiscard]] std::vector<std::byte> AcquireBuffer(std::size_t byteSize);
+
+            /**
+             * Wraps a buffer previously returned by AcquireBuffer in an ImageData, without copying it. The buffer
+             * is returned to the pool when the ImageData is destroyed.
+             */
+            [[nodiscard]] Common::ImageData::Ptr CreateImage(std::vector<std::byte> buffer,
+                                                             std::size_t pixelWidth,
+                                                             std::size_t pixelHeight,
+                                                             Common::ImageData::PixelFormat pixelFormat);
+
+            /**
+             * Frees all unused buffers. Buffers of images which are still alive are returned to the pool as normal.
+             */
+            void Clear();
+
+        private:
+
+            void ReturnBuffer(std::vector<std::byte>&& buffer);
+
+        private:
+
+            std::size_t m_maxFreeBuffersPerSize;
+
+            std::mutex m_mutex;
+            std::unordered_map<std::size_t, std::vector<std::vector<std::byte>>> m_freeBuffers;
+    };
+}
+
+#endif //ACCELAENGINE_ACCELAENGINE_SRC_MEDIA_VIDEOFRAMEPOOL_H
@@ -21,6 +21,9 @@ namespace Accela::Engine
     static constexpr char Engine_Physics_Scene_Count[] = "Engine_Physics_Scene_Count";
     static constexpr char Engine_Physics_Static_Rigid_Bodies_Count[] = "Engine_Physics_Static_Rigid_Bodies_Count";
     static constexpr char Engine_Physics_Dynamic_Rigid_Bodies_Count[] = "Engine_Physics_Dynamic_Rigid_Bodies_Count";
+    static constexpr char Engine_Physics_Moved_Rigid_Bodies_Count[] = "Engine_Physics_Moved_Rigid_Bodies_Count";
+    static constexpr char Engine_Physics_Cooked_Mesh_Count[] = "Engine_Physics_Cooked_Mesh_Count";
+    static constexpr char Engine_Physics_Scene_Query_Batch_Size[] = "Engine_Physics_Scene_Query_Batch_Size";
 }
 
 #endif //LIBACCELAENGINE_SRC_METRICS_H
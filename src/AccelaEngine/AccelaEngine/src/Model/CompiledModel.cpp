@@ -0,0 +1,302 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "CompiledModel.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <queue>
+#include <algorithm>
+
+namespace Accela::Engine
+{
+
+static CompiledSkeleton CompileSkeleton(const ModelMesh& modelMesh, const ModelNode::Ptr& skeletonRoot)
+{
+    CompiledSkeleton skeleton{};
+
+    // Breadth-first walk of the skeleton's sub-tree, which guarantees parents are output before their children
+    std::queue<std::pair<ModelNode::Ptr, int>> toProcess;
+    toProcess.emplace(skeletonRoot, -1);
+
+    while (!toProcess.empty())
+    {
+        const auto [node, parentJoint] = toProcess.front();
+        toProcess.pop();
+
+        CompiledSkeleton::Joint joint{};
+        joint.nodeId = node->id;
+        joint.parentJoint = parentJoint;
+
+        const auto boneIt = modelMesh.boneMap.find(node->name);
+        if (boneIt != modelMesh.boneMap.cend())
+        {
+            joint.boneIndex = boneIt->second.boneIndex;
+            joint.inverseBindMatrix = boneIt->second.inverseBindMatrix;
+        }
+
+        const auto jointIndex = (int)skeleton.joints.size();
+        skeleton.joints.push_back(joint);
+
+        for (const auto& child : node->children)
+        {
+            toProcess.emplace(child, jointIndex);
+        }
+    }
+
+    return skeleton;
+}
+
+static CompiledAnimation CompileAnimation(const ModelAnimation& animation,
+                                          const std::vector<unsigned int>& nodeOrder,
+                                          const std::unordered_map<unsigned int, ModelNode::Ptr>& nodeMap)
+{
+    CompiledAnimation compiled{};
+    compiled.animationName = animation.animationName;
+    compiled.animationDurationTicks = animation.animationDurationTicks;
+    compiled.animationTicksPerSecond = animation.animationTicksPerSecond;
+
+    //
+    // Create a channel for every node that the animation has keyframes for. Keyframes are matched
+    // to nodes by name, so this is the only place where node names are looked at.
+    //
+    for (const auto& nodeId : nodeOrder)
+    {
+        const auto keyFramesIt = animation.nodeKeyFrameMap.find(nodeMap.at(nodeId)->name);
+        if (keyFramesIt == animation.nodeKeyFrameMap.cend())
+        {
+            continue;
+        }
+
+        const auto& keyFrames = keyFramesIt->second;
+
+        compiled.channelNodeIds.push_back(nodeId);
+
+        compiled.positionRanges.push_back({(uint32_t)compiled.positionTimes.size(), (uint32_t)keyFrames.positionKeyFrames.size()});
+        for (const auto& keyFrame : keyFrames.positionKeyFrames)
+        {
+            compiled.positionTimes.push_back(keyFrame.animationTime);
+            compiled.positionValues.push_back(keyFrame.position);
+        }
+
+        compiled.rotationRanges.push_back({(uint32_t)compiled.rotationTimes.size(), (uint32_t)keyFrames.rotationKeyFrames.size()});
+        for (const auto& keyFrame : keyFrames.rotationKeyFrames)
+        {
+            compiled.rotationTimes.push_back(keyFrame.animationTime);
+            compiled.rotationValues.push_back(glm::normalize(keyFrame.rotation));
+        }
+
+        compiled.scaleRanges.push_back({(uint32_t)compiled.scaleTimes.size(), (uint32_t)keyFrames.scaleKeyFrames.size()});
+        for (const auto& keyFrame : keyFrames.scaleKeyFrames)
+        {
+            compiled.scaleTimes.push_back(keyFrame.animationTime);
+            compiled.scaleValues.push_back(keyFrame.scale);
+        }
+    }
+
+    return compiled;
+}
+
+CompiledModel::Ptr CompiledModel::Compile(const Model::Ptr& model)
+{
+    auto compiled = std::make_shared<CompiledModel>();
+
+    //
+    // Node hierarchy
+    //
+    std::size_t numNodes = 0;
+
+    for (const auto& nodeIt : model->nodeMap)
+    {
+        numNodes = std::max(numNodes, (std::size_t)nodeIt.first + 1);
+    }
+
+    compiled->nodeParents = std::vector<int>(numNodes, -1);
+    compiled->nodeLocalTransforms = std::vector<glm::mat4>(numNodes, glm::mat4(1));
+
+    for (const auto& nodeIt : model->nodeMap)
+    {
+        if (const auto parent = nodeIt.second->parent.lock())
+        {
+            compiled->nodeParents[nodeIt.first] = (int)parent->id;
+        }
+
+        compiled->nodeLocalTransforms[nodeIt.first] = nodeIt.second->localTransform;
+    }
+
+    if (model->rootNode)
+    {
+        std::queue<ModelNode::Ptr> toProcess;
+        toProcess.push(model->rootNode);
+
+        while (!toProcess.empty())
+        {
+            const ModelNode::Ptr node = toProcess.front();
+            toProcess.pop();
+
+            compiled->nodeOrder.push_back(node->id);
+
+            for (const auto& child : node->children)
+            {
+                toProcess.push(child);
+            }
+        }
+    }
+
+    //
+    // Node meshes and their skeletons
+    //
+    for (const auto& nodeId : model->nodesWithMeshes)
+    {
+        const ModelNode::Ptr node = model->nodeMap.at(nodeId);
+
+        unsigned int nodeMeshIndex = 0;
+
+        for (const auto& modelMeshIndex : node->meshIndices)
+        {
+            const ModelMesh& modelMesh = model->meshes.at(modelMeshIndex);
+
+            CompiledNodeMesh nodeMesh{};
+            nodeMesh.nodeId = nodeId;
+            nodeMesh.nodeMeshIndex = nodeMeshIndex++;
+            nodeMesh.modelMeshIndex = modelMeshIndex;
+            nodeMesh.numBones = modelMesh.boneMap.size();
+
+            const auto skeletonRootIt = node->meshSkeletonRoots.find(modelMeshIndex);
+            if (nodeMesh.numBones > 0 && skeletonRootIt != node->meshSkeletonRoots.cend())
+            {
+                nodeMesh.skeleton = CompileSkeleton(modelMesh, skeletonRootIt->second);
+            }
+
+            compiled->nodeMeshes.push_back(nodeMesh);
+        }
+    }
+
+    //
+    // Animations
+    //
+    for (const auto& animationIt : model->animations)
+    {
+        compiled->animations.insert({animationIt.first, CompileAnimation(animationIt.second, compiled->nodeOrder, model->nodeMap)});
+    }
+
+    return compiled;
+}
+
+/**
+ * Finds the index, i, of the keyframe pair [i, i+1] which the animation time falls between. Times
+ * before the first keyframe map to the first pair, and times after the last keyframe map to the last pair.
+ *
+ * @param pTimes The keyframe times, sorted ascending
+ * @param count The number of keyframes; must be at least 2
+ * @param animationTime The animation time to look up
+ * @param hint The pair index used by the previous lookup
+ */
+static uint32_t FindKeyFramePair(const double* pTimes, const uint32_t& count, const double& animationTime, const uint32_t& hint)
+{
+    const uint32_t lastPair = count - 2;
+
+    //
+    // Check the hinted pair, and the pair after it, before falling back to searching
+    //
+    if (hint <= lastPair)
+    {
+        if (animationTime >= pTimes[hint] && animationTime < pTimes[hint + 1])
+        {
+            return hint;
+        }
+
+        if (hint + 1 <= lastPair && animationTime >= pTimes[hint + 1] && animationTime < pTimes[hint + 2])
+        {
+            return hint + 1;
+        }
+    }
+
+    // Find the first interior keyframe with a time after the animation time; the pair starts at the keyframe before it
+    const auto it = std::upper_bound(pTimes + 1, pTimes + count - 1, animationTime);
+
+    return (uint32_t)(it - pTimes) - 1;
+}
+
+static float GetInterpolationFactor(const double& lastTimeStamp, const double& nextTimeStamp, const double& animationTime)
+{
+    const auto framesDiff = nextTimeStamp - lastTimeStamp;
+    if (framesDiff <= 0.0)
+    {
+        return 0.0f;
+    }
+
+    return std::clamp((float)((animationTime - lastTimeStamp) / framesDiff), 0.0f, 1.0f);
+}
+
+template <typename T, typename InterpolateFunc>
+static T SampleKeyFrames(const std::vector<double>& times,
+                         const std::vector<T>& values,
+                         const KeyFrameRange& range,
+                         const double& animationTime,
+                         uint32_t& cursorKey,
+                         const T& defaultValue,
+                         const InterpolateFunc& interpolate)
+{
+    if (range.count == 0) { return defaultValue; }
+    if (range.count == 1) { return values[range.offset]; }
+
+    const uint32_t pairIndex = FindKeyFramePair(times.data() + range.offset, range.count, animationTime, cursorKey);
+    cursorKey = pairIndex;
+
+    const auto keyIndex = range.offset + pairIndex;
+
+    const float factor = GetInterpolationFactor(times[keyIndex], times[keyIndex + 1], animationTime);
+
+    return interpolate(values[keyIndex], values[keyIndex + 1], factor);
+}
+
+std::vector<glm::mat4> CompiledModel::EvaluateAnimation(const CompiledAnimation& animation,
+                                                        const double& animationTime,
+                                                        AnimationCursor& cursor) const
+{
+    // Nodes which aren't animated keep their bind local transform
+    std::vector<glm::mat4> localTransforms = nodeLocalTransforms;
+
+    const auto numChannels = animation.channelNodeIds.size();
+
+    if (cursor.positionKeys.size() != numChannels)
+    {
+        cursor.positionKeys.assign(numChannels, 0);
+        cursor.rotationKeys.assign(numChannels, 0);
+        cursor.scaleKeys.assign(numChannels, 0);
+    }
+
+    for (std::size_t channel = 0; channel < numChannels; ++channel)
+    {
+        const glm::vec3 position = SampleKeyFrames(
+            animation.positionTimes, animation.positionValues, animation.positionRanges[channel],
+            animationTime, cursor.positionKeys[channel], glm::vec3(0),
+            [](const glm::vec3& a, const glm::vec3& b, float factor){ return glm::mix(a, b, factor); }
+        );
+
+        const glm::quat rotation = SampleKeyFrames(
+            animation.rotationTimes, animation.rotationValues, animation.rotationRanges[channel],
+            animationTime, cursor.rotationKeys[channel], glm::quat(1.0f, 0.0f, 0.0f, 0.0f),
+            [](const glm::quat& a, const glm::quat& b, float factor){ return glm::normalize(glm::slerp(a, b, factor)); }
+        );
+
+        const glm::vec3 scale = SampleKeyFrames(
+            animation.scaleTimes, animation.scaleValues, animation.scaleRanges[channel],
+            animationTime, cursor.scaleKeys[channel], glm::vec3(1),
+            [](const glm::vec3& a, const glm::vec3& b, float factor){ return glm::mix(a, b, factor); }
+        );
+
+        localTransforms[animation.channelNodeIds[channel]] =
+            glm::translate(glm::mat4(1.0f), position) *
+            glm::mat4_cast(rotation) *
+            glm::scale(glm::mat4(1.0f), scale);
+    }
+
+    return localTransforms;
+}
+
+}
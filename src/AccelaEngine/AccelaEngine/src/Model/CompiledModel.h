@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAENGINE_SRC_MODEL_COMPILEDMODEL_H
+#define LIBACCELAENGINE_SRC_MODEL_COMPILEDMODEL_H
+
+#include <Accela/Engine/Model/Model.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace Accela::Engine
+{
+    /**
+     * The keyframes of one type (position/rotation/scale) for one animation channel, as a
+     * range within the animation's flat keyframe arrays
+     */
+    struct KeyFrameRange
+    {
+        uint32_t offset{0};
+        uint32_t count{0};
+    };
+
+    /**
+     * A ModelAnimation compiled into a flat, structure-of-arrays form for fast evaluation.
+     *
+     * Channels are identified by node id rather than by node name, and each keyframe type's
+     * timestamps are stored contiguously (separately from their values) so that keyframe
+     * lookups are binary searches over tightly packed doubles.
+     */
+    struct CompiledAnimation
+    {
+        std::string animationName;
+        double animationDurationTicks{0};
+        double animationTicksPerSecond{0};
+
+        // channel index -> id of the node the channel animates
+        std::vector<unsigned int> channelNodeIds;
+
+        // channel index -> that channel's range of keyframes
+        std::vector<KeyFrameRange> positionRanges;
+        std::vector<KeyFrameRange> rotationRanges;
+        std::vector<KeyFrameRange> scaleRanges;
+
+        std::vector<double> positionTimes;
+        std::vector<glm::vec3> positionValues;
+
+        std::vector<double> rotationTimes;
+        std::vector<glm::quat> rotationValues;
+
+        std::vector<double> scaleTimes;
+        std::vector<glm::vec3> scaleValues;
+    };
+
+    /**
+     * Remembers, per animation channel, the keyframes that were last used when evaluating an
+     * animation. As animations almost always advance by less than one keyframe between
+     * evaluations, this lets most keyframe lookups skip searching entirely.
+     *
+     * Cursor entries are only ever used as hints and are validated before use, so a cursor
+     * that's stale (e.g. the entity switched animations) merely costs a search.
+     */
+    struct AnimationCursor
+    {
+        std::vector<uint32_t> positionKeys;
+        std::vector<uint32_t> rotationKeys;
+        std::vector<uint32_t> scaleKeys;
+    };
+
+    /**
+     * A skeleton compiled into a flat array of the nodes in the skeleton's sub-tree, ordered
+     * such that every node comes after its parent.
+     */
+    struct CompiledSkeleton
+    {
+        struct Joint
+        {
+            unsigned int nodeId{0};
+            int parentJoint{-1};                    // Index of the parent joint, or -1 for the skeleton root
+            std::optional<unsigned int> boneIndex;  // Index of the bone the node drives, if any
+            glm::mat4 inverseBindMatrix{1};
+        };
+
+        std::vector<Joint> joints;
+    };
+
+    /**
+     * A mesh attached to a node, along with the skeleton that drives it, if any
+     */
+    struct CompiledNodeMesh
+    {
+        unsigned int nodeId{0};
+        unsigned int nodeMeshIndex{0};      // Index of the mesh within the node's mesh list
+        unsigned int modelMeshIndex{0};     // Index of the mesh within the model's meshes
+        std::size_t numBones{0};            // Number of bones in the mesh's bone map, 0 if the mesh isn't skinned
+        std::optional<CompiledSkeleton> skeleton;
+    };
+
+    /**
+     * Pre-processed form of a Model's node hierarchy and animations, computed once when the model
+     * is registered, which allows for posing the model without any node name lookups or
+     * pointer-chasing through the node graph.
+     */
+    struct CompiledModel
+    {
+        using Ptr = std::shared_ptr<CompiledModel>;
+
+        /**
+         * Compile the provided model
+         */
+        [[nodiscard]] static CompiledModel::Ptr Compile(const Model::Ptr& model);
+
+        /**
+         * Evaluates an animation at the given time, returning the local transform of every node,
+         * indexed by node id. Nodes which the animation doesn't animate take their bind local transform.
+         *
+         * @param animation The animation to evaluate
+         * @param animationTime The animation time, in ticks
+         * @param cursor Keyframe cursor to read and update keyframe hints from/to
+         */
+        [[nodiscard]] std::vector<glm::mat4> EvaluateAnimation(const CompiledAnimation& animation,
+                                                               const double& animationTime,
+                                                               AnimationCursor& cursor) const;
+
+        // node id -> parent node id, or -1 for root nodes
+        std::vector<int> nodeParents;
+
+        // Node ids, ordered such that every node comes after its parent
+        std::vector<unsigned int> nodeOrder;
+
+        // node id -> the node's bind local transform
+        std::vector<glm::mat4> nodeLocalTransforms;
+
+        // All meshes attached to all nodes in the model
+        std::vector<CompiledNodeMesh> nodeMeshes;
+
+        // animation name -> compiled animation
+        std::unordered_map<std::string, CompiledAnimation> animations;
+    };
+}
+
+#endif //LIBACCELAENGINE_SRC_MODEL_COMPILEDMODEL_H
@@ -56,7 +56,7 @@ class PackageIOSystem : public Assimp::IOSystem
 
             if (!m_fileContents.contains(fileStr))
             {
-                std::expected<std::vector<std::byte>, unsigned int> modelData = m_source->GetModelData(pFile);
+                const auto modelData = m_source->GetModelData(pFile);
                 if (!modelData)
                 {
                     return nullptr;
@@ -67,7 +67,7 @@ class PackageIOSystem : public Assimp::IOSystem
 
             const auto& fileBytes = m_fileContents.at(fileStr);
 
-            return new Assimp::MemoryIOStream((const uint8_t*)fileBytes.data(), fileBytes.size(), false);
+            return new Assimp::MemoryIOStream((const uint8_t*)fileBytes.GetData(), fileBytes.GetByteSize(), false);
         }
 
         [[nodiscard]] char getOsSeparator() const override
@@ -85,7 +85,7 @@ class PackageIOSystem : public Assimp::IOSystem
         Platform::PackageSource::Ptr m_source;
 
         // Cache of file contents as assimp often calls Open/Close flows a lot of times for the same file
-        std::unordered_map<std::string, std::vector<std::byte>> m_fileContents;
+        std::unordered_map<std::string, Platform::PackageData> m_fileContents;
 };
 
 ModelLoader::ModelLoader(Common::ILogger::Ptr logger)
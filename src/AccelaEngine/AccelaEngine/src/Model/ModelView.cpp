@@ -8,9 +8,6 @@
 
 #include <glm/glm.hpp>
 
-#include <queue>
-#include <algorithm>
-
 namespace Accela::Engine
 {
 
@@ -59,33 +56,40 @@ ModelPose ModelView::BindPose() const
     return pose;
 }
 
-std::optional<ModelPose> ModelView::AnimationPose(const std::string& animationName, const double& animationTime) const
+std::optional<ModelPose> ModelView::AnimationPose(const std::string& animationName,
+                                                 const double& animationTime,
+                                                 AnimationCursor& cursor) const
 {
-    const auto it = m_registeredModel.model->animations.find(animationName);
-    if (it == m_registeredModel.model->animations.cend())
+    const auto& compiledModel = m_registeredModel.compiledModel;
+
+    const auto it = compiledModel->animations.find(animationName);
+    if (it == compiledModel->animations.cend())
     {
         return std::nullopt;
     }
 
-    return Pose(GetAnimationLocalTransforms(it->second, animationTime));
+    return Pose(compiledModel->EvaluateAnimation(it->second, animationTime, cursor));
 }
 
 ModelPose ModelView::Pose(const std::vector<glm::mat4>& localTransforms) const
 {
+    const auto& compiledModel = m_registeredModel.compiledModel;
+
     ModelPose pose{};
 
     //
-    // FulfillByFunc node local transforms to determine the global transform for each node in the model
+    // Combine node local transforms to determine the global transform for each node in the model. Nodes
+    // are visited in parent-first order, so each node's parent global transform is always already known.
     //
     std::vector<glm::mat4> globalTransforms(localTransforms.size(), glm::mat4(1));
 
-    for (unsigned int nodeId = 0; nodeId < localTransforms.size(); ++nodeId)
+    for (const auto& nodeId : compiledModel->nodeOrder)
     {
-        const auto node = m_registeredModel.model->nodeMap[nodeId];
+        const auto parentNodeId = compiledModel->nodeParents[nodeId];
 
-        if (const auto nodeParent = node->parent.lock())
+        if (parentNodeId >= 0)
         {
-            globalTransforms[nodeId] = globalTransforms[nodeParent->id] * localTransforms[nodeId];
+            globalTransforms[nodeId] = globalTransforms[parentNodeId] * localTransforms[nodeId];
         }
         else
         {
@@ -93,253 +97,72 @@ ModelPose ModelView::Pose(const std::vector<glm::mat4>& localTransforms) const
         }
     }
 
-    //
-    // Fetch skeleton data using the current node transforms
-    //
-    const auto skeletonMap = CalculateNodeSkeletons(localTransforms);
-
     //
     // Create mesh renderables for all meshes that are attached to all nodes
     //
-    unsigned int meshCounter = 0;
-
-    for (const auto& nodeId : m_registeredModel.model->nodesWithMeshes)
+    for (const auto& nodeMesh : compiledModel->nodeMeshes)
     {
-        const ModelNode::Ptr node = m_registeredModel.model->nodeMap[nodeId];
+        MeshPoseData poseData{};
+        poseData.id = {nodeMesh.nodeId, nodeMesh.nodeMeshIndex};
+        poseData.modelMesh = m_registeredModel.loadedMeshes.at(nodeMesh.modelMeshIndex);
+        poseData.nodeTransform = globalTransforms[nodeMesh.nodeId];
 
-        for (const auto& modelMeshIndex : node->meshIndices)
+        if (nodeMesh.numBones > 0)
         {
-            const ModelMesh& modelMesh = m_registeredModel.model->meshes.at(modelMeshIndex);
-            const LoadedModelMesh& loadedModelMesh = m_registeredModel.loadedMeshes.at(modelMeshIndex);
-            const auto meshHasSkeleton = !modelMesh.boneMap.empty();
+            BoneMesh boneMesh;
+            boneMesh.meshPoseData = poseData;
+            boneMesh.boneTransforms = CalculateBoneTransforms(nodeMesh, localTransforms);
 
-            MeshPoseData poseData{};
-            poseData.id = {nodeId, meshCounter++};
-            poseData.modelMesh = loadedModelMesh;
-            poseData.nodeTransform = globalTransforms[node->id];
-
-            if (meshHasSkeleton)
-            {
-                BoneMesh boneMesh;
-                boneMesh.meshPoseData = poseData;
-                boneMesh.boneTransforms = skeletonMap.at(node->id);
-
-                pose.boneMeshes.push_back(boneMesh);
-            }
-            else
-            {
-                pose.meshPoseDatas.push_back(poseData);
-            }
+            pose.boneMeshes.push_back(boneMesh);
         }
-    }
-
-    return pose;
-}
-
-std::unordered_map<unsigned int, std::vector<glm::mat4>> ModelView::CalculateNodeSkeletons(
-    const std::vector<glm::mat4>& localTransforms) const
-{
-    std::unordered_map<unsigned int, std::vector<glm::mat4>> nodeSkeletons;
-
-    //
-    // For all nodes with a mesh with a skeleton, calculate the current bone transforms for that skeleton
-    //
-    for (const auto& nodeId : m_registeredModel.model->nodesWithMeshes)
-    {
-        const ModelNode::Ptr node = m_registeredModel.model->nodeMap[nodeId];
-
-        for (const auto& skeletonRootIt : node->meshSkeletonRoots)
+        else
         {
-            nodeSkeletons.insert(std::make_pair(nodeId, CalculateNodeSkeletons(localTransforms, skeletonRootIt.first, skeletonRootIt.second)));
+            pose.meshPoseDatas.push_back(poseData);
         }
     }
 
-    return nodeSkeletons;
+    return pose;
 }
 
-std::vector<glm::mat4>
-ModelView::CalculateNodeSkeletons(const std::vector<glm::mat4>& localTransforms,
-                                  const unsigned int& meshIndex,
-                                  const ModelNode::Ptr& skeletonRoot) const
+std::vector<glm::mat4> ModelView::CalculateBoneTransforms(const CompiledNodeMesh& nodeMesh,
+                                                          const std::vector<glm::mat4>& localTransforms)
 {
-    const ModelMesh& modelMesh = m_registeredModel.model->meshes[meshIndex];
-
-    const auto numSkeletonBones = modelMesh.boneMap.size();
-
-    std::vector<glm::mat4> boneTransforms(numSkeletonBones, glm::mat4(1));
-
-    std::queue<std::pair<ModelNode::Ptr, glm::mat4>> toProcess;
-    toProcess.emplace(skeletonRoot, glm::mat4(1));
+    std::vector<glm::mat4> boneTransforms(nodeMesh.numBones, glm::mat4(1));
 
-    while (!toProcess.empty())
+    // If the mesh's skeleton root couldn't be determined, leave it in its bind pose
+    if (!nodeMesh.skeleton)
     {
-        const std::pair<ModelNode::Ptr, glm::mat4> node = toProcess.front();
-        toProcess.pop();
-
-        const glm::mat4 nodeLocalTransform = localTransforms[node.first->id];
-        const glm::mat4 globalTransform = node.second * nodeLocalTransform;
-
-        const auto boneIt = modelMesh.boneMap.find(node.first->name);
-        if (boneIt != modelMesh.boneMap.cend())
-        {
-            boneTransforms[boneIt->second.boneIndex] = globalTransform * boneIt->second.inverseBindMatrix;
-        }
-
-        for (const auto& child : node.first->children)
-        {
-            toProcess.emplace(child, globalTransform);
-        }
+        return boneTransforms;
     }
 
-    return boneTransforms;
-}
-
-std::vector<glm::mat4>
-ModelView::GetAnimationLocalTransforms(const ModelAnimation& animation, const double& animationTime) const
-{
-    std::vector<glm::mat4> localTransforms(m_registeredModel.model->nodeMap.size());
+    //
+    // Combine the local transforms of the skeleton's nodes, relative to the skeleton root. Joints are
+    // ordered parent-first, so each joint's parent transform is always already known.
+    //
+    const auto& joints = nodeMesh.skeleton->joints;
 
-    std::queue<ModelNode::Ptr> toProcess;
-    toProcess.push(m_registeredModel.model->rootNode);
+    std::vector<glm::mat4> jointTransforms(joints.size());
 
-    while (!toProcess.empty())
+    for (std::size_t x = 0; x < joints.size(); ++x)
     {
-        const ModelNode::Ptr node = toProcess.front();
-        toProcess.pop();
-
-        const auto keyFramesIt = animation.nodeKeyFrameMap.find(node->name);
+        const auto& joint = joints[x];
 
-        if (keyFramesIt == animation.nodeKeyFrameMap.cend())
+        if (joint.parentJoint >= 0)
         {
-            localTransforms[node->id] = node->localTransform;
+            jointTransforms[x] = jointTransforms[joint.parentJoint] * localTransforms[joint.nodeId];
         }
         else
         {
-            const glm::mat4 positionTransform = InterpolatePosition(keyFramesIt->second, animationTime);
-            const glm::mat4 rotationTransform = InterpolateRotation(keyFramesIt->second, animationTime);
-            const glm::mat4 scaleTransform = InterpolateScale(keyFramesIt->second, animationTime);
-
-            localTransforms[node->id] = positionTransform * rotationTransform * scaleTransform;
-        }
-
-        for (const auto& child : node->children)
-        {
-            toProcess.push(child);
-        }
-    }
-
-    return localTransforms;
-}
-
-unsigned int ModelView::GetPositionKeyFrameIndex(const NodeKeyFrames& keyFrames, const double& animTime)
-{
-    for (unsigned int x = 0; x < keyFrames.positionKeyFrames.size() - 1; ++x)
-    {
-        if (animTime < keyFrames.positionKeyFrames[x + 1].animationTime)
-        {
-            return x;
-        }
-    }
-
-    return 0;
-}
-
-unsigned int ModelView::GetRotationKeyFrameIndex(const NodeKeyFrames& keyFrames, const double& animTime)
-{
-    for (unsigned int x = 0; x < keyFrames.rotationKeyFrames.size() - 1; ++x)
-    {
-        if (animTime < keyFrames.rotationKeyFrames[x + 1].animationTime)
-        {
-            return x;
+            jointTransforms[x] = localTransforms[joint.nodeId];
         }
-    }
 
-    return 0;
-}
-
-unsigned int ModelView::GetScaleKeyFrameIndex(const NodeKeyFrames& keyFrames, const double& animTime)
-{
-    for (unsigned int x = 0; x < keyFrames.scaleKeyFrames.size() - 1; ++x)
-    {
-        if (animTime < keyFrames.scaleKeyFrames[x + 1].animationTime)
+        if (joint.boneIndex)
         {
-            return x;
+            boneTransforms[*joint.boneIndex] = jointTransforms[x] * joint.inverseBindMatrix;
         }
     }
 
-    return 0;
-}
-
-float ModelView::GetScaleFactor(double lastTimeStamp, double nextTimeStamp, double animationTime)
-{
-    auto midWayLength = (float)(animationTime - lastTimeStamp);
-    auto framesDiff = (float)(nextTimeStamp - lastTimeStamp);
-    return midWayLength / framesDiff;
-}
-
-glm::mat4 ModelView::InterpolatePosition(const NodeKeyFrames& keyFrames, double animationTime)
-{
-    if (keyFrames.positionKeyFrames.size() == 1)
-    {
-        return glm::translate(glm::mat4(1.0f), keyFrames.positionKeyFrames[0].position);
-    }
-
-    int p0Index = (int)GetPositionKeyFrameIndex(keyFrames, animationTime);
-    int p1Index = p0Index + 1;
-
-    float scaleFactor = GetScaleFactor(keyFrames.positionKeyFrames[p0Index].animationTime,
-                                       keyFrames.positionKeyFrames[p1Index].animationTime,
-                                       animationTime);
-
-    glm::vec3 finalPosition = glm::mix(keyFrames.positionKeyFrames[p0Index].position,
-                                       keyFrames.positionKeyFrames[p1Index].position,
-                                       scaleFactor);
-
-    return glm::translate(glm::mat4(1.0f), finalPosition);
-}
-
-glm::mat4 ModelView::InterpolateRotation(const NodeKeyFrames& keyFrames, double animationTime)
-{
-    if (keyFrames.rotationKeyFrames.size() == 1)
-    {
-        auto rotation = glm::normalize(keyFrames.rotationKeyFrames[0].rotation);
-        return glm::mat4_cast(rotation);
-    }
-
-    int p0Index = (int)GetRotationKeyFrameIndex(keyFrames, animationTime);
-    int p1Index = p0Index + 1;
-
-    float scaleFactor = GetScaleFactor(keyFrames.rotationKeyFrames[p0Index].animationTime,
-                                       keyFrames.rotationKeyFrames[p1Index].animationTime,
-                                       animationTime);
-
-    glm::quat finalRotation = glm::slerp(keyFrames.rotationKeyFrames[p0Index].rotation,
-                                         keyFrames.rotationKeyFrames[p1Index].rotation,
-                                         scaleFactor);
-    finalRotation = glm::normalize(finalRotation);
-
-    return glm::mat4_cast(finalRotation);
-}
-
-glm::mat4 ModelView::InterpolateScale(const NodeKeyFrames& keyFrames, double animationTime)
-{
-    if (keyFrames.scaleKeyFrames.size() == 1)
-    {
-        return glm::scale(glm::mat4(1.0f), keyFrames.scaleKeyFrames[0].scale);
-
-    }
-
-    int p0Index = (int)GetScaleKeyFrameIndex(keyFrames, animationTime);
-    int p1Index = p0Index + 1;
-
-    float scaleFactor = GetScaleFactor(keyFrames.scaleKeyFrames[p0Index].animationTime,
-                                       keyFrames.scaleKeyFrames[p1Index].animationTime,
-                                       animationTime);
-
-    glm::vec3 finalScale = glm::mix(keyFrames.scaleKeyFrames[p0Index].scale,
-                                    keyFrames.scaleKeyFrames[p1Index].scale,
-                                    scaleFactor);
-    return glm::scale(glm::mat4(1.0f), finalScale);
+    return boneTransforms;
 }
 
 }
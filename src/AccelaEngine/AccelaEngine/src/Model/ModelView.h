@@ -9,6 +9,7 @@
 
 #include "RegisteredModel.h"
 #include "ModelPose.h"
+#include "CompiledModel.h"
 
 #include <string>
 #include <optional>
@@ -24,33 +25,25 @@ namespace Accela::Engine
             explicit ModelView(RegisteredModel registeredModel);
 
             ModelPose BindPose() const;
-            std::optional<ModelPose> AnimationPose(const std::string& animationName, const double& animationTime) const;
+
+            /**
+             * @param animationName The animation to pose the model with
+             * @param animationTime The animation time, in ticks
+             * @param cursor Keyframe cursor for the entity being posed, carried between calls
+             *
+             * @return The model's pose, or std::nullopt if the model has no such animation
+             */
+            std::optional<ModelPose> AnimationPose(const std::string& animationName,
+                                                   const double& animationTime,
+                                                   AnimationCursor& cursor) const;
 
         private:
 
             ModelPose Pose(const std::vector<glm::mat4>& localTransforms) const;
 
-            std::unordered_map<unsigned int, std::vector<glm::mat4>> CalculateNodeSkeletons(
-                const std::vector<glm::mat4>& localTransforms) const;
-
-            std::vector<glm::mat4> CalculateNodeSkeletons(
-                const std::vector<glm::mat4>& localTransforms,
-                const unsigned int& meshIndex,
-                const ModelNode::Ptr& skeletonRoot) const;
-
-            std::vector<glm::mat4> GetAnimationLocalTransforms(
-                const ModelAnimation& animation,
-                const double& animationTime) const;
-
-            static unsigned int GetPositionKeyFrameIndex(const NodeKeyFrames& keyFrames, const double& animTime);
-            static unsigned int GetRotationKeyFrameIndex(const NodeKeyFrames& keyFrames, const double& animTime);
-            static unsigned int GetScaleKeyFrameIndex(const NodeKeyFrames& keyFrames, const double& animTime);
-
-            static float GetScaleFactor(double lastTimeStamp, double nextTimeStamp, double animationTime);
-
-            static glm::mat4 InterpolatePosition(const NodeKeyFrames& keyFrames, double animationTime);
-            static glm::mat4 InterpolateRotation(const NodeKeyFrames& keyFrames, double animationTime);
-            static glm::mat4 InterpolateScale(const NodeKeyFrames& keyFrames, double animationTime);
+            static std::vector<glm::mat4> CalculateBoneTransforms(
+                const CompiledNodeMesh& nodeMesh,
+                const std::vector<glm::mat4>& localTransforms);
 
         private:
 
@@ -7,6 +7,8 @@
 #ifndef LIBACCELAENGINE_SRC_MODEL_REGISTEREDMODEL_H
 #define LIBACCELAENGINE_SRC_MODEL_REGISTEREDMODEL_H
 
+#include "CompiledModel.h"
+
 #include <Accela/Engine/Model/Model.h>
 
 #include <Accela/Render/Id.h>
@@ -29,6 +31,9 @@ namespace Accela::Engine
         // The parsed model definition
         Model::Ptr model;
 
+        // The model's hierarchy and animations, compiled for posing
+        CompiledModel::Ptr compiledModel;
+
         // Data that was loaded into the renderer for each mesh in the model
         //
         // model mesh index -> loaded mesh data
@@ -19,7 +19,7 @@ Construct::Construct(std::string name)
 
 }
 
-std::expected<Construct::Ptr, bool> Construct::FromBytes(const std::vector<std::byte>& data)
+std::expected<Construct::Ptr, bool> Construct::FromBytes(std::span<const std::byte> data)
 {
     const auto constructExpect = ObjectFromBytes<Construct, ConstructModel>(data);
     if (!constructExpect)
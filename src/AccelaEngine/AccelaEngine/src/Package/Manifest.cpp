@@ -15,7 +15,7 @@
 namespace Accela::Engine
 {
 
-std::expected<Manifest, Manifest::CreateError> Manifest::FromBytes(const std::vector<std::byte>& data)
+std::expected<Manifest, Manifest::CreateError> Manifest::FromBytes(std::span<const std::byte> data)
 {
     ManifestModel model{};
 
@@ -24,7 +24,7 @@ std::expected<Manifest, Manifest::CreateError> Manifest::FromBytes(const std::ve
         //
         // Parse the manifest file's contents into a json object
         //
-        const nlohmann::json j = nlohmann::json::parse(data.cbegin(), data.cend());
+        const nlohmann::json j = nlohmann::json::parse(data.begin(), data.end());
 
         //
         // Before interpreting the json blob, we at minimum need to look through it for
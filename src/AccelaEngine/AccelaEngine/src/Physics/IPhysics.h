@@ -40,9 +40,13 @@ namespace Accela::Engine
             virtual void SimulationStep(unsigned int timeStep) = 0;
 
             /**
-             * Instructs the physics system to mark bodies as no longer dirty.
+             * Pops the simulated state of all bodies which moved during SimulationSteps, since the last time
+             * this method was called. Driven by the physics engine's active actor list, so sleeping bodies never
+             * produce deltas. If a body moved during multiple steps it has a delta for each, in step order.
+             *
+             * @return Per-body deltas, which can be applied directly to the bodies' components
              */
-            virtual void MarkBodiesClean() = 0;
+            [[nodiscard]] virtual std::vector<RigidBodyDelta> PopRigidBodyDeltas() = 0;
 
             /**
              * Pops all trigger events that have occurred during SimulationSteps, since the last
@@ -56,10 +60,9 @@ namespace Accela::Engine
             * @param eid The EntityId to fetch the RigidBody for
             * @param scene Optional scene identifier which can reduce an internal lookup if supplied
             *
-            * @return The latest RigidBody for the corresponding eid, with a boolean specifying whether
-            * the body is dirty, or std::nullopt if no such entity body exists
+            * @return The latest RigidBody for the corresponding eid, or std::nullopt if no such entity body exists
             */
-            [[nodiscard]] virtual std::optional<std::pair<RigidBody, bool>> GetRigidBody(
+            [[nodiscard]] virtual std::optional<RigidBody> GetRigidBody(
                 const EntityId& eid,
                 const std::optional<PhysicsSceneName>& scene) = 0;
 
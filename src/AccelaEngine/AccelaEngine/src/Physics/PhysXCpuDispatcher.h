@@ -0,0 +1,43 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAENGINE_SRC_PHYSICS_PHYSXCPUDISPATCHER_H
+#define LIBACCELAENGINE_SRC_PHYSICS_PHYSXCPUDISPATCHER_H
+
+#include "PhysXWrapper.h"
+
+#include <Accela/Common/Thread/JobSystem.h>
+
+namespace Accela::Engine
+{
+    /**
+     * PhysX CPU dispatcher which runs PhysX's simulation tasks on the engine's shared job
+     * system, rather than on a separate PhysX-owned thread pool.
+     */
+    struct PhysXCpuDispatcher : public physx::PxCpuDispatcher
+    {
+        explicit PhysXCpuDispatcher(Common::JobSystem::Ptr jobSystem)
+            : m_jobSystem(std::move(jobSystem))
+        { }
+
+        void submitTask(physx::PxBaseTask& task) override
+        {
+            m_jobSystem->Submit([&task](){
+                task.run();
+                task.release();
+            });
+        }
+
+        [[nodiscard]] uint32_t getWorkerCount() const override
+        {
+            return m_jobSystem->GetWorkerCount();
+        }
+
+        Common::JobSystem::Ptr m_jobSystem;
+    };
+}
+
+#endif //LIBACCELAENGINE_SRC_PHYSICS_PHYSXCPUDISPATCHER_H
@@ -10,20 +10,29 @@
 
 #include <Accela/Common/BuildInfo.h>
 
-#include <thread>
 #include <array>
 #include <algorithm>
+#include <vector>
 
 namespace Accela::Engine
 {
 
+// Max number of scene queries run per job; each query is cheap, so they're batched up
+// to amortize job dispatch overhead
+static constexpr std::size_t SCENE_QUERY_GRAIN_SIZE = 64;
+
 PhysXPhysics::PhysXPhysics(Common::ILogger::Ptr logger,
                            Common::IMetrics::Ptr metrics,
-                           IWorldResourcesPtr worldResources)
+                           IWorldResourcesPtr worldResources,
+                           Common::JobSystem::Ptr jobSystem,
+                           std::optional<std::string> cookedMeshCacheDirectory)
    : m_logger(std::move(logger))
    , m_metrics(std::move(metrics))
    , m_worldResources(std::move(worldResources))
+   , m_jobSystem(jobSystem)
+   , m_cookedMeshCacheDirectory(std::move(cookedMeshCacheDirectory))
    , m_physXLogger(m_logger)
+   , m_pxCpuDispatcher(std::move(jobSystem))
 {
     InitPhysX();
 }
@@ -44,10 +53,6 @@ void PhysXPhysics::InitPhysX()
         m_physXLogger
     );
 
-    // TODO Perf: What's the proper thread count value in relation to hardware threads?
-    // TODO Perf: Evaluate perf of other "work wait mode" parameter values
-    m_pxCpuDispatcher = physx::PxDefaultCpuDispatcherCreate(std::thread::hardware_concurrency());
-
     m_pxPhysics = PxCreatePhysics(
         PX_PHYSICS_VERSION,
         *m_pxFoundation,
@@ -63,15 +68,22 @@ void PhysXPhysics::InitPhysX()
             m_pxCudaContextManager = PxCreateCudaContextManager(*m_pxFoundation, cudaContextManagerDesc,PxGetProfilerCallback());
         }
     #endif
+
+    m_triangleMeshCache = std::make_shared<PhysXTriangleMeshCache>(m_logger, m_pxPhysics, m_cookedMeshCacheDirectory);
 }
 
 void PhysXPhysics::DestroyPhysX()
 {
     m_logger->Log(Common::LogLevel::Info, "PhysXPhysics: Destroying PhysX");
 
+    if (m_triangleMeshCache)
+    {
+        m_triangleMeshCache->Destroy();
+        m_triangleMeshCache = nullptr;
+    }
+
     PX_RELEASE(m_pxCudaContextManager)
     PX_RELEASE(m_pxPhysics)
-    PX_RELEASE(m_pxCpuDispatcher)
     PX_RELEASE(m_pxFoundation)
 
     SyncMetrics();
@@ -110,7 +122,7 @@ void PhysXPhysics::SimulationStep(unsigned int timeStep)
     if (Common::BuildInfo::IsDebugBuild()) { DebugCheckResources(); }
 }
 
-std::optional<std::pair<RigidBody, bool>> PhysXPhysics::GetRigidBody(const EntityId& eid, const std::optional<PhysicsSceneName>& scene)
+std::optional<RigidBody> PhysXPhysics::GetRigidBody(const EntityId& eid, const std::optional<PhysicsSceneName>& scene)
 {
     const auto sceneName = GetSceneName(eid, scene);
     if (!sceneName)
@@ -131,12 +143,23 @@ std::optional<std::pair<RigidBody, bool>> PhysXPhysics::GetRigidBody(const Entit
     return sceneIt->second.GetRigidBody(eid);
 }
 
-void PhysXPhysics::MarkBodiesClean()
+std::vector<RigidBodyDelta> PhysXPhysics::PopRigidBodyDeltas()
 {
+    // Common case of a single scene; hand back its deltas without copying them
+    if (m_scenes.size() == 1)
+    {
+        return m_scenes.begin()->second.PopRigidBodyDeltas();
+    }
+
+    std::vector<RigidBodyDelta> results;
+
     for (auto& scene : m_scenes)
     {
-        scene.second.MarkBodiesClean();
+        const auto sceneDeltas = scene.second.PopRigidBodyDeltas();
+        results.insert(results.end(), sceneDeltas.cbegin(), sceneDeltas.cend());
     }
+
+    return results;
 }
 
 std::unordered_map<PhysicsSceneName, std::queue<PhysicsTriggerEvent>> PhysXPhysics::PopTriggerEvents()
@@ -371,6 +394,8 @@ void PhysXPhysics::ClearAll()
         (void)scene.second.Clear();
     }
 
+    m_triangleMeshCache->PruneUnused();
+
     SyncMetrics();
 }
 
@@ -414,8 +439,9 @@ bool PhysXPhysics::CreateScene(const PhysicsSceneName& scene, const PhysicsScene
         m_logger,
         m_worldResources,
         m_pxPhysics,
-        m_pxCpuDispatcher,
-        m_pxCudaContextManager
+        &m_pxCpuDispatcher,
+        m_pxCudaContextManager,
+        m_triangleMeshCache
     );
     if (!physXScene.Create())
     {
@@ -444,6 +470,9 @@ bool PhysXPhysics::DestroyScene(const PhysicsSceneName& scene)
     it->second.Destroy();
     m_scenes.erase(scene);
 
+    // Release any cooked meshes which only the destroyed scene was using
+    m_triangleMeshCache->PruneUnused();
+
     SyncMetrics();
 
     return true;
@@ -485,6 +514,106 @@ std::vector<RaycastResult> PhysXPhysics::RaycastForCollisions(const PhysicsScene
     return sceneIt->second.RaycastForCollisions(rayStart_worldSpace, rayEnd_worldSpace);
 }
 
+const PhysXScene* PhysXPhysics::GetQueryScene(const PhysicsSceneName& scene, const char* caller) const
+{
+    const auto sceneIt = m_scenes.find(scene);
+    if (sceneIt == m_scenes.cend())
+    {
+        m_logger->Log(Common::LogLevel::Error, "PhysXPhysics::{}: No such scene: {}", caller, scene.name);
+        return nullptr;
+    }
+
+    return &sceneIt->second;
+}
+
+bool PhysXPhysics::RaycastBatch(const PhysicsSceneName& scene,
+                                std::span<const RaycastQuery> queries,
+                                std::span<std::optional<SceneQueryHit>> results) const
+{
+    const auto pScene = GetQueryScene(scene, "RaycastBatch");
+    if (pScene == nullptr) { return false; }
+
+    if (results.size() < queries.size())
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "PhysXPhysics::RaycastBatch: Results buffer too small: {} < {}", results.size(), queries.size());
+        return false;
+    }
+
+    // The scene isn't written to while the batch runs, so queries can safely run concurrently
+    m_jobSystem->ParallelFor(0, queries.size(), SCENE_QUERY_GRAIN_SIZE, [&](std::size_t begin, std::size_t end){
+        for (std::size_t x = begin; x < end; ++x)
+        {
+            results[x] = pScene->Raycast(queries[x]);
+        }
+    });
+
+    m_metrics->SetCounterValue(Engine_Physics_Scene_Query_Batch_Size, queries.size());
+
+    return true;
+}
+
+bool PhysXPhysics::SweepBatch(const PhysicsSceneName& scene,
+                              std::span<const SweepQuery> queries,
+                              std::span<std::optional<SceneQueryHit>> results) const
+{
+    const auto pScene = GetQueryScene(scene, "SweepBatch");
+    if (pScene == nullptr) { return false; }
+
+    if (results.size() < queries.size())
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "PhysXPhysics::SweepBatch: Results buffer too small: {} < {}", results.size(), queries.size());
+        return false;
+    }
+
+    m_jobSystem->ParallelFor(0, queries.size(), SCENE_QUERY_GRAIN_SIZE, [&](std::size_t begin, std::size_t end){
+        for (std::size_t x = begin; x < end; ++x)
+        {
+            results[x] = pScene->Sweep(queries[x]);
+        }
+    });
+
+    m_metrics->SetCounterValue(Engine_Physics_Scene_Query_Batch_Size, queries.size());
+
+    return true;
+}
+
+bool PhysXPhysics::OverlapBatch(const PhysicsSceneName& scene,
+                                std::span<const OverlapQuery> queries,
+                                std::size_t maxHitsPerQuery,
+                                std::span<SceneQueryObject> hits,
+                                std::span<std::size_t> hitCounts) const
+{
+    const auto pScene = GetQueryScene(scene, "OverlapBatch");
+    if (pScene == nullptr) { return false; }
+
+    if (hits.size() < queries.size() * maxHitsPerQuery || hitCounts.size() < queries.size())
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "PhysXPhysics::OverlapBatch: Hit buffers too small for {} queries", queries.size());
+        return false;
+    }
+
+    m_jobSystem->ParallelFor(0, queries.size(), SCENE_QUERY_GRAIN_SIZE, [&](std::size_t begin, std::size_t end){
+        // Scratch buffer PhysX writes overlaps into, shared by all the queries of this sub-range
+        std::vector<physx::PxOverlapHit> pxHitBuffer(maxHitsPerQuery);
+
+        for (std::size_t x = begin; x < end; ++x)
+        {
+            hitCounts[x] = pScene->Overlap(
+                queries[x],
+                pxHitBuffer,
+                hits.subspan(x * maxHitsPerQuery, maxHitsPerQuery)
+            );
+        }
+    });
+
+    m_metrics->SetCounterValue(Engine_Physics_Scene_Query_Batch_Size, queries.size());
+
+    return true;
+}
+
 void PhysXPhysics::SyncMetrics()
 {
     m_metrics->SetCounterValue(Engine_Physics_Scene_Count, m_scenes.size());
@@ -500,6 +629,11 @@ void PhysXPhysics::SyncMetrics()
 
     m_metrics->SetCounterValue(Engine_Physics_Static_Rigid_Bodies_Count, staticRigidBodiesCount);
     m_metrics->SetCounterValue(Engine_Physics_Dynamic_Rigid_Bodies_Count, dynamicRigidBodiesCount);
+
+    if (m_triangleMeshCache)
+    {
+        m_metrics->SetCounterValue(Engine_Physics_Cooked_Mesh_Count, m_triangleMeshCache->GetNumMeshes());
+    }
 }
 
 void PhysXPhysics::DebugCheckResources()
@@ -10,7 +10,9 @@
 #include "IPhysics.h"
 #include "PhysXWrapper.h"
 #include "PhysXLogger.h"
+#include "PhysXCpuDispatcher.h"
 #include "PhysXScene.h"
+#include "PhysXTriangleMeshCache.h"
 
 #include "../ForwardDeclares.h"
 
@@ -18,11 +20,15 @@
 
 #include <Accela/Common/Log/ILogger.h>
 #include <Accela/Common/Metrics/IMetrics.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 #include <unordered_map>
 #include <unordered_set>
 #include <queue>
 #include <functional>
+#include <optional>
+#include <string>
+#include <span>
 
 namespace Accela::Engine
 {
@@ -30,18 +36,24 @@ namespace Accela::Engine
     {
         public:
 
+            /**
+             * @param cookedMeshCacheDirectory Directory to persist cooked collision meshes to, or
+             * std::nullopt to only cache cooked meshes in memory
+             */
             PhysXPhysics(Common::ILogger::Ptr logger,
                          Common::IMetrics::Ptr metrics,
-                         IWorldResourcesPtr worldResources);
+                         IWorldResourcesPtr worldResources,
+                         Common::JobSystem::Ptr jobSystem,
+                         std::optional<std::string> cookedMeshCacheDirectory = std::nullopt);
             ~PhysXPhysics() override;
 
             //
             // IPhysics
             //
             void SimulationStep(unsigned int timeStep) override;
-            [[nodiscard]] std::optional<std::pair<RigidBody, bool>> GetRigidBody(const EntityId& eid,
-                                                                                 const std::optional<PhysicsSceneName>& scene) override;
-            void MarkBodiesClean() override;
+            [[nodiscard]] std::optional<RigidBody> GetRigidBody(const EntityId& eid,
+                                                                const std::optional<PhysicsSceneName>& scene) override;
+            [[nodiscard]] std::vector<RigidBodyDelta> PopRigidBodyDeltas() override;
             [[nodiscard]] std::unordered_map<PhysicsSceneName, std::queue<PhysicsTriggerEvent>> PopTriggerEvents() override;
 
             [[nodiscard]] bool CreateRigidBody(const PhysicsSceneName& scene, const EntityId& eid, const RigidBody& rigidBody) override;
@@ -85,8 +97,22 @@ namespace Accela::Engine
                 const glm::vec3& rayStart_worldSpace,
                 const glm::vec3& rayEnd_worldSpace) const override;
 
+            [[nodiscard]] bool RaycastBatch(const PhysicsSceneName& scene,
+                                            std::span<const RaycastQuery> queries,
+                                            std::span<std::optional<SceneQueryHit>> results) const override;
+            [[nodiscard]] bool SweepBatch(const PhysicsSceneName& scene,
+                                          std::span<const SweepQuery> queries,
+                                          std::span<std::optional<SceneQueryHit>> results) const override;
+            [[nodiscard]] bool OverlapBatch(const PhysicsSceneName& scene,
+                                            std::span<const OverlapQuery> queries,
+                                            std::size_t maxHitsPerQuery,
+                                            std::span<SceneQueryObject> hits,
+                                            std::span<std::size_t> hitCounts) const override;
+
         private:
 
+            [[nodiscard]] const PhysXScene* GetQueryScene(const PhysicsSceneName& scene, const char* caller) const;
+
             void InitPhysX();
             void DestroyPhysX();
 
@@ -103,15 +129,20 @@ namespace Accela::Engine
             Common::ILogger::Ptr m_logger;
             Common::IMetrics::Ptr m_metrics;
             IWorldResourcesPtr m_worldResources;
+            Common::JobSystem::Ptr m_jobSystem;
+            std::optional<std::string> m_cookedMeshCacheDirectory;
 
             // PhysX Global
             PhysxLogger m_physXLogger;
             physx::PxDefaultAllocator m_pxAllocator;
             physx::PxFoundation* m_pxFoundation{nullptr};
-            physx::PxDefaultCpuDispatcher* m_pxCpuDispatcher{nullptr};
+            PhysXCpuDispatcher m_pxCpuDispatcher;
             physx::PxPhysics* m_pxPhysics{nullptr};
             physx::PxCudaContextManager* m_pxCudaContextManager{nullptr};
 
+            // Cooked collision meshes, shared by all scenes
+            PhysXTriangleMeshCache::Ptr m_triangleMeshCache;
+
             // PhysX Scenes
             std::unordered_map<PhysicsSceneName, PhysXScene> m_scenes;
             std::unordered_map<EntityId, PhysicsSceneName> m_entityToScene;
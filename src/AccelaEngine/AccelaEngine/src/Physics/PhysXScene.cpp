@@ -51,13 +51,53 @@ static physx::PxShapeFlags GetShapeFlags(const ShapeUsage& usage)
     return flags;
 }
 
+static physx::PxQueryFilterData GetQueryFilterData(PhysicsFilterGroups filterGroups)
+{
+    // PhysX's default query filtering only reports shapes whose query filter data shares a set
+    // bit with the query's filter data
+    physx::PxQueryFilterData pxQueryFilterData{};
+    pxQueryFilterData.data = physx::PxFilterData(filterGroups, 0, 0, 0);
+    return pxQueryFilterData;
+}
+
+static std::pair<physx::PxGeometryHolder, physx::PxTransform> GetQueryGeometry(const SceneQueryShape& shape,
+                                                                               const glm::vec3& position,
+                                                                               const glm::quat& orientation)
+{
+    auto pose = physx::PxTransform(ToPhysX(position), ToPhysX(orientation));
+    physx::PxGeometryHolder geometry;
+
+    if (const auto pAABB = std::get_if<Bounds_AABB>(&shape))
+    {
+        // Box geometry is centered on its pose, so move the pose to the center of the AABB
+        const auto center = (pAABB->min + pAABB->max) / 2.0f;
+        pose.p = ToPhysX(position + (orientation * center));
+
+        geometry = physx::PxGeometryHolder(physx::PxBoxGeometry(ToPhysX((pAABB->max - pAABB->min) / 2.0f)));
+    }
+    else if (const auto pSphere = std::get_if<Bounds_Sphere>(&shape))
+    {
+        geometry = physx::PxGeometryHolder(physx::PxSphereGeometry(pSphere->radius));
+    }
+    else if (const auto pCapsule = std::get_if<Bounds_Capsule>(&shape))
+    {
+        // PhysX capsules run along their x axis, rotate it so that it runs along the y axis
+        pose.q = pose.q * physx::PxQuat(physx::PxHalfPi, physx::PxVec3(0.0f, 0.0f, 1.0f));
+
+        geometry = physx::PxGeometryHolder(physx::PxCapsuleGeometry(pCapsule->radius, pCapsule->height / 2.0f));
+    }
+
+    return {geometry, pose};
+}
+
 PhysXScene::PhysXScene(PhysicsSceneName name,
                        PhysicsSceneParams params,
                        Common::ILogger::Ptr logger,
                        std::shared_ptr<IWorldResources> worldResources,
                        physx::PxPhysics* pPhysics,
                        physx::PxCpuDispatcher* pCpuDispatcher,
-                       physx::PxCudaContextManager* pCudaContextManager)
+                       physx::PxCudaContextManager* pCudaContextManager,
+                       PhysXTriangleMeshCache::Ptr triangleMeshCache)
     : m_name(std::move(name))
     , m_params(std::move(params))
     , m_logger(std::move(logger))
@@ -65,9 +105,11 @@ PhysXScene::PhysXScene(PhysicsSceneName name,
     , m_pPhysics(pPhysics)
     , m_pCpuDispatcher(pCpuDispatcher)
     , m_pCudaContextManager(pCudaContextManager)
+    , m_triangleMeshCache(std::move(triangleMeshCache))
 {
     assert(m_pPhysics != nullptr);
     assert(m_pCpuDispatcher != nullptr);
+    assert(m_triangleMeshCache != nullptr);
 }
 
 bool PhysXScene::Create()
@@ -142,6 +184,7 @@ void PhysXScene::Destroy()
 
         // Clear internal state
          m_physXActorToEntity.clear();
+         m_rigidBodyDeltas.clear();
 
     //
     // Destroy scene
@@ -193,12 +236,11 @@ void PhysXScene::ApplyPlayerControllerMovements(unsigned int timeStep)
     }
 }
 
-void PhysXScene::MarkBodiesClean()
+std::vector<RigidBodyDelta> PhysXScene::PopRigidBodyDeltas()
 {
-    for (auto& rigidBody: m_entityToRigidBody)
-    {
-        rigidBody.second.isDirty = false;
-    }
+    auto rigidBodyDeltas = std::move(m_rigidBodyDeltas);
+    m_rigidBodyDeltas = {};
+    return rigidBodyDeltas;
 }
 
 std::queue<PhysicsTriggerEvent> PhysXScene::PopTriggerEvents()
@@ -210,9 +252,14 @@ std::queue<PhysicsTriggerEvent> PhysXScene::PopTriggerEvents()
 
 void PhysXScene::SyncRigidBodyDataFromPhysX()
 {
+    //
+    // Only actors which moved during the step are reported as active; sleeping actors are never visited
+    //
     physx::PxU32 numActiveActors{0};
     const auto activeActors = m_pScene->getActiveActors(numActiveActors);
 
+    m_rigidBodyDeltas.reserve(m_rigidBodyDeltas.size() + numActiveActors);
+
     for (physx::PxU32 x = 0; x < numActiveActors; ++x)
     {
         const auto it = m_physXActorToEntity.find(activeActors[x]);
@@ -221,17 +268,36 @@ void PhysXScene::SyncRigidBodyDataFromPhysX()
         const auto it2 = m_entityToRigidBody.find(it->second);
         if (it2 == m_entityToRigidBody.cend()) { continue; }
 
+        auto& physXRigidBody = it2->second;
+
         //
         // Sync actor data
         //
-        const auto globalPose = it2->second.pRigidActor->getGlobalPose();
-        it2->second.data.actor.position = FromPhysX(globalPose.p);
-        it2->second.data.actor.orientation = FromPhysX(globalPose.q);
+        const auto globalPose = physXRigidBody.pRigidActor->getGlobalPose();
+        physXRigidBody.data.actor.position = FromPhysX(globalPose.p);
+        physXRigidBody.data.actor.orientation = FromPhysX(globalPose.q);
+
+        glm::vec3 linearVelocity{0.0f};
+
+        if (auto* pRigidDynamic = GetAsRigidDynamic(physXRigidBody.pRigidActor))
+        {
+            linearVelocity = FromPhysX(pRigidDynamic->getLinearVelocity());
+
+            if (auto* pDynamicData = std::get_if<RigidBodyDynamicData>(&physXRigidBody.data.body.subData))
+            {
+                pDynamicData->linearVelocity = linearVelocity;
+            }
+        }
 
         //
-        // Update dirty state
+        // Record the body's new state
         //
-        it2->second.isDirty = true;
+        m_rigidBodyDeltas.push_back(RigidBodyDelta{
+            .eid = it->second,
+            .position = physXRigidBody.data.actor.position,
+            .orientation = physXRigidBody.data.actor.orientation,
+            .linearVelocity = linearVelocity
+        });
     }
 }
 
@@ -343,7 +409,7 @@ bool PhysXScene::CreateRigidBody(const EntityId& eid, const RigidBody& rigidBody
     return true;
 }
 
-std::optional<std::pair<RigidBody, bool>> PhysXScene::GetRigidBody(const EntityId& eid)
+std::optional<RigidBody> PhysXScene::GetRigidBody(const EntityId& eid)
 {
     const auto it = m_entityToRigidBody.find(eid);
     if (it == m_entityToRigidBody.cend())
@@ -353,7 +419,7 @@ std::optional<std::pair<RigidBody, bool>> PhysXScene::GetRigidBody(const EntityI
         return std::nullopt;
     }
 
-    return std::make_pair(it->second.data, it->second.isDirty);
+    return it->second.data;
 }
 
 bool PhysXScene::UpdateRigidBody(const EntityId& eid, const RigidBody& rigidBody)
@@ -573,6 +639,9 @@ physx::PxShape* PhysXScene::CreateShape(const ShapeData& shape, physx::PxMateria
     localTransform.q = ToPhysX(shape.localOrientation * localOrientationAdjustment);
     pShape->setLocalPose(localTransform);
 
+    // Filter groups
+    pShape->setQueryFilterData(physx::PxFilterData(shape.filterGroups, 0, 0, 0));
+
     return pShape;
 }
 
@@ -712,31 +781,18 @@ physx::PxShape* PhysXScene::CreateShape_StaticMesh(const ShapeData& shape,
 
     //params.meshPreprocessParams |= physx::PxMeshPreprocessingFlag::eDISABLE_ACTIVE_EDGES_PRECOMPUTE;
 
-    physx::PxTriangleMeshDesc meshDesc;
-    meshDesc.points.count           = pxVertices.size();
-    meshDesc.points.stride          = sizeof(physx::PxVec3);
-    meshDesc.points.data            = pxVertices.data();
-
-    meshDesc.triangles.count        = pxIndices.size() / 3;
-    meshDesc.triangles.stride       = 3 * sizeof(physx::PxU32);
-    meshDesc.triangles.data         = pxIndices.data();
-
     // Only validate meshes without duplicate vertices or else the validation fails even though we're
     // explicitly configuring mesh welding ..
-    if (Common::BuildInfo::IsDebugBuild() && !boundsStaticMesh.meshCanContainDuplicateVertices)
-    {
-        const bool meshValidationResult = PxValidateTriangleMesh(params, meshDesc);
-        if (!meshValidationResult)
-        {
-            m_logger->Log(Common::LogLevel::Warning,
-              "PhysXScene::CreateShape_StaticMesh: Mesh failed validation: {}", boundsStaticMesh.resource.GetUniqueName());
-        }
-    }
+    const bool validateMesh = Common::BuildInfo::IsDebugBuild() && !boundsStaticMesh.meshCanContainDuplicateVertices;
 
-    auto* pTriangleMesh = PxCreateTriangleMesh(
+    // Fetch the cooked mesh from the cache; identical mesh data is only ever cooked once, and the
+    // resulting mesh is shared by every shape, in every scene, that uses it
+    auto* pTriangleMesh = m_triangleMeshCache->GetTriangleMesh(
+        pxVertices,
+        pxIndices,
         params,
-        meshDesc,
-        m_pPhysics->getPhysicsInsertionCallback()
+        validateMesh,
+        boundsStaticMesh.resource.GetUniqueName()
     );
     if (pTriangleMesh == nullptr)
     {
@@ -780,6 +836,13 @@ bool PhysXScene::CreatePlayerController(const PlayerControllerName& player,
         return false;
     }
 
+    // Player controllers aren't assigned filter groups, so they belong to all of them
+    physx::PxShape* pControllerShape{nullptr};
+    if (pxPlayerController->getActor()->getShapes(&pControllerShape, 1) == 1)
+    {
+        pControllerShape->setQueryFilterData(physx::PxFilterData(PHYSICS_FILTER_GROUPS_ALL, 0, 0, 0));
+    }
+
     m_playerControllers.insert({player, PhysXPlayerController(pxPlayerController, desc.material)});
     m_physXActorToPlayerController.insert({pxPlayerController->getActor(), player});
 
@@ -956,6 +1019,97 @@ std::vector<RaycastResult> PhysXScene::RaycastForCollisions(const glm::vec3& ray
     return results;
 }
 
+std::optional<SceneQueryHit> PhysXScene::Raycast(const RaycastQuery& query) const
+{
+    const auto distance = glm::distance(query.rayStart_worldSpace, query.rayEnd_worldSpace);
+    if (distance <= 0.0f) { return std::nullopt; }
+
+    physx::PxRaycastBuffer pxRaycastBuffer{};
+
+    m_pScene->raycast(
+        ToPhysX(query.rayStart_worldSpace),
+        ToPhysX((query.rayEnd_worldSpace - query.rayStart_worldSpace) / distance),
+        distance,
+        pxRaycastBuffer,
+        physx::PxHitFlag::eDEFAULT,
+        GetQueryFilterData(query.filterGroups)
+    );
+
+    if (!pxRaycastBuffer.hasBlock) { return std::nullopt; }
+
+    return ToSceneQueryHit(pxRaycastBuffer.block);
+}
+
+std::optional<SceneQueryHit> PhysXScene::Sweep(const SweepQuery& query) const
+{
+    const auto distance = glm::distance(query.sweepStart_worldSpace, query.sweepEnd_worldSpace);
+    if (distance <= 0.0f) { return std::nullopt; }
+
+    const auto [geometry, pose] = GetQueryGeometry(query.shape, query.sweepStart_worldSpace, query.orientation);
+
+    physx::PxSweepBuffer pxSweepBuffer{};
+
+    m_pScene->sweep(
+        geometry.any(),
+        pose,
+        ToPhysX((query.sweepEnd_worldSpace - query.sweepStart_worldSpace) / distance),
+        distance,
+        pxSweepBuffer,
+        physx::PxHitFlag::eDEFAULT,
+        GetQueryFilterData(query.filterGroups)
+    );
+
+    if (!pxSweepBuffer.hasBlock) { return std::nullopt; }
+
+    return ToSceneQueryHit(pxSweepBuffer.block);
+}
+
+std::size_t PhysXScene::Overlap(const OverlapQuery& query,
+                                std::span<physx::PxOverlapHit> pxHitBuffer,
+                                std::span<SceneQueryObject> hits) const
+{
+    if (pxHitBuffer.empty() || hits.empty()) { return 0; }
+
+    const auto [geometry, pose] = GetQueryGeometry(query.shape, query.position_worldSpace, query.orientation);
+
+    physx::PxOverlapBuffer pxOverlapBuffer(pxHitBuffer.data(), static_cast<physx::PxU32>(pxHitBuffer.size()));
+
+    // Report every overlap as a touch, rather than stopping at the first (blocking) overlap
+    auto pxQueryFilterData = GetQueryFilterData(query.filterGroups);
+    pxQueryFilterData.flags = pxQueryFilterData.flags | physx::PxQueryFlag::eNO_BLOCK;
+
+    m_pScene->overlap(geometry.any(), pose, pxOverlapBuffer, pxQueryFilterData);
+
+    std::size_t numHits = 0;
+
+    for (physx::PxU32 x = 0; x < pxOverlapBuffer.getNbTouches() && numHits < hits.size(); ++x)
+    {
+        const auto object = PxRigidActorToEntity(pxOverlapBuffer.getTouch(x).actor);
+        if (!object) { continue; }
+
+        // Bodies with multiple shapes overlap once per shape; only report each body once
+        const auto hitsEnd = hits.begin() + static_cast<std::ptrdiff_t>(numHits);
+        if (std::find(hits.begin(), hitsEnd, *object) != hitsEnd) { continue; }
+
+        hits[numHits++] = *object;
+    }
+
+    return numHits;
+}
+
+std::optional<SceneQueryHit> PhysXScene::ToSceneQueryHit(const physx::PxLocationHit& pxHit) const
+{
+    const auto object = PxRigidActorToEntity(pxHit.actor);
+    if (!object) { return std::nullopt; }
+
+    return SceneQueryHit{
+        .hit = *object,
+        .hitPoint_worldSpace = FromPhysX(pxHit.position),
+        .hitNormal_worldSpace = FromPhysX(pxHit.normal),
+        .distance = pxHit.distance
+    };
+}
+
 void PhysXScene::onConstraintBreak(physx::PxConstraintInfo*, physx::PxU32)
 {
 
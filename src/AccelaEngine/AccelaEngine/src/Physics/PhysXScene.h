@@ -9,6 +9,7 @@
 
 #include "PhysXWrapper.h"
 #include "RigidBody.h"
+#include "PhysXTriangleMeshCache.h"
 
 #include <Accela/Engine/Common.h>
 #include <Accela/Engine/Physics/IPhysicsRuntime.h>
@@ -20,6 +21,8 @@
 #include <unordered_map>
 #include <string>
 #include <queue>
+#include <span>
+#include <optional>
 
 namespace Accela::Engine
 {
@@ -35,7 +38,8 @@ namespace Accela::Engine
                        std::shared_ptr<IWorldResources> worldResources,
                        physx::PxPhysics* pPhysics,
                        physx::PxCpuDispatcher* pCpuDispatcher,
-                       physx::PxCudaContextManager* pCudaContextManager);
+                       physx::PxCudaContextManager* pCudaContextManager,
+                       PhysXTriangleMeshCache::Ptr triangleMeshCache);
 
             [[nodiscard]] bool Create();
             [[nodiscard]] bool Clear();
@@ -44,7 +48,7 @@ namespace Accela::Engine
             void StartSimulatingStep(unsigned int timeStep);
             void FinishSimulatingStep();
 
-            void MarkBodiesClean();
+            [[nodiscard]] std::vector<RigidBodyDelta> PopRigidBodyDeltas();
 
             [[nodiscard]] std::queue<PhysicsTriggerEvent> PopTriggerEvents();
 
@@ -56,7 +60,7 @@ namespace Accela::Engine
             // Rigid Bodies
             //
             [[nodiscard]] bool CreateRigidBody(const EntityId& eid, const RigidBody& rigidBody);
-            [[nodiscard]] std::optional<std::pair<RigidBody, bool>> GetRigidBody(const EntityId& eid);
+            [[nodiscard]] std::optional<RigidBody> GetRigidBody(const EntityId& eid);
             [[nodiscard]] bool UpdateRigidBody(const EntityId& eid, const RigidBody& rigidBody);
             [[nodiscard]] bool DestroyRigidBody(const EntityId& eid);
 
@@ -83,6 +87,18 @@ namespace Accela::Engine
                 const glm::vec3& rayStart_worldSpace,
                 const glm::vec3& rayEnd_worldSpace) const;
 
+            //
+            // Scene Queries
+            //
+            // Only read from the scene, so may be called concurrently with each other, but not with
+            // simulation steps or anything that modifies the scene
+            //
+            [[nodiscard]] std::optional<SceneQueryHit> Raycast(const RaycastQuery& query) const;
+            [[nodiscard]] std::optional<SceneQueryHit> Sweep(const SweepQuery& query) const;
+            [[nodiscard]] std::size_t Overlap(const OverlapQuery& query,
+                                              std::span<physx::PxOverlapHit> pxHitBuffer,
+                                              std::span<SceneQueryObject> hits) const;
+
             //
             // PxSimulationEventCallback
             //
@@ -130,8 +146,6 @@ namespace Accela::Engine
                 RigidBody data;
                 physx::PxRigidActor* pRigidActor{nullptr};
                 std::vector<std::pair<physx::PxShape*, physx::PxMaterial*>> shapes;
-
-                bool isDirty{false};
             };
 
             struct PhysXPlayerController
@@ -182,6 +196,7 @@ namespace Accela::Engine
             [[nodiscard]] static inline physx::PxRigidDynamic* GetAsRigidDynamic(const physx::PxRigidActor* pRigidActor);
 
             [[nodiscard]] std::optional<std::variant<EntityId, PlayerControllerName>> PxRigidActorToEntity(physx::PxRigidActor* pRigidActor) const;
+            [[nodiscard]] std::optional<SceneQueryHit> ToSceneQueryHit(const physx::PxLocationHit& pxHit) const;
 
         private:
 
@@ -195,6 +210,7 @@ namespace Accela::Engine
             physx::PxScene* m_pScene{nullptr};
             physx::PxControllerManager* m_pControllerManager{nullptr};
             physx::PxCudaContextManager* m_pCudaContextManager{nullptr};
+            PhysXTriangleMeshCache::Ptr m_triangleMeshCache;
 
             // Rigid Bodies
             std::unordered_map<EntityId, PhysXRigidBody> m_entityToRigidBody;
@@ -205,6 +221,9 @@ namespace Accela::Engine
             std::unordered_map<physx::PxActor*, PlayerControllerName> m_physXActorToPlayerController;
 
             std::queue<PhysicsTriggerEvent> m_triggerEvents;
+
+            // State of bodies which moved during simulation steps, since last popped
+            std::vector<RigidBodyDelta> m_rigidBodyDeltas;
     };
 }
 
@@ -0,0 +1,386 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "PhysXTriangleMeshCache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <format>
+
+namespace Accela::Engine
+{
+
+static constexpr uint32_t COOKED_MESH_FILE_MAGIC = 0x4D435041; // "APCM"
+static constexpr uint32_t COOKED_MESH_FILE_VERSION = 1;
+
+struct CookedMeshFileHeader
+{
+    uint32_t magic{COOKED_MESH_FILE_MAGIC};
+    uint32_t version{COOKED_MESH_FILE_VERSION};
+    uint32_t physxVersion{PX_PHYSICS_VERSION};
+    uint32_t numVertices{0};
+    uint32_t numIndices{0};
+    uint32_t dataByteSize{0};
+    uint64_t hash{0};
+};
+
+// 64-bit FNV-1a, continued from the provided hash
+static uint64_t HashBytes(uint64_t hash, const void* pData, const std::size_t& byteSize)
+{
+    const auto* pBytes = static_cast<const unsigned char*>(pData);
+
+    for (std::size_t x = 0; x < byteSize; ++x)
+    {
+        hash ^= (uint64_t)pBytes[x];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+template <typename T>
+static uint64_t HashValue(uint64_t hash, const T& value)
+{
+    return HashBytes(hash, &value, sizeof(T));
+}
+
+PhysXTriangleMeshCache::PhysXTriangleMeshCache(Common::ILogger::Ptr logger,
+                                               physx::PxPhysics* pPhysics,
+                                               std::optional<std::string> cacheDirectory)
+    : m_logger(std::move(logger))
+    , m_pPhysics(pPhysics)
+    , m_cacheDirectory(std::move(cacheDirectory))
+{
+
+}
+
+physx::PxTriangleMesh* PhysXTriangleMeshCache::GetTriangleMesh(const std::vector<physx::PxVec3>& vertices,
+                                                               const std::vector<physx::PxU32>& indices,
+                                                               const physx::PxCookingParams& params,
+                                                               bool validate,
+                                                               const std::string& tag)
+{
+    const auto key = CalculateKey(vertices, indices, params);
+
+    //
+    // Only the mesh's own entry is locked while it's loaded or cooked, so that other meshes can be fetched
+    // or cooked in the meantime. Concurrent requests for this mesh wait here until it's ready.
+    //
+    const auto entry = GetOrCreateEntry(key);
+
+    std::lock_guard<std::mutex> entryLock(entry->mutex);
+
+    //
+    // Return the existing mesh, if the mesh has already been cooked
+    //
+    if (entry->pTriangleMesh != nullptr)
+    {
+        return entry->pTriangleMesh;
+    }
+
+    //
+    // Otherwise, load the mesh from disk, if it was cooked in a previous run
+    //
+    if (auto* pTriangleMesh = LoadFromDisk(key))
+    {
+        m_logger->Log(Common::LogLevel::Debug,
+          "PhysXTriangleMeshCache: Loaded cooked mesh from disk: {}, key: {:016x}", tag, key.hash);
+
+        entry->pTriangleMesh = pTriangleMesh;
+        return pTriangleMesh;
+    }
+
+    //
+    // Otherwise, cook the mesh
+    //
+    physx::PxTriangleMeshDesc meshDesc;
+    meshDesc.points.count           = (physx::PxU32)vertices.size();
+    meshDesc.points.stride          = sizeof(physx::PxVec3);
+    meshDesc.points.data            = vertices.data();
+
+    meshDesc.triangles.count        = (physx::PxU32)(indices.size() / 3);
+    meshDesc.triangles.stride       = 3 * sizeof(physx::PxU32);
+    meshDesc.triangles.data         = indices.data();
+
+    if (validate && !PxValidateTriangleMesh(params, meshDesc))
+    {
+        m_logger->Log(Common::LogLevel::Warning, "PhysXTriangleMeshCache: Mesh failed validation: {}", tag);
+    }
+
+    // Note: on failure the entry is left empty, so that a later request tries to cook the mesh again
+    entry->pTriangleMesh = CookMesh(key, meshDesc, params, tag);
+
+    return entry->pTriangleMesh;
+}
+
+PhysXTriangleMeshCache::MeshEntry::Ptr PhysXTriangleMeshCache::GetOrCreateEntry(const MeshKey& key)
+{
+    std::lock_guard<std::mutex> lock(m_meshesMutex);
+
+    auto& entry = m_meshes[key];
+    if (!entry)
+    {
+        entry = std::make_shared<MeshEntry>();
+    }
+
+    return entry;
+}
+
+physx::PxTriangleMesh* PhysXTriangleMeshCache::CookMesh(const MeshKey& key,
+                                                        const physx::PxTriangleMeshDesc& meshDesc,
+                                                        const physx::PxCookingParams& params,
+                                                        const std::string& tag)
+{
+    m_logger->Log(Common::LogLevel::Debug, "PhysXTriangleMeshCache: Cooking mesh: {}, key: {:016x}", tag, key.hash);
+
+    //
+    // Without a disk cache, insert the mesh directly into PhysX, skipping serialization
+    //
+    if (!m_cacheDirectory)
+    {
+        auto* pTriangleMesh = PxCreateTriangleMesh(params, meshDesc, m_pPhysics->getPhysicsInsertionCallback());
+        if (pTriangleMesh == nullptr)
+        {
+            m_logger->Log(Common::LogLevel::Error, "PhysXTriangleMeshCache: Failed to create triangle mesh: {}", tag);
+        }
+
+        return pTriangleMesh;
+    }
+
+    //
+    // Otherwise, cook the mesh into a buffer, persist the buffer, and create the mesh from it
+    //
+    physx::PxDefaultMemoryOutputStream cookedData;
+
+    if (!PxCookTriangleMesh(params, meshDesc, cookedData))
+    {
+        m_logger->Log(Common::LogLevel::Error, "PhysXTriangleMeshCache: Failed to cook triangle mesh: {}", tag);
+        return nullptr;
+    }
+
+    physx::PxDefaultMemoryInputData inputData(cookedData.getData(), cookedData.getSize());
+
+    auto* pTriangleMesh = m_pPhysics->createTriangleMesh(inputData);
+    if (pTriangleMesh == nullptr)
+    {
+        m_logger->Log(Common::LogLevel::Error, "PhysXTriangleMeshCache: Failed to create triangle mesh: {}", tag);
+        return nullptr;
+    }
+
+    SaveToDisk(key, cookedData);
+
+    return pTriangleMesh;
+}
+
+void PhysXTriangleMeshCache::PruneUnused()
+{
+    std::lock_guard<std::mutex> lock(m_meshesMutex);
+
+    std::erase_if(m_meshes, [](const auto& it){
+        // Entries can only be fetched while m_meshesMutex is held, so if the map holds the only reference to
+        // the entry, no other thread is waiting on or cooking its mesh
+        if (it.second.use_count() > 1) { return false; }
+
+        std::lock_guard<std::mutex> entryLock(it.second->mutex);
+
+        if (it.second->pTriangleMesh != nullptr)
+        {
+            // If our reference is the only one left, nothing is using the mesh anymore
+            if (it.second->pTriangleMesh->getReferenceCount() > 1) { return false; }
+
+            it.second->pTriangleMesh->release();
+        }
+
+        return true;
+    });
+}
+
+void PhysXTriangleMeshCache::Destroy()
+{
+    std::lock_guard<std::mutex> lock(m_meshesMutex);
+
+    if (!m_meshes.empty())
+    {
+        m_logger->Log(Common::LogLevel::Info, "PhysXTriangleMeshCache: Releasing {} triangle meshes", m_meshes.size());
+    }
+
+    for (auto& it : m_meshes)
+    {
+        std::lock_guard<std::mutex> entryLock(it.second->mutex);
+
+        if (it.second->pTriangleMesh != nullptr)
+        {
+            it.second->pTriangleMesh->release();
+            it.second->pTriangleMesh = nullptr;
+        }
+    }
+
+    m_meshes.clear();
+}
+
+std::size_t PhysXTriangleMeshCache::GetNumMeshes() const
+{
+    std::lock_guard<std::mutex> lock(m_meshesMutex);
+    return m_meshes.size();
+}
+
+PhysXTriangleMeshCache::MeshKey PhysXTriangleMeshCache::CalculateKey(const std::vector<physx::PxVec3>& vertices,
+                                                                     const std::vector<physx::PxU32>& indices,
+                                                                     const physx::PxCookingParams& params)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    hash = HashBytes(hash, vertices.data(), vertices.size() * sizeof(physx::PxVec3));
+    hash = HashBytes(hash, indices.data(), indices.size() * sizeof(physx::PxU32));
+
+    //
+    // All of the cooking params, including those which only apply to other kinds of meshes, so that no change
+    // to the params can ever return a mesh cooked differently. Hashed field by field, as the params struct
+    // has padding.
+    //
+    hash = HashValue(hash, params.areaTestEpsilon);
+    hash = HashValue(hash, params.planeTolerance);
+    hash = HashValue(hash, (physx::PxU32)params.convexMeshCookingType);
+    hash = HashValue(hash, params.suppressTriangleMeshRemapTable);
+    hash = HashValue(hash, params.buildTriangleAdjacencies);
+    hash = HashValue(hash, params.buildGPUData);
+    hash = HashValue(hash, params.scale.length);
+    hash = HashValue(hash, params.scale.speed);
+    hash = HashValue(hash, (physx::PxU32)params.meshPreprocessParams);
+    hash = HashValue(hash, params.meshWeldTolerance);
+    hash = HashValue(hash, params.meshAreaMinLimit);
+    hash = HashValue(hash, params.meshEdgeLengthMaxLimit);
+    hash = HashValue(hash, params.gaussMapLimit);
+    hash = HashValue(hash, params.maxWeightRatioInTet);
+
+    const auto midphaseType = params.midphaseDesc.getType();
+    hash = HashValue(hash, (physx::PxU32)midphaseType);
+
+    if (midphaseType == physx::PxMeshMidPhase::eBVH33)
+    {
+        hash = HashValue(hash, params.midphaseDesc.mBVH33Desc.meshSizePerformanceTradeOff);
+        hash = HashValue(hash, (physx::PxU32)params.midphaseDesc.mBVH33Desc.meshCookingHint);
+    }
+    else if (midphaseType == physx::PxMeshMidPhase::eBVH34)
+    {
+        hash = HashValue(hash, params.midphaseDesc.mBVH34Desc.numPrimsPerLeaf);
+        hash = HashValue(hash, (physx::PxU32)params.midphaseDesc.mBVH34Desc.buildStrategy);
+        hash = HashValue(hash, params.midphaseDesc.mBVH34Desc.quantized);
+    }
+
+    MeshKey key{};
+    key.hash = hash;
+    key.numVertices = (uint32_t)vertices.size();
+    key.numIndices = (uint32_t)indices.size();
+
+    return key;
+}
+
+std::optional<std::string> PhysXTriangleMeshCache::GetCacheFilePath(const MeshKey& key) const
+{
+    if (!m_cacheDirectory) { return std::nullopt; }
+
+    const auto fileName = std::format("collision_{:016x}_{}_{}.bin", key.hash, key.numVertices, key.numIndices);
+
+    return (std::filesystem::path(*m_cacheDirectory) / fileName).string();
+}
+
+physx::PxTriangleMesh* PhysXTriangleMeshCache::LoadFromDisk(const MeshKey& key)
+{
+    const auto filePath = GetCacheFilePath(key);
+    if (!filePath) { return nullptr; }
+
+    std::ifstream file(*filePath, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+    {
+        return nullptr;
+    }
+
+    CookedMeshFileHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    {
+        return nullptr;
+    }
+
+    // Note that the PhysX version is checked so that data cooked by a different PhysX version is ignored
+    if (header.magic != COOKED_MESH_FILE_MAGIC ||
+        header.version != COOKED_MESH_FILE_VERSION ||
+        header.physxVersion != PX_PHYSICS_VERSION ||
+        header.hash != key.hash ||
+        header.numVertices != key.numVertices ||
+        header.numIndices != key.numIndices)
+    {
+        m_logger->Log(Common::LogLevel::Warning,
+          "PhysXTriangleMeshCache: Ignoring stale cooked mesh file: {}", *filePath);
+        return nullptr;
+    }
+
+    std::vector<physx::PxU8> data(header.dataByteSize);
+    if (!file.read(reinterpret_cast<char*>(data.data()), (std::streamsize)data.size()))
+    {
+        m_logger->Log(Common::LogLevel::Warning,
+          "PhysXTriangleMeshCache: Ignoring truncated cooked mesh file: {}", *filePath);
+        return nullptr;
+    }
+
+    physx::PxDefaultMemoryInputData inputData(data.data(), (physx::PxU32)data.size());
+
+    return m_pPhysics->createTriangleMesh(inputData);
+}
+
+void PhysXTriangleMeshCache::SaveToDisk(const MeshKey& key, const physx::PxDefaultMemoryOutputStream& cookedData) const
+{
+    const auto filePath = GetCacheFilePath(key);
+    if (!filePath) { return; }
+
+    std::error_code ec;
+    std::filesystem::create_directories(*m_cacheDirectory, ec);
+    if (ec)
+    {
+        m_logger->Log(Common::LogLevel::Warning,
+          "PhysXTriangleMeshCache: Failed to create cache directory: {}, error: {}", *m_cacheDirectory, ec.message());
+        return;
+    }
+
+    CookedMeshFileHeader header{};
+    header.numVertices = key.numVertices;
+    header.numIndices = key.numIndices;
+    header.dataByteSize = cookedData.getSize();
+    header.hash = key.hash;
+
+    // Write to a temp file and rename it into place, so a partially written file is never read
+    const auto tempFilePath = *filePath + ".tmp";
+
+    {
+        std::ofstream file(tempFilePath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            m_logger->Log(Common::LogLevel::Warning,
+              "PhysXTriangleMeshCache: Failed to open cooked mesh file for writing: {}", tempFilePath);
+            return;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(cookedData.getData()), (std::streamsize)cookedData.getSize());
+
+        if (!file.good())
+        {
+            m_logger->Log(Common::LogLevel::Warning,
+              "PhysXTriangleMeshCache: Failed to write cooked mesh file: {}", tempFilePath);
+            return;
+        }
+    }
+
+    std::filesystem::rename(tempFilePath, *filePath, ec);
+    if (ec)
+    {
+        m_logger->Log(Common::LogLevel::Warning,
+          "PhysXTriangleMeshCache: Failed to rename cooked mesh file: {}, error: {}", *filePath, ec.message());
+        std::filesystem::remove(tempFilePath, ec);
+    }
+}
+
+}
@@ -0,0 +1,145 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAENGINE_SRC_PHYSICS_PHYSXTRIANGLEMESHCACHE_H
+#define LIBACCELAENGINE_SRC_PHYSICS_PHYSXTRIANGLEMESHCACHE_H
+
+#include "PhysXWrapper.h"
+
+#include <Accela/Common/Log/ILogger.h>
+
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <optional>
+#include <mutex>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Engine
+{
+    /**
+     * Content-addressed cache of cooked PhysX triangle meshes.
+     *
+     * Meshes are keyed by a hash of their vertices, indices, and the cooking parameters that affect the cooked
+     * result, so identical mesh data is only ever cooked once, no matter how many shapes, bodies, or scenes
+     * use it. The cache holds one PhysX reference to each mesh it hands out; shapes created from a mesh hold
+     * their own references, so a mesh stays alive for as long as any scene is using it.
+     *
+     * If a cache directory is provided, cooked mesh data is additionally persisted to disk and loaded back on
+     * subsequent runs, skipping cooking entirely.
+     *
+     * Thread safe. Meshes are cooked while holding only their own key's lock, so requests for different
+     * meshes cook concurrently, while concurrent requests for the same mesh wait for it to be cooked once.
+     */
+    class PhysXTriangleMeshCache
+    {
+        public:
+
+            using Ptr = std::shared_ptr<PhysXTriangleMeshCache>;
+
+        public:
+
+            /**
+             * @param logger The logger to use
+             * @param pPhysics The PhysX physics instance to create meshes with
+             * @param cacheDirectory Directory to persist cooked meshes to, or std::nullopt for no disk cache
+             */
+            PhysXTriangleMeshCache(Common::ILogger::Ptr logger,
+                                   physx::PxPhysics* pPhysics,
+                                   std::optional<std::string> cacheDirectory);
+
+            /**
+             * Returns a triangle mesh for the provided mesh data and cooking params, cooking it only if an
+             * identical mesh isn't already in memory or on disk.
+             *
+             * The returned mesh is owned by the cache; it remains valid until the next call to PruneUnused
+             * or Destroy, so the caller should create a shape from it (which takes its own reference) before then.
+             *
+             * @param vertices The mesh's vertices
+             * @param indices The mesh's triangle indices
+             * @param params The params to cook the mesh with
+             * @param validate Whether to validate the mesh before cooking it
+             * @param tag Tag to identify the mesh with in logging
+             *
+             * @return The triangle mesh, or nullptr on error
+             */
+            [[nodiscard]] physx::PxTriangleMesh* GetTriangleMesh(const std::vector<physx::PxVec3>& vertices,
+                                                                 const std::vector<physx::PxU32>& indices,
+                                                                 const physx::PxCookingParams& params,
+                                                                 bool validate,
+                                                                 const std::string& tag);
+
+            /**
+             * Releases the cache's reference to any mesh which is no longer in use by any shape
+             */
+            void PruneUnused();
+
+            /**
+             * Releases the cache's reference to all meshes
+             */
+            void Destroy();
+
+            [[nodiscard]] std::size_t GetNumMeshes() const;
+
+        private:
+
+            struct MeshKey
+            {
+                uint64_t hash{0};
+                uint32_t numVertices{0};
+                uint32_t numIndices{0};
+
+                auto operator<=>(const MeshKey&) const = default;
+            };
+
+            struct MeshKeyHash
+            {
+                std::size_t operator()(const MeshKey& key) const noexcept { return (std::size_t)key.hash; }
+            };
+
+            struct MeshEntry
+            {
+                using Ptr = std::shared_ptr<MeshEntry>;
+
+                // Held while the mesh is loaded or cooked, and while reading or releasing it
+                std::mutex mutex;
+
+                // The mesh, or nullptr if it hasn't been (successfully) loaded or cooked yet
+                physx::PxTriangleMesh* pTriangleMesh{nullptr};
+            };
+
+        private:
+
+            [[nodiscard]] static MeshKey CalculateKey(const std::vector<physx::PxVec3>& vertices,
+                                                      const std::vector<physx::PxU32>& indices,
+                                                      const physx::PxCookingParams& params);
+
+            [[nodiscard]] MeshEntry::Ptr GetOrCreateEntry(const MeshKey& key);
+
+            [[nodiscard]] physx::PxTriangleMesh* CookMesh(const MeshKey& key,
+                                                          const physx::PxTriangleMeshDesc& meshDesc,
+                                                          const physx::PxCookingParams& params,
+                                                          const std::string& tag);
+
+            [[nodiscard]] std::optional<std::string> GetCacheFilePath(const MeshKey& key) const;
+            [[nodiscard]] physx::PxTriangleMesh* LoadFromDisk(const MeshKey& key);
+            void SaveToDisk(const MeshKey& key, const physx::PxDefaultMemoryOutputStream& cookedData) const;
+
+        private:
+
+            Common::ILogger::Ptr m_logger;
+            physx::PxPhysics* m_pPhysics;
+            std::optional<std::string> m_cacheDirectory;
+
+            // Guards m_meshes itself; each entry's mesh is guarded by the entry's own mutex
+            mutable std::mutex m_meshesMutex;
+            std::unordered_map<MeshKey, MeshEntry::Ptr, MeshKeyHash> m_meshes;
+    };
+}
+
+#endif //LIBACCELAENGINE_SRC_PHYSICS_PHYSXTRIANGLEMESHCACHE_H
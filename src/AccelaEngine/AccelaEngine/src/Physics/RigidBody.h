@@ -86,6 +86,9 @@ namespace Accela::Engine
 
         // Local orientation of the shape's bounds relative to the body's model space
         glm::quat localOrientation;
+
+        // Filter groups the shape belongs to, for scene query filtering
+        PhysicsFilterGroups filterGroups{PHYSICS_FILTER_GROUPS_ALL};
     };
 
     struct RigidActorData
@@ -113,6 +116,17 @@ namespace Accela::Engine
         RigidActorData actor;
         RigidBodyData body;
     };
+
+    /**
+     * The simulated state of a rigid body which moved during a simulation step
+     */
+    struct RigidBodyDelta
+    {
+        EntityId eid;
+        glm::vec3 position;
+        glm::quat orientation;
+        glm::vec3 linearVelocity;
+    };
 }
 
 #endif //LIBACCELAENGINE_INCLUDE_ACCELA_ENGINE_PHYSICS_RIGIDBODY_H
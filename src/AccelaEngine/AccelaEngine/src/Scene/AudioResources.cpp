@@ -10,7 +10,6 @@
 #include "../Audio/AudioManager.h"
 #include "../Audio/AudioUtil.h"
 
-#include <Accela/Common/Thread/ResultMessage.h>
 #include <Accela/Common/Thread/ThreadUtil.h>
 
 #include <cstring>
@@ -21,27 +20,20 @@ namespace Accela::Engine
 AudioResources::AudioResources(Common::ILogger::Ptr logger,
                                PackageResourcesPtr packages,
                                AudioManagerPtr audioManager,
-                               std::shared_ptr<Common::MessageDrivenThreadPool> threadPool)
+                               Common::JobSystem::Ptr jobSystem)
     : m_logger(std::move(logger))
     , m_packages(std::move(packages))
     , m_audioManager(std::move(audioManager))
-    , m_threadPool(std::move(threadPool))
+    , m_jobSystem(std::move(jobSystem))
 {
 
 }
 
 std::future<bool> AudioResources::LoadAudio(const PackageResourceIdentifier& resource)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnLoadAudio(resource)
-        );
+    return m_jobSystem->SubmitForResult<bool>([=,this](){
+        return OnLoadAudio(resource);
     });
-
-    return messageFuture;
 }
 
 bool AudioResources::OnLoadAudio(const PackageResourceIdentifier& resource)
@@ -83,16 +75,9 @@ bool AudioResources::LoadAudio(const CustomResourceIdentifier& resource, const C
 
 std::future<bool> AudioResources::LoadAllAudio(const PackageName& packageName)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnLoadAllAudio(packageName)
-        );
+    return m_jobSystem->SubmitForResult<bool>([=,this](){
+        return OnLoadAllAudio(packageName);
     });
-
-    return messageFuture;
 }
 
 bool AudioResources::OnLoadAllAudio(const PackageName& packageName)
@@ -121,16 +106,9 @@ bool AudioResources::OnLoadAllAudio(const PackageName& packageName)
 
 std::future<bool> AudioResources::LoadAllAudio()
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnLoadAllAudio()
-        );
+    return m_jobSystem->SubmitForResult<bool>([=,this](){
+        return OnLoadAllAudio();
     });
-
-    return messageFuture;
 }
 
 bool AudioResources::OnLoadAllAudio()
@@ -237,7 +215,7 @@ bool AudioResources::LoadPackageAudio(const Platform::PackageSource::Ptr& packag
         return false;
     }
 
-    const auto audioData = AudioDataFromBytes(*audioBytes, resource.GetResourceName());
+    const auto audioData = AudioDataFromBytes(audioBytes->GetBytes(), resource.GetResourceName());
     if (!audioData)
     {
         m_logger->Log(Common::LogLevel::Error,
@@ -257,9 +235,9 @@ bool AudioResources::LoadPackageAudio(const Platform::PackageSource::Ptr& packag
     return true;
 }
 
-std::expected<Common::AudioData::Ptr, bool> AudioResources::AudioDataFromBytes(std::vector<std::byte>& bytes, const std::string& tag) const
+std::expected<Common::AudioData::Ptr, bool> AudioResources::AudioDataFromBytes(std::span<const std::byte> bytes, const std::string& tag) const
 {
-    // TODO Perf: Can we avoid the copy?
+    // AudioFile requires its input as a vector of uint8_t
     std::vector<uint8_t> audioUInts(bytes.size());
     memcpy(audioUInts.data(), bytes.data(), bytes.size());
 
@@ -14,11 +14,12 @@
 #include "Accela/Platform/Package/PackageSource.h"
 
 #include <Accela/Common/Log/ILogger.h>
-#include <Accela/Common/Thread/MessageDrivenThreadPool.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 #include <unordered_set>
 #include <unordered_map>
 #include <expected>
+#include <span>
 
 namespace Accela::Platform
 {
@@ -34,7 +35,7 @@ namespace Accela::Engine
             AudioResources(Common::ILogger::Ptr logger,
                            PackageResourcesPtr packages,
                            AudioManagerPtr audioManager,
-                           std::shared_ptr<Common::MessageDrivenThreadPool> threadPool);
+                           Common::JobSystem::Ptr jobSystem);
 
             //
             // IAudioResources
@@ -55,14 +56,14 @@ namespace Accela::Engine
 
             [[nodiscard]] bool LoadPackageAudio(const Platform::PackageSource::Ptr& package, const PackageResourceIdentifier& resource);
 
-            [[nodiscard]] std::expected<Common::AudioData::Ptr, bool> AudioDataFromBytes(std::vector<std::byte>& bytes, const std::string& tag) const;
+            [[nodiscard]] std::expected<Common::AudioData::Ptr, bool> AudioDataFromBytes(std::span<const std::byte> bytes, const std::string& tag) const;
 
         private:
 
             Common::ILogger::Ptr m_logger;
             PackageResourcesPtr m_packages;
             AudioManagerPtr m_audioManager;
-            std::shared_ptr<Common::MessageDrivenThreadPool> m_threadPool;
+            Common::JobSystem::Ptr m_jobSystem;
 
             std::mutex m_audioMutex;
             std::unordered_map<PackageName, std::unordered_set<ResourceIdentifier>> m_packageAudio;
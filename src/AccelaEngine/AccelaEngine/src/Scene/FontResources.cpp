@@ -9,49 +9,33 @@
 
 #include <Accela/Platform/Text/IText.h>
 
-#include <Accela/Common/Thread/ResultMessage.h>
-
 namespace Accela::Engine
 {
 
 FontResources::FontResources(Common::ILogger::Ptr logger,
                              PackageResourcesPtr packages,
                              std::shared_ptr<Platform::IText> text,
-                             std::shared_ptr<Common::MessageDrivenThreadPool> threadPool)
+                             Common::JobSystem::Ptr jobSystem)
      : m_logger(std::move(logger))
      , m_packages(std::move(packages))
      , m_text(std::move(text))
-     , m_threadPool(std::move(threadPool))
+     , m_jobSystem(std::move(jobSystem))
 {
 
 }
 
 std::future<bool> FontResources::LoadFont(const PackageResourceIdentifier& resource, uint8_t fontSize)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnLoadFont(resource, fontSize, fontSize)
-        );
+    return m_jobSystem->SubmitForResult<bool>([=,this](){
+        return OnLoadFont(resource, fontSize, fontSize);
     });
-
-    return messageFuture;
 }
 
 std::future<bool> FontResources::LoadFont(const PackageResourceIdentifier& resource, uint8_t startFontSize, uint8_t endFontSize)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnLoadFont(resource, startFontSize, endFontSize)
-        );
+    return m_jobSystem->SubmitForResult<bool>([=,this](){
+        return OnLoadFont(resource, startFontSize, endFontSize);
     });
-
-    return messageFuture;
 }
 
 bool FontResources::OnLoadFont(const PackageResourceIdentifier& resource, uint8_t startFontSize, uint8_t endFontSize)
@@ -69,16 +53,9 @@ bool FontResources::OnLoadFont(const PackageResourceIdentifier& resource, uint8_
 
 std::future<bool> FontResources::LoadAllFonts(const PackageName& packageName, uint8_t startFontSize, uint8_t endFontSize)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnLoadAllFonts(packageName, startFontSize, endFontSize)
-        );
+    return m_jobSystem->SubmitForResult<bool>([=,this](){
+        return OnLoadAllFonts(packageName, startFontSize, endFontSize);
     });
-
-    return messageFuture;
 }
 
 bool FontResources::OnLoadAllFonts(const PackageName& packageName, uint8_t startFontSize, uint8_t endFontSize)
@@ -110,16 +87,9 @@ bool FontResources::OnLoadAllFonts(const PackageName& packageName, uint8_t start
 
 std::future<bool> FontResources::LoadAllFonts(uint8_t startFontSize, uint8_t endFontSize)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnLoadAllFonts(startFontSize, endFontSize)
-        );
+    return m_jobSystem->SubmitForResult<bool>([=,this](){
+        return OnLoadAllFonts(startFontSize, endFontSize);
     });
-
-    return messageFuture;
 }
 
 bool FontResources::OnLoadAllFonts(uint8_t startFontSize, uint8_t endFontSize)
@@ -156,7 +126,7 @@ bool FontResources::LoadPackageFont(const Platform::PackageSource::Ptr& package,
 
     for (uint8_t fontSize = startFontSize; fontSize <= endFontSize; ++fontSize)
     {
-        if (!m_text->LoadFontBlocking(resource.GetResourceName(), *fontData, fontSize)) { allSuccessful = false; }
+        if (!m_text->LoadFontBlocking(resource.GetResourceName(), fontData->GetBytes(), fontSize)) { allSuccessful = false; }
     }
 
     return allSuccessful;
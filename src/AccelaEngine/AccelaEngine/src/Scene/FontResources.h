@@ -14,7 +14,7 @@
 #include "Accela/Platform/Package/PackageSource.h"
 
 #include <Accela/Common/Log/ILogger.h>
-#include <Accela/Common/Thread/MessageDrivenThreadPool.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 namespace Accela::Platform
 {
@@ -36,7 +36,7 @@ namespace Accela::Engine
             FontResources(Common::ILogger::Ptr logger,
                           PackageResourcesPtr packages,
                           std::shared_ptr<Platform::IText> text,
-                          std::shared_ptr<Common::MessageDrivenThreadPool> threadPool);
+                          Common::JobSystem::Ptr jobSystem);
 
             //
             // IFontResources
@@ -66,7 +66,7 @@ namespace Accela::Engine
             Common::ILogger::Ptr m_logger;
             PackageResourcesPtr m_packages;
             std::shared_ptr<Platform::IText> m_text;
-            std::shared_ptr<Common::MessageDrivenThreadPool> m_threadPool;
+            Common::JobSystem::Ptr m_jobSystem;
     };
 }
 
@@ -10,26 +10,17 @@
 
 #include <Accela/Render/IRenderer.h>
 
-#include <Accela/Common/Thread/ResultMessage.h>
-
 namespace Accela::Engine
 {
 
-struct MaterialResultMessage : public Common::ResultMessage<Render::MaterialId>
-{
-    MaterialResultMessage()
-        : Common::ResultMessage<Render::MaterialId>("MaterialResultMessage")
-    { }
-};
-
 MaterialResources::MaterialResources(Common::ILogger::Ptr logger,
                                      ITextureResourcesPtr textures,
                                      std::shared_ptr<Render::IRenderer> renderer,
-                                     std::shared_ptr<Common::MessageDrivenThreadPool> threadPool)
+                                     Common::JobSystem::Ptr jobSystem)
     : m_logger(std::move(logger))
     , m_textures(std::move(textures))
     , m_renderer(std::move(renderer))
-    , m_threadPool(std::move(threadPool))
+    , m_jobSystem(std::move(jobSystem))
 {
 
 }
@@ -39,16 +30,9 @@ std::future<Render::MaterialId> MaterialResources::LoadObjectMaterial(
     const ObjectMaterialProperties& properties,
     ResultWhen resultWhen)
 {
-    auto message = std::make_shared<MaterialResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<MaterialResultMessage>(_message)->SetResult(
-            OnLoadObjectMaterial(resource, properties, resultWhen)
-        );
+    return m_jobSystem->SubmitForResult<Render::MaterialId>([=,this](){
+        return OnLoadObjectMaterial(resource, properties, resultWhen);
     });
-
-    return messageFuture;
 }
 
 Render::MaterialId MaterialResources::OnLoadObjectMaterial(const CustomResourceIdentifier& resource,
@@ -14,7 +14,7 @@
 #include <Accela/Render/Id.h>
 
 #include <Accela/Common/Log/ILogger.h>
-#include <Accela/Common/Thread/MessageDrivenThreadPool.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 #include <unordered_map>
 #include <expected>
@@ -33,7 +33,7 @@ namespace Accela::Engine
             MaterialResources(Common::ILogger::Ptr logger,
                               ITextureResourcesPtr textures,
                               std::shared_ptr<Render::IRenderer> renderer,
-                              std::shared_ptr<Common::MessageDrivenThreadPool> threadPool);
+                              Common::JobSystem::Ptr jobSystem);
 
             //
             // IMaterialResources
@@ -65,7 +65,7 @@ namespace Accela::Engine
             Common::ILogger::Ptr m_logger;
             ITextureResourcesPtr m_textures;
             std::shared_ptr<Render::IRenderer> m_renderer;
-            std::shared_ptr<Common::MessageDrivenThreadPool> m_threadPool;
+            Common::JobSystem::Ptr m_jobSystem;
 
             mutable std::mutex m_materialsMutex;
             std::unordered_map<ResourceIdentifier, Render::MaterialId> m_materials;
@@ -13,28 +13,19 @@
 #include <Accela/Render/IRenderer.h>
 #include <Accela/Render/Mesh/StaticMesh.h>
 
-#include <Accela/Common/Thread/ResultMessage.h>
-
 namespace Accela::Engine
 {
 
-struct MeshResultMessage : public Common::ResultMessage<Render::MeshId>
-{
-    MeshResultMessage()
-        : Common::ResultMessage<Render::MeshId>("MeshResultMessage")
-    { }
-};
-
 MeshResources::MeshResources(Common::ILogger::Ptr logger,
                              ITextureResourcesPtr textures,
                              std::shared_ptr<Render::IRenderer> renderer,
                              std::shared_ptr<Platform::IFiles> files,
-                             std::shared_ptr<Common::MessageDrivenThreadPool> threadPool)
+                             Common::JobSystem::Ptr jobSystem)
     : m_logger(std::move(logger))
     , m_textures(std::move(textures))
     , m_renderer(std::move(renderer))
     , m_files(std::move(files))
-    , m_threadPool(std::move(threadPool))
+    , m_jobSystem(std::move(jobSystem))
 {
 
 }
@@ -45,16 +36,9 @@ std::future<Render::MeshId> MeshResources::LoadStaticMesh(const CustomResourceId
                                                           Render::MeshUsage usage,
                                                           ResultWhen resultWhen)
 {
-    auto message = std::make_shared<MeshResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<MeshResultMessage>(_message)->SetResult(
-            OnLoadStaticMesh(resource, vertices, indices, usage, resultWhen)
-        );
+    return m_jobSystem->SubmitForResult<Render::MeshId>([=,this](){
+        return OnLoadStaticMesh(resource, vertices, indices, usage, resultWhen);
     });
-
-    return messageFuture;
 }
 
 std::future<Render::MeshId> MeshResources::LoadHeightMapMesh(const CustomResourceIdentifier& resource,
@@ -66,16 +50,9 @@ std::future<Render::MeshId> MeshResources::LoadHeightMapMesh(const CustomResourc
                                                              Render::MeshUsage usage,
                                                              ResultWhen resultWhen)
 {
-    auto message = std::make_shared<MeshResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<MeshResultMessage>(_message)->SetResult(
-            OnLoadHeightMapMesh(resource, heightMapTextureId, heightMapDataSize, meshSize_worldSpace, displacementFactor, uvSpanWorldSize, usage, resultWhen)
-        );
+    return m_jobSystem->SubmitForResult<Render::MeshId>([=,this](){
+        return OnLoadHeightMapMesh(resource, heightMapTextureId, heightMapDataSize, meshSize_worldSpace, displacementFactor, uvSpanWorldSize, usage, resultWhen);
     });
-
-    return messageFuture;
 }
 
 std::future<Render::MeshId> MeshResources::LoadHeightMapMesh(const CustomResourceIdentifier& resource,
@@ -87,16 +64,9 @@ std::future<Render::MeshId> MeshResources::LoadHeightMapMesh(const CustomResourc
                                                              Render::MeshUsage usage,
                                                              ResultWhen resultWhen)
 {
-    auto message = std::make_shared<MeshResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=, this](const Common::Message::Ptr& _message) {
-        std::dynamic_pointer_cast<MeshResultMessage>(_message)->SetResult(
-            OnLoadHeightMapMesh(resource, heightMapImage, heightMapDataSize, meshSize_worldSpace, displacementFactor, uvSpanWorldSize, usage, resultWhen)
-        );
+    return m_jobSystem->SubmitForResult<Render::MeshId>([=,this](){
+        return OnLoadHeightMapMesh(resource, heightMapImage, heightMapDataSize, meshSize_worldSpace, displacementFactor, uvSpanWorldSize, usage, resultWhen);
     });
-
-    return messageFuture;
 }
 
 Render::MeshId MeshResources::OnLoadStaticMesh(const CustomResourceIdentifier& resource,
@@ -169,6 +139,14 @@ Render::MeshId MeshResources::OnLoadHeightMapMesh(const CustomResourceIdentifier
                                                   Render::MeshUsage usage,
                                                   ResultWhen resultWhen)
 {
+    // Height maps are sampled per-pixel on the CPU, which block-compressed data can't provide
+    if (heightMapImage->IsBlockCompressed())
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "OnLoadHeightMapMesh: Height map image is block-compressed, which isn't supported: {}", resource.GetUniqueName());
+        return Render::MeshId::Invalid();
+    }
+
     //
     // Parse the image data to generate height map data
     //
@@ -13,7 +13,7 @@
 #include <Accela/Engine/Scene/HeightMapData.h>
 
 #include <Accela/Common/Log/ILogger.h>
-#include <Accela/Common/Thread/MessageDrivenThreadPool.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 #include <mutex>
 #include <unordered_map>
@@ -38,7 +38,7 @@ namespace Accela::Engine
                           ITextureResourcesPtr textures,
                           std::shared_ptr<Render::IRenderer> renderer,
                           std::shared_ptr<Platform::IFiles> files,
-                          std::shared_ptr<Common::MessageDrivenThreadPool> threadPool);
+                          Common::JobSystem::Ptr jobSystem);
 
             //
             // IMeshResources
@@ -128,7 +128,7 @@ namespace Accela::Engine
             ITextureResourcesPtr m_textures;
             std::shared_ptr<Render::IRenderer> m_renderer;
             std::shared_ptr<Platform::IFiles> m_files;
-            std::shared_ptr<Common::MessageDrivenThreadPool> m_threadPool;
+            Common::JobSystem::Ptr m_jobSystem;
 
             mutable std::mutex m_meshesMutex;
             std::unordered_map<ResourceIdentifier, Render::MeshId> m_meshes; // Ids of all loaded meshes
@@ -14,22 +14,29 @@
 #include <Accela/Render/IRenderer.h>
 #include <Accela/Render/Mesh/StaticMesh.h>
 #include <Accela/Render/Mesh/BoneMesh.h>
+#include <Accela/Render/Mesh/MeshSimplifier.h>
 
-#include <Accela/Common/Thread/ResultMessage.h>
+#include <unordered_set>
+#include <atomic>
+#include <cstdint>
+#include <cassert>
 
 namespace Accela::Engine
 {
 
+// Meshes with fewer triangles than this aren't worth generating LODs for
+static constexpr std::size_t MIN_LOD_TRIANGLE_COUNT = 512;
+
 ModelResources::ModelResources(Common::ILogger::Ptr logger,
                                PackageResourcesPtr packages,
                                std::shared_ptr<Render::IRenderer> renderer,
                                std::shared_ptr<Platform::IFiles> files,
-                               std::shared_ptr<Common::MessageDrivenThreadPool> threadPool)
+                               Common::JobSystem::Ptr jobSystem)
    : m_logger(std::move(logger))
    , m_packages(std::move(packages))
    , m_renderer(std::move(renderer))
    , m_files(std::move(files))
-   , m_threadPool(std::move(threadPool))
+   , m_jobSystem(std::move(jobSystem))
    , m_modelLoader(m_logger)
 {
 
@@ -37,44 +44,23 @@ ModelResources::ModelResources(Common::ILogger::Ptr logger,
 
 std::future<bool> ModelResources::LoadModel(const PackageResourceIdentifier& resource, ResultWhen resultWhen)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnLoadModel(resource, resultWhen)
-        );
+    return SubmitLoad([=,this](const LoadCallback& onResult){
+        OnLoadModel(resource, resultWhen, onResult);
     });
-
-    return messageFuture;
 }
 
 std::future<bool> ModelResources::LoadAllModels(const PackageName& packageName, ResultWhen resultWhen)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnLoadAllModels(packageName, resultWhen)
-        );
+    return SubmitLoad([=,this](const LoadCallback& onResult){
+        OnLoadAllModels(packageName, resultWhen, onResult);
     });
-
-    return messageFuture;
 }
 
 std::future<bool> ModelResources::LoadAllModels(ResultWhen resultWhen)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnLoadAllModels(resultWhen)
-        );
+    return SubmitLoad([=,this](const LoadCallback& onResult){
+        OnLoadAllModels(resultWhen, onResult);
     });
-
-    return messageFuture;
 }
 
 std::future<bool> ModelResources::LoadModel(const CustomResourceIdentifier& resource,
@@ -82,26 +68,55 @@ std::future<bool> ModelResources::LoadModel(const CustomResourceIdentifier& reso
                                             const ModelTextures& modelTextures,
                                             ResultWhen resultWhen)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
+    return SubmitLoad([=,this](const LoadCallback& onResult){
+        // Decode any of the model's embedded textures; the rest were provided by the caller
+        const auto allModelTextures = DecodeModelTextures(resource.GetResourceName(), model, std::nullopt, modelTextures);
+        if (!allModelTextures)
+        {
+            m_logger->Log(Common::LogLevel::Error,
+              "ModelResources::LoadModel: Failed to decode model textures: {}", resource.GetUniqueName());
+            onResult(false);
+            return;
+        }
 
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            LoadPackageModelInternal(resource, model, modelTextures, resultWhen)
-        );
+        LoadPackageModelInternal(resource, model, *allModelTextures, resultWhen, onResult);
     });
+}
+
+std::future<bool> ModelResources::SubmitLoad(std::function<void(const LoadCallback&)> load)
+{
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto future = promise->get_future();
+
+    m_jobSystem->Submit([promise, load = std::move(load)](){
+        // The result can be reported from another thread, so whichever of the result or a failure comes
+        // first is the one which is kept
+        auto resultReported = std::make_shared<std::atomic<bool>>(false);
 
-    return messageFuture;
+        try
+        {
+            load([=](bool result){
+                if (!resultReported->exchange(true)) { promise->set_value(result); }
+            });
+        }
+        catch (...)
+        {
+            if (!resultReported->exchange(true)) { promise->set_exception(std::current_exception()); }
+        }
+    });
+
+    return future;
 }
 
-bool ModelResources::OnLoadModel(const PackageResourceIdentifier& resource, ResultWhen resultWhen)
+void ModelResources::OnLoadModel(const PackageResourceIdentifier& resource, ResultWhen resultWhen, const LoadCallback& onResult)
 {
     const auto package = m_packages->GetPackageSource(*resource.GetPackageName());
     if (!package)
     {
         m_logger->Log(Common::LogLevel::Error,
           "ModelResources::OnLoadModel: No such package: {}", resource.GetPackageName()->name);
-        return false;
+        onResult(false);
+        return;
     }
 
     const auto splitFileName = SplitFileName(resource.GetResourceName());
@@ -109,7 +124,8 @@ bool ModelResources::OnLoadModel(const PackageResourceIdentifier& resource, Resu
     {
         m_logger->Log(Common::LogLevel::Error,
           "ModelResources::OnLoadModel: Invalid model file name: {}", resource.GetUniqueName());
-        return false;
+        onResult(false);
+        return;
     }
 
     const auto model = m_modelLoader.LoadModel(resource, *package, splitFileName->second, resource.GetUniqueName());
@@ -117,21 +133,23 @@ bool ModelResources::OnLoadModel(const PackageResourceIdentifier& resource, Resu
     {
         m_logger->Log(Common::LogLevel::Error,
           "ModelResources::OnLoadModel: ModelLoader failed to load model: {}", resource.GetUniqueName());
-        return false;
+        onResult(false);
+        return;
     }
 
-    auto modelTextures = LoadPackageModelTextures(resource, model, *package);
+    auto modelTextures = DecodeModelTextures(resource.GetResourceName(), model, *package, {});
     if (!modelTextures)
     {
         m_logger->Log(Common::LogLevel::Error,
           "ModelResources::OnLoadModel: Failed to load package model textures: {}", resource.GetUniqueName());
-        return false;
+        onResult(false);
+        return;
     }
 
-    return LoadPackageModelInternal(resource, model, *modelTextures, resultWhen);
+    LoadPackageModelInternal(resource, model, *modelTextures, resultWhen, onResult);
 }
 
-bool ModelResources::OnLoadAllModels(const PackageName& packageName, ResultWhen resultWhen)
+void ModelResources::OnLoadAllModels(const PackageName& packageName, ResultWhen resultWhen, const LoadCallback& onResult)
 {
     m_logger->Log(Common::LogLevel::Info, "ModelResources: Loading all model resources for package: {}", packageName.name);
 
@@ -140,53 +158,192 @@ bool ModelResources::OnLoadAllModels(const PackageName& packageName, ResultWhen
     {
         m_logger->Log(Common::LogLevel::Error,
           "ModelResources::OnLoadAllModels: No such package: {}", packageName.name);
-        return false;
+        onResult(false);
+        return;
     }
 
-    bool allSuccessful = true;
-
-    const auto modelResourceNames = (*package)->GetModelResourceNames();
+    std::vector<PackageResourceIdentifier> resources;
 
-    for (const auto& modelResourceName : modelResourceNames)
+    for (const auto& modelResourceName : (*package)->GetModelResourceNames())
     {
-        allSuccessful = allSuccessful && OnLoadModel(PRI(packageName, modelResourceName), resultWhen);
+        resources.push_back(PRI(packageName, modelResourceName));
     }
 
-    return allSuccessful;
+    LoadModels(resources, resultWhen, onResult);
 }
 
-bool ModelResources::OnLoadAllModels(ResultWhen resultWhen)
+void ModelResources::OnLoadAllModels(ResultWhen resultWhen, const LoadCallback& onResult)
 {
     m_logger->Log(Common::LogLevel::Info, "ModelResources: Loading all model resources");
 
-    const auto packages = m_packages->GetAllPackages();
+    // Gather the models of every package, so that they're all loaded in parallel with one another,
+    // rather than one package at a time
+    std::vector<PackageResourceIdentifier> resources;
 
-    bool allSuccessful = true;
+    for (const auto& package : m_packages->GetAllPackages())
+    {
+        const auto packageName = PackageName(package->GetPackageName());
+
+        for (const auto& modelResourceName : package->GetModelResourceNames())
+        {
+            resources.push_back(PRI(packageName, modelResourceName));
+        }
+    }
+
+    LoadModels(resources, resultWhen, onResult);
+}
 
-    for (const auto& package : packages)
+void ModelResources::LoadModels(const std::vector<PackageResourceIdentifier>& resources, ResultWhen resultWhen, const LoadCallback& onResult)
+{
+    if (resources.empty())
     {
-        allSuccessful = allSuccessful && OnLoadAllModels(PackageName(package->GetPackageName()), resultWhen);
+        onResult(true);
+        return;
     }
 
-    return allSuccessful;
+    //
+    // Each model is loaded in its own job. Every model load further fans out its own texture decodes
+    // and mesh builds, so all of the job system's workers are kept busy when loading many models.
+    //
+    // The loads aren't waited on; a model's result can be reported long after its job has finished, if
+    // the model was already being loaded elsewhere. The last model to report its result reports the
+    // overall result.
+    //
+    struct LoadModelsState
+    {
+        std::vector<PackageResourceIdentifier> resources;
+        std::vector<uint8_t> results;
+        std::atomic<std::size_t> numRemaining{0};
+    };
+
+    auto state = std::make_shared<LoadModelsState>();
+    state->resources = resources;
+    state->results.resize(resources.size(), false);
+    state->numRemaining = resources.size();
+
+    const auto onModelResult = [=,this](std::size_t x, bool result){
+        state->results[x] = result;
+
+        if (state->numRemaining.fetch_sub(1, std::memory_order_acq_rel) != 1) { return; }
+
+        bool allSuccessful = true;
+
+        for (std::size_t y = 0; y < state->resources.size(); ++y)
+        {
+            if (!state->results[y])
+            {
+                m_logger->Log(Common::LogLevel::Error,
+                  "ModelResources::LoadModels: Failed to load model: {}", state->resources[y].GetUniqueName());
+                allSuccessful = false;
+            }
+        }
+
+        onResult(allSuccessful);
+    };
+
+    for (std::size_t x = 0; x < resources.size(); ++x)
+    {
+        m_jobSystem->Submit([=,this](){
+            OnLoadModel(state->resources[x], resultWhen, [=](bool result){ onModelResult(x, result); });
+        });
+    }
 }
 
-bool ModelResources::LoadPackageModelInternal(const ResourceIdentifier& resource,
+void ModelResources::LoadPackageModelInternal(const ResourceIdentifier& resource,
                                               const Model::Ptr& model,
                                               const std::unordered_map<std::string, Common::ImageData::Ptr>& modelTextures,
-                                              ResultWhen resultWhen)
+                                              ResultWhen resultWhen,
+                                              const LoadCallback& onResult)
 {
     m_logger->Log(Common::LogLevel::Info, "ModelResources: Loading model: {}", resource.GetUniqueName());
 
-    if (m_models.contains(resource))
+    //
+    // Reserve the model's resource while it's loading, so that concurrent loads of the same
+    // model don't both register it with the renderer.
+    //
+    // If the model is already being loaded, the result of that load is the result of this one. The model
+    // isn't usable until that load finishes, so the request's result is reported by that load when it
+    // finishes.
+    //
+    bool alreadyLoaded = false;
+    bool alreadyLoading = false;
+
+    {
+        std::lock_guard<std::recursive_mutex> modelsLock(m_modelsMutex);
+
+        if (m_models.contains(resource))
+        {
+            alreadyLoaded = true;
+        }
+        else if (const auto loadingIt = m_modelsLoading.find(resource); loadingIt != m_modelsLoading.cend())
+        {
+            alreadyLoading = true;
+            loadingIt->second.push_back(onResult);
+        }
+        else
+        {
+            m_modelsLoading.insert({resource, {}});
+        }
+    }
+
+    if (alreadyLoaded)
     {
         m_logger->Log(Common::LogLevel::Warning,
           "ModelResources::LoadPackageModelInternal: Model already existed, name: {}", resource.GetUniqueName());
-        return true;
+        onResult(true);
+        return;
+    }
+
+    if (alreadyLoading)
+    {
+        m_logger->Log(Common::LogLevel::Debug,
+          "ModelResources::LoadPackageModelInternal: Model is already loading, name: {}", resource.GetUniqueName());
+        return;
     }
 
+    const auto registeredModel = RegisterModel(resource, model, modelTextures, resultWhen);
+
+    //
+    // Publish the model now that all of its resources have resolved
+    //
+    std::vector<LoadCallback> waitingRequests;
+
+    {
+        std::lock_guard<std::recursive_mutex> modelsLock(m_modelsMutex);
+
+        const auto loadingIt = m_modelsLoading.find(resource);
+        if (loadingIt != m_modelsLoading.cend())
+        {
+            waitingRequests = std::move(loadingIt->second);
+            m_modelsLoading.erase(loadingIt);
+        }
+
+        if (registeredModel)
+        {
+            m_models.insert({resource, *registeredModel});
+        }
+    }
+
+    onResult(registeredModel.has_value());
+
+    for (const auto& waitingRequest : waitingRequests)
+    {
+        waitingRequest(registeredModel.has_value());
+    }
+}
+
+std::expected<RegisteredModel, bool> ModelResources::RegisterModel(const ResourceIdentifier& resource,
+                                                                   const Model::Ptr& model,
+                                                                   const ModelTextures& modelTextures,
+                                                                   ResultWhen resultWhen)
+{
     RegisteredModel registeredModel{};
     registeredModel.model = model;
+    registeredModel.compiledModel = CompiledModel::Compile(model);
+
+    // Renderer operations for the model's resources. Rather than waiting on each in turn, they're all
+    // issued up front so the renderer can process them back to back, and then waited on together.
+    std::vector<std::future<bool>> opFutures;
 
     //
     // Load the model's materials/textures into the renderer
@@ -197,98 +354,222 @@ bool ModelResources::LoadPackageModelInternal(const ResourceIdentifier& resource
 
     for (const auto& materialIt : model->materials)
     {
-        const auto materialIdExpected = LoadModelMeshMaterial(registeredModel, resource.GetResourceName(), materialIt.second, modelTextures, resultWhen);
+        const auto materialIdExpected = LoadModelMeshMaterial(registeredModel, resource.GetResourceName(), materialIt.second, modelTextures, opFutures);
         if (!materialIdExpected)
         {
             m_logger->Log(Common::LogLevel::Error,
-              "ModelResources::LoadPackageModelInternal: Failed to load mesh material: {}", materialIt.second.name);
-            return false;
+              "ModelResources::RegisterModel: Failed to load mesh material: {}", materialIt.second.name);
+            (void)AwaitRendererOps(opFutures);
+            DestroyRegisteredModelResources(registeredModel);
+            return std::unexpected(false);
         }
 
         registeredMaterials[materialIt.first] = *materialIdExpected;
     }
 
     //
-    // Load the model's meshes into the renderer
+    // Build the model's renderer meshes, in parallel, as they copy all of the model's vertex data
     //
+    std::vector<const ModelMesh*> modelMeshes;
+    modelMeshes.reserve(model->meshes.size());
+
     for (const auto& modelMeshIt : model->meshes)
     {
-        const auto meshIdExpected = LoadModelMesh(registeredModel, registeredMaterials, modelMeshIt.second, resultWhen);
+        modelMeshes.push_back(&modelMeshIt.second);
+    }
+
+    std::vector<Render::Mesh::Ptr> meshes(modelMeshes.size());
+
+    m_jobSystem->ParallelFor(0, modelMeshes.size(), 1, [&](std::size_t begin, std::size_t end){
+        for (std::size_t x = begin; x < end; ++x)
+        {
+            meshes[x] = BuildModelMesh(*modelMeshes[x]);
+        }
+    });
+
+    //
+    // Load the model's meshes into the renderer
+    //
+    for (std::size_t x = 0; x < modelMeshes.size(); ++x)
+    {
+        const auto meshIdExpected = LoadModelMesh(registeredModel, registeredMaterials, *modelMeshes[x], meshes[x], opFutures);
         if (!meshIdExpected)
         {
             m_logger->Log(Common::LogLevel::Error,
-              "ModelResources::LoadPackageModelInternal: Failed to load mesh: {}", modelMeshIt.second.name);
-            return false;
+              "ModelResources::RegisterModel: Failed to load mesh: {}", modelMeshes[x]->name);
+
+            // Return the ids of the meshes which were built but never loaded
+            for (std::size_t y = x + 1; y < meshes.size(); ++y)
+            {
+                m_renderer->GetIds()->meshIds.ReturnId(meshes[y]->id);
+            }
+
+            (void)AwaitRendererOps(opFutures);
+            DestroyRegisteredModelResources(registeredModel);
+            return std::unexpected(false);
         }
     }
 
-    std::lock_guard<std::recursive_mutex> modelsLock(m_modelsMutex);
-    m_models.insert({resource, registeredModel});
+    //
+    // If requested, wait for the renderer to finish loading everything
+    //
+    if (resultWhen == ResultWhen::FullyLoaded)
+    {
+        if (!AwaitRendererOps(opFutures))
+        {
+            m_logger->Log(Common::LogLevel::Error,
+              "ModelResources::RegisterModel: Renderer failed to load model resources: {}", resource.GetUniqueName());
+            DestroyRegisteredModelResources(registeredModel);
+            return std::unexpected(false);
+        }
+    }
 
-    return true;
+    return registeredModel;
 }
 
-std::expected<ModelTextures, bool> ModelResources::LoadPackageModelTextures(const PackageResourceIdentifier& resource,
-                                                                            const Model::Ptr& model,
-                                                                            const Platform::PackageSource::Ptr& package)
+bool ModelResources::AwaitRendererOps(std::vector<std::future<bool>>& opFutures) const
+{
+    bool allSuccessful = true;
+
+    for (auto& opFuture : opFutures)
+    {
+        // Note: Awaited via the job system so this worker keeps running other jobs while the renderer works
+        allSuccessful = m_jobSystem->Await(std::move(opFuture)) && allSuccessful;
+    }
+
+    opFutures.clear();
+
+    return allSuccessful;
+}
+
+std::expected<ModelTextures, bool> ModelResources::DecodeModelTextures(const std::string& modelResourceName,
+                                                                       const Model::Ptr& model,
+                                                                       const std::optional<Platform::PackageSource::Ptr>& package,
+                                                                       const ModelTextures& providedTextures)
 {
     //
-    // Loads from package all non-embedded textures for all the model's materials
+    // Gather the unique textures, across all the model's materials, which need their data loaded/decoded
     //
+    std::vector<const ModelTexture*> toDecode;
+    std::unordered_set<std::string> seenFileNames;
 
-    std::unordered_map<std::string, Common::ImageData::Ptr> textures;
+    const auto gatherTextures = [&](const std::vector<ModelTexture>& textures){
+        for (const auto& texture : textures)
+        {
+            if (providedTextures.contains(texture.fileName)) { continue; }
+            if (!seenFileNames.insert(texture.fileName).second) { continue; }
+
+            toDecode.push_back(&texture);
+        }
+    };
 
     for (const auto& material : model->materials)
     {
-        if (!LoadPackageModelTextures(resource, material.second.ambientTextures, package, textures)) { return std::unexpected(false); }
-        if (!LoadPackageModelTextures(resource, material.second.diffuseTextures, package, textures)) { return std::unexpected(false); }
-        if (!LoadPackageModelTextures(resource, material.second.specularTextures, package, textures)) { return std::unexpected(false); }
-        if (!LoadPackageModelTextures(resource, material.second.normalTextures, package, textures)) { return std::unexpected(false); }
+        gatherTextures(material.second.ambientTextures);
+        gatherTextures(material.second.diffuseTextures);
+        gatherTextures(material.second.specularTextures);
+        gatherTextures(material.second.normalTextures);
     }
 
-    return textures;
-}
+    //
+    // Decode the textures in parallel
+    //
+    std::vector<std::expected<Common::ImageData::Ptr, bool>> decoded(toDecode.size(), std::unexpected(false));
 
-bool ModelResources::LoadPackageModelTextures(const PackageResourceIdentifier& resource,
-                                              const std::vector<ModelTexture>& textures,
-                                              const Platform::PackageSource::Ptr& package,
-                                              ModelTextures& result)
-{
-    for (const auto& texture : textures)
-    {
-        // Don't need to load any package data for embedded textures
-        if (texture.embeddedData) { continue; }
+    m_jobSystem->ParallelFor(0, toDecode.size(), 1, [&](std::size_t begin, std::size_t end){
+        for (std::size_t x = begin; x < end; ++x)
+        {
+            decoded[x] = DecodeModelTexture(modelResourceName, *toDecode[x], package);
+        }
+    });
 
-        const auto textureResourceName = texture.fileName;
+    ModelTextures result = providedTextures;
 
-        const auto textureBytesExpect = package->GetModelTextureData(resource.GetResourceName(), textureResourceName);
-        const auto textureDataFormatHint = package->GetTextureFormatHint(textureResourceName);
-        if (!textureBytesExpect || !textureDataFormatHint)
+    for (std::size_t x = 0; x < toDecode.size(); ++x)
+    {
+        if (!decoded[x])
         {
-            m_logger->Log(Common::LogLevel::Error,
-              "ModelResources::LoadPackageModelTextures: Failed to load texture from package: {}", textureResourceName);
-            return false;
+            return std::unexpected(false);
         }
 
-        const auto textureDataExpect = m_files->LoadTexture(*textureBytesExpect, *textureDataFormatHint);
-        if (!textureDataExpect)
+        result.insert({toDecode[x]->fileName, *decoded[x]});
+    }
+
+    return result;
+}
+
+std::expected<Common::ImageData::Ptr, bool> ModelResources::DecodeModelTexture(const std::string& modelResourceName,
+                                                                               const ModelTexture& modelTexture,
+                                                                               const std::optional<Platform::PackageSource::Ptr>& package) const
+{
+    //
+    // If the model's texture had embedded data, process it into an ImageData
+    //
+    if (modelTexture.embeddedData)
+    {
+        const bool embeddedDataIsCompressed = modelTexture.embeddedData->dataHeight == 0;
+
+        // If the embedded data is compressed, rely on platform to uncompress it into an image
+        if (embeddedDataIsCompressed)
         {
-            m_logger->Log(Common::LogLevel::Error,
-              "ModelResources::LoadPackageTexture: Failed to convert texture to an image: {}", resource.GetUniqueName());
-            return INVALID_ID;
+            const auto textureLoadExpect = m_files->LoadTexture(
+                modelTexture.embeddedData->data,
+                modelTexture.embeddedData->dataFormat);
+            if (!textureLoadExpect)
+            {
+                m_logger->Log(Common::LogLevel::Error,
+                  "ModelResources::DecodeModelTexture: Failed to interpret compressed texture data: {}", modelTexture.fileName);
+                return std::unexpected(false);
+            }
+
+            return *textureLoadExpect;
         }
 
-        result.insert({textureResourceName, *textureDataExpect});
+        // Otherwise, if the embedded data is uncompressed, we can interpret it directly
+        return std::make_shared<Common::ImageData>(
+            modelTexture.embeddedData->data,
+            1,
+            modelTexture.embeddedData->dataWidth,
+            modelTexture.embeddedData->dataHeight,
+            Common::ImageData::PixelFormat::RGBA32
+        );
+    }
+
+    //
+    // Otherwise, the texture's data needs to be loaded from the model's package
+    //
+    if (!package)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "ModelResources::DecodeModelTexture: No data provided for texture: {} : {}", modelResourceName, modelTexture.fileName);
+        return std::unexpected(false);
+    }
+
+    const auto textureBytesExpect = (*package)->GetModelTextureData(modelResourceName, modelTexture.fileName);
+    const auto textureDataFormatHint = (*package)->GetTextureFormatHint(modelTexture.fileName);
+    if (!textureBytesExpect || !textureDataFormatHint)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "ModelResources::DecodeModelTexture: Failed to load texture from package: {}", modelTexture.fileName);
+        return std::unexpected(false);
     }
 
-    return true;
+    const auto textureDataExpect = m_files->LoadTexture(textureBytesExpect->GetBytes(), *textureDataFormatHint);
+    if (!textureDataExpect)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "ModelResources::DecodeModelTexture: Failed to convert texture to an image: {} : {}", modelResourceName, modelTexture.fileName);
+        return std::unexpected(false);
+    }
+
+    return *textureDataExpect;
 }
 
 std::expected<Render::MaterialId, bool> ModelResources::LoadModelMeshMaterial(RegisteredModel& registeredModel,
                                                                               const std::string& modelName,
                                                                               const ModelMaterial& material,
                                                                               const ModelTextures& modelTextures,
-                                                                              ResultWhen resultWhen) const
+                                                                              std::vector<std::future<bool>>& opFutures) const
 {
     //
     // Sanity check that the material the mesh uses only specifies one texture file for each
@@ -341,7 +622,7 @@ std::expected<Render::MaterialId, bool> ModelResources::LoadModelMeshMaterial(Re
 
     for (const auto& texture : material.ambientTextures)
     {
-        const auto textureIdExpected = LoadModelMaterialTexture(registeredModel, modelName, texture, modelTextures, resultWhen);
+        const auto textureIdExpected = LoadModelMaterialTexture(registeredModel, modelName, texture, modelTextures, opFutures);
         if (!textureIdExpected)
         {
             return std::unexpected(false);
@@ -353,7 +634,7 @@ std::expected<Render::MaterialId, bool> ModelResources::LoadModelMeshMaterial(Re
     }
     for (const auto& texture : material.diffuseTextures)
     {
-        const auto textureIdExpected = LoadModelMaterialTexture(registeredModel, modelName, texture, modelTextures, resultWhen);
+        const auto textureIdExpected = LoadModelMaterialTexture(registeredModel, modelName, texture, modelTextures, opFutures);
         if (!textureIdExpected)
         {
             return std::unexpected(false);
@@ -365,7 +646,7 @@ std::expected<Render::MaterialId, bool> ModelResources::LoadModelMeshMaterial(Re
     }
     for (const auto& texture : material.specularTextures)
     {
-        const auto textureIdExpected = LoadModelMaterialTexture(registeredModel, modelName, texture, modelTextures, resultWhen);
+        const auto textureIdExpected = LoadModelMaterialTexture(registeredModel, modelName, texture, modelTextures, opFutures);
         if (!textureIdExpected)
         {
             return std::unexpected(false);
@@ -377,7 +658,7 @@ std::expected<Render::MaterialId, bool> ModelResources::LoadModelMeshMaterial(Re
     }
     for (const auto& texture : material.normalTextures)
     {
-        const auto textureIdExpected = LoadModelMaterialTexture(registeredModel, modelName, texture, modelTextures, resultWhen);
+        const auto textureIdExpected = LoadModelMaterialTexture(registeredModel, modelName, texture, modelTextures, opFutures);
         if (!textureIdExpected)
         {
             return std::unexpected(false);
@@ -395,13 +676,7 @@ std::expected<Render::MaterialId, bool> ModelResources::LoadModelMeshMaterial(Re
         material.name
     );
 
-    auto opFuture = m_renderer->CreateMaterial(objectMaterial);
-
-    if (resultWhen == ResultWhen::FullyLoaded && !opFuture.get())
-    {
-        // The material creation failed
-        return std::unexpected(false);
-    }
+    opFutures.push_back(m_renderer->CreateMaterial(objectMaterial));
 
     registeredModel.loadedMaterials.insert(objectMaterial->materialId);
 
@@ -412,7 +687,7 @@ std::expected<Render::TextureId, bool> ModelResources::LoadModelMaterialTexture(
                                                                                 const std::string& modelName,
                                                                                 const ModelTexture& modelTexture,
                                                                                 const ModelTextures& modelTextures,
-                                                                                ResultWhen resultWhen) const
+                                                                                std::vector<std::future<bool>>& opFutures) const
 {
     const auto loadedTextureIt = registeredModel.loadedTextures.find(modelTexture.fileName);
 
@@ -422,60 +697,16 @@ std::expected<Render::TextureId, bool> ModelResources::LoadModelMaterialTexture(
         return loadedTextureIt->second;
     }
 
-    const auto textureId = m_renderer->GetIds()->textureIds.GetId();
-
-    std::optional<Common::ImageData::Ptr> textureData;
-
-    //
-    // If the model's texture had embedded data, process it into an ImageData
-    //
-    if (modelTexture.embeddedData)
+    // Note that all the model's texture data, embedded or not, was decoded up front
+    const auto it = modelTextures.find(modelTexture.fileName);
+    if (it == modelTextures.cend())
     {
-        const bool embeddedDataIsCompressed = modelTexture.embeddedData->dataHeight == 0;
-
-        // If the embedded data is compressed, rely on platform to uncompress it into an image
-        if (embeddedDataIsCompressed)
-        {
-            const auto textureLoadExpect = m_files->LoadTexture(
-                modelTexture.embeddedData->data,
-                modelTexture.embeddedData->dataFormat);
-            if (!textureLoadExpect)
-            {
-                m_logger->Log(Common::LogLevel::Error,
-                  "ModelResources::LoadModelMaterialTexture: Failed to interpret compressed texture data: {}", modelTexture.fileName);
-                return std::unexpected(false);
-            }
-
-            textureData = *textureLoadExpect;
-        }
-            // Otherwise, if the embedded data is uncompressed, we can interpret it directly
-        else
-        {
-            textureData = std::make_shared<Common::ImageData>(
-                modelTexture.embeddedData->data,
-                1,
-                modelTexture.embeddedData->dataWidth,
-                modelTexture.embeddedData->dataHeight,
-                Common::ImageData::PixelFormat::RGBA32
-            );
-        }
+        m_logger->Log(Common::LogLevel::Error,
+          "ModelResources::LoadModelMaterialTexture: Failed to get texture data: {} : {}", modelName, modelTexture.fileName);
+        return std::unexpected(false);
     }
 
-    //
-    // If the model texture has no embedded data, we need to load its data from disk
-    //
-    if (!textureData)
-    {
-        const auto it = modelTextures.find(modelTexture.fileName);
-        if (it == modelTextures.cend())
-        {
-            m_logger->Log(Common::LogLevel::Error,
-              "ModelResources::LoadModelMaterialTexture: Failed to get texture data: {} : {}", modelName, modelTexture.fileName);
-            return std::unexpected(false);
-        }
-
-        textureData = it->second;
-    }
+    const auto textureId = m_renderer->GetIds()->textureIds.GetId();
 
     //
     // Register the texture and its data as a Texture in the renderer
@@ -484,13 +715,14 @@ std::expected<Render::TextureId, bool> ModelResources::LoadModelMaterialTexture(
         textureId,
         1,
         false,
-        *textureData,
+        it->second,
         modelTexture.fileName
     );
     if (!texture)
     {
         m_logger->Log(Common::LogLevel::Error,
           "ModelResources::LoadModelMaterialTexture: Failed to create texture object: {} : {}", modelName, modelTexture.fileName);
+        m_renderer->GetIds()->textureIds.ReturnId(textureId);
         return std::unexpected(false);
     }
 
@@ -505,34 +737,18 @@ std::expected<Render::TextureId, bool> ModelResources::LoadModelMaterialTexture(
     const auto textureView = Render::TextureView::ViewAs2D(Render::TextureView::DEFAULT());
     const auto textureSampler = Render::TextureSampler(Render::TextureSampler::DEFAULT(), modelTexture.uvAddressMode);
 
-    auto opFuture = m_renderer->CreateTexture(*texture, textureView, textureSampler);
-
-    if (resultWhen == ResultWhen::FullyLoaded && !opFuture.get())
-    {
-        // The texture creation failed
-        return std::unexpected(false);
-    }
+    opFutures.push_back(m_renderer->CreateTexture(*texture, textureView, textureSampler));
 
     registeredModel.loadedTextures.insert(std::make_pair(modelTexture.fileName, textureId));
 
     return textureId;
 }
 
-std::expected<Render::MeshId, bool> ModelResources::LoadModelMesh(RegisteredModel& registeredModel,
-                                                                  const std::unordered_map<unsigned int, Render::MaterialId>& registeredMaterials,
-                                                                  const ModelMesh& modelMesh,
-                                                                  ResultWhen resultWhen) const
+Render::Mesh::Ptr ModelResources::BuildModelMesh(const ModelMesh& modelMesh) const
 {
-    const auto materialId = registeredMaterials.find(modelMesh.materialIndex);
-    if (materialId == registeredMaterials.cend())
-    {
-        m_logger->Log(Common::LogLevel::Error, "ModelResources::LoadModelMesh: Can't load mesh as its material doesn't exist");
-        return std::unexpected(false);
-    }
-
     const auto meshId = m_renderer->GetIds()->meshIds.GetId();
 
-    Render::Mesh::Ptr mesh = nullptr;
+    Render::Mesh::Ptr mesh;
 
     switch (modelMesh.meshType)
     {
@@ -559,27 +775,46 @@ std::expected<Render::MeshId, bool> ModelResources::LoadModelMesh(RegisteredMode
         break;
     }
 
-    // TODO Perf: Method to load multiple meshes in one call - doing one by one is too slow for
-    //  something like sponza that has ~400 meshes if waiting for FullyLoaded, with only one
-    //  render thread processing each mesh in sequence.
-    auto opFuture = m_renderer->CreateMesh(mesh, Render::MeshUsage::Immutable);
+    assert(mesh != nullptr);
 
-    if (resultWhen == ResultWhen::FullyLoaded && !opFuture.get())
+    //
+    // Generate a LOD chain for the mesh, which the renderer selects from based on how large the
+    // mesh's objects are on screen
+    //
+    if (mesh && modelMesh.indices.size() / 3 >= MIN_LOD_TRIANGLE_COUNT)
+    {
+        Render::MeshSimplifier::GenerateLODs(*mesh);
+    }
+
+    return mesh;
+}
+
+std::expected<Render::MeshId, bool> ModelResources::LoadModelMesh(RegisteredModel& registeredModel,
+                                                                  const std::unordered_map<unsigned int, Render::MaterialId>& registeredMaterials,
+                                                                  const ModelMesh& modelMesh,
+                                                                  const Render::Mesh::Ptr& mesh,
+                                                                  std::vector<std::future<bool>>& opFutures) const
+{
+    const auto materialId = registeredMaterials.find(modelMesh.materialIndex);
+    if (materialId == registeredMaterials.cend())
     {
-        // The mesh creation failed
+        m_logger->Log(Common::LogLevel::Error, "ModelResources::LoadModelMesh: Can't load mesh as its material doesn't exist");
+        m_renderer->GetIds()->meshIds.ReturnId(mesh->id);
         return std::unexpected(false);
     }
 
+    opFutures.push_back(m_renderer->CreateMesh(mesh, Render::MeshUsage::Immutable));
+
     //
     // Record this mesh's loaded data
     //
     LoadedModelMesh loadedModelMesh;
-    loadedModelMesh.meshId = meshId;
+    loadedModelMesh.meshId = mesh->id;
     loadedModelMesh.meshMaterialId = materialId->second;
 
     registeredModel.loadedMeshes.insert(std::make_pair(modelMesh.meshIndex, loadedModelMesh));
 
-    return meshId;
+    return mesh->id;
 }
 
 std::optional<RegisteredModel> ModelResources::GetLoadedModel(const ResourceIdentifier& resource) const
@@ -607,32 +842,39 @@ void ModelResources::DestroyModel(const ResourceIdentifier& resource)
         return;
     }
 
+    DestroyRegisteredModelResources(*model);
+
+    // Erase our knowledge of the model
+    m_models.erase(resource);
+}
+
+void ModelResources::DestroyRegisteredModelResources(const RegisteredModel& registeredModel) const
+{
     // Destroy the model's material's textures
-    for (const auto& textureIt : model->loadedTextures)
+    for (const auto& textureIt : registeredModel.loadedTextures)
     {
         m_renderer->DestroyTexture(textureIt.second);
     }
 
     // Destroy the model's materials
-    for (const auto& materialId : model->loadedMaterials)
+    for (const auto& materialId : registeredModel.loadedMaterials)
     {
         m_renderer->DestroyMaterial(materialId);
     }
 
     // Destroy the model's meshes
-    for (const auto& meshIt : model->loadedMeshes)
+    for (const auto& meshIt : registeredModel.loadedMeshes)
     {
         m_renderer->DestroyMesh(meshIt.second.meshId);
     }
-
-    // Erase our knowledge of the model
-    m_models.erase(resource);
 }
 
 void ModelResources::DestroyAll()
 {
     m_logger->Log(Common::LogLevel::Info, "ModelResources: Destroying all model resources");
 
+    std::lock_guard<std::recursive_mutex> modelsLock(m_modelsMutex);
+
     while (!m_models.empty())
     {
         DestroyModel(m_models.cbegin()->first);
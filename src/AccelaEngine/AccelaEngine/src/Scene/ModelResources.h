@@ -17,11 +17,15 @@
 #include "Accela/Platform/Package/PackageSource.h"
 
 #include <Accela/Common/Log/ILogger.h>
-#include <Accela/Common/Thread/MessageDrivenThreadPool.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 #include <unordered_map>
 #include <expected>
 #include <vector>
+#include <optional>
+#include <future>
+#include <mutex>
+#include <functional>
 
 namespace Accela::Render
 {
@@ -43,7 +47,7 @@ namespace Accela::Engine
                            PackageResourcesPtr packages,
                            std::shared_ptr<Render::IRenderer> renderer,
                            std::shared_ptr<Platform::IFiles> files,
-                           std::shared_ptr<Common::MessageDrivenThreadPool> threadPool);
+                           Common::JobSystem::Ptr jobSystem);
 
             //
             // IModelResources
@@ -65,45 +69,91 @@ namespace Accela::Engine
 
         private:
 
-            [[nodiscard]] bool OnLoadModel(const PackageResourceIdentifier& resource, ResultWhen resultWhen);
-            [[nodiscard]] bool OnLoadAllModels(const PackageName& packageName, ResultWhen resultWhen);
-            [[nodiscard]] bool OnLoadAllModels(ResultWhen resultWhen);
+            // Receives the result of a model load, once it's known. May be called from any thread.
+            using LoadCallback = std::function<void(bool)>;
 
-            [[nodiscard]] bool LoadPackageModelInternal(const ResourceIdentifier& resource,
-                                                        const Model::Ptr& model,
-                                                        const ModelTextures& modelTextures,
-                                                        ResultWhen resultWhen);
+        private:
 
-            [[nodiscard]] std::expected<ModelTextures, bool> LoadPackageModelTextures(
-                const PackageResourceIdentifier& resource,
+            /**
+             * Runs a load as a job. The returned future receives the result which the load reports to its
+             * callback, which can happen after the job itself has finished.
+             */
+            [[nodiscard]] std::future<bool> SubmitLoad(std::function<void(const LoadCallback&)> load);
+
+            void OnLoadModel(const PackageResourceIdentifier& resource, ResultWhen resultWhen, const LoadCallback& onResult);
+            void OnLoadAllModels(const PackageName& packageName, ResultWhen resultWhen, const LoadCallback& onResult);
+            void OnLoadAllModels(ResultWhen resultWhen, const LoadCallback& onResult);
+
+            /**
+             * Loads the provided models in parallel, one job per model. The overall result is reported once
+             * every model's result has been.
+             */
+            void LoadModels(const std::vector<PackageResourceIdentifier>& resources, ResultWhen resultWhen, const LoadCallback& onResult);
+
+            /**
+             * Loads a model into the renderer. If the model is already being loaded, the request's result is
+             * reported when that load finishes. The request never waits for it, as the in-progress load can be
+             * suspended further down the current thread's stack.
+             */
+            void LoadPackageModelInternal(const ResourceIdentifier& resource,
+                                          const Model::Ptr& model,
+                                          const ModelTextures& modelTextures,
+                                          ResultWhen resultWhen,
+                                          const LoadCallback& onResult);
+
+            /**
+             * Registers all of a model's resources with the renderer. All renderer operations are issued up
+             * front and, if resultWhen is FullyLoaded, waited on together at the end. On failure, any resources
+             * which were registered are destroyed.
+             */
+            [[nodiscard]] std::expected<RegisteredModel, bool> RegisterModel(const ResourceIdentifier& resource,
+                                                                             const Model::Ptr& model,
+                                                                             const ModelTextures& modelTextures,
+                                                                             ResultWhen resultWhen);
+
+            [[nodiscard]] bool AwaitRendererOps(std::vector<std::future<bool>>& opFutures) const;
+
+            /**
+             * Decodes, in parallel, the data of all of a model's textures which weren't already provided; embedded
+             * textures from the model itself, and other textures from the model's package, if one is provided.
+             *
+             * @return The provided textures plus all the newly decoded textures, keyed by texture file name
+             */
+            [[nodiscard]] std::expected<ModelTextures, bool> DecodeModelTextures(
+                const std::string& modelResourceName,
                 const Model::Ptr& model,
-                const Platform::PackageSource::Ptr& package);
+                const std::optional<Platform::PackageSource::Ptr>& package,
+                const ModelTextures& providedTextures);
 
-            [[nodiscard]] bool LoadPackageModelTextures(
-                const PackageResourceIdentifier& resource,
-                const std::vector<ModelTexture>& textures,
-                const Platform::PackageSource::Ptr& package,
-                ModelTextures& result);
+            [[nodiscard]] std::expected<Common::ImageData::Ptr, bool> DecodeModelTexture(
+                const std::string& modelResourceName,
+                const ModelTexture& modelTexture,
+                const std::optional<Platform::PackageSource::Ptr>& package) const;
 
             [[nodiscard]] std::expected<Render::MaterialId, bool> LoadModelMeshMaterial(
                 RegisteredModel& registeredModel,
                 const std::string& modelName,
                 const ModelMaterial& material,
                 const std::unordered_map<std::string, Common::ImageData::Ptr>& modelTextures,
-                ResultWhen resultWhen) const;
+                std::vector<std::future<bool>>& opFutures) const;
 
             [[nodiscard]] std::expected<Render::TextureId, bool> LoadModelMaterialTexture(
                 RegisteredModel& registeredModel,
                 const std::string& modelName,
                 const ModelTexture& modelTexture,
                 const std::unordered_map<std::string, Common::ImageData::Ptr>& modelTextures,
-                ResultWhen resultWhen) const;
+                std::vector<std::future<bool>>& opFutures) const;
+
+            [[nodiscard]] Render::Mesh::Ptr BuildModelMesh(const ModelMesh& modelMesh) const;
 
             [[nodiscard]] std::expected<Render::MeshId, bool> LoadModelMesh(
                 RegisteredModel& registeredModel,
                 const std::unordered_map<unsigned int, Render::MaterialId>& registeredMaterials,
                 const ModelMesh& modelMesh,
-                ResultWhen resultWhen) const;
+                const Render::Mesh::Ptr& mesh,
+                std::vector<std::future<bool>>& opFutures) const;
+
+            void DestroyRegisteredModelResources(const RegisteredModel& registeredModel) const;
 
         private:
 
@@ -111,11 +161,13 @@ namespace Accela::Engine
             PackageResourcesPtr m_packages;
             std::shared_ptr<Render::IRenderer> m_renderer;
             std::shared_ptr<Platform::IFiles> m_files;
-            std::shared_ptr<Common::MessageDrivenThreadPool> m_threadPool;
+            Common::JobSystem::Ptr m_jobSystem;
             ModelLoader m_modelLoader;
 
             mutable std::recursive_mutex m_modelsMutex;
             std::unordered_map<ResourceIdentifier, RegisteredModel> m_models;
+            // Resource -> Requests waiting on the result of the in-progress load of the model
+            std::unordered_map<ResourceIdentifier, std::vector<LoadCallback>> m_modelsLoading;
     };
 }
 
@@ -8,40 +8,24 @@
 
 #include <Accela/Platform/File/IFiles.h>
 
-#include <Accela/Common/Thread/ResultMessage.h>
-
 namespace Accela::Engine
 {
 
-struct FetchConstructResultMessage : public Common::ResultMessage<std::expected<Construct::Ptr, bool>>
-{
-        FetchConstructResultMessage()
-        : Common::ResultMessage<std::expected<Construct::Ptr, bool>>("FetchConstructResultMessage")
-    { }
-};
-
 PackageResources::PackageResources(Common::ILogger::Ptr logger,
                                    std::shared_ptr<Platform::IFiles> files,
-                                   std::shared_ptr<Common::MessageDrivenThreadPool> threadPool)
+                                   Common::JobSystem::Ptr jobSystem)
     : m_logger(std::move(logger))
     , m_files(std::move(files))
-    , m_threadPool(std::move(threadPool))
+    , m_jobSystem(std::move(jobSystem))
 {
 
 }
 
 std::future<bool> PackageResources::OpenAndRegisterPackage(const PackageName& packageName)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnOpenAndRegisterPackage(packageName)
-        );
+    return m_jobSystem->SubmitForResult<bool>([=,this](){
+        return OnOpenAndRegisterPackage(packageName);
     });
-
-    return messageFuture;
 }
 
 bool PackageResources::RegisterPackageSource(const Platform::PackageSource::Ptr& package)
@@ -103,16 +87,9 @@ void PackageResources::ClosePackage(const PackageName& packageName)
 
 std::future<std::expected<Construct::Ptr, bool>> PackageResources::FetchPackageConstruct(const PRI& construct)
 {
-    auto message = std::make_shared<FetchConstructResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<FetchConstructResultMessage>(_message)->SetResult(
-            OnFetchPackageConstruct(construct)
-        );
+    return m_jobSystem->SubmitForResult<std::expected<Construct::Ptr, bool>>([=,this](){
+        return OnFetchPackageConstruct(construct);
     });
-
-    return messageFuture;
 }
 
 bool PackageResources::OnOpenAndRegisterPackage(const PackageName& packageName)
@@ -147,7 +124,7 @@ std::expected<Construct::Ptr, bool> PackageResources::OnFetchPackageConstruct(co
         return std::unexpected(false);
     }
 
-    const auto constructObj = Construct::FromBytes(*constructData);
+    const auto constructObj = Construct::FromBytes(constructData->GetBytes());
     if (!constructObj)
     {
         m_logger->Log(Common::LogLevel::Error,
@@ -12,7 +12,7 @@
 #include <Accela/Engine/Scene/IPackageResources.h>
 
 #include <Accela/Common/Log/ILogger.h>
-#include <Accela/Common/Thread/MessageDrivenThreadPool.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 #include <unordered_map>
 
@@ -29,7 +29,7 @@ namespace Accela::Engine
 
             PackageResources(Common::ILogger::Ptr logger,
                              std::shared_ptr<Platform::IFiles> files,
-                             std::shared_ptr<Common::MessageDrivenThreadPool> threadPool);
+                             Common::JobSystem::Ptr jobSystem);
 
             //
             // IPackageResources
@@ -54,7 +54,7 @@ namespace Accela::Engine
 
             Common::ILogger::Ptr m_logger;
             std::shared_ptr<Platform::IFiles> m_files;
-            std::shared_ptr<Common::MessageDrivenThreadPool> m_threadPool;
+            Common::JobSystem::Ptr m_jobSystem;
 
             mutable std::mutex m_packagesMutex;
             std::unordered_map<PackageName, Platform::PackageSource::Ptr> m_packages;
@@ -88,53 +88,42 @@ void PhysicsSyncSystem::Pre_UpdatePhysics(const RunState::Ptr&, entt::registry&
 
 void PhysicsSyncSystem::PostSimulationStep(const RunState::Ptr& runState, entt::registry& registry) const
 {
-    // Update component data for entities for which the physics system has marked their physics state as dirty
-    Post_SyncDirtyEntities(runState, registry);
+    // Update component data for entities whose bodies moved during the simulation step
+    Post_SyncMovedEntities(runState, registry);
 
     // Notify the scene about any physics triggers that were hit
     Post_NotifyTriggers(runState, registry);
 }
 
-void PhysicsSyncSystem::Post_SyncDirtyEntities(const RunState::Ptr&, entt::registry& registry) const
+void PhysicsSyncSystem::Post_SyncMovedEntities(const RunState::Ptr&, entt::registry& registry) const
 {
     //
-    // Loop through all the dirty physics entities, and update their state from the physics system, now that
-    // the physics state has been changed.
+    // Apply the new state of the bodies which the physics system reports moved during the step. Sleeping
+    // bodies report nothing, so this scales with the number of moving bodies rather than physics entities.
     //
-    registry.view<PhysicsStateComponent, PhysicsComponent, TransformComponent>().each(
-        [&](const auto& eid,
-            const PhysicsStateComponent&,
-            const PhysicsComponent& physicsComponent,
-            const TransformComponent& transformComponent)
-        {
-            PhysicsComponent updatedPhysics = physicsComponent;
-            TransformComponent updatedTransform = transformComponent;
+    const auto rigidBodyDeltas = m_physics->PopRigidBodyDeltas();
 
-            const auto body = m_physics->GetRigidBody((EntityId)eid, physicsComponent.scene);
-            if (!body)
-            {
-                m_logger->Log(Common::LogLevel::Error,
-                  "PhysicsSyncSystem::PostSimulationStep: No such entity body exists: {}", (EntityId)eid);
-                return;
-            }
+    for (const auto& delta : rigidBodyDeltas)
+    {
+        const auto eid = (entt::entity)delta.eid;
 
-            // If the body isn't dirty, skip it
-            if (!body->second)
-            {
-                return;
-            }
+        // The entity, or its physics, may have been removed since the step
+        if (!registry.valid(eid)) { continue; }
 
-            SetComponentsFromData(body->first, updatedTransform);
+        auto* pPhysicsComponent = registry.try_get<PhysicsComponent>(eid);
+        if (pPhysicsComponent == nullptr || !registry.all_of<TransformComponent>(eid)) { continue; }
 
-            registry.emplace_or_replace<PhysicsComponent>(eid, updatedPhysics);
-            registry.emplace_or_replace<TransformComponent>(eid, updatedTransform);
-        }
-    );
+        // Updated in place without notifying; the physics system is already the source of this data
+        pPhysicsComponent->linearVelocity = delta.linearVelocity;
 
-    //
-    // Tell the physics system we've synced to its dirty body data
-    //
-    m_physics->MarkBodiesClean();
+        // Patched in place, which notifies listeners so the entity's renderable state is re-synced
+        registry.patch<TransformComponent>(eid, [&](TransformComponent& transformComponent){
+            transformComponent.SetPosition(delta.position);
+            transformComponent.SetOrientation(delta.orientation);
+        });
+    }
+
+    m_metrics->SetCounterValue(Engine_Physics_Moved_Rigid_Bodies_Count, rigidBodyDeltas.size());
 }
 
 void PhysicsSyncSystem::Post_NotifyTriggers(const RunState::Ptr& runState, entt::registry&) const
@@ -209,7 +198,7 @@ ShapeData PhysicsSyncSystem::GetShape(const PhysicsShape& physicsShape,
     material.dynamicFriction = physicsShape.material.dynamicFriction;
     material.restitution = physicsShape.material.restitution;
 
-    return ShapeData(
+    auto shapeData = ShapeData(
         physicsShape.usage,
         physicsShape.bounds,
         material,
@@ -217,12 +206,9 @@ ShapeData PhysicsSyncSystem::GetShape(const PhysicsShape& physicsShape,
         physicsShape.localTransform,
         physicsShape.localOrientation
     );
-}
+    shapeData.filterGroups = physicsShape.filterGroups;
 
-void PhysicsSyncSystem::SetComponentsFromData(const RigidBody& data, TransformComponent& transformComponent)
-{
-    transformComponent.SetPosition(data.actor.position);
-    transformComponent.SetOrientation(data.actor.orientation);
+    return shapeData;
 }
 
 }
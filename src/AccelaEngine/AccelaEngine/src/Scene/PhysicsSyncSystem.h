@@ -39,7 +39,7 @@ namespace Accela::Engine
             void Pre_UpdatePhysics(const RunState::Ptr& runState, entt::registry& registry) const;
 
             void PostSimulationStep(const RunState::Ptr& runState, entt::registry& registry) const;
-            void Post_SyncDirtyEntities(const RunState::Ptr& runState, entt::registry& registry) const;
+            void Post_SyncMovedEntities(const RunState::Ptr& runState, entt::registry& registry) const;
             void Post_NotifyTriggers(const RunState::Ptr& runState, entt::registry& registry) const;
 
             [[nodiscard]] static RigidBody GetRigidBodyFrom(const PhysicsComponent& physicsComponent,
@@ -48,8 +48,6 @@ namespace Accela::Engine
             [[nodiscard]] static ShapeData GetShape(const PhysicsShape& physicsShape,
                                                     const TransformComponent& transformComponent);
 
-             static void SetComponentsFromData(const RigidBody& data, TransformComponent& transformComponent);
-
         private:
 
             Common::ILogger::Ptr m_logger;
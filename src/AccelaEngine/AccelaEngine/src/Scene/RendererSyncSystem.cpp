@@ -158,7 +158,7 @@ void RendererSyncSystem::CompleteModelRenderable(entt::registry& registry, entt:
     // Pose the model according to the model's animation state. Will either return the model's bind pose
     // if no animation is active, or the proper pose for the animation if one exists
     //
-    animationComponent.modelPose = GetModelPose(modelComponent.modelResource, modelComponent.animationState);
+    animationComponent.modelPose = GetModelPose(modelComponent.modelResource, modelComponent.animationState, animationComponent.animationCursor);
     if (!animationComponent.modelPose)
     {
         return;
@@ -230,7 +230,7 @@ void RendererSyncSystem::ProcessUpdatedRenderables(const RunState::Ptr& runState
                     registry.get<ModelRenderableComponent, ModelRenderableStateComponent, TransformComponent>(entity);
 
                 // Calculate the current model pose from the animation state
-                modelStateComponent.modelPose = GetModelPose(modelComponent.modelResource, modelComponent.animationState);
+                modelStateComponent.modelPose = GetModelPose(modelComponent.modelResource, modelComponent.animationState, modelStateComponent.animationCursor);
                 if (!modelStateComponent.modelPose)
                 {
                     return;
@@ -406,6 +406,7 @@ Render::ObjectRenderable RendererSyncSystem::GetObjectRenderable(entt::registry&
     renderable.materialId = objectComponent.materialId;
     renderable.modelTransform = transformComponent.GetTransformMatrix();
     renderable.shadowPass = objectComponent.shadowPass;
+    renderable.occluder = objectComponent.occluder;
 
     if (!stateComponent.renderableIds.empty())
     {
@@ -458,6 +459,7 @@ Render::ObjectRenderable RendererSyncSystem::GetModelRenderable(RenderableStateC
     renderable.materialId = meshPoseData.modelMesh.meshMaterialId;
     renderable.modelTransform = transformComponent.GetTransformMatrix() * meshPoseData.nodeTransform;
     renderable.shadowPass = modelComponent.shadowPass;
+    renderable.occluder = modelComponent.occluder;
 
     const auto stateId = stateComponent.renderableIds.find(NodeMeshId::HashFunction{}(meshPoseData.id));
     if (stateId != stateComponent.renderableIds.cend())
@@ -480,6 +482,7 @@ Render::ObjectRenderable RendererSyncSystem::GetModelRenderable(RenderableStateC
     renderable.modelTransform = transformComponent.GetTransformMatrix() * boneMesh.meshPoseData.nodeTransform;
     renderable.boneTransforms = boneMesh.boneTransforms;
     renderable.shadowPass = modelComponent.shadowPass;
+    renderable.occluder = modelComponent.occluder;
 
     const auto stateId = stateComponent.renderableIds.find(NodeMeshId::HashFunction{}(boneMesh.meshPoseData.id));
     if (stateId != stateComponent.renderableIds.cend())
@@ -505,7 +508,8 @@ Render::Light RendererSyncSystem::GetLightRenderable(entt::registry& registry, e
 }
 
 std::optional<ModelPose> RendererSyncSystem::GetModelPose(const ResourceIdentifier& model,
-                                                          const std::optional<ModelAnimationState>& animationState)
+                                                          const std::optional<ModelAnimationState>& animationState,
+                                                          AnimationCursor& animationCursor)
 {
     const auto registeredModelOpt = std::dynamic_pointer_cast<ModelResources>(m_worldResources->Models())->GetLoadedModel(model);
     if (!registeredModelOpt)
@@ -518,7 +522,7 @@ std::optional<ModelPose> RendererSyncSystem::GetModelPose(const ResourceIdentifi
 
     if (animationState.has_value())
     {
-        return modelView.AnimationPose(animationState->animationName, animationState->animationTime);
+        return modelView.AnimationPose(animationState->animationName, animationState->animationTime, animationCursor);
     }
     else
     {
@@ -85,7 +85,9 @@ namespace Accela::Engine
 
             [[nodiscard]] static Render::Light GetLightRenderable(entt::registry& registry, entt::entity entity);
 
-            [[nodiscard]] std::optional<ModelPose> GetModelPose(const ResourceIdentifier& model, const std::optional<ModelAnimationState>& animationState);
+            [[nodiscard]] std::optional<ModelPose> GetModelPose(const ResourceIdentifier& model,
+                                                                const std::optional<ModelAnimationState>& animationState,
+                                                                AnimationCursor& animationCursor);
 
             [[nodiscard]] static glm::vec3 GetVirtualToRenderRatio(const RunState::Ptr& runState);
 
@@ -0,0 +1,316 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "SpriteSpatialIndex.h"
+#include "WorldLogic.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Accela::Engine
+{
+
+// Sprites which would be registered in more cells than this are kept in the oversized list instead
+static constexpr uint64_t MAX_CELLS_PER_SPRITE = 64;
+
+static bool BoundsOverlap(const glm::vec2& aMin, const glm::vec2& aMax, const glm::vec2& bMin, const glm::vec2& bMax)
+{
+    return aMin.x <= bMax.x && aMax.x >= bMin.x &&
+           aMin.y <= bMax.y && aMax.y >= bMin.y;
+}
+
+static float PointToSegmentDistance(const glm::vec2& p, const glm::vec2& a, const glm::vec2& b)
+{
+    const auto ab = b - a;
+    const float abLength2 = glm::dot(ab, ab);
+    const float t = abLength2 > 0.0f ? std::clamp(glm::dot(p - a, ab) / abLength2, 0.0f, 1.0f) : 0.0f;
+
+    return glm::distance(p, a + (ab * t));
+}
+
+static float PointToQuadDistance(const glm::vec2& p, const SpriteSpatialIndex::SpriteQuad& quad)
+{
+    if (PointWithinRect(p, quad)) { return 0.0f; }
+
+    float distance = std::numeric_limits<float>::max();
+
+    for (std::size_t x = 0; x < quad.size(); ++x)
+    {
+        distance = std::min(distance, PointToSegmentDistance(p, quad[x], quad[(x + 1) % quad.size()]));
+    }
+
+    return distance;
+}
+
+SpriteSpatialIndex::SpriteSpatialIndex(float cellSize)
+    : m_cellSize(cellSize)
+{
+
+}
+
+void SpriteSpatialIndex::Upsert(EntityId eid, const SpriteQuad& quad, float depth)
+{
+    Entry entry{};
+    entry.quad = quad;
+    entry.boundsMin = quad[0];
+    entry.boundsMax = quad[0];
+    entry.depth = depth;
+
+    for (const auto& point : quad)
+    {
+        entry.boundsMin = glm::min(entry.boundsMin, point);
+        entry.boundsMax = glm::max(entry.boundsMax, point);
+    }
+
+    const auto cellRange = GetCellRange(entry.boundsMin, entry.boundsMax);
+    if (cellRange.NumCells() <= MAX_CELLS_PER_SPRITE)
+    {
+        entry.cells = cellRange;
+    }
+
+    const auto it = m_entries.find(eid);
+    if (it != m_entries.cend())
+    {
+        // Sprites usually move less than a cell between updates, in which case their cell
+        // registrations don't need to be touched
+        if (it->second.cells != entry.cells)
+        {
+            RemoveFromCells(eid, it->second.cells);
+            AddToCells(eid, entry.cells);
+        }
+
+        it->second = entry;
+        return;
+    }
+
+    AddToCells(eid, entry.cells);
+    m_entries.insert({eid, entry});
+}
+
+void SpriteSpatialIndex::Remove(EntityId eid)
+{
+    const auto it = m_entries.find(eid);
+    if (it == m_entries.cend())
+    {
+        return;
+    }
+
+    RemoveFromCells(eid, it->second.cells);
+    m_entries.erase(it);
+}
+
+void SpriteSpatialIndex::Clear()
+{
+    m_entries.clear();
+    m_cells.clear();
+    m_oversized.clear();
+}
+
+std::vector<EntityId> SpriteSpatialIndex::QueryPoint(const glm::vec2& virtualPoint) const
+{
+    std::vector<EntityId> results;
+
+    // A point only falls within one cell, so no sprite is visited twice
+    ForEachCandidate(virtualPoint, virtualPoint, [&](EntityId eid, const Entry& entry){
+        if (BoundsOverlap(virtualPoint, virtualPoint, entry.boundsMin, entry.boundsMax) &&
+            PointWithinRect(virtualPoint, entry.quad))
+        {
+            results.push_back(eid);
+        }
+    });
+
+    return SortedByDepth(std::move(results));
+}
+
+std::vector<EntityId> SpriteSpatialIndex::QueryRect(const glm::vec2& virtualMin, const glm::vec2& virtualMax) const
+{
+    std::vector<EntityId> results;
+
+    ForEachCandidate(virtualMin, virtualMax, [&](EntityId eid, const Entry& entry){
+        if (BoundsOverlap(virtualMin, virtualMax, entry.boundsMin, entry.boundsMax))
+        {
+            results.push_back(eid);
+        }
+    });
+
+    // Sprites which span multiple cells are visited once per cell
+    std::ranges::sort(results);
+    const auto duplicates = std::ranges::unique(results);
+    results.erase(duplicates.begin(), duplicates.end());
+
+    return SortedByDepth(std::move(results));
+}
+
+std::optional<EntityId> SpriteSpatialIndex::QueryNearest(const glm::vec2& virtualPoint, float maxVirtualDistance) const
+{
+    if (m_entries.empty()) { return std::nullopt; }
+
+    std::optional<std::pair<EntityId, const Entry*>> best;
+    float bestDistance = std::numeric_limits<float>::max();
+
+    //
+    // Search outwards in growing squares around the point. Any sprite within radius of the point
+    // overlaps the square, so once the best sprite found is within radius, it's the closest.
+    //
+    float radius = m_cellSize;
+
+    while (true)
+    {
+        radius = std::min(radius, maxVirtualDistance);
+
+        const bool visitedAll = ForEachCandidate(virtualPoint - radius, virtualPoint + radius, [&](EntityId eid, const Entry& entry){
+            const float distance = PointToQuadDistance(virtualPoint, entry.quad);
+            if (distance > maxVirtualDistance) { return; }
+
+            const bool isCloser = distance < bestDistance;
+            const bool isTiedAndHigher = distance == bestDistance && best && entry.depth < best->second->depth;
+
+            if (isCloser || isTiedAndHigher)
+            {
+                best = std::make_pair(eid, &entry);
+                bestDistance = distance;
+            }
+        });
+
+        if (visitedAll || bestDistance <= radius || radius >= maxVirtualDistance)
+        {
+            break;
+        }
+
+        radius *= 2.0f;
+    }
+
+    if (!best) { return std::nullopt; }
+
+    return best->first;
+}
+
+SpriteSpatialIndex::CellRange SpriteSpatialIndex::GetCellRange(const glm::vec2& virtualMin, const glm::vec2& virtualMax) const
+{
+    // Clamp to well within int32 range, so that the cell range math can't overflow
+    constexpr float CELL_LIMIT = 1 << 30;
+
+    const auto ToCell = [&](float virtualCoord){
+        return (int32_t)std::clamp(std::floor(virtualCoord / m_cellSize), -CELL_LIMIT, CELL_LIMIT);
+    };
+
+    return {
+        .minX = ToCell(virtualMin.x),
+        .minY = ToCell(virtualMin.y),
+        .maxX = ToCell(virtualMax.x),
+        .maxY = ToCell(virtualMax.y)
+    };
+}
+
+uint64_t SpriteSpatialIndex::GetCellKey(int32_t x, int32_t y)
+{
+    return ((uint64_t)(uint32_t)x << 32) | (uint64_t)(uint32_t)y;
+}
+
+void SpriteSpatialIndex::AddToCells(EntityId eid, const std::optional<CellRange>& cells)
+{
+    if (!cells)
+    {
+        m_oversized.push_back(eid);
+        return;
+    }
+
+    for (int32_t y = cells->minY; y <= cells->maxY; ++y)
+    {
+        for (int32_t x = cells->minX; x <= cells->maxX; ++x)
+        {
+            m_cells[GetCellKey(x, y)].push_back(eid);
+        }
+    }
+}
+
+static void SwapRemove(std::vector<EntityId>& eids, EntityId eid)
+{
+    const auto it = std::ranges::find(eids, eid);
+    if (it == eids.cend()) { return; }
+
+    *it = eids.back();
+    eids.pop_back();
+}
+
+void SpriteSpatialIndex::RemoveFromCells(EntityId eid, const std::optional<CellRange>& cells)
+{
+    if (!cells)
+    {
+        SwapRemove(m_oversized, eid);
+        return;
+    }
+
+    for (int32_t y = cells->minY; y <= cells->maxY; ++y)
+    {
+        for (int32_t x = cells->minX; x <= cells->maxX; ++x)
+        {
+            const auto cellIt = m_cells.find(GetCellKey(x, y));
+            if (cellIt == m_cells.cend()) { continue; }
+
+            SwapRemove(cellIt->second, eid);
+
+            if (cellIt->second.empty())
+            {
+                m_cells.erase(cellIt);
+            }
+        }
+    }
+}
+
+bool SpriteSpatialIndex::ForEachCandidate(const glm::vec2& virtualMin,
+                                          const glm::vec2& virtualMax,
+                                          const CandidateFunc& func) const
+{
+    const auto cellRange = GetCellRange(virtualMin, virtualMax);
+
+    //
+    // If the rect covers more cells than there are occupied cells, it's cheaper to just visit
+    // every sprite directly
+    //
+    if (cellRange.NumCells() > m_cells.size())
+    {
+        for (const auto& it : m_entries)
+        {
+            func(it.first, it.second);
+        }
+
+        return true;
+    }
+
+    for (int32_t y = cellRange.minY; y <= cellRange.maxY; ++y)
+    {
+        for (int32_t x = cellRange.minX; x <= cellRange.maxX; ++x)
+        {
+            const auto cellIt = m_cells.find(GetCellKey(x, y));
+            if (cellIt == m_cells.cend()) { continue; }
+
+            for (const auto& eid : cellIt->second)
+            {
+                func(eid, m_entries.at(eid));
+            }
+        }
+    }
+
+    for (const auto& eid : m_oversized)
+    {
+        func(eid, m_entries.at(eid));
+    }
+
+    return false;
+}
+
+std::vector<EntityId> SpriteSpatialIndex::SortedByDepth(std::vector<EntityId> eids) const
+{
+    std::ranges::sort(eids, [&](const EntityId& l, const EntityId& r){
+        return m_entries.at(l).depth < m_entries.at(r).depth;
+    });
+
+    return eids;
+}
+
+}
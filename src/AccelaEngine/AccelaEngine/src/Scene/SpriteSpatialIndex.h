@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAENGINE_SRC_SCENE_SPRITESPATIALINDEX_H
+#define LIBACCELAENGINE_SRC_SCENE_SPRITESPATIALINDEX_H
+
+#include <Accela/Engine/Common.h>
+
+#include <glm/glm.hpp>
+
+#include <unordered_map>
+#include <vector>
+#include <array>
+#include <optional>
+#include <functional>
+#include <cstdint>
+
+namespace Accela::Engine
+{
+    /**
+     * Uniform grid over the virtual space bounds of sprites, for answering hit-testing and other
+     * screen-space queries without visiting every sprite.
+     *
+     * Each sprite is registered in every grid cell its bounding box touches. Sprites which would touch
+     * an excessive number of cells (e.g. full screen backgrounds) are instead kept in a separate list
+     * which every query checks.
+     *
+     * Query results are sorted from top to bottom (ascending depth).
+     */
+    class SpriteSpatialIndex
+    {
+        public:
+
+            /** A sprite's virtual space corners: top left, top right, bottom right, bottom left */
+            using SpriteQuad = std::array<glm::vec2, 4>;
+
+        public:
+
+            /**
+             * @param cellSize Virtual space width/height of each grid cell
+             */
+            explicit SpriteSpatialIndex(float cellSize = 128.0f);
+
+            /**
+             * Adds a sprite to the index, or updates its bounds if it's already in the index
+             *
+             * @param eid The sprite's entity
+             * @param quad The sprite's virtual space corners
+             * @param depth The sprite's depth; lower depths are on top
+             */
+            void Upsert(EntityId eid, const SpriteQuad& quad, float depth);
+
+            /**
+             * Removes a sprite from the index, if it's in the index
+             */
+            void Remove(EntityId eid);
+
+            void Clear();
+
+            [[nodiscard]] std::size_t GetNumSprites() const noexcept { return m_entries.size(); }
+
+            /**
+             * @return The sprites which contain the virtual point, sorted from top to bottom
+             */
+            [[nodiscard]] std::vector<EntityId> QueryPoint(const glm::vec2& virtualPoint) const;
+
+            /**
+             * @return The sprites whose bounding boxes overlap the virtual rect, sorted from top to bottom
+             */
+            [[nodiscard]] std::vector<EntityId> QueryRect(const glm::vec2& virtualMin, const glm::vec2& virtualMax) const;
+
+            /**
+             * @return The sprite closest to the virtual point, within maxVirtualDistance of it, or std::nullopt
+             * if there's no such sprite. Of sprites which are equally close (e.g. which all contain the point),
+             * the top-most is returned.
+             */
+            [[nodiscard]] std::optional<EntityId> QueryNearest(const glm::vec2& virtualPoint, float maxVirtualDistance) const;
+
+        private:
+
+            struct CellRange
+            {
+                int32_t minX{0};
+                int32_t minY{0};
+                int32_t maxX{0};
+                int32_t maxY{0};
+
+                auto operator<=>(const CellRange&) const = default;
+
+                [[nodiscard]] uint64_t NumCells() const noexcept
+                {
+                    return (uint64_t)(maxX - minX + 1) * (uint64_t)(maxY - minY + 1);
+                }
+            };
+
+            struct Entry
+            {
+                SpriteQuad quad{};
+                glm::vec2 boundsMin{0.0f};
+                glm::vec2 boundsMax{0.0f};
+                float depth{0.0f};
+
+                // Cells the sprite is registered in, or std::nullopt if it's in the oversized list
+                std::optional<CellRange> cells;
+            };
+
+            using CandidateFunc = std::function<void(EntityId eid, const Entry& entry)>;
+
+        private:
+
+            [[nodiscard]] CellRange GetCellRange(const glm::vec2& virtualMin, const glm::vec2& virtualMax) const;
+            [[nodiscard]] static uint64_t GetCellKey(int32_t x, int32_t y);
+
+            void AddToCells(EntityId eid, const std::optional<CellRange>& cells);
+            void RemoveFromCells(EntityId eid, const std::optional<CellRange>& cells);
+
+            /**
+             * Invokes func for every sprite which might overlap the provided rect. A sprite may be
+             * visited more than once.
+             *
+             * @return True if every sprite in the index was visited
+             */
+            bool ForEachCandidate(const glm::vec2& virtualMin, const glm::vec2& virtualMax, const CandidateFunc& func) const;
+
+            [[nodiscard]] std::vector<EntityId> SortedByDepth(std::vector<EntityId> eids) const;
+
+        private:
+
+            float m_cellSize;
+
+            std::unordered_map<EntityId, Entry> m_entries;
+            std::unordered_map<uint64_t, std::vector<EntityId>> m_cells;
+            std::vector<EntityId> m_oversized;
+    };
+}
+
+#endif //LIBACCELAENGINE_SRC_SCENE_SPRITESPATIALINDEX_H
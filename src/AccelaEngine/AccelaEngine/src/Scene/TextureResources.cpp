@@ -13,39 +13,24 @@
 #include <Accela/Platform/File/IFiles.h>
 
 #include <Accela/Common/Thread/ThreadUtil.h>
-#include <Accela/Common/Thread/ResultMessage.h>
 
 #include <cstring>
 
 namespace Accela::Engine
 {
 
-struct TextureResultMessage : public Common::ResultMessage<Render::TextureId>
-{
-    TextureResultMessage()
-        : Common::ResultMessage<Render::TextureId>("TextureResultMessage")
-    { }
-};
-
-struct TextRenderResultMessage : public Common::ResultMessage<std::expected<TextRender, bool>>
-{
-    TextRenderResultMessage()
-        : Common::ResultMessage<std::expected<TextRender, bool>>("TextRenderResultMessage")
-    { }
-};
-
 TextureResources::TextureResources(Common::ILogger::Ptr logger,
                                    PackageResourcesPtr packages,
                                    std::shared_ptr<Render::IRenderer> renderer,
                                    std::shared_ptr<Platform::IFiles> files,
                                    std::shared_ptr<Platform::IText> text,
-                                   std::shared_ptr<Common::MessageDrivenThreadPool> threadPool)
+                                   Common::JobSystem::Ptr jobSystem)
     : m_logger(std::move(logger))
     , m_packages(std::move(packages))
     , m_renderer(std::move(renderer))
     , m_files(std::move(files))
     , m_text(std::move(text))
-    , m_threadPool(std::move(threadPool))
+    , m_jobSystem(std::move(jobSystem))
 {
 
 }
@@ -54,16 +39,9 @@ std::future<Render::TextureId> TextureResources::LoadPackageTexture(const Packag
                                                                     const TextureLoadConfig& loadConfig,
                                                                     ResultWhen resultWhen)
 {
-    auto message = std::make_shared<TextureResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<TextureResultMessage>(_message)->SetResult(
-            OnLoadPackageTexture(resource, loadConfig, resultWhen)
-        );
+    return m_jobSystem->SubmitForResult<Render::TextureId>([=,this](){
+        return OnLoadPackageTexture(resource, loadConfig, resultWhen);
     });
-
-    return messageFuture;
 }
 
 Render::TextureId TextureResources::OnLoadPackageTexture(const PackageResourceIdentifier& resource,
@@ -78,16 +56,9 @@ std::future<Render::TextureId> TextureResources::LoadPackageCubeTexture(const st
                                                                         const std::string& tag,
                                                                         ResultWhen resultWhen)
 {
-    auto message = std::make_shared<TextureResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<TextureResultMessage>(_message)->SetResult(
-            OnLoadPackageCubeTexture(resources, loadConfig, tag, resultWhen)
-        );
+    return m_jobSystem->SubmitForResult<Render::TextureId>([=,this](){
+        return OnLoadPackageCubeTexture(resources, loadConfig, tag, resultWhen);
     });
-
-    return messageFuture;
 }
 
 Render::TextureId TextureResources::OnLoadPackageCubeTexture(const std::array<PackageResourceIdentifier, 6>& resources,
@@ -106,16 +77,9 @@ std::future<Render::TextureId> TextureResources::LoadCustomTexture(const Common:
                                                                    const std::string& tag,
                                                                    ResultWhen resultWhen)
 {
-    auto message = std::make_shared<TextureResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<TextureResultMessage>(_message)->SetResult(
-            OnLoadCustomTexture(imageData, loadConfig, tag, resultWhen)
-        );
+    return m_jobSystem->SubmitForResult<Render::TextureId>([=,this](){
+        return OnLoadCustomTexture(imageData, loadConfig, tag, resultWhen);
     });
-
-    return messageFuture;
 }
 
 Render::TextureId TextureResources::OnLoadCustomTexture(const Common::ImageData::Ptr& imageData,
@@ -130,16 +94,9 @@ Render::TextureId TextureResources::OnLoadCustomTexture(const Common::ImageData:
 
 std::future<std::expected<TextRender, bool>> TextureResources::RenderText(const std::string& text, const Platform::TextProperties& properties, ResultWhen resultWhen)
 {
-    auto message = std::make_shared<TextRenderResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<TextRenderResultMessage>(_message)->SetResult(
-            OnRenderText(text, properties, resultWhen)
-        );
+    return m_jobSystem->SubmitForResult<std::expected<TextRender, bool>>([=,this](){
+        return OnRenderText(text, properties, resultWhen);
     });
-
-    return messageFuture;
 }
 
 std::expected<TextRender, bool> TextureResources::OnRenderText(const std::string& text,
@@ -263,7 +220,7 @@ Render::TextureId TextureResources::LoadPackageTexture(const std::vector<Package
             return Render::TextureId::Invalid();
         }
 
-        const auto textureDataExpect = m_files->LoadTexture(*textureBytesExpect, *textureDataFormatHint);
+        const auto textureDataExpect = m_files->LoadTexture(textureBytesExpect->GetBytes(), *textureDataFormatHint);
         if (!textureDataExpect)
         {
             m_logger->Log(Common::LogLevel::Error,
@@ -383,22 +340,35 @@ Common::ImageData::Ptr TextureResources::TextureDataToImageData(const TextureDat
     }
 
     //
-    // Otherwise, combine the texture's images into a new, tightly packed, image
+    // Otherwise, combine the texture's images into a new, tightly packed, image. Image data is stored
+    // mip-major, so each mip level of each image is copied in next to the same mip level of the others.
     //
+    const auto numMipLevels = textureData.textureImages[0]->GetNumMipLevels();
+
     std::vector<std::byte> combinedImageData(textureData.textureImages[0]->GetTotalByteSize() * textureData.textureImages.size());
+    std::size_t combinedByteOffset = 0;
 
-    for (unsigned int x = 0; x < textureData.textureImages.size(); ++x)
+    for (uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
     {
-        memcpy(
-            (void*)(combinedImageData.data() + (textureData.textureImages[x]->GetTotalByteSize() * x)),
-            (void*)textureData.textureImages[x]->GetPixelBytes().data(),
-            textureData.textureImages[x]->GetTotalByteSize()
-        );
+        for (unsigned int x = 0; x < textureData.textureImages.size(); ++x)
+        {
+            const auto& textureImage = textureData.textureImages[x];
+            const auto mipLevelByteSize = textureImage->GetMipLevelByteSize(mipLevel);
+
+            memcpy(
+                (void*)(combinedImageData.data() + combinedByteOffset),
+                (void*)(textureImage->GetPixelBytes().data() + textureImage->GetMipLevelByteOffset(mipLevel)),
+                mipLevelByteSize
+            );
+
+            combinedByteOffset += mipLevelByteSize;
+        }
     }
 
     return std::make_shared<Common::ImageData>(
         combinedImageData,
         6,
+        numMipLevels,
         textureData.textureImages[0]->GetPixelWidth(),
         textureData.textureImages[0]->GetPixelHeight(),
         textureData.textureImages[0]->GetPixelFormat());
@@ -13,7 +13,7 @@
 #include <Accela/Engine/Scene/ITextureResources.h>
 
 #include <Accela/Common/Log/ILogger.h>
-#include <Accela/Common/Thread/MessageDrivenThreadPool.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 #include <expected>
 #include <memory>
@@ -46,7 +46,7 @@ namespace Accela::Engine
                              std::shared_ptr<Render::IRenderer> renderer,
                              std::shared_ptr<Platform::IFiles> files,
                              std::shared_ptr<Platform::IText> text,
-                             std::shared_ptr<Common::MessageDrivenThreadPool> threadPool);
+                             Common::JobSystem::Ptr jobSystem);
 
             //
             // ITextureResources
@@ -110,7 +110,7 @@ namespace Accela::Engine
             std::shared_ptr<Render::IRenderer> m_renderer;
             std::shared_ptr<Platform::IFiles> m_files;
             std::shared_ptr<Platform::IText> m_text;
-            std::shared_ptr<Common::MessageDrivenThreadPool> m_threadPool;
+            Common::JobSystem::Ptr m_jobSystem;
 
             mutable std::mutex m_texturesMutex;
             std::unordered_map<Render::TextureId, RegisteredTexture> m_textures;
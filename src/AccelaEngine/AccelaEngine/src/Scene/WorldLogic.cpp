@@ -81,8 +81,6 @@ bool PointInsideLine(const glm::vec2& p, const std::array<glm::vec2, 2>& l)
         >= 0.0f;
 }
 
-// Whether the given point, is within the bounds of the rect provided. All coordinates
-// are expected to be in screen/virtual space.
 bool PointWithinRect(const glm::vec2& p, const std::array<glm::vec2, 4>& r)
 {
     return
@@ -92,16 +90,15 @@ bool PointWithinRect(const glm::vec2& p, const std::array<glm::vec2, 4>& r)
         PointInsideLine(p, {r[3], r[0]});
 }
 
-bool SpriteContainsPoint(const IWorldResources::Ptr& resources,
-                         const Render::RenderSettings& renderSettings,
-                         const glm::vec2& virtualResolution,
-                         const SpriteRenderableComponent& sprite,
-                         const TransformComponent& transform,
-                         const glm::vec2& virtualPoint)
+std::optional<std::array<glm::vec2, 4>> GetSpriteVirtualPoints(const IWorldResources::Ptr& resources,
+                                                                 const Render::RenderSettings& renderSettings,
+                                                                 const glm::vec2& virtualResolution,
+                                                                 const SpriteRenderableComponent& sprite,
+                                                                 const TransformComponent& transform)
 {
     const auto textureDataOpt = resources->Textures()->GetLoadedTextureData(sprite.textureId);
 
-    if (!textureDataOpt || !textureDataOpt->data) { return false; }
+    if (!textureDataOpt || !textureDataOpt->data) { return std::nullopt; }
 
     auto pixelSize = glm::vec2(textureDataOpt->pixelSize.w, textureDataOpt->pixelSize.h);
     const auto virtualPosition = transform.GetPosition();
@@ -139,7 +136,20 @@ bool SpriteContainsPoint(const IWorldResources::Ptr& resources,
         return point;
     });
 
-    return PointWithinRect(virtualPoint, spriteVirtualPoints);
+    return spriteVirtualPoints;
+}
+
+bool SpriteContainsPoint(const IWorldResources::Ptr& resources,
+                         const Render::RenderSettings& renderSettings,
+                         const glm::vec2& virtualResolution,
+                         const SpriteRenderableComponent& sprite,
+                         const TransformComponent& transform,
+                         const glm::vec2& virtualPoint)
+{
+    const auto spriteVirtualPoints = GetSpriteVirtualPoints(resources, renderSettings, virtualResolution, sprite, transform);
+    if (!spriteVirtualPoints) { return false; }
+
+    return PointWithinRect(virtualPoint, *spriteVirtualPoints);
 }
 
 }
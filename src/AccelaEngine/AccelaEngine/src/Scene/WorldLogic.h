@@ -17,6 +17,7 @@
 #include <glm/glm.hpp>
 
 #include <optional>
+#include <array>
 
 namespace Accela::Engine
 {
@@ -58,6 +59,31 @@ namespace Accela::Engine
         };
     }
 
+    /**
+     * Whether the given point is within the bounds of the rect provided. All coordinates
+     * are expected to be in screen/virtual space.
+     *
+     * @param p The point to be tested
+     * @param r The rect's corners, in clockwise order (top left, top right, bottom right, bottom left)
+     */
+    [[nodiscard]] bool PointWithinRect(const glm::vec2& p, const std::array<glm::vec2, 4>& r);
+
+    /**
+     * Calculates the virtual space corners of a sprite, after its transform has been applied
+     *
+     * @param resources The IWorldResources instance
+     * @param sprite The sprite component
+     * @param transform The sprite's transform component
+     *
+     * @return The sprite's corners (top left, top right, bottom right, bottom left), or std::nullopt
+     * if the sprite's texture isn't loaded
+     */
+    [[nodiscard]] std::optional<std::array<glm::vec2, 4>> GetSpriteVirtualPoints(const IWorldResources::Ptr& resources,
+                                                                                const Render::RenderSettings& renderSettings,
+                                                                                const glm::vec2& virtualResolution,
+                                                                                const SpriteRenderableComponent& sprite,
+                                                                                const TransformComponent& transform);
+
     /**
      * Determines whether a given point in render space overlaps with a specified sprite
      *
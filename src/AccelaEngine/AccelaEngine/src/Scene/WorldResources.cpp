@@ -18,8 +18,6 @@
 
 #include <Accela/Render/IRenderer.h>
 
-#include <Accela/Common/Thread/ResultMessage.h>
-
 #include <algorithm>
 
 namespace Accela::Engine
@@ -29,20 +27,21 @@ WorldResources::WorldResources(Common::ILogger::Ptr logger,
                                std::shared_ptr<Render::IRenderer> renderer,
                                std::shared_ptr<Platform::IFiles> files,
                                std::shared_ptr<Platform::IText> text,
-                               AudioManagerPtr audioManager)
+                               AudioManagerPtr audioManager,
+                               Common::JobSystem::Ptr jobSystem)
     : m_logger(std::move(logger))
-    , m_threadPool(std::make_shared<Common::MessageDrivenThreadPool>("Resources", 4)) // TODO Perf: Adjust pool size
+    , m_jobSystem(std::move(jobSystem))
     , m_renderer(std::move(renderer))
     , m_files(std::move(files))
     , m_text(std::move(text))
     , m_audioManager(std::move(audioManager))
-    , m_packages(std::make_shared<PackageResources>(m_logger, m_files, m_threadPool))
-    , m_textures(std::make_shared<TextureResources>(m_logger, m_packages, m_renderer, m_files, m_text, m_threadPool))
-    , m_meshes(std::make_shared<MeshResources>(m_logger, m_textures, m_renderer, m_files, m_threadPool))
-    , m_materials(std::make_shared<MaterialResources>(m_logger, m_textures, m_renderer, m_threadPool))
-    , m_audio(std::make_shared<AudioResources>(m_logger, m_packages, m_audioManager, m_threadPool))
-    , m_fonts(std::make_shared<FontResources>(m_logger, m_packages, m_text, m_threadPool))
-    , m_models(std::make_shared<ModelResources>(m_logger, m_packages, m_renderer, m_files, m_threadPool))
+    , m_packages(std::make_shared<PackageResources>(m_logger, m_files, m_jobSystem))
+    , m_textures(std::make_shared<TextureResources>(m_logger, m_packages, m_renderer, m_files, m_text, m_jobSystem))
+    , m_meshes(std::make_shared<MeshResources>(m_logger, m_textures, m_renderer, m_files, m_jobSystem))
+    , m_materials(std::make_shared<MaterialResources>(m_logger, m_textures, m_renderer, m_jobSystem))
+    , m_audio(std::make_shared<AudioResources>(m_logger, m_packages, m_audioManager, m_jobSystem))
+    , m_fonts(std::make_shared<FontResources>(m_logger, m_packages, m_text, m_jobSystem))
+    , m_models(std::make_shared<ModelResources>(m_logger, m_packages, m_renderer, m_files, m_jobSystem))
 {
 
 }
@@ -57,16 +56,9 @@ IModelResources::Ptr WorldResources::Models() const { return m_models; }
 
 std::future<bool> WorldResources::EnsurePackageResources(const PackageName& packageName, ResultWhen resultWhen)
 {
-    auto message = std::make_shared<Common::BoolResultMessage>();
-    auto messageFuture = message->CreateFuture();
-
-    m_threadPool->PostMessage(message, [=,this](const Common::Message::Ptr& _message){
-        std::dynamic_pointer_cast<Common::BoolResultMessage>(_message)->SetResult(
-            OnEnsurePackageResources(packageName, resultWhen)
-        );
+    return m_jobSystem->SubmitForResult<bool>([=,this](){
+        return OnEnsurePackageResources(packageName, resultWhen);
     });
-
-    return messageFuture;
 }
 
 bool WorldResources::OnEnsurePackageResources(const PackageName& packageName, ResultWhen resultWhen) const
@@ -79,7 +71,7 @@ bool WorldResources::OnEnsurePackageResources(const PackageName& packageName, Re
     const auto package = m_packages->GetPackageSource(packageName);
     if (!package)
     {
-        if (!m_packages->OpenAndRegisterPackage(packageName).get())
+        if (!m_jobSystem->Await(m_packages->OpenAndRegisterPackage(packageName)))
         {
             m_logger->Log(Common::LogLevel::Error,
               "WorldResources::OnOpenAndLoadPackage: Failed to open/register package: {}", packageName.name);
@@ -95,8 +87,11 @@ bool WorldResources::OnEnsurePackageResources(const PackageName& packageName, Re
     // Note that we're also not bailing out if any particular step fails, we're just
     // trying to load as much of the package as we successfully can.
     //
+    // Note that as this runs as a job, waits on other loads go through the job system
+    // rather than blocking the worker outright.
+    //
 
-    if (!m_audio->LoadAllAudio(packageName).get())
+    if (!m_jobSystem->Await(m_audio->LoadAllAudio(packageName)))
     {
         m_logger->Log(Common::LogLevel::Error,
           "WorldResources::OnOpenAndLoadPackage: Failed to load all audio for package: {}", packageName.name);
@@ -104,7 +99,7 @@ bool WorldResources::OnEnsurePackageResources(const PackageName& packageName, Re
 
     // Note that we're by default only loading sizes 8 through 20 of each font.
     // TODO: Revisit?
-    if (!m_fonts->LoadAllFonts(packageName, 8, 20).get())
+    if (!m_jobSystem->Await(m_fonts->LoadAllFonts(packageName, 8, 20)))
     {
         m_logger->Log(Common::LogLevel::Error,
           "WorldResources::OnOpenAndLoadPackage: Failed to load all fonts for package: {}", packageName.name);
@@ -124,7 +119,7 @@ bool WorldResources::OnEnsurePackageResources(const PackageName& packageName, Re
           "WorldResources::OnOpenAndLoadPackage: Failed to load all materials for package: {}", packageName.name);
     }*/
 
-    if (!m_models->LoadAllModels(packageName, resultWhen).get())
+    if (!m_jobSystem->Await(m_models->LoadAllModels(packageName, resultWhen)))
     {
         m_logger->Log(Common::LogLevel::Error,
           "WorldResources::OnOpenAndLoadPackage: Failed to load all models for package: {}", packageName.name);
@@ -16,7 +16,7 @@
 #include <Accela/Render/Texture/Texture.h>
 
 #include <Accela/Common/Log/ILogger.h>
-#include <Accela/Common/Thread/MessageDrivenThreadPool.h>
+#include <Accela/Common/Thread/JobSystem.h>
 
 #include <expected>
 #include <unordered_map>
@@ -45,7 +45,8 @@ namespace Accela::Engine
                            std::shared_ptr<Render::IRenderer> renderer,
                            std::shared_ptr<Platform::IFiles> files,
                            std::shared_ptr<Platform::IText> text,
-                           AudioManagerPtr audioManager);
+                           AudioManagerPtr audioManager,
+                           Common::JobSystem::Ptr jobSystem);
 
             [[nodiscard]] IPackageResources::Ptr Packages() const override;
             [[nodiscard]] ITextureResources::Ptr Textures() const override;
@@ -66,7 +67,7 @@ namespace Accela::Engine
         private:
 
             Common::ILogger::Ptr m_logger;
-            std::shared_ptr<Common::MessageDrivenThreadPool> m_threadPool;
+            Common::JobSystem::Ptr m_jobSystem;
             std::shared_ptr<Render::IRenderer> m_renderer;
             std::shared_ptr<Platform::IFiles> m_files;
             std::shared_ptr<Platform::IText> m_text;
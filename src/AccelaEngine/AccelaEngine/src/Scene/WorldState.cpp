@@ -31,6 +31,9 @@
 #include <Accela/Common/Assert.h>
 
 #include <algorithm>
+#include <cmath>
+#include <future>
+#include <chrono>
 
 namespace Accela::Engine
 {
@@ -70,6 +73,8 @@ void WorldState::AssertEntityValid(EntityId entityId, std::string_view caller) c
 
 void WorldState::CreateRegistryListeners()
 {
+    m_registry.on_construct<SpriteRenderableComponent>().connect<&WorldState::OnSpriteRenderableComponentCreated>(this);
+    m_registry.on_construct<TransformComponent>().connect<&WorldState::OnTransformComponentCreated>(this);
     m_registry.on_construct<ModelRenderableComponent>().connect<&WorldState::OnModelRenderableComponentCreated>(this);
     m_registry.on_construct<PhysicsComponent>().connect<&WorldState::OnPhysicsComponentCreated>(this);
 
@@ -153,6 +158,9 @@ glm::vec2 WorldState::GetVirtualResolution() const noexcept
 void WorldState::SetVirtualResolution(const glm::vec2& virtualResolution) noexcept
 {
     m_virtualResolution = virtualResolution;
+
+    // Sprite virtual sizes can depend on the virtual resolution
+    MarkAllSpriteBoundsDirty();
 }
 
 Render::USize WorldState::RenderSizeToVirtualSize(const Render::USize& renderSize)
@@ -276,73 +284,221 @@ void WorldState::DestroyAllEntities()
 
 std::vector<EntityId> WorldState::GetSpriteEntitiesAt(const glm::vec2& virtualPoint) const
 {
-    std::vector<std::pair<EntityId, float>> matchedSprites;
+    SyncSpriteIndex();
 
-    //
-    // Get all sprite entities at that render point
-    //
-    m_registry.view<SpriteRenderableComponent, TransformComponent>().each(
-        [&](const entt::entity& eid,
-            const SpriteRenderableComponent& spriteComponent,
-            const TransformComponent& transformComponent
-        )
+    return m_spriteIndex.QueryPoint(virtualPoint);
+}
+
+std::optional<EntityId> WorldState::GetTopSpriteEntityAt(const glm::vec2& virtualPoint) const
+{
+    const auto allEntities = GetSpriteEntitiesAt(virtualPoint);
+    if (allEntities.empty())
+    {
+        return std::nullopt;
+    }
+
+    return allEntities.front();
+}
+
+std::vector<EntityId> WorldState::GetSpriteEntitiesIn(const glm::vec2& virtualMin, const glm::vec2& virtualMax) const
+{
+    SyncSpriteIndex();
+
+    return m_spriteIndex.QueryRect(virtualMin, virtualMax);
+}
+
+std::optional<EntityId> WorldState::GetNearestSpriteEntity(const glm::vec2& virtualPoint, float maxVirtualDistance) const
+{
+    SyncSpriteIndex();
+
+    return m_spriteIndex.QueryNearest(virtualPoint, maxVirtualDistance);
+}
+
+void WorldState::MarkSpriteBoundsDirty(entt::entity entity) const
+{
+    m_dirtySpriteBounds.insert((EntityId)entity);
+}
+
+void WorldState::MarkAllSpriteBoundsDirty() const
+{
+    for (const auto& entity : m_registry.view<SpriteRenderableComponent>())
+    {
+        MarkSpriteBoundsDirty(entity);
+    }
+}
+
+void WorldState::SyncSpriteIndex() const
+{
+    std::erase_if(m_dirtySpriteBounds, [&](const EntityId& eid){
+        const auto entity = (entt::entity)eid;
+
+        const auto pSpriteComponent = m_registry.valid(entity) ? m_registry.try_get<SpriteRenderableComponent>(entity) : nullptr;
+        const auto pTransformComponent = m_registry.valid(entity) ? m_registry.try_get<TransformComponent>(entity) : nullptr;
+
+        if (pSpriteComponent == nullptr || pTransformComponent == nullptr)
         {
-            if (SpriteContainsPoint(m_worldResources, m_renderSettings, m_virtualResolution, spriteComponent, transformComponent, virtualPoint))
-            {
-                matchedSprites.emplace_back((EntityId)eid, transformComponent.GetPosition().z);
-            }
+            m_spriteIndex.Remove(eid);
+            return true;
         }
-    );
 
-    //
-    // Sort the entities by height, with the closest (top) first
-    //
-    std::ranges::sort(matchedSprites, [](const auto& p1, const auto& p2){
-       return p1.second < p2.second;
-    });
-
-    //
-    // Transform the sorted entities to a basic entity id vector without height data
-    //
-    std::vector<EntityId> sortedMatchedSprites;
+        const auto spriteVirtualPoints = GetSpriteVirtualPoints(
+            m_worldResources,
+            m_renderSettings,
+            m_virtualResolution,
+            *pSpriteComponent,
+            *pTransformComponent
+        );
+
+        // If the sprite's texture isn't loaded yet, its size isn't known. Leave it out of the
+        // index and keep it dirty so that it's retried on the next sync.
+        if (!spriteVirtualPoints)
+        {
+            m_spriteIndex.Remove(eid);
+            return false;
+        }
 
-    std::ranges::transform(matchedSprites, std::back_inserter(sortedMatchedSprites), [](const auto& p){
-        return p.first;
+        m_spriteIndex.Upsert(eid, *spriteVirtualPoints, pTransformComponent->GetPosition().z);
+        return true;
     });
+}
 
-    return sortedMatchedSprites;
+void WorldState::OnSpriteRenderableComponentCreated(entt::registry&, entt::entity entity)
+{
+    MarkSpriteBoundsDirty(entity);
 }
 
-std::optional<EntityId> WorldState::GetTopSpriteEntityAt(const glm::vec2& virtualPoint) const
+void WorldState::OnTransformComponentCreated(entt::registry& registry, entt::entity entity)
 {
-    const auto allEntities = GetSpriteEntitiesAt(virtualPoint);
-    if (allEntities.empty())
+    if (registry.all_of<SpriteRenderableComponent>(entity))
     {
-        return std::nullopt;
+        MarkSpriteBoundsDirty(entity);
     }
+}
 
-    return allEntities.front();
+Render::URect WorldState::VirtualPointToPickRect(const glm::vec2& virtualPoint) const
+{
+    const auto renderPoint = VirtualPointToRenderPoint(m_renderSettings, m_virtualResolution, virtualPoint);
+
+    // Pick the single render pixel underneath the point
+    return Render::URect(
+        (uint32_t)std::max(renderPoint.x, 0.0f),
+        (uint32_t)std::max(renderPoint.y, 0.0f),
+        1,
+        1
+    );
 }
 
 std::optional<EntityId> WorldState::GetTopObjectEntityAt(const glm::vec2& virtualPoint) const
 {
-    const auto renderPoint = VirtualPointToRenderPoint(m_renderSettings, m_virtualResolution, virtualPoint);
+    const auto objectIds = m_renderer->PickObjectsInRenderRect(VirtualPointToPickRect(virtualPoint)).get();
 
-    const auto objectId = m_renderer->GetTopObjectAtRenderPoint(renderPoint);
-    if (!objectId || !objectId->IsValid())
+    const auto entities = ObjectsToEntities(objectIds, "GetTopObjectEntityAt");
+    if (entities.empty())
     {
         return std::nullopt;
     }
 
-    const auto entity = std::dynamic_pointer_cast<RendererSyncSystem>(m_rendererSyncSystem)->GetObjectEntity(*objectId);
-    if (!entity)
+    return entities.front();
+}
+
+void WorldState::GetTopObjectEntityAt(const glm::vec2& virtualPoint,
+                                      std::function<void(const std::optional<EntityId>&)> onResult)
+{
+    m_pendingObjectPicks.push_back(PendingObjectPick{
+        .objectIds = m_renderer->PickObjectsInRenderRect(VirtualPointToPickRect(virtualPoint)),
+        .onResult = [onResult = std::move(onResult)](const std::vector<EntityId>& entities){
+            onResult(entities.empty() ? std::nullopt : std::optional<EntityId>(entities.front()));
+        },
+        .caller = "GetTopObjectEntityAt"
+    });
+}
+
+void WorldState::GetObjectEntitiesIn(const glm::vec2& virtualMin,
+                                     const glm::vec2& virtualMax,
+                                     std::function<void(const std::vector<EntityId>&)> onResult)
+{
+    const auto renderMin = glm::max(VirtualPointToRenderPoint(m_renderSettings, m_virtualResolution, virtualMin), glm::vec2(0.0f));
+    const auto renderMax = glm::max(VirtualPointToRenderPoint(m_renderSettings, m_virtualResolution, virtualMax), glm::vec2(0.0f));
+
+    // Cover every render pixel the virtual rect touches, and at least one pixel
+    const auto x = (uint32_t)std::floor(std::min(renderMin.x, renderMax.x));
+    const auto y = (uint32_t)std::floor(std::min(renderMin.y, renderMax.y));
+    const auto w = std::max((uint32_t)std::ceil(std::max(renderMin.x, renderMax.x)) - x, 1U);
+    const auto h = std::max((uint32_t)std::ceil(std::max(renderMin.y, renderMax.y)) - y, 1U);
+
+    m_pendingObjectPicks.push_back(PendingObjectPick{
+        .objectIds = m_renderer->PickObjectsInRenderRect(Render::URect(x, y, w, h)),
+        .onResult = std::move(onResult),
+        .caller = "GetObjectEntitiesIn"
+    });
+}
+
+void WorldState::GetObjectEntitiesAlongRay(const std::string& sceneName,
+                                           const glm::vec3& rayStart_worldSpace,
+                                           const glm::vec3& rayEnd_worldSpace,
+                                           std::function<void(const std::vector<EntityId>&)> onResult)
+{
+    m_pendingObjectPicks.push_back(PendingObjectPick{
+        .objectIds = m_renderer->PickObjectsAlongRay(sceneName, rayStart_worldSpace, rayEnd_worldSpace),
+        .onResult = std::move(onResult),
+        .caller = "GetObjectEntitiesAlongRay"
+    });
+}
+
+void WorldState::FulfillObjectPicks()
+{
+    //
+    // Pull out the picks whose results are ready before calling any callbacks, as callbacks may request
+    // further picks
+    //
+    std::vector<PendingObjectPick> readyPicks;
+    std::vector<PendingObjectPick> stillPendingPicks;
+
+    for (auto& pick : m_pendingObjectPicks)
     {
-        m_logger->Log(Common::LogLevel::Error,
-          "WorldState::GetTopObjectEntityAt: Found an object, but unable to determine its entity: {}", objectId->id);
-        return std::nullopt;
+        const bool isReady = pick.objectIds.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+
+        (isReady ? readyPicks : stillPendingPicks).push_back(std::move(pick));
     }
 
-    return EntityId(*entity);
+    m_pendingObjectPicks = std::move(stillPendingPicks);
+
+    //
+    // The object to entity mapping is only valid on the engine thread, so it's looked up here, rather than
+    // by the render thread which produced the result
+    //
+    for (auto& pick : readyPicks)
+    {
+        pick.onResult(ObjectsToEntities(pick.objectIds.get(), pick.caller));
+    }
+}
+
+void WorldState::CancelObjectPicks()
+{
+    m_pendingObjectPicks.clear();
+}
+
+std::vector<EntityId> WorldState::ObjectsToEntities(const std::vector<Render::ObjectId>& objectIds, const std::string& caller) const
+{
+    const auto rendererSyncSystem = std::dynamic_pointer_cast<RendererSyncSystem>(m_rendererSyncSystem);
+
+    std::vector<EntityId> entities;
+
+    for (const auto& objectId : objectIds)
+    {
+        const auto entity = rendererSyncSystem->GetObjectEntity(objectId);
+        if (!entity)
+        {
+            // Can legitimately happen if the entity was destroyed after the frame was rendered
+            m_logger->Log(Common::LogLevel::Warning,
+              "WorldState::{}: Found an object, but unable to determine its entity: {}", caller, objectId.id);
+            continue;
+        }
+
+        entities.push_back(EntityId(*entity));
+    }
+
+    return entities;
 }
 
 void WorldState::CreateConstructEntities(const Construct::Ptr& construct)
@@ -433,6 +589,7 @@ void MarkStateComponentDirty(entt::registry& registry, entt::entity entity)
 void WorldState::OnSpriteRenderableComponentUpdated(entt::registry& registry, entt::entity entity)
 {
     MarkStateComponentDirty<RenderableStateComponent>(registry, entity);
+    MarkSpriteBoundsDirty(entity);
 }
 
 void WorldState::OnObjectRenderableComponentUpdated(entt::registry& registry, entt::entity entity)
@@ -455,6 +612,11 @@ void WorldState::OnTransformComponentUpdated(entt::registry& registry, entt::ent
     MarkStateComponentDirty<RenderableStateComponent>(registry, entity);
     MarkStateComponentDirty<LightRenderableStateComponent>(registry, entity);
 
+    if (registry.all_of<SpriteRenderableComponent>(entity))
+    {
+        MarkSpriteBoundsDirty(entity);
+    }
+
     // If the component was updated, and not because we're syncing its data from the
     // physics system, then we want to update the physics system with the new data
     if (m_executingSystem != IWorldSystem::Type::PhysicsSync)
@@ -481,6 +643,9 @@ void WorldState::OnPhysicsComponentUpdated(entt::registry& registry, entt::entit
 void WorldState::OnSpriteRenderableComponentDestroyed(entt::registry&, entt::entity entity)
 {
     RemoveComponent<RenderableStateComponent>((EntityId)entity);
+
+    m_spriteIndex.Remove((EntityId)entity);
+    m_dirtySpriteBounds.erase((EntityId)entity);
 }
 
 void WorldState::OnObjectRenderableComponentDestroyed(entt::registry&, entt::entity entity)
@@ -508,6 +673,9 @@ void WorldState::OnTransformComponentDestroyed(entt::registry&, entt::entity ent
 {
     RemoveComponent<RenderableStateComponent>((EntityId)entity);
     RemoveComponent<PhysicsStateComponent>((EntityId)entity);
+
+    m_spriteIndex.Remove((EntityId)entity);
+    m_dirtySpriteBounds.erase((EntityId)entity);
 }
 
 void WorldState::OnPhysicsComponentDestroyed(entt::registry&, entt::entity entity)
@@ -772,6 +940,8 @@ IPhysicsRuntime::Ptr WorldState::GetPhysics() const
 
 void WorldState::MarkSpritesDirty()
 {
+    MarkAllSpriteBoundsDirty();
+
     m_registry.view<RenderableStateComponent, SpriteRenderableComponent>().each(
     [&](const auto&,
             RenderableStateComponent& renderableComponent,
@@ -790,6 +960,9 @@ Render::RenderSettings WorldState::GetRenderSettings() const noexcept
 void WorldState::SetRenderSettings(const Render::RenderSettings& renderSettings) noexcept
 {
     m_renderSettings = renderSettings;
+
+    // Sprite virtual sizes can depend on the render resolution
+    MarkAllSpriteBoundsDirty();
 }
 
 std::unordered_set<EntityId> WorldState::GetHighlightedEntities() const noexcept
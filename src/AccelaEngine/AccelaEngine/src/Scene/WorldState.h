@@ -9,6 +9,7 @@
 
 #include "IWorldSystem.h"
 #include "SceneState.h"
+#include "SpriteSpatialIndex.h"
 
 #include "../ForwardDeclares.h"
 #include "../RunState.h"
@@ -29,8 +30,11 @@
 #include <entt/entt.hpp>
 
 #include <expected>
+#include <future>
+#include <functional>
 #include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace Accela::Engine
@@ -51,6 +55,8 @@ namespace Accela::Engine
                        const glm::vec2& virtualResolution);
 
             void ExecuteSystems(const RunState::Ptr& runState);
+            void FulfillObjectPicks();
+            void CancelObjectPicks();
             void SyncAudioListenerToCamera(const Camera::Ptr& camera);
             [[nodiscard]] SceneState& GetOrCreateSceneState(const std::string& sceneName);
             void MarkSpritesDirty();
@@ -67,7 +73,20 @@ namespace Accela::Engine
 
             [[nodiscard]] std::vector<EntityId> GetSpriteEntitiesAt(const glm::vec2& virtualPoint) const override;
             [[nodiscard]] std::optional<EntityId> GetTopSpriteEntityAt(const glm::vec2& virtualPoint) const override;
+            [[nodiscard]] std::vector<EntityId> GetSpriteEntitiesIn(const glm::vec2& virtualMin,
+                                                                    const glm::vec2& virtualMax) const override;
+            [[nodiscard]] std::optional<EntityId> GetNearestSpriteEntity(const glm::vec2& virtualPoint,
+                                                                         float maxVirtualDistance) const override;
             [[nodiscard]] std::optional<EntityId> GetTopObjectEntityAt(const glm::vec2& virtualPoint) const override;
+            void GetTopObjectEntityAt(const glm::vec2& virtualPoint,
+                                      std::function<void(const std::optional<EntityId>&)> onResult) override;
+            void GetObjectEntitiesIn(const glm::vec2& virtualMin,
+                                     const glm::vec2& virtualMax,
+                                     std::function<void(const std::vector<EntityId>&)> onResult) override;
+            void GetObjectEntitiesAlongRay(const std::string& sceneName,
+                                           const glm::vec3& rayStart_worldSpace,
+                                           const glm::vec3& rayEnd_worldSpace,
+                                           std::function<void(const std::vector<EntityId>&)> onResult) override;
 
             void CreateConstructEntities(const Construct::Ptr& construct) override;
 
@@ -192,6 +211,16 @@ namespace Accela::Engine
             //
             [[nodiscard]] IPhysicsRuntime::Ptr GetPhysics() const override;
 
+        private:
+
+            // An object pick which the renderer is still producing the result of
+            struct PendingObjectPick
+            {
+                std::future<std::vector<Render::ObjectId>> objectIds;
+                std::function<void(const std::vector<EntityId>&)> onResult;
+                std::string caller;
+            };
+
         private:
 
             void AssertEntityValid(EntityId entityId, std::string_view caller) const;
@@ -199,6 +228,16 @@ namespace Accela::Engine
             void CreateRegistryListeners();
             void CreateSystems();
 
+            void MarkSpriteBoundsDirty(entt::entity entity) const;
+            void MarkAllSpriteBoundsDirty() const;
+            void SyncSpriteIndex() const;
+
+            [[nodiscard]] Render::URect VirtualPointToPickRect(const glm::vec2& virtualPoint) const;
+            [[nodiscard]] std::vector<EntityId> ObjectsToEntities(const std::vector<Render::ObjectId>& objectIds,
+                                                                  const std::string& caller) const;
+
+            void OnSpriteRenderableComponentCreated(entt::registry& registry, entt::entity entity);
+            void OnTransformComponentCreated(entt::registry& registry, entt::entity entity);
             void OnModelRenderableComponentCreated(entt::registry& registry, entt::entity entity);
             void OnPhysicsComponentCreated(entt::registry& registry, entt::entity entity);
 
@@ -244,6 +283,14 @@ namespace Accela::Engine
             glm::vec2 m_virtualResolution;
             std::unordered_map<std::string, SceneState> m_sceneState;
             std::unordered_set<EntityId> m_highlightedEntities;
+
+            // Screen-space index of sprite bounds, synced lazily from the sprites whose bounds
+            // changed, when it's next queried
+            mutable SpriteSpatialIndex m_spriteIndex;
+            mutable std::unordered_set<EntityId> m_dirtySpriteBounds;
+
+            // Object picks whose callbacks are called, from the engine thread, once their result is ready
+            std::vector<PendingObjectPick> m_pendingObjectPicks;
     };
 }
 
@@ -16,6 +16,7 @@
 
 #include <expected>
 #include <vector>
+#include <span>
 #include <cstddef>
 #include <string>
 #include <cstring>
@@ -78,13 +79,13 @@ namespace Accela::Engine
      * @return The deserialized CType class, or false on error
      */
     template <typename CType, typename MType>
-    std::expected<CType, bool> ObjectFromBytes(const std::vector<std::byte>& bytes)
+    std::expected<CType, bool> ObjectFromBytes(std::span<const std::byte> bytes)
     {
         MType model{};
 
         try
         {
-            const nlohmann::json j = nlohmann::json::parse(bytes.cbegin(), bytes.cend());
+            const nlohmann::json j = nlohmann::json::parse(bytes.begin(), bytes.end());
             model = j.template get<MType>();
         }
         catch (nlohmann::json::exception& e)
@@ -16,6 +16,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <span>
 #include <cstddef>
 #include <optional>
 
@@ -31,8 +32,10 @@ namespace Accela::Platform
     static constexpr const char* VIDEO_SUBDIR = "videos";
     static constexpr const char* FONTS_SUBDIR = "fonts";
     static constexpr const char* MODELS_SUBDIR = "models";
+    static constexpr const char* CACHE_SUBDIR = "cache";
 
     static constexpr const char* PACKAGE_EXTENSION = ".apc";
+    static constexpr const char* PACKED_PACKAGE_EXTENSION = ".apak";
     static constexpr const char* CONSTRUCT_EXTENSION = ".acn";
 
     /**
@@ -65,7 +68,7 @@ namespace Accela::Platform
             [[nodiscard]] virtual std::expected<std::vector<std::string>, bool> ListFilesInDirectory(const std::string& directory) const = 0;
             [[nodiscard]] virtual std::string EnsureEndsWithSeparator(const std::string& source) const = 0;
 
-            [[nodiscard]] virtual std::expected<Common::ImageData::Ptr, bool> LoadTexture(const std::vector<std::byte>& data, const std::optional<std::string>& dataFormatHint) const = 0;
+            [[nodiscard]] virtual std::expected<Common::ImageData::Ptr, bool> LoadTexture(std::span<const std::byte> data, const std::optional<std::string>& dataFormatHint) const = 0;
             [[nodiscard]] virtual std::expected<std::vector<unsigned char>, bool> LoadAccelaFile(const std::string& subdir, const std::string& fileName) const = 0;
     };
 }
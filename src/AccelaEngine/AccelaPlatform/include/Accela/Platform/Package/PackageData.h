@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAPLATFORM_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKAGEDATA_H
+#define LIBACCELAPLATFORM_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKAGEDATA_H
+
+#include <Accela/Common/SharedLib.h>
+
+#include <memory>
+#include <vector>
+#include <span>
+#include <cstddef>
+
+namespace Accela::Platform
+{
+    /**
+     * A read-only block of data fetched from a package.
+     *
+     * The data is either owned by the object itself, or is a view into memory owned by the package
+     * it came from (for example, a memory mapped package file). In the latter case the object keeps
+     * that memory alive, so the data remains valid for as long as any copy of the object exists, even
+     * if the package source itself is destroyed. Copies are cheap and share the same underlying data.
+     */
+    class ACCELA_PUBLIC PackageData
+    {
+        public:
+
+            PackageData() = default;
+
+            /**
+             * Creates package data which owns the provided bytes
+             */
+            explicit PackageData(std::vector<std::byte> bytes)
+            {
+                auto owned = std::make_shared<const std::vector<std::byte>>(std::move(bytes));
+                m_bytes = std::span<const std::byte>(owned->data(), owned->size());
+                m_owner = std::move(owned);
+            }
+
+            /**
+             * Creates package data which views bytes that are kept alive by the provided owner
+             */
+            PackageData(std::span<const std::byte> bytes, std::shared_ptr<const void> owner)
+                : m_owner(std::move(owner))
+                , m_bytes(bytes)
+            { }
+
+            [[nodiscard]] std::span<const std::byte> GetBytes() const noexcept { return m_bytes; }
+            [[nodiscard]] const std::byte* GetData() const noexcept { return m_bytes.data(); }
+            [[nodiscard]] std::size_t GetByteSize() const noexcept { return m_bytes.size(); }
+
+            /**
+             * @return A copy of the data, for consumers which need to take ownership of it
+             */
+            [[nodiscard]] std::vector<std::byte> ToVector() const { return {m_bytes.begin(), m_bytes.end()}; }
+
+        private:
+
+            std::shared_ptr<const void> m_owner;
+            std::span<const std::byte> m_bytes;
+    };
+}
+
+#endif //LIBACCELAPLATFORM_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKAGEDATA_H
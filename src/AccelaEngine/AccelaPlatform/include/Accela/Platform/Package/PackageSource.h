@@ -7,6 +7,8 @@
 #ifndef LIBACCELAPLATFORM_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKAGESOURCE_H
 #define LIBACCELAPLATFORM_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKAGESOURCE_H
 
+#include "PackageData.h"
+
 #include <Accela/Common/SharedLib.h>
 #include <Accela/Common/ImageData.h>
 
@@ -50,15 +52,18 @@ namespace Accela::Platform
             [[nodiscard]] virtual std::expected<std::string, bool> GetModelTextureFormatHint(const std::string& modelResourceName,
                                                                                              const std::string& resourceName) const = 0;
 
-            [[nodiscard]] virtual std::expected<std::vector<std::byte>, unsigned int> GetManifestFileData() const = 0;
-            [[nodiscard]] virtual std::expected<std::vector<std::byte>, unsigned int> GetFontData(const std::string& resourceName) const = 0;
-            [[nodiscard]] virtual std::expected<std::vector<std::byte>, unsigned int> GetAudioData(const std::string& resourceName) const = 0;
+            //
+            // Note that returned PackageData may be a view into memory owned by the package, rather than a copy
+            //
+            [[nodiscard]] virtual std::expected<PackageData, unsigned int> GetManifestFileData() const = 0;
+            [[nodiscard]] virtual std::expected<PackageData, unsigned int> GetFontData(const std::string& resourceName) const = 0;
+            [[nodiscard]] virtual std::expected<PackageData, unsigned int> GetAudioData(const std::string& resourceName) const = 0;
             [[nodiscard]] virtual std::expected<std::string, unsigned int> GetVideoUrl(const std::string& resourceName) const = 0;
-            [[nodiscard]] virtual std::expected<std::vector<std::byte>, unsigned int> GetModelData(const std::string& resourceName) const = 0;
-            [[nodiscard]] virtual std::expected<std::vector<std::byte>, unsigned int> GetTextureData(const std::string& resourceName) const = 0;
-            [[nodiscard]] virtual std::expected<std::vector<std::byte>, unsigned int> GetModelTextureData(const std::string& modelResourceName,
-                                                                                                          const std::string& textureResourceName) const = 0;
-            [[nodiscard]] virtual std::expected<std::vector<std::byte>, unsigned int> GetConstructData(const std::string& constructName) const = 0;
+            [[nodiscard]] virtual std::expected<PackageData, unsigned int> GetModelData(const std::string& resourceName) const = 0;
+            [[nodiscard]] virtual std::expected<PackageData, unsigned int> GetTextureData(const std::string& resourceName) const = 0;
+            [[nodiscard]] virtual std::expected<PackageData, unsigned int> GetModelTextureData(const std::string& modelResourceName,
+                                                                                               const std::string& textureResourceName) const = 0;
+            [[nodiscard]] virtual std::expected<PackageData, unsigned int> GetConstructData(const std::string& constructName) const = 0;
 
         protected:
 
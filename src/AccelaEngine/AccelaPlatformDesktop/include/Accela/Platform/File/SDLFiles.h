@@ -36,7 +36,7 @@ namespace Accela::Platform
             [[nodiscard]] std::string EnsureEndsWithSeparator(const std::string& source) const override;
 
             [[nodiscard]] std::expected<std::vector<std::string>, bool> ListFilesInDirectory(const std::string& directory) const override;
-            [[nodiscard]] std::expected<Common::ImageData::Ptr, bool> LoadTexture(const std::vector<std::byte>& data, const std::optional<std::string>& dataFormatHint) const override;
+            [[nodiscard]] std::expected<Common::ImageData::Ptr, bool> LoadTexture(std::span<const std::byte> data, const std::optional<std::string>& dataFormatHint) const override;
             [[nodiscard]] std::expected<std::vector<unsigned char>, bool> LoadAccelaFile(const std::string& subdir, const std::string& fileName) const override;
 
         private:
@@ -72,15 +72,15 @@ namespace Accela::Platform
             [[nodiscard]] std::expected<std::string, bool> GetModelTextureFormatHint(const std::string& modelResourceName,
                                                                                      const std::string& resourceName) const override;
 
-            [[nodiscard]] std::expected<std::vector<std::byte>, unsigned int> GetManifestFileData() const override;
-            [[nodiscard]] std::expected<std::vector<std::byte>, unsigned int> GetFontData(const std::string& resourceName) const override;
-            [[nodiscard]] std::expected<std::vector<std::byte>, unsigned int> GetAudioData(const std::string& resourceName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetManifestFileData() const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetFontData(const std::string& resourceName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetAudioData(const std::string& resourceName) const override;
             [[nodiscard]] std::expected<std::string, unsigned int> GetVideoUrl(const std::string& resourceName) const override;
-            [[nodiscard]] std::expected<std::vector<std::byte>, unsigned int> GetModelData(const std::string& resourceName) const override;
-            [[nodiscard]] std::expected<std::vector<std::byte>, unsigned int> GetTextureData(const std::string& resourceName) const override;
-            [[nodiscard]] std::expected<std::vector<std::byte>, unsigned int> GetModelTextureData(const std::string& modelResourceName,
-                                                                                                  const std::string& textureResourceName) const override;
-            [[nodiscard]] std::expected<std::vector<std::byte>, unsigned int> GetConstructData(const std::string& constructName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetModelData(const std::string& resourceName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetTextureData(const std::string& resourceName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetModelTextureData(const std::string& modelResourceName,
+                                                                                       const std::string& textureResourceName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetConstructData(const std::string& constructName) const override;
 
             //
             // Internal
@@ -95,7 +95,7 @@ namespace Accela::Platform
             [[nodiscard]] static std::expected<std::vector<std::filesystem::path>, bool> GetFilePaths(const std::filesystem::path& directory);
             [[nodiscard]] static std::expected<std::vector<std::filesystem::path>, bool> GetModelFilePaths(const std::filesystem::path& directory);
             [[nodiscard]] static std::vector<std::string> GetFileNames(const std::vector<std::filesystem::path>& filePaths);
-            [[nodiscard]] static std::expected<std::vector<std::byte>, bool> GetFileBytes(const std::filesystem::path& filePath);
+            [[nodiscard]] static std::expected<PackageData, unsigned int> GetFileBytes(const std::filesystem::path& filePath);
 
         private:
 
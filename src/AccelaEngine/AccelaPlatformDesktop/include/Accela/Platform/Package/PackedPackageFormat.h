@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAPLATFORMDESKTOP_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKEDPACKAGEFORMAT_H
+#define LIBACCELAPLATFORMDESKTOP_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKEDPACKAGEFORMAT_H
+
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Platform
+{
+    //
+    // Packed package file layout:
+    //
+    // [PackedPackageHeader]
+    // [Entry data blobs, each starting at a multiple of PackedPackageHeader::blobAlignment]
+    // [PackedPackageEntry array, sorted by entry path]
+    // [Entry path strings, not null terminated]
+    //
+    // Entry paths are relative to the root of the package directory that was packed, use '/' as
+    // a separator, and are compared bytewise. The package's manifest is stored at PACKED_MANIFEST_PATH, and
+    // a newline separated list of the package's model resource names is stored at PACKED_MODELS_PATH.
+    //
+    // The header and index entries are serialized field by field, in the order they're declared below,
+    // with no padding, and all values little-endian. Entry data is stored uncompressed, so that it can be
+    // handed out as views directly into the mapped file.
+    //
+
+    static constexpr uint32_t PACKED_PACKAGE_MAGIC = 0x4B415041; // "APAK"
+    static constexpr uint32_t PACKED_PACKAGE_VERSION = 1;
+    static constexpr uint32_t PACKED_PACKAGE_BLOB_ALIGNMENT = 64;
+    static constexpr const char* PACKED_MANIFEST_PATH = "manifest";
+    static constexpr const char* PACKED_MODELS_PATH = "models";
+
+    struct PackedPackageHeader
+    {
+        uint32_t magic{PACKED_PACKAGE_MAGIC};
+        uint32_t version{PACKED_PACKAGE_VERSION};
+        uint32_t entryCount{0};
+        uint32_t blobAlignment{PACKED_PACKAGE_BLOB_ALIGNMENT};
+        uint64_t indexOffset{0};
+        uint64_t stringsOffset{0};
+        uint64_t stringsByteSize{0};
+        uint64_t fileByteSize{0};
+    };
+
+    struct PackedPackageEntry
+    {
+        uint64_t pathOffset{0};             // Offset of the entry's path within the strings block
+        uint32_t pathByteSize{0};
+        uint32_t flags{0};                  // Reserved, must be 0
+        uint64_t dataOffset{0};             // Offset of the entry's data from the start of the file
+        uint64_t dataByteSize{0};
+    };
+
+    static constexpr std::size_t PACKED_PACKAGE_HEADER_BYTE_SIZE = 48;
+    static constexpr std::size_t PACKED_PACKAGE_ENTRY_BYTE_SIZE = 32;
+}
+
+#endif //LIBACCELAPLATFORMDESKTOP_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKEDPACKAGEFORMAT_H
@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAPLATFORMDESKTOP_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKEDPACKAGESOURCE_H
+#define LIBACCELAPLATFORMDESKTOP_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKEDPACKAGESOURCE_H
+
+#include "Accela/Platform/Package/PackageSource.h"
+#include "Accela/Platform/Package/PackedPackageFormat.h"
+
+#include <Accela/Common/SharedLib.h>
+
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <memory>
+
+namespace Accela::Platform
+{
+    class MappedFile;
+
+    /**
+     * A package stored as a single packed file on disk (as produced by PackedPackageWriter).
+     *
+     * The file is memory mapped, and data fetched from the package is returned as views directly
+     * into the mapping, rather than being read into separately allocated buffers.
+     */
+    class ACCELA_PUBLIC PackedPackageSource : public PackageSource
+    {
+        public:
+
+            using Ptr = std::shared_ptr<PackedPackageSource>;
+
+            enum class OpenPackageError
+            {
+                PackageFileDoesntExist,
+                FailureMappingFile,
+                PackageFormatInvalid,
+                UnsupportedVersion
+            };
+
+        public:
+
+            /**
+             * Opens a packed package file on disk
+             *
+             * @param packedFile The path to the packed package file
+             * @param looseDirectory Optional package directory that resources which can't be packed (videos,
+             * which are streamed from a URL) are resolved against
+             *
+             * @return A PackageSource object, or OpenPackageError on error
+             */
+            [[nodiscard]] static std::expected<PackageSource::Ptr, OpenPackageError> OpenPacked(
+                const std::filesystem::path& packedFile,
+                const std::optional<std::filesystem::path>& looseDirectory);
+
+        private:
+
+            struct Tag{};
+
+        public:
+
+            PackedPackageSource(Tag,
+                                std::string packageName,
+                                std::shared_ptr<MappedFile> mappedFile,
+                                std::optional<std::filesystem::path> looseDirectory);
+
+            //
+            // Package
+            //
+            [[nodiscard]] std::vector<std::string> GetAudioResourceNames() const override;
+            [[nodiscard]] std::vector<std::string> GetFontResourceNames() const override;
+            [[nodiscard]] std::vector<std::string> GetModelResourceNames() const override;
+            [[nodiscard]] std::vector<std::string> GetTextureResourceNames() const override;
+            [[nodiscard]] std::vector<std::string> GetConstructResourceNames() const override;
+
+            [[nodiscard]] std::expected<std::string, bool> GetTextureFormatHint(const std::string& resourceName) const override;
+            [[nodiscard]] std::expected<std::string, bool> GetModelTextureFormatHint(const std::string& modelResourceName,
+                                                                                     const std::string& resourceName) const override;
+
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetManifestFileData() const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetFontData(const std::string& resourceName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetAudioData(const std::string& resourceName) const override;
+            [[nodiscard]] std::expected<std::string, unsigned int> GetVideoUrl(const std::string& resourceName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetModelData(const std::string& resourceName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetTextureData(const std::string& resourceName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetModelTextureData(const std::string& modelResourceName,
+                                                                                       const std::string& textureResourceName) const override;
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetConstructData(const std::string& constructName) const override;
+
+        private:
+
+            struct Entry
+            {
+                std::string_view path;
+                std::span<const std::byte> data;
+            };
+
+        private:
+
+            [[nodiscard]] std::expected<void, OpenPackageError> LoadIndex();
+
+            [[nodiscard]] std::expected<PackageData, unsigned int> GetEntryData(const std::string& path) const;
+
+            [[nodiscard]] std::vector<std::string> GetEntryNamesInDirectory(const std::string& directory) const;
+
+        private:
+
+            std::shared_ptr<MappedFile> m_mappedFile;
+            std::optional<std::filesystem::path> m_looseDirectory;
+
+            // Sorted by path
+            std::vector<Entry> m_entries;
+
+            std::vector<std::string> m_modelResourceNames;
+    };
+}
+
+#endif //LIBACCELAPLATFORMDESKTOP_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKEDPACKAGESOURCE_H
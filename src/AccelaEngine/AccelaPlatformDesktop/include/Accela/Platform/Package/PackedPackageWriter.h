@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAPLATFORMDESKTOP_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKEDPACKAGEWRITER_H
+#define LIBACCELAPLATFORMDESKTOP_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKEDPACKAGEWRITER_H
+
+#include <Accela/Common/SharedLib.h>
+
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace Accela::Platform
+{
+    /**
+     * Converts a package directory on disk into a single packed package file, which can be opened
+     * with PackedPackageSource.
+     */
+    class ACCELA_PUBLIC PackedPackageWriter
+    {
+        public:
+
+            enum class WriteError
+            {
+                PackageInvalid,
+                FailureReadingPackage,
+                FailureTransformingEntry,
+                FailureWritingFile
+            };
+
+            /**
+             * Optionally transforms an entry's data before it's packed (e.g. to compress textures). Receives
+             * the entry's path and its data, which it can modify in place. Returns false on error.
+             */
+            using EntryTransform = std::function<bool(const std::string& entryPath, std::vector<char>& data)>;
+
+            struct Result
+            {
+                std::size_t entryCount{0};
+                uintmax_t fileByteSize{0};
+            };
+
+        public:
+
+            /**
+             * Packs a package directory into a packed package file.
+             *
+             * All of the package's assets and constructs are packed, except for videos, which are
+             * streamed from a URL and so must remain loose in the package directory.
+             *
+             * @param manifestFile Path to the manifest file of the package to be packed
+             * @param outputFile Path to write the packed package file to
+             * @param entryTransform Optional transform applied to each entry's data before it's packed
+             *
+             * @return Details about the written file, or WriteError on error
+             */
+            [[nodiscard]] static std::expected<Result, WriteError> WritePackedPackage(const std::filesystem::path& manifestFile,
+                                                                                      const std::filesystem::path& outputFile,
+                                                                                      const EntryTransform& entryTransform = {});
+    };
+}
+
+#endif //LIBACCELAPLATFORMDESKTOP_INCLUDE_ACCELA_PLATFORM_PACKAGE_PACKEDPACKAGEWRITER_H
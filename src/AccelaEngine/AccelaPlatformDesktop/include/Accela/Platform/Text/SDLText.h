@@ -30,7 +30,7 @@ namespace Accela::Platform
 
             void Destroy() override;
 
-            bool LoadFontBlocking(const std::string& fontFileName, const std::vector<std::byte>& fontData, uint8_t fontSize) override;
+            bool LoadFontBlocking(const std::string& fontFileName, std::span<const std::byte> fontData, uint8_t fontSize) override;
             bool IsFontLoaded(const std::string& fontFileName, uint8_t fontSize) override;
             void UnloadFont(const std::string& fontFileName) override;
             void UnloadFont(const std::string& fontFileName, uint8_t fontSize) override;
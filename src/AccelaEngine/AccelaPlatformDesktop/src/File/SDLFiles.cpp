@@ -8,12 +8,16 @@
 
 #include <Accela/Platform/File/SDLFiles.h>
 #include <Accela/Platform/Package/DiskPackageSource.h>
+#include <Accela/Platform/Package/PackedPackageSource.h>
+
+#include <Accela/Common/Image/KTX2.h>
 
 #include <SDL2/SDL_filesystem.h>
 #include <SDL2/SDL_image.h>
 
 #include <filesystem>
 #include <fstream>
+#include <optional>
 
 namespace Accela::Platform
 {
@@ -45,9 +49,23 @@ std::expected<std::vector<std::string>, bool> SDLFiles::ListFilesInDirectory(con
 }
 
 std::expected<Common::ImageData::Ptr, bool>
-SDLFiles::LoadTexture(const std::vector<std::byte>& data,
+SDLFiles::LoadTexture(std::span<const std::byte> data,
                       const std::optional<std::string>& dataFormatHint) const
 {
+    // KTX2 textures, which contain pre-baked mips and/or block-compressed data, bypass SDL_image entirely
+    if (Common::KTX2::IsKTX2(data))
+    {
+        auto imageData = Common::KTX2::Parse(data);
+        if (!imageData)
+        {
+            m_logger->Log(Common::LogLevel::Error,
+              "LoadTexture: Failed to parse KTX2 texture data, error code: {}", (unsigned int)imageData.error());
+            return std::unexpected(false);
+        }
+
+        return *imageData;
+    }
+
     auto pRwOps = SDL_RWFromConstMem((void*)data.data(), (int)data.size());
 
     SDL_Surface* pSurface{nullptr};
@@ -81,6 +99,27 @@ SDLFiles::LoadTexture(const std::vector<std::byte>& data,
 
 std::expected<Common::ImageData::Ptr, unsigned int> SDLFiles::LoadTexture(const std::string& filePath) const
 {
+    if (std::filesystem::path(filePath).extension() == ".ktx2")
+    {
+        std::ifstream file(filePath, std::ios::in | std::ios::binary);
+        if (!file.is_open())
+        {
+            m_logger->Log(Common::LogLevel::Error, "LoadAssetTexture: Failed to open KTX2 file: {}", filePath);
+            return std::unexpected(1);
+        }
+
+        const std::vector<char> fileContents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        const auto imageData = Common::KTX2::Parse(std::as_bytes(std::span(fileContents)));
+        if (!imageData)
+        {
+            m_logger->Log(Common::LogLevel::Error, "LoadAssetTexture: Failed to parse KTX2 file: {}", filePath);
+            return std::unexpected(2);
+        }
+
+        return *imageData;
+    }
+
     SDL_Surface *pSurface = IMG_Load(filePath.c_str());
     if (pSurface == nullptr)
     {
@@ -156,9 +195,90 @@ std::string SDLFiles::GetPackageDirectory(const std::string& packageName) const
     return GetAccelaSubdirectory(PACKAGES_DIR) + EnsureEndsWithSeparator(packageName);
 }
 
+/**
+ * @return The most recent write time of any packable file within a package directory, or std::nullopt
+ * if the directory doesn't exist or couldn't be read
+ */
+static std::optional<std::filesystem::file_time_type> GetPackageDirectoryWriteTime(const std::filesystem::path& packageDirectory)
+{
+    // Videos are never packed, so changes to them don't make a packed file stale
+    const auto videosDirectory = packageDirectory / ASSETS_DIR / VIDEO_SUBDIR;
+
+    std::optional<std::filesystem::file_time_type> newestWriteTime;
+
+    std::error_code ec{};
+
+    for (auto it = std::filesystem::recursive_directory_iterator(packageDirectory, ec);
+         it != std::filesystem::recursive_directory_iterator();
+         it.increment(ec))
+    {
+        if (ec) { return std::nullopt; }
+
+        if (it->path() == videosDirectory)
+        {
+            it.disable_recursion_pending();
+            continue;
+        }
+
+        if (!it->is_regular_file(ec) || ec) { continue; }
+
+        const auto writeTime = it->last_write_time(ec);
+        if (ec) { continue; }
+
+        if (!newestWriteTime || writeTime > *newestWriteTime)
+        {
+            newestWriteTime = writeTime;
+        }
+    }
+
+    if (ec) { return std::nullopt; }
+
+    return newestWriteTime;
+}
+
 std::expected<PackageSource::Ptr, bool> SDLFiles::LoadPackage(const std::string& packageName) const
 {
     const auto packageDirectory = std::filesystem::path(GetPackageDirectory(packageName));
+
+    //
+    // If a packed version of the package exists, prefer it over the package's directory, unless the
+    // directory has been modified since the package was packed
+    //
+    const auto packedFile = std::filesystem::path(GetPackagesDirectory()) / std::string(packageName + Platform::PACKED_PACKAGE_EXTENSION);
+
+    std::error_code ec{};
+    bool usePackedFile = std::filesystem::exists(packedFile, ec);
+
+    if (usePackedFile)
+    {
+        const auto packedWriteTime = std::filesystem::last_write_time(packedFile, ec);
+        const auto directoryWriteTime = GetPackageDirectoryWriteTime(packageDirectory);
+
+        if (!ec && directoryWriteTime && *directoryWriteTime > packedWriteTime)
+        {
+            m_logger->Log(Common::LogLevel::Warning,
+              "SDLFiles::LoadPackage: Package directory {} is newer than packed package {}, loading from the directory. "
+              "Re-pack the package to use the packed file.", packageDirectory.string(), packedFile.string());
+            usePackedFile = false;
+        }
+    }
+
+    if (usePackedFile)
+    {
+        m_logger->Log(Common::LogLevel::Info,
+          "SDLFiles::LoadPackage: Loading package {} from packed file {}", packageName, packedFile.string());
+
+        const auto packedPackage = PackedPackageSource::OpenPacked(packedFile, packageDirectory);
+        if (!packedPackage)
+        {
+            m_logger->Log(Common::LogLevel::Error,
+              "SDLFiles::LoadPackage: Failed to load packed package {}, error code: {}", packageName, (int)packedPackage.error());
+            return std::unexpected(false);
+        }
+
+        return *packedPackage;
+    }
+
     const auto packageFile = packageDirectory / std::string(packageName + Platform::PACKAGE_EXTENSION);
 
     const auto package = DiskPackageSource::OpenOnDisk(packageFile);
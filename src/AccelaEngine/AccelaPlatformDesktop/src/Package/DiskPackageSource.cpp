@@ -189,7 +189,7 @@ std::vector<std::string> DiskPackageSource::GetFileNames(const std::vector<std::
     return names;
 }
 
-std::expected<std::vector<std::byte>, bool> DiskPackageSource::GetFileBytes(const std::filesystem::path& filePath)
+std::expected<PackageData, unsigned int> DiskPackageSource::GetFileBytes(const std::filesystem::path& filePath)
 {
     std::error_code ec{};
 
@@ -201,19 +201,19 @@ std::expected<std::vector<std::byte>, bool> DiskPackageSource::GetFileBytes(cons
     const auto fileSize = std::filesystem::file_size(filePath, ec);
     if (ec)
     {
-        return std::unexpected(false);
+        return std::unexpected(0);
     }
 
     std::ifstream file(filePath.c_str(), std::ios::in | std::ios::binary);
     if (!file.is_open())
     {
-        return std::unexpected(false);
+        return std::unexpected(0);
     }
 
     std::vector<std::byte> fileContents(fileSize);
     file.read(reinterpret_cast<char*>(fileContents.data()), (long)fileSize);
 
-    return fileContents;
+    return PackageData(std::move(fileContents));
 }
 
 std::expected<std::string, bool> DiskPackageSource::GetTextureFormatHint(const std::string& resourceName) const
@@ -244,17 +244,17 @@ DiskPackageSource::GetModelTextureFormatHint(const std::string&, const std::stri
     return path.extension().string();
 }
 
-std::expected<std::vector<std::byte>, unsigned int> DiskPackageSource::GetManifestFileData() const
+std::expected<PackageData, unsigned int> DiskPackageSource::GetManifestFileData() const
 {
     return GetFileBytes(m_manifestFilePath);
 }
 
-std::expected<std::vector<std::byte>, unsigned int> DiskPackageSource::GetFontData(const std::string& resourceName) const
+std::expected<PackageData, unsigned int> DiskPackageSource::GetFontData(const std::string& resourceName) const
 {
     return GetFileBytes(m_packageDir / Platform::ASSETS_DIR / Platform::FONTS_SUBDIR / resourceName);
 }
 
-std::expected<std::vector<std::byte>, unsigned int> DiskPackageSource::GetAudioData(const std::string& resourceName) const
+std::expected<PackageData, unsigned int> DiskPackageSource::GetAudioData(const std::string& resourceName) const
 {
     return GetFileBytes(m_packageDir / Platform::ASSETS_DIR / Platform::AUDIO_SUBDIR / resourceName);
 }
@@ -264,19 +264,19 @@ std::expected<std::string, unsigned int> DiskPackageSource::GetVideoUrl(const st
     return std::filesystem::path(m_packageDir / Platform::ASSETS_DIR / Platform::VIDEO_SUBDIR / resourceName).string();
 }
 
-std::expected<std::vector<std::byte>, unsigned int> DiskPackageSource::GetModelData(const std::string& resourceName) const
+std::expected<PackageData, unsigned int> DiskPackageSource::GetModelData(const std::string& resourceName) const
 {
     std::filesystem::path fileNamePath(resourceName);
 
     return GetFileBytes(m_packageDir / Platform::ASSETS_DIR / Platform::MODELS_SUBDIR / fileNamePath.replace_extension() / resourceName);
 }
 
-std::expected<std::vector<std::byte>, unsigned int> DiskPackageSource::GetTextureData(const std::string& resourceName) const
+std::expected<PackageData, unsigned int> DiskPackageSource::GetTextureData(const std::string& resourceName) const
 {
     return GetFileBytes(m_packageDir / Platform::ASSETS_DIR / Platform::TEXTURES_SUBDIR / resourceName);
 }
 
-std::expected<std::vector<std::byte>, unsigned int>
+std::expected<PackageData, unsigned int>
 DiskPackageSource::GetModelTextureData(const std::string& modelResourceName, const std::string& textureResourceName) const
 {
     std::filesystem::path modelFileNamePath(modelResourceName);
@@ -284,7 +284,7 @@ DiskPackageSource::GetModelTextureData(const std::string& modelResourceName, con
     return GetFileBytes(m_packageDir / Platform::ASSETS_DIR / Platform::MODELS_SUBDIR / modelFileNamePath.replace_extension() / textureResourceName);
 }
 
-std::expected<std::vector<std::byte>, unsigned int>
+std::expected<PackageData, unsigned int>
 DiskPackageSource::GetConstructData(const std::string& constructName) const
 {
     return GetFileBytes(m_packageDir / Platform::CONSTRUCTS_DIR / constructName);
@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "MappedFile.h"
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace Accela::Platform
+{
+
+std::expected<MappedFile::Ptr, MappedFile::OpenError> MappedFile::Open(const std::filesystem::path& filePath)
+{
+    std::error_code ec{};
+
+    if (!std::filesystem::exists(filePath, ec) || ec)
+    {
+        return std::unexpected(OpenError::FileDoesntExist);
+    }
+
+    const auto fileSize = std::filesystem::file_size(filePath, ec);
+    if (ec)
+    {
+        return std::unexpected(OpenError::MappingFailed);
+    }
+
+    // Zero-length files can't be mapped
+    if (fileSize == 0)
+    {
+        return std::unexpected(OpenError::FileEmpty);
+    }
+
+    auto mappedFile = std::make_shared<MappedFile>(Tag{});
+
+#ifdef _WIN32
+    const HANDLE hFile = CreateFileW(
+        filePath.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+        nullptr
+    );
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return std::unexpected(OpenError::MappingFailed);
+    }
+    mappedFile->m_hFile = hFile;
+
+    const HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (hMapping == nullptr)
+    {
+        return std::unexpected(OpenError::MappingFailed);
+    }
+    mappedFile->m_hMapping = hMapping;
+
+    const void* pData = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    if (pData == nullptr)
+    {
+        return std::unexpected(OpenError::MappingFailed);
+    }
+#else
+    const int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return std::unexpected(OpenError::MappingFailed);
+    }
+
+    void* pData = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping holds its own reference to the file, so the descriptor isn't needed past this point
+    close(fd);
+
+    if (pData == MAP_FAILED)
+    {
+        return std::unexpected(OpenError::MappingFailed);
+    }
+#endif
+
+    mappedFile->m_pData = static_cast<const std::byte*>(pData);
+    mappedFile->m_byteSize = (std::size_t)fileSize;
+
+    return mappedFile;
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if (m_pData != nullptr) { UnmapViewOfFile(m_pData); }
+    if (m_hMapping != nullptr) { CloseHandle(m_hMapping); }
+    if (m_hFile != nullptr) { CloseHandle(m_hFile); }
+#else
+    if (m_pData != nullptr) { munmap(const_cast<std::byte*>(m_pData), m_byteSize); }
+#endif
+
+    m_pData = nullptr;
+    m_byteSize = 0;
+}
+
+}
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAPLATFORMDESKTOP_SRC_PACKAGE_MAPPEDFILE_H
+#define LIBACCELAPLATFORMDESKTOP_SRC_PACKAGE_MAPPEDFILE_H
+
+#include <filesystem>
+#include <expected>
+#include <memory>
+#include <span>
+#include <cstddef>
+
+namespace Accela::Platform
+{
+    /**
+     * A file which is memory mapped read-only for the lifetime of the object
+     */
+    class MappedFile
+    {
+        public:
+
+            using Ptr = std::shared_ptr<MappedFile>;
+
+            enum class OpenError
+            {
+                FileDoesntExist,
+                FileEmpty,
+                MappingFailed
+            };
+
+        public:
+
+            [[nodiscard]] static std::expected<Ptr, OpenError> Open(const std::filesystem::path& filePath);
+
+        private:
+
+            struct Tag{};
+
+        public:
+
+            explicit MappedFile(Tag) {}
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            [[nodiscard]] std::span<const std::byte> GetBytes() const noexcept { return {m_pData, m_byteSize}; }
+
+        private:
+
+            const std::byte* m_pData{nullptr};
+            std::size_t m_byteSize{0};
+
+            #ifdef _WIN32
+                void* m_hFile{nullptr};
+                void* m_hMapping{nullptr};
+            #endif
+    };
+}
+
+#endif //LIBACCELAPLATFORMDESKTOP_SRC_PACKAGE_MAPPEDFILE_H
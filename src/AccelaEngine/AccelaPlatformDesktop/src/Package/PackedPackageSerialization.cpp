@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "PackedPackageSerialization.h"
+
+#include <cstdint>
+#include <concepts>
+
+namespace Accela::Platform
+{
+
+template <std::unsigned_integral T>
+static void WriteLE(std::byte*& pOut, T value)
+{
+    for (std::size_t x = 0; x < sizeof(T); ++x)
+    {
+        *pOut++ = static_cast<std::byte>((value >> (x * 8)) & 0xFF);
+    }
+}
+
+template <std::unsigned_integral T>
+static T ReadLE(const std::byte*& pIn)
+{
+    T value{0};
+
+    for (std::size_t x = 0; x < sizeof(T); ++x)
+    {
+        value |= static_cast<T>(std::to_integer<T>(*pIn++) << (x * 8));
+    }
+
+    return value;
+}
+
+std::array<std::byte, PACKED_PACKAGE_HEADER_BYTE_SIZE> SerializeHeader(const PackedPackageHeader& header)
+{
+    std::array<std::byte, PACKED_PACKAGE_HEADER_BYTE_SIZE> bytes{};
+    auto* pOut = bytes.data();
+
+    WriteLE(pOut, header.magic);
+    WriteLE(pOut, header.version);
+    WriteLE(pOut, header.entryCount);
+    WriteLE(pOut, header.blobAlignment);
+    WriteLE(pOut, header.indexOffset);
+    WriteLE(pOut, header.stringsOffset);
+    WriteLE(pOut, header.stringsByteSize);
+    WriteLE(pOut, header.fileByteSize);
+
+    return bytes;
+}
+
+PackedPackageHeader DeserializeHeader(std::span<const std::byte, PACKED_PACKAGE_HEADER_BYTE_SIZE> bytes)
+{
+    PackedPackageHeader header{};
+    const auto* pIn = bytes.data();
+
+    header.magic = ReadLE<uint32_t>(pIn);
+    header.version = ReadLE<uint32_t>(pIn);
+    header.entryCount = ReadLE<uint32_t>(pIn);
+    header.blobAlignment = ReadLE<uint32_t>(pIn);
+    header.indexOffset = ReadLE<uint64_t>(pIn);
+    header.stringsOffset = ReadLE<uint64_t>(pIn);
+    header.stringsByteSize = ReadLE<uint64_t>(pIn);
+    header.fileByteSize = ReadLE<uint64_t>(pIn);
+
+    return header;
+}
+
+std::array<std::byte, PACKED_PACKAGE_ENTRY_BYTE_SIZE> SerializeEntry(const PackedPackageEntry& entry)
+{
+    std::array<std::byte, PACKED_PACKAGE_ENTRY_BYTE_SIZE> bytes{};
+    auto* pOut = bytes.data();
+
+    WriteLE(pOut, entry.pathOffset);
+    WriteLE(pOut, entry.pathByteSize);
+    WriteLE(pOut, entry.flags);
+    WriteLE(pOut, entry.dataOffset);
+    WriteLE(pOut, entry.dataByteSize);
+
+    return bytes;
+}
+
+PackedPackageEntry DeserializeEntry(std::span<const std::byte, PACKED_PACKAGE_ENTRY_BYTE_SIZE> bytes)
+{
+    PackedPackageEntry entry{};
+    const auto* pIn = bytes.data();
+
+    entry.pathOffset = ReadLE<uint64_t>(pIn);
+    entry.pathByteSize = ReadLE<uint32_t>(pIn);
+    entry.flags = ReadLE<uint32_t>(pIn);
+    entry.dataOffset = ReadLE<uint64_t>(pIn);
+    entry.dataByteSize = ReadLE<uint64_t>(pIn);
+
+    return entry;
+}
+
+}
@@ -0,0 +1,30 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELAPLATFORMDESKTOP_SRC_PACKAGE_PACKEDPACKAGESERIALIZATION_H
+#define LIBACCELAPLATFORMDESKTOP_SRC_PACKAGE_PACKEDPACKAGESERIALIZATION_H
+
+#include <Accela/Platform/Package/PackedPackageFormat.h>
+
+#include <array>
+#include <span>
+#include <cstddef>
+
+namespace Accela::Platform
+{
+    //
+    // Converts packed package structures to and from their on-disk (little-endian, unpadded)
+    // representation, independent of the host's byte order and struct layout
+    //
+
+    [[nodiscard]] std::array<std::byte, PACKED_PACKAGE_HEADER_BYTE_SIZE> SerializeHeader(const PackedPackageHeader& header);
+    [[nodiscard]] PackedPackageHeader DeserializeHeader(std::span<const std::byte, PACKED_PACKAGE_HEADER_BYTE_SIZE> bytes);
+
+    [[nodiscard]] std::array<std::byte, PACKED_PACKAGE_ENTRY_BYTE_SIZE> SerializeEntry(const PackedPackageEntry& entry);
+    [[nodiscard]] PackedPackageEntry DeserializeEntry(std::span<const std::byte, PACKED_PACKAGE_ENTRY_BYTE_SIZE> bytes);
+}
+
+#endif //LIBACCELAPLATFORMDESKTOP_SRC_PACKAGE_PACKEDPACKAGESERIALIZATION_H
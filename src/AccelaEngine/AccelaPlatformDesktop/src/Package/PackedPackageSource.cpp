@@ -0,0 +1,305 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "MappedFile.h"
+#include "PackedPackageSerialization.h"
+
+#include <Accela/Platform/Package/PackedPackageSource.h>
+
+#include <Accela/Platform/File/IFiles.h>
+
+#include <algorithm>
+#include <ranges>
+
+namespace Accela::Platform
+{
+
+static std::string AssetsPath(const std::string& subdir)
+{
+    return std::string(ASSETS_DIR) + "/" + subdir;
+}
+
+std::expected<PackageSource::Ptr, PackedPackageSource::OpenPackageError> PackedPackageSource::OpenPacked(
+    const std::filesystem::path& packedFile,
+    const std::optional<std::filesystem::path>& looseDirectory)
+{
+    const auto mappedFile = MappedFile::Open(packedFile);
+    if (!mappedFile)
+    {
+        if (mappedFile.error() == MappedFile::OpenError::FileDoesntExist)
+        {
+            return std::unexpected(OpenPackageError::PackageFileDoesntExist);
+        }
+
+        return std::unexpected(OpenPackageError::FailureMappingFile);
+    }
+
+    auto packageSource = std::make_shared<PackedPackageSource>(
+        Tag{},
+        std::filesystem::path(packedFile).filename().replace_extension().string(),
+        *mappedFile,
+        looseDirectory
+    );
+
+    const auto loadResult = packageSource->LoadIndex();
+    if (!loadResult)
+    {
+        return std::unexpected(loadResult.error());
+    }
+
+    return packageSource;
+}
+
+PackedPackageSource::PackedPackageSource(PackedPackageSource::Tag,
+                                         std::string packageName,
+                                         std::shared_ptr<MappedFile> mappedFile,
+                                         std::optional<std::filesystem::path> looseDirectory)
+    : PackageSource(std::move(packageName))
+    , m_mappedFile(std::move(mappedFile))
+    , m_looseDirectory(std::move(looseDirectory))
+{
+
+}
+
+std::expected<void, PackedPackageSource::OpenPackageError> PackedPackageSource::LoadIndex()
+{
+    const auto fileBytes = m_mappedFile->GetBytes();
+
+    //
+    // Validate the header
+    //
+    if (fileBytes.size() < PACKED_PACKAGE_HEADER_BYTE_SIZE)
+    {
+        return std::unexpected(OpenPackageError::PackageFormatInvalid);
+    }
+
+    const auto header = DeserializeHeader(fileBytes.first<PACKED_PACKAGE_HEADER_BYTE_SIZE>());
+
+    if (header.magic != PACKED_PACKAGE_MAGIC)
+    {
+        return std::unexpected(OpenPackageError::PackageFormatInvalid);
+    }
+
+    if (header.version != PACKED_PACKAGE_VERSION)
+    {
+        return std::unexpected(OpenPackageError::UnsupportedVersion);
+    }
+
+    const uint64_t fileByteSize = fileBytes.size();
+
+    const auto rangeValid = [&](uint64_t offset, uint64_t byteSize){
+        return offset <= fileByteSize && byteSize <= fileByteSize - offset;
+    };
+
+    if (header.fileByteSize != fileByteSize ||
+        header.entryCount > fileByteSize / PACKED_PACKAGE_ENTRY_BYTE_SIZE ||
+        !rangeValid(header.indexOffset, (uint64_t)header.entryCount * PACKED_PACKAGE_ENTRY_BYTE_SIZE) ||
+        !rangeValid(header.stringsOffset, header.stringsByteSize))
+    {
+        return std::unexpected(OpenPackageError::PackageFormatInvalid);
+    }
+
+    //
+    // Load and validate the index
+    //
+    const auto* pStrings = reinterpret_cast<const char*>(fileBytes.data() + header.stringsOffset);
+
+    m_entries.clear();
+    m_entries.reserve(header.entryCount);
+
+    for (uint32_t x = 0; x < header.entryCount; ++x)
+    {
+        const auto packedEntry = DeserializeEntry(
+            fileBytes.subspan(header.indexOffset + ((uint64_t)x * PACKED_PACKAGE_ENTRY_BYTE_SIZE)).first<PACKED_PACKAGE_ENTRY_BYTE_SIZE>()
+        );
+
+        if (packedEntry.pathOffset > header.stringsByteSize ||
+            packedEntry.pathByteSize > header.stringsByteSize - packedEntry.pathOffset ||
+            !rangeValid(packedEntry.dataOffset, packedEntry.dataByteSize))
+        {
+            return std::unexpected(OpenPackageError::PackageFormatInvalid);
+        }
+
+        // Entry flags are reserved for future format versions
+        if (packedEntry.flags != 0)
+        {
+            return std::unexpected(OpenPackageError::UnsupportedVersion);
+        }
+
+        m_entries.push_back(Entry{
+            .path = std::string_view(pStrings + packedEntry.pathOffset, packedEntry.pathByteSize),
+            .data = fileBytes.subspan(packedEntry.dataOffset, packedEntry.dataByteSize)
+        });
+    }
+
+    // Lookups binary search the index, so it has to be sorted
+    if (!std::ranges::is_sorted(m_entries, {}, &Entry::path))
+    {
+        return std::unexpected(OpenPackageError::PackageFormatInvalid);
+    }
+
+    //
+    // Load the package's model resource names
+    //
+    const auto modelsData = GetEntryData(PACKED_MODELS_PATH);
+    if (!modelsData)
+    {
+        return std::unexpected(OpenPackageError::PackageFormatInvalid);
+    }
+
+    const auto modelsStr = std::string_view(reinterpret_cast<const char*>(modelsData->GetData()), modelsData->GetByteSize());
+
+    for (const auto modelName : std::views::split(modelsStr, '\n'))
+    {
+        if (!modelName.empty())
+        {
+            m_modelResourceNames.emplace_back(modelName.begin(), modelName.end());
+        }
+    }
+
+    return {};
+}
+
+std::expected<PackageData, unsigned int> PackedPackageSource::GetEntryData(const std::string& path) const
+{
+    const auto it = std::ranges::lower_bound(m_entries, std::string_view(path), {}, &Entry::path);
+    if (it == m_entries.cend() || it->path != path)
+    {
+        return std::unexpected(0);
+    }
+
+    // The returned data keeps the file mapping alive
+    return PackageData(it->data, m_mappedFile);
+}
+
+std::vector<std::string> PackedPackageSource::GetEntryNamesInDirectory(const std::string& directory) const
+{
+    const auto prefix = directory + "/";
+
+    std::vector<std::string> names;
+
+    // Entries are sorted, so all entries within the directory are contiguous, starting at the prefix
+    for (auto it = std::ranges::lower_bound(m_entries, std::string_view(prefix), {}, &Entry::path);
+         it != m_entries.cend() && it->path.starts_with(prefix);
+         ++it)
+    {
+        const auto name = it->path.substr(prefix.size());
+
+        // Skip entries within subdirectories
+        if (name.find('/') != std::string_view::npos) { continue; }
+
+        names.emplace_back(name);
+    }
+
+    return names;
+}
+
+std::vector<std::string> PackedPackageSource::GetAudioResourceNames() const
+{
+    return GetEntryNamesInDirectory(AssetsPath(AUDIO_SUBDIR));
+}
+
+std::vector<std::string> PackedPackageSource::GetFontResourceNames() const
+{
+    return GetEntryNamesInDirectory(AssetsPath(FONTS_SUBDIR));
+}
+
+std::vector<std::string> PackedPackageSource::GetModelResourceNames() const
+{
+    return m_modelResourceNames;
+}
+
+std::vector<std::string> PackedPackageSource::GetTextureResourceNames() const
+{
+    return GetEntryNamesInDirectory(AssetsPath(TEXTURES_SUBDIR));
+}
+
+std::vector<std::string> PackedPackageSource::GetConstructResourceNames() const
+{
+    return GetEntryNamesInDirectory(CONSTRUCTS_DIR);
+}
+
+std::expected<std::string, bool> PackedPackageSource::GetTextureFormatHint(const std::string& resourceName) const
+{
+    const auto path = std::filesystem::path(resourceName);
+    if (!path.has_extension())
+    {
+        return std::unexpected(false);
+    }
+
+    std::string hint = path.extension().string();
+
+    // Remove leading period from the extension name (.jpg - > jpg)
+    hint = hint.substr(1, hint.size() - 1);
+
+    return hint;
+}
+
+std::expected<std::string, bool>
+PackedPackageSource::GetModelTextureFormatHint(const std::string&, const std::string& resourceName) const
+{
+    const auto path = std::filesystem::path(resourceName);
+    if (!path.has_extension())
+    {
+        return std::unexpected(false);
+    }
+
+    return path.extension().string();
+}
+
+std::expected<PackageData, unsigned int> PackedPackageSource::GetManifestFileData() const
+{
+    return GetEntryData(PACKED_MANIFEST_PATH);
+}
+
+std::expected<PackageData, unsigned int> PackedPackageSource::GetFontData(const std::string& resourceName) const
+{
+    return GetEntryData(AssetsPath(FONTS_SUBDIR) + "/" + resourceName);
+}
+
+std::expected<PackageData, unsigned int> PackedPackageSource::GetAudioData(const std::string& resourceName) const
+{
+    return GetEntryData(AssetsPath(AUDIO_SUBDIR) + "/" + resourceName);
+}
+
+std::expected<std::string, unsigned int> PackedPackageSource::GetVideoUrl(const std::string& resourceName) const
+{
+    // Videos are streamed from a URL rather than read from memory, so they aren't packed, and
+    // are instead resolved against the package's loose directory, if it has one
+    if (!m_looseDirectory)
+    {
+        return std::unexpected(0);
+    }
+
+    return std::filesystem::path(*m_looseDirectory / ASSETS_DIR / VIDEO_SUBDIR / resourceName).string();
+}
+
+std::expected<PackageData, unsigned int> PackedPackageSource::GetModelData(const std::string& resourceName) const
+{
+    const auto modelName = std::filesystem::path(resourceName).replace_extension().string();
+
+    return GetEntryData(AssetsPath(MODELS_SUBDIR) + "/" + modelName + "/" + resourceName);
+}
+
+std::expected<PackageData, unsigned int> PackedPackageSource::GetTextureData(const std::string& resourceName) const
+{
+    return GetEntryData(AssetsPath(TEXTURES_SUBDIR) + "/" + resourceName);
+}
+
+std::expected<PackageData, unsigned int>
+PackedPackageSource::GetModelTextureData(const std::string& modelResourceName, const std::string& textureResourceName) const
+{
+    const auto modelName = std::filesystem::path(modelResourceName).replace_extension().string();
+
+    return GetEntryData(AssetsPath(MODELS_SUBDIR) + "/" + modelName + "/" + textureResourceName);
+}
+
+std::expected<PackageData, unsigned int> PackedPackageSource::GetConstructData(const std::string& constructName) const
+{
+    return GetEntryData(std::string(CONSTRUCTS_DIR) + "/" + constructName);
+}
+
+}
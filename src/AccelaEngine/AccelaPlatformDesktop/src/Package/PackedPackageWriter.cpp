@@ -0,0 +1,228 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "PackedPackageSerialization.h"
+
+#include <Accela/Platform/Package/PackedPackageWriter.h>
+#include <Accela/Platform/Package/PackedPackageFormat.h>
+#include <Accela/Platform/Package/DiskPackageSource.h>
+
+#include <Accela/Platform/File/IFiles.h>
+
+#include <fstream>
+#include <vector>
+#include <string>
+#include <optional>
+#include <algorithm>
+
+namespace Accela::Platform
+{
+
+struct SourceFile
+{
+    std::string entryPath;
+
+    // Either the path of the file to pack, or the data to pack
+    std::filesystem::path filePath;
+    std::optional<std::string> data;
+};
+
+static bool GatherFiles(const std::filesystem::path& packageDir,
+                        const std::filesystem::path& directory,
+                        std::vector<SourceFile>& files)
+{
+    std::error_code ec{};
+
+    for (auto it = std::filesystem::recursive_directory_iterator(directory, ec);
+         it != std::filesystem::recursive_directory_iterator();
+         it.increment(ec))
+    {
+        if (ec) { return false; }
+
+        if (!it->is_regular_file(ec) || ec) { continue; }
+
+        const auto relativePath = std::filesystem::relative(it->path(), packageDir, ec);
+        if (ec) { return false; }
+
+        files.push_back({relativePath.generic_string(), it->path(), std::nullopt});
+    }
+
+    return !ec;
+}
+
+static bool WritePadding(std::ofstream& file, uint64_t alignment)
+{
+    const auto position = (uint64_t)file.tellp();
+    const auto remainder = position % alignment;
+
+    if (remainder != 0)
+    {
+        const std::vector<char> padding(alignment - remainder, 0);
+        file.write(padding.data(), (std::streamsize)padding.size());
+    }
+
+    return file.good();
+}
+
+std::expected<PackedPackageWriter::Result, PackedPackageWriter::WriteError> PackedPackageWriter::WritePackedPackage(
+    const std::filesystem::path& manifestFile,
+    const std::filesystem::path& outputFile,
+    const EntryTransform& entryTransform)
+{
+    //
+    // Make sure the package is a valid package before packing it
+    //
+    const auto diskPackage = DiskPackageSource::OpenOnDisk(manifestFile);
+    if (!diskPackage)
+    {
+        return std::unexpected(WriteError::PackageInvalid);
+    }
+
+    const auto packageDir = manifestFile.parent_path();
+
+    //
+    // Gather the files to be packed
+    //
+    std::vector<SourceFile> sourceFiles;
+    sourceFiles.push_back({PACKED_MANIFEST_PATH, manifestFile, std::nullopt});
+
+    // Which file within a model directory is the model file is determined the same way a directory package
+    // determines it, and recorded, so that the packed package reports exactly the same models
+    std::string modelNames;
+    for (const auto& modelName : (*diskPackage)->GetModelResourceNames())
+    {
+        modelNames += modelName + "\n";
+    }
+    sourceFiles.push_back({PACKED_MODELS_PATH, {}, modelNames});
+
+    std::vector<SourceFile> assetFiles;
+    if (!GatherFiles(packageDir, packageDir / ASSETS_DIR, assetFiles) ||
+        !GatherFiles(packageDir, packageDir / CONSTRUCTS_DIR, sourceFiles))
+    {
+        return std::unexpected(WriteError::FailureReadingPackage);
+    }
+
+    // Videos are streamed from their URL, so they're left out of the packed file
+    const auto videosPrefix = std::string(ASSETS_DIR) + "/" + VIDEO_SUBDIR + "/";
+
+    std::ranges::copy_if(assetFiles, std::back_inserter(sourceFiles), [&](const auto& sourceFile){
+        return !sourceFile.entryPath.starts_with(videosPrefix);
+    });
+
+    std::ranges::sort(sourceFiles, {}, &SourceFile::entryPath);
+
+    //
+    // Write the file. Written to a temp file which is renamed into place once complete, so
+    // a partially written package is never left behind.
+    //
+    const auto tempOutputFile = std::filesystem::path(outputFile.string() + ".tmp");
+
+    std::ofstream file(tempOutputFile, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        return std::unexpected(WriteError::FailureWritingFile);
+    }
+
+    const auto failWrite = [&](WriteError error){
+        file.close();
+        std::error_code ec{};
+        std::filesystem::remove(tempOutputFile, ec);
+        return std::unexpected(error);
+    };
+
+    // Placeholder header; rewritten once the offsets are known
+    PackedPackageHeader header{};
+
+    const auto writeHeader = [&](){
+        const auto headerBytes = SerializeHeader(header);
+        file.write(reinterpret_cast<const char*>(headerBytes.data()), (std::streamsize)headerBytes.size());
+    };
+
+    writeHeader();
+
+    std::vector<PackedPackageEntry> entries;
+    std::string strings;
+
+    std::vector<char> fileContents;
+
+    for (const auto& sourceFile : sourceFiles)
+    {
+        if (!WritePadding(file, PACKED_PACKAGE_BLOB_ALIGNMENT)) { return failWrite(WriteError::FailureWritingFile); }
+
+        if (sourceFile.data)
+        {
+            fileContents.assign(sourceFile.data->cbegin(), sourceFile.data->cend());
+        }
+        else
+        {
+            std::error_code ec{};
+            const auto sourceFileSize = std::filesystem::file_size(sourceFile.filePath, ec);
+            if (ec) { return failWrite(WriteError::FailureReadingPackage); }
+
+            std::ifstream sourceStream(sourceFile.filePath, std::ios::in | std::ios::binary);
+            if (!sourceStream.is_open()) { return failWrite(WriteError::FailureReadingPackage); }
+
+            fileContents.resize(sourceFileSize);
+            if (!sourceStream.read(fileContents.data(), (std::streamsize)sourceFileSize)) { return failWrite(WriteError::FailureReadingPackage); }
+        }
+
+        if (entryTransform && !entryTransform(sourceFile.entryPath, fileContents))
+        {
+            return failWrite(WriteError::FailureTransformingEntry);
+        }
+
+        const uint64_t fileSize = fileContents.size();
+
+        PackedPackageEntry entry{};
+        entry.pathOffset = strings.size();
+        entry.pathByteSize = (uint32_t)sourceFile.entryPath.size();
+        entry.dataOffset = (uint64_t)file.tellp();
+        entry.dataByteSize = fileSize;
+
+        file.write(fileContents.data(), (std::streamsize)fileSize);
+        if (!file.good()) { return failWrite(WriteError::FailureWritingFile); }
+
+        strings += sourceFile.entryPath;
+        entries.push_back(entry);
+    }
+
+    //
+    // Write the index and path strings
+    //
+    if (!WritePadding(file, alignof(uint64_t))) { return failWrite(WriteError::FailureWritingFile); }
+
+    header.entryCount = (uint32_t)entries.size();
+    header.indexOffset = (uint64_t)file.tellp();
+
+    for (const auto& entry : entries)
+    {
+        const auto entryBytes = SerializeEntry(entry);
+        file.write(reinterpret_cast<const char*>(entryBytes.data()), (std::streamsize)entryBytes.size());
+    }
+
+    header.stringsOffset = (uint64_t)file.tellp();
+    header.stringsByteSize = strings.size();
+    file.write(strings.data(), (std::streamsize)strings.size());
+
+    header.fileByteSize = (uint64_t)file.tellp();
+
+    file.seekp(0);
+    writeHeader();
+
+    file.close();
+    if (!file) { return failWrite(WriteError::FailureWritingFile); }
+
+    std::error_code ec{};
+    std::filesystem::rename(tempOutputFile, outputFile, ec);
+    if (ec) { return failWrite(WriteError::FailureWritingFile); }
+
+    return Result{
+        .entryCount = entries.size(),
+        .fileByteSize = header.fileByteSize
+    };
+}
+
+}
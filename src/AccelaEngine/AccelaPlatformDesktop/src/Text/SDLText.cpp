@@ -31,7 +31,7 @@ void SDLText::Destroy()
     }
 }
 
-bool SDLText::LoadFontBlocking(const std::string& fontFileName, const std::vector<std::byte>& fontData, uint8_t fontSize)
+bool SDLText::LoadFontBlocking(const std::string& fontFileName, std::span<const std::byte> fontData, uint8_t fontSize)
 {
     if (IsFontLoaded(fontFileName, fontSize))
     {
@@ -42,7 +42,7 @@ bool SDLText::LoadFontBlocking(const std::string& fontFileName, const std::vecto
     m_logger->Log(Common::LogLevel::Info, "LoadFont: Loading font: {}x{}", fontFileName, fontSize);
 
     auto loadedFont = std::make_shared<LoadedFont>();
-    loadedFont->fontData = fontData;
+    loadedFont->fontData.assign(fontData.begin(), fontData.end());
 
     // Needed to make a persistent heap copy of font data in memory for this RWops, as the font data needs to stay
     // alive until the TTF_Font that's created is closed
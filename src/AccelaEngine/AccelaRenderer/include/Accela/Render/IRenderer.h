@@ -18,6 +18,7 @@
 #include "Task/WorldUpdate.h"
 #include "Mesh/Mesh.h"
 #include "Material/Material.h"
+#include "Util/Rect.h"
 
 #include <Accela/Common/SharedLib.h>
 #include <Accela/Common/ImageData.h>
@@ -62,7 +63,6 @@ namespace Accela::Render
 
             // Synchronous
             [[nodiscard]] virtual Ids::Ptr GetIds() const = 0;
-            [[nodiscard]] virtual std::optional<ObjectId> GetTopObjectAtRenderPoint(const glm::vec2& renderPoint) const = 0;
 
             // Asynchronous
             virtual std::future<bool> CreateTexture(const Texture& texture,
@@ -81,6 +81,36 @@ namespace Accela::Render
             virtual std::future<bool> RenderFrame(const RenderGraph::Ptr& renderGraph) = 0;
             virtual std::future<bool> SurfaceChanged() = 0;
             virtual std::future<bool> ChangeRenderSettings(const RenderSettings& renderSettings) = 0;
+
+            // Asynchronous picking
+
+            /**
+             * Reads back which objects were rendered within a region of the most recently presented frame. Only
+             * the requested region of the object detail render output is copied back from the GPU. The copy is
+             * queued behind the frames already in flight, and doesn't wait for another frame to be rendered, so
+             * the result is available at most framesInFlight frames later.
+             *
+             * @param renderRect The region to be picked, in render resolution space. A 1x1 rect picks a single point.
+             *
+             * @return The ids of the objects visible within the region, ordered by how many of the
+             * region's pixels they cover, most first
+             */
+            virtual std::future<std::vector<ObjectId>> PickObjectsInRenderRect(const URect& renderRect) = 0;
+
+            /**
+             * Finds the objects which a world-space ray segment passes through, by testing the ray against
+             * the renderer's object bounds hierarchy on the CPU. Requires no GPU readback, but only tests
+             * against object bounding boxes, not their exact geometry.
+             *
+             * @param sceneName The scene to pick objects from
+             * @param rayStart_worldSpace The start point of the ray
+             * @param rayEnd_worldSpace The end point of the ray
+             *
+             * @return The ids of the objects the ray passes through, ordered nearest first
+             */
+            virtual std::future<std::vector<ObjectId>> PickObjectsAlongRay(const std::string& sceneName,
+                                                                           const glm::vec3& rayStart_worldSpace,
+                                                                           const glm::vec3& rayEnd_worldSpace) = 0;
     };
 }
 
@@ -7,6 +7,8 @@
 #ifndef LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_MESH_MESH_H
 #define LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_MESH_MESH_H
 
+#include "MeshLOD.h"
+
 #include "../Id.h"
 
 #include <Accela/Common/SharedLib.h>
@@ -49,6 +51,10 @@ namespace Accela::Render
         MeshType type;
         MeshId id;
         std::string tag;
+
+        // Optional LOD chain, ordered from highest to lowest detail. Each LOD is a range of the mesh's
+        // indices. If empty, the mesh's full index range is its only LOD.
+        std::vector<MeshLOD> lods;
     };
 }
 
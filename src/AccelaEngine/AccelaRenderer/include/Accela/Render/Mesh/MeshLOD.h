@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_MESH_MESHLOD_H
+#define LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_MESH_MESHLOD_H
+
+#include <Accela/Common/SharedLib.h>
+
+#include <span>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Render
+{
+    /** Maximum number of LODs (including the full detail LOD 0) a mesh can have */
+    static constexpr std::size_t MAX_MESH_LODS = 8;
+
+    /**
+     * A level of detail of a mesh. All of a mesh's LODs share the mesh's vertices, and each LOD is
+     * a range of the mesh's indices.
+     */
+    struct ACCELA_PUBLIC MeshLOD
+    {
+        uint32_t firstIndex{0};     // Offset into the mesh's indices where the LOD's indices start
+        uint32_t indexCount{0};     // Number of indices in the LOD
+        float error{0.0f};          // Geometric error of the LOD, relative to the bounding radius of the mesh
+    };
+
+    /**
+     * Selects which LOD to render a mesh with.
+     *
+     * Picks the lowest detail LOD whose projected error is within maxPixelError. When a previously selected
+     * LOD is provided, it's kept until its error moves past maxPixelError by more than the hysteresis margin
+     * (or a lower detail LOD is within maxPixelError by more than the margin), so that objects near a LOD
+     * transition distance don't flicker between LODs.
+     *
+     * @param lods The mesh's LODs, ordered from highest to lowest detail, with increasing errors
+     * @param pixelsPerError Screen-space size, in pixels, of an error of 1.0 (the mesh's bounding radius)
+     * @param maxPixelError Maximum screen-space error, in pixels, the selected LOD may have
+     * @param hysteresis Fractional margin around maxPixelError required to switch away from previousLOD
+     * @param previousLOD The LOD previously selected for the mesh, if any
+     *
+     * @return The index of the selected LOD
+     */
+    [[nodiscard]] ACCELA_PUBLIC uint8_t SelectMeshLOD(std::span<const MeshLOD> lods,
+                                                      float pixelsPerError,
+                                                      float maxPixelError,
+                                                      float hysteresis,
+                                                      std::optional<uint8_t> previousLOD);
+}
+
+#endif //LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_MESH_MESHLOD_H
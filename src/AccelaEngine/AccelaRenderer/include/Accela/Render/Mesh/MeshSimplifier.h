@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_MESH_MESHSIMPLIFIER_H
+#define LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_MESH_MESHSIMPLIFIER_H
+
+#include "Mesh.h"
+
+#include <Accela/Common/SharedLib.h>
+
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Render
+{
+    /**
+     * Parameters which control LOD chain generation
+     */
+    struct ACCELA_PUBLIC MeshLODParams
+    {
+        // Max number of LODs to generate, including LOD 0. Capped at MAX_MESH_LODS.
+        std::size_t maxLODs{4};
+
+        // Target ratio of each LOD's triangle count to the previous LOD's triangle count
+        float reductionRatio{0.5f};
+
+        // Generation stops when a LOD can't be reduced to below this ratio of the previous LOD's triangle count
+        float minReductionRatio{0.85f};
+
+        // Generation stops once a LOD has fewer than this many triangles
+        std::size_t minTriangleCount{64};
+    };
+
+    /**
+     * CPU mesh simplifier, based on quadric error metrics.
+     *
+     * Simplifies meshes by iteratively collapsing edges onto one of their existing vertices, cheapest
+     * (as measured by each vertex's accumulated plane quadric) first. As vertices are never moved or created,
+     * a simplified mesh is just a new index list over its source mesh's vertices, which allows all of a
+     * mesh's LODs to share one vertex buffer.
+     *
+     * Open mesh borders are only ever collapsed along themselves, and vertices on attribute seams (distinct
+     * vertices which share a position, such as at UV seams or hard normal edges) are never collapsed, so
+     * simplification doesn't tear meshes apart. Collapses which would flip a triangle are rejected.
+     */
+    class ACCELA_PUBLIC MeshSimplifier
+    {
+        public:
+
+            struct Result
+            {
+                std::vector<uint32_t> indices;  // Index list of the simplified mesh
+                float error{0.0f};              // Approximate geometric error (distance) of the simplified mesh
+            };
+
+        public:
+
+            /**
+             * Simplifies a triangle list mesh.
+             *
+             * @param positions The mesh's vertex positions
+             * @param indices The mesh's triangle list indices
+             * @param targetIndexCount Index count to reduce the mesh to. The result may have more indices
+             * if the mesh can't be simplified that far.
+             *
+             * @return The simplified mesh
+             */
+            [[nodiscard]] static Result Simplify(std::span<const glm::vec3> positions,
+                                                 std::span<const uint32_t> indices,
+                                                 std::size_t targetIndexCount);
+
+            /**
+             * Generates a LOD chain for a StaticMesh or BoneMesh. Each LOD's indices are appended to the
+             * mesh's indices and the mesh's lods are filled in, with LOD 0 being the mesh's original indices.
+             * Each LOD is simplified from the previous one.
+             *
+             * Does nothing for meshes which already have LODs.
+             *
+             * @return Whether any LODs, beyond LOD 0, were generated
+             */
+            static bool GenerateLODs(Mesh& mesh, const MeshLODParams& params = {});
+    };
+}
+
+#endif //LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_MESH_MESHSIMPLIFIER_H
@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_NULLRENDERER_H
+#define LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_NULLRENDERER_H
+
+#include "RendererBase.h"
+
+#include <Accela/Common/SharedLib.h>
+#include <Accela/Common/Log/ILogger.h>
+#include <Accela/Common/Metrics/IMetrics.h>
+
+#include <unordered_set>
+
+namespace Accela::Render
+{
+    /**
+     * Headless IRenderer implementation which requires no GPU.
+     *
+     * Runs the same render thread and task dispatch machinery as any other RendererBase subclass, and
+     * fulfills every future in the asynchronous API, but doesn't perform any actual rendering work. It
+     * tracks which resources and renderables exist so that it reports the same success/failure results
+     * a real renderer would (e.g. updating a texture which doesn't exist fails).
+     *
+     * Intended for benchmarking and testing engine logic on machines without a GPU.
+     */
+    class ACCELA_PUBLIC NullRenderer : public RendererBase
+    {
+        public:
+
+            NullRenderer(Common::ILogger::Ptr logger, Common::IMetrics::Ptr metrics);
+
+        protected:
+
+            void OnIdle() override;
+
+            bool OnInitialize(const RenderInit& renderInit, const RenderSettings& renderSettings) override;
+            bool OnShutdown() override;
+            bool OnRenderFrame(RenderGraph::Ptr renderGraph) override;
+            void OnCreateTexture(std::promise<bool> resultPromise,
+                                 const Texture& texture,
+                                 const TextureView& textureView,
+                                 const TextureSampler& textureSampler) override;
+            void OnUpdateTexture(std::promise<bool> resultPromise,
+                                 const TextureId& textureId,
+                                 const Common::ImageData::Ptr& imageData) override;
+            bool OnDestroyTexture(TextureId textureId) override;
+            bool OnCreateMesh(std::promise<bool> resultPromise,
+                              const Mesh::Ptr& mesh,
+                              MeshUsage meshUsage) override;
+            bool OnDestroyMesh(MeshId meshId) override;
+            bool OnCreateMaterial(std::promise<bool> resultPromise,
+                                  const Material::Ptr& material) override;
+            bool OnDestroyMaterial(MaterialId materialId) override;
+            bool OnCreateRenderTarget(RenderTargetId renderTargetId, const std::string& tag) override;
+            bool OnDestroyRenderTarget(RenderTargetId renderTargetId) override;
+            bool OnWorldUpdate(const WorldUpdate& update) override;
+            bool OnSurfaceChanged() override;
+            bool OnChangeRenderSettings(const RenderSettings& renderSettings) override;
+            void OnPickRenderRect(std::promise<std::vector<ObjectId>> resultPromise,
+                                  const URect& renderRect) override;
+            std::vector<ObjectId> OnPickRay(const std::string& sceneName,
+                                            const glm::vec3& rayStart_worldSpace,
+                                            const glm::vec3& rayEnd_worldSpace) override;
+
+        private:
+
+            void SyncMetrics();
+
+        private:
+
+            std::unordered_set<TextureId> m_textures;
+            std::unordered_set<MeshId> m_meshes;
+            std::unordered_set<MaterialId> m_materials;
+            std::unordered_set<RenderTargetId> m_renderTargets;
+
+            std::unordered_set<SpriteId> m_sprites;
+            std::unordered_set<ObjectId> m_objects;
+            std::unordered_set<TerrainId> m_terrains;
+            std::unordered_set<LightId> m_lights;
+
+            uintmax_t m_frameCount{0};
+    };
+}
+
+#endif //LIBACCELARENDERER_INCLUDE_ACCELA_RENDER_NULLRENDERER_H
@@ -10,6 +10,8 @@
 #include "Shader/ShaderSpec.h"
 
 #include <vector>
+#include <string>
+#include <optional>
 
 namespace Accela::Render
 {
@@ -29,6 +31,10 @@ namespace Accela::Render
     {
         OutputMode outputMode{OutputMode::Display};
         std::vector<ShaderSpec> shaders;
+
+        // File that compiled pipeline data is persisted to, so that pipelines don't need to be fully
+        // recompiled on subsequent runs. No pipeline data is persisted if not provided.
+        std::optional<std::string> pipelineCacheFilePath;
     };
 }
 
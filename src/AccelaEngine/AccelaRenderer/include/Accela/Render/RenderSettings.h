@@ -94,6 +94,15 @@ namespace Accela::Render
         // as the objects themselves are rendered
         std::optional<float> shadowRenderDistance;
 
+        // Whether shadow casting lights keep a cached copy of their shadow map containing only static (never
+        // moved) objects. When only moving objects affect a light's shadow map, the cached copy is restored and
+        // just the moving objects are re-rendered on top of it, rather than re-rendering every object.
+        //
+        // Off by default, as it doubles shadow map memory: every shadow casting light holds a second shadow map.
+        // At high shadow quality that's an extra 4096x4096 depth image per cascade, or six of them (~384MB with
+        // a 32-bit depth format) per point light.
+        bool shadowCaching{false};
+
         //
         // Textures
         //
@@ -114,6 +123,18 @@ namespace Accela::Render
         // Whether to render objects in wireframe
         bool objectsWireframe{false};
 
+        // Max screen-space error, in pixels, that an object's mesh LOD may introduce. Objects whose meshes have
+        // LODs are rendered with the lowest detail LOD within this error. 0 always renders full detail meshes.
+        float objectLODMaxPixelError{1.0f};
+
+        // Fractional margin around objectLODMaxPixelError that an object's LOD error must move past before the
+        // object switches LOD, which prevents objects near a LOD transition from flickering between LODs
+        float objectLODHysteresis{0.25f};
+
+        // Whether to cull objects which are hidden behind occluder objects (see ObjectRenderable::occluder), by
+        // rasterizing the occluders into a low resolution depth buffer on the CPU
+        bool objectOcclusionCulling{true};
+
         //
         // Lighting
         //
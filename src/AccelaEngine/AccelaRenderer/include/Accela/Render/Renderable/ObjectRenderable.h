@@ -30,6 +30,9 @@ namespace Accela::Render
         MaterialId materialId{INVALID_ID};
         glm::mat4 modelTransform{1.0f};
         bool shadowPass{true};
+        // Whether the object hides objects behind it during CPU occlusion culling. Intended for large,
+        // opaque, objects such as buildings and walls; only applies to objects with static meshes.
+        bool occluder{false};
         std::optional<std::vector<glm::mat4>> boneTransforms;
     };
 }
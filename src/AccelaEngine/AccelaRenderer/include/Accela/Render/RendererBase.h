@@ -58,6 +58,10 @@ namespace Accela::Render
             std::future<bool> RenderFrame(const RenderGraph::Ptr& renderGraph) override;
             std::future<bool> SurfaceChanged() override;
             std::future<bool> ChangeRenderSettings(const RenderSettings& renderSettings) override;
+            std::future<std::vector<ObjectId>> PickObjectsInRenderRect(const URect& renderRect) override;
+            std::future<std::vector<ObjectId>> PickObjectsAlongRay(const std::string& sceneName,
+                                                                   const glm::vec3& rayStart_worldSpace,
+                                                                   const glm::vec3& rayEnd_worldSpace) override;
 
         protected:
 
@@ -86,6 +90,11 @@ namespace Accela::Render
             virtual bool OnWorldUpdate(const WorldUpdate& update) = 0;
             virtual bool OnSurfaceChanged() = 0;
             virtual bool OnChangeRenderSettings(const RenderSettings& renderSettings) = 0;
+            virtual void OnPickRenderRect(std::promise<std::vector<ObjectId>> resultPromise,
+                                          const URect& renderRect) = 0;
+            virtual std::vector<ObjectId> OnPickRay(const std::string& sceneName,
+                                                    const glm::vec3& rayStart_worldSpace,
+                                                    const glm::vec3& rayEnd_worldSpace) = 0;
 
         private:
 
@@ -30,7 +30,9 @@ namespace Accela::Render
         DestroyRenderTarget,    // Destroy a render target
         WorldUpdate,            // Update the state of the world
         SurfaceChanged,         // Handle window/surface change
-        ChangeRenderSettings    // Apply new render settings
+        ChangeRenderSettings,   // Apply new render settings
+        PickRenderRect,         // Read back the objects rendered within a region of the screen
+        PickRay                 // Find the objects along a world-space ray
     };
 
     /**
@@ -22,7 +22,11 @@ namespace Accela::Render
 {
     enum class Format
     {
-        RGBA32
+        RGBA32,
+        BC1,
+        BC3,
+        BC5,
+        BC7
     };
 
     /**
@@ -43,6 +47,18 @@ namespace Accela::Render
                 case Common::ImageData::PixelFormat::RGBA32:
                     imageFormat = Format::RGBA32;
                 break;
+                case Common::ImageData::PixelFormat::BC1:
+                    imageFormat = Format::BC1;
+                break;
+                case Common::ImageData::PixelFormat::BC3:
+                    imageFormat = Format::BC3;
+                break;
+                case Common::ImageData::PixelFormat::BC5:
+                    imageFormat = Format::BC5;
+                break;
+                case Common::ImageData::PixelFormat::BC7:
+                    imageFormat = Format::BC7;
+                break;
                 default: return std::nullopt;
             }
 
@@ -54,15 +70,31 @@ namespace Accela::Render
             texture.cubicTexture = cubicTexture;
             texture.data = data;
             texture.tag = tag;
+
+            // Use any mip levels which were baked into the data
+            if (data->GetNumMipLevels() > 1)
+            {
+                texture.numMipLevels = data->GetNumMipLevels();
+            }
+
             return texture;
         }
 
         /**
          * Automatically sets numMipLevels to "full" mip levels - the number of times the size
-         * of the texture can be cut in half
+         * of the texture can be cut in half.
+         *
+         * If the texture's data has pre-baked mip levels, or is block-compressed (and so can't have
+         * mip levels generated for it), numMipLevels is instead set to the number of mip levels in the data.
          */
         void SetFullMipLevels()
         {
+            if (data && (data->GetNumMipLevels() > 1 || data->IsBlockCompressed()))
+            {
+                numMipLevels = data->GetNumMipLevels();
+                return;
+            }
+
             numMipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(pixelSize.w, pixelSize.h)))) + 1;
         }
 
@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Render/Mesh/MeshLOD.h>
+
+#include <algorithm>
+
+namespace Accela::Render
+{
+
+uint8_t SelectMeshLOD(std::span<const MeshLOD> lods,
+                      float pixelsPerError,
+                      float maxPixelError,
+                      float hysteresis,
+                      std::optional<uint8_t> previousLOD)
+{
+    const auto numLODs = std::min(lods.size(), MAX_MESH_LODS);
+    if (numLODs <= 1) { return 0; }
+
+    // Returns the lowest detail LOD whose projected error is within the provided max error
+    const auto selectLOD = [&](float maxError){
+        uint8_t lod = 0;
+
+        for (std::size_t x = 1; x < numLODs; ++x)
+        {
+            if (lods[x].error * pixelsPerError > maxError) { break; }
+            lod = static_cast<uint8_t>(x);
+        }
+
+        return lod;
+    };
+
+    if (!previousLOD || *previousLOD >= numLODs)
+    {
+        return selectLOD(maxPixelError);
+    }
+
+    // Switch to higher detail once the previous LOD's error is clearly too large
+    if (lods[*previousLOD].error * pixelsPerError > maxPixelError * (1.0f + hysteresis))
+    {
+        return selectLOD(maxPixelError);
+    }
+
+    // Switch to lower detail once a lower detail LOD's error is clearly small enough
+    const auto lowerDetailLOD = selectLOD(maxPixelError * (1.0f - hysteresis));
+    if (lowerDetailLOD > *previousLOD)
+    {
+        return lowerDetailLOD;
+    }
+
+    return *previousLOD;
+}
+
+}
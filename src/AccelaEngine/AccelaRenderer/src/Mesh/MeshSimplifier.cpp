@@ -0,0 +1,550 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Render/Mesh/MeshSimplifier.h>
+#include <Accela/Render/Mesh/StaticMesh.h>
+#include <Accela/Render/Mesh/BoneMesh.h>
+
+#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+
+namespace Accela::Render
+{
+
+// Weight of the quadrics which hold open borders in place, relative to the quadrics of triangle planes
+static constexpr double BORDER_QUADRIC_WEIGHT = 10.0;
+
+// Minimum cosine of the angle between a triangle's normal before and after a collapse. Collapses which
+// rotate a triangle further than this are considered to flip (or badly fold) it, and are rejected.
+static constexpr float MIN_COLLAPSE_NORMAL_COS = 0.2f;
+
+/**
+ * Plane quadric; the symmetric 4x4 matrix of the sum of squared distances to a set of planes,
+ * along with the total weight of the planes
+ */
+struct Quadric
+{
+    double a2{0}, ab{0}, ac{0}, ad{0};
+    double b2{0}, bc{0}, bd{0};
+    double c2{0}, cd{0};
+    double d2{0};
+    double weight{0};
+
+    Quadric& operator+=(const Quadric& o)
+    {
+        a2 += o.a2; ab += o.ab; ac += o.ac; ad += o.ad;
+        b2 += o.b2; bc += o.bc; bd += o.bd;
+        c2 += o.c2; cd += o.cd;
+        d2 += o.d2;
+        weight += o.weight;
+        return *this;
+    }
+
+    Quadric operator+(const Quadric& o) const
+    {
+        Quadric result = *this;
+        result += o;
+        return result;
+    }
+};
+
+enum class VertexKind : uint8_t
+{
+    Manifold,   // Interior vertex; can be collapsed onto any neighbour
+    Border,     // Vertex on an open border; can only be collapsed along the border
+    Locked      // Vertex on an attribute seam or non-manifold edge; never collapsed
+};
+
+struct Collapse
+{
+    uint32_t fromVertex;
+    uint32_t toVertex;
+    float cost;
+};
+
+[[nodiscard]] static Quadric PlaneQuadric(const glm::vec3& normal, const glm::vec3& pointOnPlane, double weight)
+{
+    const double a = normal.x;
+    const double b = normal.y;
+    const double c = normal.z;
+    const double d = -(a * pointOnPlane.x + b * pointOnPlane.y + c * pointOnPlane.z);
+
+    Quadric q{};
+    q.a2 = a * a * weight; q.ab = a * b * weight; q.ac = a * c * weight; q.ad = a * d * weight;
+    q.b2 = b * b * weight; q.bc = b * c * weight; q.bd = b * d * weight;
+    q.c2 = c * c * weight; q.cd = c * d * weight;
+    q.d2 = d * d * weight;
+    q.weight = weight;
+    return q;
+}
+
+/**
+ * @return The weighted mean squared distance from the point to the quadric's planes
+ */
+[[nodiscard]] static float QuadricError(const Quadric& q, const glm::vec3& p)
+{
+    if (q.weight <= 0.0) { return 0.0f; }
+
+    const double x = p.x;
+    const double y = p.y;
+    const double z = p.z;
+
+    const double error =
+        q.a2 * x * x + 2.0 * q.ab * x * y + 2.0 * q.ac * x * z + 2.0 * q.ad * x +
+        q.b2 * y * y + 2.0 * q.bc * y * z + 2.0 * q.bd * y +
+        q.c2 * z * z + 2.0 * q.cd * z +
+        q.d2;
+
+    return static_cast<float>(std::max(error, 0.0) / q.weight);
+}
+
+[[nodiscard]] static uint64_t EdgeKey(uint32_t a, uint32_t b)
+{
+    return (static_cast<uint64_t>(std::min(a, b)) << 32U) | static_cast<uint64_t>(std::max(a, b));
+}
+
+/**
+ * @return For each vertex, the index of the first vertex which shares its exact position
+ */
+[[nodiscard]] static std::vector<uint32_t> BuildPositionRemap(std::span<const glm::vec3> positions)
+{
+    using PositionKey = std::array<uint32_t, 3>;
+
+    struct PositionKeyHash
+    {
+        std::size_t operator()(const PositionKey& key) const noexcept
+        {
+            return (key[0] * 73856093U) ^ (key[1] * 19349663U) ^ (key[2] * 83492791U);
+        }
+    };
+
+    std::unordered_map<PositionKey, uint32_t, PositionKeyHash> positionVertices;
+    positionVertices.reserve(positions.size());
+
+    std::vector<uint32_t> remap(positions.size());
+
+    for (uint32_t x = 0; x < positions.size(); ++x)
+    {
+        const PositionKey key{
+            std::bit_cast<uint32_t>(positions[x].x),
+            std::bit_cast<uint32_t>(positions[x].y),
+            std::bit_cast<uint32_t>(positions[x].z)
+        };
+
+        remap[x] = positionVertices.emplace(key, x).first->second;
+    }
+
+    return remap;
+}
+
+/**
+ * @return Whether moving vertex from's position to vertex to's position flips any of the provided triangles
+ * which contain from but not to
+ */
+[[nodiscard]] static bool CollapseFlipsTriangles(std::span<const glm::vec3> positions,
+                                                 std::span<const uint32_t> positionRemap,
+                                                 std::span<const uint32_t> indices,
+                                                 std::span<const uint32_t> fromTriangles,
+                                                 uint32_t fromVertex,
+                                                 uint32_t toVertex)
+{
+    const auto& toPosition = positions[toVertex];
+
+    for (const auto triangle : fromTriangles)
+    {
+        const auto* pTriangle = &indices[triangle * 3];
+
+        // Triangles which contain both vertices are removed by the collapse
+        if (positionRemap[pTriangle[0]] == positionRemap[toVertex] ||
+            positionRemap[pTriangle[1]] == positionRemap[toVertex] ||
+            positionRemap[pTriangle[2]] == positionRemap[toVertex])
+        {
+            continue;
+        }
+
+        std::array<glm::vec3, 3> before{positions[pTriangle[0]], positions[pTriangle[1]], positions[pTriangle[2]]};
+        std::array<glm::vec3, 3> after = before;
+
+        for (unsigned int v = 0; v < 3; ++v)
+        {
+            if (pTriangle[v] == fromVertex) { after[v] = toPosition; }
+        }
+
+        const auto normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+        const auto normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+
+        const float lengths = glm::length(normalBefore) * glm::length(normalAfter);
+
+        if (glm::dot(normalBefore, normalAfter) <= MIN_COLLAPSE_NORMAL_COS * lengths)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+MeshSimplifier::Result MeshSimplifier::Simplify(std::span<const glm::vec3> positions,
+                                                std::span<const uint32_t> indices,
+                                                std::size_t targetIndexCount)
+{
+    Result result{};
+    result.indices.assign(indices.begin(), indices.end());
+
+    if (indices.size() % 3 != 0) { return result; }
+    if (std::ranges::any_of(indices, [&](uint32_t index){ return index >= positions.size(); })) { return result; }
+
+    const auto numVertices = static_cast<uint32_t>(positions.size());
+
+    //
+    // Vertices which share a position are treated as one vertex (a "position") for topology and error
+    // purposes. Positions which are shared by multiple referenced vertices are attribute seams.
+    //
+    const auto positionRemap = BuildPositionRemap(positions);
+
+    std::vector<bool> isSeamPosition(numVertices, false);
+    {
+        std::vector<uint32_t> positionFirstVertex(numVertices, UINT32_MAX);
+
+        for (const auto index : indices)
+        {
+            auto& firstVertex = positionFirstVertex[positionRemap[index]];
+
+            if (firstVertex == UINT32_MAX) { firstVertex = index; }
+            else if (firstVertex != index) { isSeamPosition[positionRemap[index]] = true; }
+        }
+    }
+
+    //
+    // Accumulate the (area weighted) planes of each position's triangles into a quadric per position
+    //
+    std::vector<Quadric> quadrics(numVertices);
+
+    for (std::size_t t = 0; t < indices.size(); t += 3)
+    {
+        const auto& p0 = positions[indices[t]];
+        const auto& p1 = positions[indices[t + 1]];
+        const auto& p2 = positions[indices[t + 2]];
+
+        const auto normal = glm::cross(p1 - p0, p2 - p0);
+        const auto normalLength = glm::length(normal);
+        if (normalLength <= 0.0f) { continue; }
+
+        const auto quadric = PlaneQuadric(normal / normalLength, p0, normalLength * 0.5);
+
+        quadrics[positionRemap[indices[t]]] += quadric;
+        quadrics[positionRemap[indices[t + 1]]] += quadric;
+        quadrics[positionRemap[indices[t + 2]]] += quadric;
+    }
+
+    //
+    // Simplify in passes. Each pass collapses the cheapest edges first, with each position only involved in one
+    // collapse per pass, so that the pass' adjacency and flip checks stay valid as collapses are applied.
+    //
+    std::vector<VertexKind> positionKinds(numVertices);
+    std::unordered_map<uint64_t, uint32_t> edgeTriangleCounts;
+    std::vector<uint32_t> vertexTriangleOffsets(numVertices + 1);
+    std::vector<uint32_t> vertexTriangles;
+    std::vector<Collapse> collapses;
+    std::vector<bool> positionTouched(numVertices);
+    std::vector<uint32_t> vertexRemap(numVertices);
+
+    float maxCollapseError = 0.0f;
+    bool firstPass = true;
+
+    while (result.indices.size() > targetIndexCount)
+    {
+        const auto& curIndices = result.indices;
+        const auto numTriangles = curIndices.size() / 3;
+
+        //
+        // Classify positions by the current topology
+        //
+        edgeTriangleCounts.clear();
+        edgeTriangleCounts.reserve(curIndices.size());
+
+        for (std::size_t t = 0; t < curIndices.size(); t += 3)
+        {
+            for (unsigned int e = 0; e < 3; ++e)
+            {
+                const auto a = positionRemap[curIndices[t + e]];
+                const auto b = positionRemap[curIndices[t + ((e + 1) % 3)]];
+                edgeTriangleCounts[EdgeKey(a, b)]++;
+            }
+        }
+
+        for (uint32_t x = 0; x < numVertices; ++x)
+        {
+            positionKinds[x] = isSeamPosition[x] ? VertexKind::Locked : VertexKind::Manifold;
+        }
+
+        for (std::size_t t = 0; t < curIndices.size(); t += 3)
+        {
+            for (unsigned int e = 0; e < 3; ++e)
+            {
+                const auto a = positionRemap[curIndices[t + e]];
+                const auto b = positionRemap[curIndices[t + ((e + 1) % 3)]];
+                const auto edgeCount = edgeTriangleCounts[EdgeKey(a, b)];
+
+                for (const auto position : {a, b})
+                {
+                    if (edgeCount > 2) { positionKinds[position] = VertexKind::Locked; }
+                    else if (edgeCount == 1 && positionKinds[position] == VertexKind::Manifold) { positionKinds[position] = VertexKind::Border; }
+                }
+
+                // Add quadrics for the original mesh's open borders, which hold them in place. The quadric's
+                // plane contains the border edge and is perpendicular to the border's triangle.
+                if (firstPass && edgeCount == 1)
+                {
+                    const auto& p0 = positions[curIndices[t]];
+                    const auto& p1 = positions[curIndices[t + 1]];
+                    const auto& p2 = positions[curIndices[t + 2]];
+
+                    const auto edge = positions[b] - positions[a];
+                    const auto borderNormal = glm::cross(edge, glm::cross(p1 - p0, p2 - p0));
+                    const auto borderNormalLength = glm::length(borderNormal);
+                    if (borderNormalLength <= 0.0f) { continue; }
+
+                    const auto quadric = PlaneQuadric(
+                        borderNormal / borderNormalLength,
+                        positions[a],
+                        BORDER_QUADRIC_WEIGHT * glm::dot(edge, edge)
+                    );
+
+                    quadrics[a] += quadric;
+                    quadrics[b] += quadric;
+                }
+            }
+        }
+
+        firstPass = false;
+
+        //
+        // Build vertex -> triangles adjacency
+        //
+        std::ranges::fill(vertexTriangleOffsets, 0);
+        for (const auto index : curIndices) { vertexTriangleOffsets[index + 1]++; }
+        for (uint32_t x = 0; x < numVertices; ++x) { vertexTriangleOffsets[x + 1] += vertexTriangleOffsets[x]; }
+
+        vertexTriangles.resize(curIndices.size());
+        {
+            auto writeOffsets = vertexTriangleOffsets;
+
+            for (std::size_t x = 0; x < curIndices.size(); ++x)
+            {
+                vertexTriangles[writeOffsets[curIndices[x]]++] = static_cast<uint32_t>(x / 3);
+            }
+        }
+
+        //
+        // Gather candidate collapses, in both directions of every edge, and order them by cost
+        //
+        collapses.clear();
+
+        for (std::size_t t = 0; t < curIndices.size(); t += 3)
+        {
+            for (unsigned int e = 0; e < 3; ++e)
+            {
+                const auto v0 = curIndices[t + e];
+                const auto v1 = curIndices[t + ((e + 1) % 3)];
+
+                for (const auto& [from, to] : {std::pair{v0, v1}, std::pair{v1, v0}})
+                {
+                    const auto fromPosition = positionRemap[from];
+                    const auto toPosition = positionRemap[to];
+
+                    if (fromPosition == toPosition) { continue; }
+                    if (positionKinds[fromPosition] == VertexKind::Locked) { continue; }
+                    if (positionKinds[fromPosition] == VertexKind::Border &&
+                        edgeTriangleCounts[EdgeKey(fromPosition, toPosition)] != 1) { continue; }
+
+                    const auto cost = QuadricError(quadrics[fromPosition] + quadrics[toPosition], positions[to]);
+
+                    collapses.push_back({.fromVertex = from, .toVertex = to, .cost = cost});
+                }
+            }
+        }
+
+        std::ranges::sort(collapses, [](const Collapse& a, const Collapse& b){ return a.cost < b.cost; });
+
+        //
+        // Apply as many collapses as are needed, cheapest first
+        //
+        const auto trianglesToRemove = (curIndices.size() - targetIndexCount + 2) / 3;
+        std::size_t trianglesRemoved = 0;
+        std::size_t numCollapsed = 0;
+
+        std::fill(positionTouched.begin(), positionTouched.end(), false);
+        for (uint32_t x = 0; x < numVertices; ++x) { vertexRemap[x] = x; }
+
+        for (const auto& collapse : collapses)
+        {
+            if (trianglesRemoved >= trianglesToRemove) { break; }
+
+            const auto fromPosition = positionRemap[collapse.fromVertex];
+            const auto toPosition = positionRemap[collapse.toVertex];
+
+            if (positionTouched[fromPosition] || positionTouched[toPosition]) { continue; }
+
+            // Note that non-seam positions are only referenced by a single vertex, so the from vertex's
+            // triangles are all of the from position's triangles
+            const std::span<const uint32_t> fromTriangles(
+                vertexTriangles.data() + vertexTriangleOffsets[collapse.fromVertex],
+                vertexTriangleOffsets[collapse.fromVertex + 1] - vertexTriangleOffsets[collapse.fromVertex]
+            );
+
+            if (CollapseFlipsTriangles(positions, positionRemap, curIndices, fromTriangles, collapse.fromVertex, collapse.toVertex))
+            {
+                continue;
+            }
+
+            vertexRemap[collapse.fromVertex] = collapse.toVertex;
+            quadrics[toPosition] += quadrics[fromPosition];
+            maxCollapseError = std::max(maxCollapseError, collapse.cost);
+
+            // Lock the neighbourhood of the collapse for the rest of the pass
+            for (const auto triangle : fromTriangles)
+            {
+                for (unsigned int v = 0; v < 3; ++v)
+                {
+                    positionTouched[positionRemap[curIndices[triangle * 3 + v]]] = true;
+                }
+            }
+
+            trianglesRemoved += positionKinds[fromPosition] == VertexKind::Border ? 1 : 2;
+            numCollapsed++;
+        }
+
+        if (numCollapsed == 0) { break; }
+
+        //
+        // Apply the pass' collapses to the index list, dropping triangles which became degenerate
+        //
+        std::vector<uint32_t> newIndices;
+        newIndices.reserve(curIndices.size());
+
+        for (std::size_t t = 0; t < numTriangles; ++t)
+        {
+            const auto i0 = vertexRemap[curIndices[t * 3]];
+            const auto i1 = vertexRemap[curIndices[t * 3 + 1]];
+            const auto i2 = vertexRemap[curIndices[t * 3 + 2]];
+
+            const auto p0 = positionRemap[i0];
+            const auto p1 = positionRemap[i1];
+            const auto p2 = positionRemap[i2];
+
+            if (p0 == p1 || p1 == p2 || p0 == p2) { continue; }
+
+            newIndices.insert(newIndices.end(), {i0, i1, i2});
+        }
+
+        result.indices = std::move(newIndices);
+    }
+
+    result.error = std::sqrt(maxCollapseError);
+
+    return result;
+}
+
+bool MeshSimplifier::GenerateLODs(Mesh& mesh, const MeshLODParams& params)
+{
+    if (!mesh.lods.empty()) { return false; }
+
+    std::vector<glm::vec3> positions;
+    std::vector<uint32_t>* pIndices = nullptr;
+
+    switch (mesh.type)
+    {
+        case MeshType::Static:
+        {
+            auto& staticMesh = dynamic_cast<StaticMesh&>(mesh);
+            positions.reserve(staticMesh.vertices.size());
+            for (const auto& vertex : staticMesh.vertices) { positions.push_back(vertex.position); }
+            pIndices = &staticMesh.indices;
+        }
+        break;
+        case MeshType::Bone:
+        {
+            auto& boneMesh = dynamic_cast<BoneMesh&>(mesh);
+            positions.reserve(boneMesh.vertices.size());
+            for (const auto& vertex : boneMesh.vertices) { positions.push_back(vertex.position); }
+            pIndices = &boneMesh.indices;
+        }
+        break;
+    }
+
+    if (pIndices == nullptr || pIndices->size() < 3 || positions.empty()) { return false; }
+
+    auto& indices = *pIndices;
+
+    //
+    // LOD errors are stored relative to the mesh's bounding radius, so that they can be projected to screen
+    // space using an object's world-space bounds, whatever its scale
+    //
+    glm::vec3 boundsMin = positions.front();
+    glm::vec3 boundsMax = positions.front();
+
+    for (const auto& position : positions)
+    {
+        boundsMin = glm::min(boundsMin, position);
+        boundsMax = glm::max(boundsMax, position);
+    }
+
+    const float boundsRadius = glm::length(boundsMax - boundsMin) * 0.5f;
+    if (boundsRadius <= 0.0f) { return false; }
+
+    //
+    // Simplify each LOD from the previous LOD. Each LOD's error is the sum of the errors of the simplification
+    // steps leading to it, which bounds its error relative to LOD 0.
+    //
+    std::vector<MeshLOD> lods;
+    lods.push_back({.firstIndex = 0, .indexCount = static_cast<uint32_t>(indices.size()), .error = 0.0f});
+
+    std::vector<uint32_t> prevLODIndices = indices;
+    float lodError = 0.0f;
+
+    const auto maxLODs = std::min(params.maxLODs, MAX_MESH_LODS);
+
+    while (lods.size() < maxLODs)
+    {
+        const auto prevTriangleCount = prevLODIndices.size() / 3;
+        if (prevTriangleCount < params.minTriangleCount) { break; }
+
+        const auto targetTriangleCount = std::max(
+            static_cast<std::size_t>(static_cast<float>(prevTriangleCount) * params.reductionRatio),
+            params.minTriangleCount
+        );
+
+        auto result = Simplify(positions, prevLODIndices, targetTriangleCount * 3);
+
+        if (static_cast<float>(result.indices.size()) > static_cast<float>(prevLODIndices.size()) * params.minReductionRatio)
+        {
+            break;
+        }
+
+        lodError += result.error / boundsRadius;
+
+        lods.push_back({
+            .firstIndex = static_cast<uint32_t>(indices.size()),
+            .indexCount = static_cast<uint32_t>(result.indices.size()),
+            .error = lodError
+        });
+
+        indices.insert(indices.end(), result.indices.cbegin(), result.indices.cend());
+        prevLODIndices = std::move(result.indices);
+    }
+
+    if (lods.size() <= 1) { return false; }
+
+    mesh.lods = std::move(lods);
+
+    return true;
+}
+
+}
@@ -0,0 +1,192 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Render/NullRenderer.h>
+
+namespace Accela::Render
+{
+
+static constexpr char NullRenderer_Frames_Count[] = "NullRenderer_Frames_Count";
+static constexpr char NullRenderer_Textures_Count[] = "NullRenderer_Textures_Count";
+static constexpr char NullRenderer_Meshes_Count[] = "NullRenderer_Meshes_Count";
+static constexpr char NullRenderer_Materials_Count[] = "NullRenderer_Materials_Count";
+static constexpr char NullRenderer_Objects_Count[] = "NullRenderer_Objects_Count";
+static constexpr char NullRenderer_Sprites_Count[] = "NullRenderer_Sprites_Count";
+
+NullRenderer::NullRenderer(Common::ILogger::Ptr logger, Common::IMetrics::Ptr metrics)
+    : RendererBase(std::move(logger), std::move(metrics))
+{
+
+}
+
+void NullRenderer::OnIdle()
+{
+    // no-op
+}
+
+bool NullRenderer::OnInitialize(const RenderInit&, const RenderSettings&)
+{
+    m_logger->Log(Common::LogLevel::Info, "NullRenderer: Initializing");
+
+    return true;
+}
+
+bool NullRenderer::OnShutdown()
+{
+    m_logger->Log(Common::LogLevel::Info, "NullRenderer: Shutting down");
+
+    m_textures.clear();
+    m_meshes.clear();
+    m_materials.clear();
+    m_renderTargets.clear();
+    m_sprites.clear();
+    m_objects.clear();
+    m_terrains.clear();
+    m_lights.clear();
+    m_frameCount = 0;
+
+    return true;
+}
+
+bool NullRenderer::OnRenderFrame(RenderGraph::Ptr)
+{
+    m_frameCount++;
+
+    SyncMetrics();
+
+    return true;
+}
+
+void NullRenderer::OnCreateTexture(std::promise<bool> resultPromise,
+                                   const Texture& texture,
+                                   const TextureView&,
+                                   const TextureSampler&)
+{
+    resultPromise.set_value(m_textures.insert(texture.id).second);
+}
+
+void NullRenderer::OnUpdateTexture(std::promise<bool> resultPromise,
+                                   const TextureId& textureId,
+                                   const Common::ImageData::Ptr&)
+{
+    resultPromise.set_value(m_textures.contains(textureId));
+}
+
+bool NullRenderer::OnDestroyTexture(TextureId textureId)
+{
+    if (m_textures.erase(textureId) > 0)
+    {
+        m_ids->textureIds.ReturnId(textureId);
+    }
+
+    return true;
+}
+
+bool NullRenderer::OnCreateMesh(std::promise<bool> resultPromise, const Mesh::Ptr& mesh, MeshUsage)
+{
+    const bool inserted = m_meshes.insert(mesh->id).second;
+
+    resultPromise.set_value(inserted);
+
+    return inserted;
+}
+
+bool NullRenderer::OnDestroyMesh(MeshId meshId)
+{
+    if (m_meshes.erase(meshId) > 0)
+    {
+        m_ids->meshIds.ReturnId(meshId);
+    }
+
+    return true;
+}
+
+bool NullRenderer::OnCreateMaterial(std::promise<bool> resultPromise, const Material::Ptr& material)
+{
+    const bool inserted = m_materials.insert(material->materialId).second;
+
+    resultPromise.set_value(inserted);
+
+    return inserted;
+}
+
+bool NullRenderer::OnDestroyMaterial(MaterialId materialId)
+{
+    m_materials.erase(materialId);
+    return true;
+}
+
+bool NullRenderer::OnCreateRenderTarget(RenderTargetId renderTargetId, const std::string&)
+{
+    return m_renderTargets.insert(renderTargetId).second;
+}
+
+bool NullRenderer::OnDestroyRenderTarget(RenderTargetId renderTargetId)
+{
+    m_renderTargets.erase(renderTargetId);
+    return true;
+}
+
+bool NullRenderer::OnWorldUpdate(const WorldUpdate& update)
+{
+    for (const auto& renderable : update.toAddSpriteRenderables) { m_sprites.insert(renderable.spriteId); }
+    for (const auto& renderable : update.toAddObjectRenderables) { m_objects.insert(renderable.objectId); }
+    for (const auto& renderable : update.toAddTerrainRenderables) { m_terrains.insert(renderable.terrainId); }
+    for (const auto& light : update.toAddLights) { m_lights.insert(light.lightId); }
+
+    for (const auto& id : update.toDeleteSpriteIds)
+    {
+        if (m_sprites.erase(id) > 0) { m_ids->spriteIds.ReturnId(id); }
+    }
+    for (const auto& id : update.toDeleteObjectIds)
+    {
+        if (m_objects.erase(id) > 0) { m_ids->objectIds.ReturnId(id); }
+    }
+    for (const auto& id : update.toDeleteTerrainIds)
+    {
+        if (m_terrains.erase(id) > 0) { m_ids->terrainIds.ReturnId(id); }
+    }
+    for (const auto& id : update.toDeleteLightIds)
+    {
+        m_lights.erase(id);
+    }
+
+    return true;
+}
+
+bool NullRenderer::OnSurfaceChanged()
+{
+    return true;
+}
+
+bool NullRenderer::OnChangeRenderSettings(const RenderSettings&)
+{
+    return true;
+}
+
+void NullRenderer::OnPickRenderRect(std::promise<std::vector<ObjectId>> resultPromise, const URect&)
+{
+    // Nothing is ever rendered, so there's never an object within any region
+    resultPromise.set_value({});
+}
+
+std::vector<ObjectId> NullRenderer::OnPickRay(const std::string&, const glm::vec3&, const glm::vec3&)
+{
+    // Object bounds aren't tracked, so there's never an object along any ray
+    return {};
+}
+
+void NullRenderer::SyncMetrics()
+{
+    m_metrics->SetCounterValue(NullRenderer_Frames_Count, m_frameCount);
+    m_metrics->SetCounterValue(NullRenderer_Textures_Count, m_textures.size());
+    m_metrics->SetCounterValue(NullRenderer_Meshes_Count, m_meshes.size());
+    m_metrics->SetCounterValue(NullRenderer_Materials_Count, m_materials.size());
+    m_metrics->SetCounterValue(NullRenderer_Objects_Count, m_objects.size());
+    m_metrics->SetCounterValue(NullRenderer_Sprites_Count, m_sprites.size());
+}
+
+}
@@ -134,6 +134,18 @@ std::future<bool> RendererBase::ChangeRenderSettings(const RenderSettings& rende
     return Submit<RenderTask_ChangeRenderSettings, bool>(false, renderSettings);
 }
 
+std::future<std::vector<ObjectId>> RendererBase::PickObjectsInRenderRect(const URect& renderRect)
+{
+    return Submit<RenderTask_PickRenderRect, std::vector<ObjectId>>({}, renderRect);
+}
+
+std::future<std::vector<ObjectId>> RendererBase::PickObjectsAlongRay(const std::string& sceneName,
+                                                                     const glm::vec3& rayStart_worldSpace,
+                                                                     const glm::vec3& rayEnd_worldSpace)
+{
+    return Submit<RenderTask_PickRay, std::vector<ObjectId>>({}, sceneName, rayStart_worldSpace, rayEnd_worldSpace);
+}
+
 // Fulfills a render task message's promise by setting the message's result to the value returned
 // by applying the data arguments within the message to the provided func, as arguments.
 template <typename TaskType, typename Ret, typename Func>
@@ -211,6 +223,12 @@ void RendererBase::OnTaskMessageReceived(const Common::Message::Ptr& msg)
         case RenderTaskType::ChangeRenderSettings:
             FulfillDirect<RenderTask_ChangeRenderSettings, bool>(msg, std::bind_front(&RendererBase::OnChangeRenderSettings, this));
         break;
+        case RenderTaskType::PickRenderRect:
+            FulfillManual<RenderTask_PickRenderRect, std::vector<ObjectId>>(msg, std::bind_front(&RendererBase::OnPickRenderRect, this));
+        break;
+        case RenderTaskType::PickRay:
+            FulfillDirect<RenderTask_PickRay, std::vector<ObjectId>>(msg, std::bind_front(&RendererBase::OnPickRay, this));
+        break;
     }
 }
 
@@ -17,6 +17,7 @@
 #include <Accela/Render/Texture/TextureView.h>
 #include <Accela/Render/Texture/TextureSampler.h>
 #include <Accela/Render/Mesh/Mesh.h>
+#include <Accela/Render/Util/Rect.h>
 
 #include <Accela/Common/ImageData.h>
 
@@ -37,6 +38,8 @@ namespace Accela::Render
     using RenderTask_WorldUpdate = DataRenderTask<RenderTaskType::WorldUpdate, WorldUpdate>;
     using RenderTask_SurfaceChanged = DataRenderTask<RenderTaskType::SurfaceChanged>;
     using RenderTask_ChangeRenderSettings = DataRenderTask<RenderTaskType::ChangeRenderSettings, RenderSettings>;
+    using RenderTask_PickRenderRect = DataRenderTask<RenderTaskType::PickRenderRect, URect>;
+    using RenderTask_PickRay = DataRenderTask<RenderTaskType::PickRay, std::string, glm::vec3, glm::vec3>;
 }
 
 #endif //LIBACCELARENDERER_SRC_TASK_RENDERTASKS_H
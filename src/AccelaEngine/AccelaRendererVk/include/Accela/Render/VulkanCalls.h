@@ -83,6 +83,9 @@ namespace Accela::Render
             VkResult vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const override;
             VkResult vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const override;
             void vkDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) const override;
+            VkResult vkCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) const override;
+            void vkDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) const override;
+            VkResult vkGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) const override;
             VkResult vkCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) const override;
             void vkDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) const override;
             VkResult vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) const override;
@@ -228,6 +231,9 @@ namespace Accela::Render
             PFN_vkCreateGraphicsPipelines m_vkCreateGraphicsPipelines{nullptr};
             PFN_vkCreateComputePipelines m_vkCreateComputePipelines{nullptr};
             PFN_vkDestroyPipeline m_vkDestroyPipeline{nullptr};
+            PFN_vkCreatePipelineCache m_vkCreatePipelineCache{nullptr};
+            PFN_vkDestroyPipelineCache m_vkDestroyPipelineCache{nullptr};
+            PFN_vkGetPipelineCacheData m_vkGetPipelineCacheData{nullptr};
             PFN_vkCreateFramebuffer m_vkCreateFramebuffer{nullptr};
             PFN_vkDestroyFramebuffer m_vkDestroyFramebuffer{nullptr};
             PFN_vkCreateCommandPool m_vkCreateCommandPool{nullptr};
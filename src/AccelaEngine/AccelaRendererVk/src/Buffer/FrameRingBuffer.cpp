@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "FrameRingBuffer.h"
+#include "IBuffers.h"
+
+#include "../VulkanObjs.h"
+#include "../PostExecutionOp.h"
+
+#include "../Vulkan/VulkanPhysicalDevice.h"
+
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+
+namespace Accela::Render
+{
+
+// Initial byte size of a ring's buffer; enough for a few hundred skinned objects' bone palettes
+static constexpr std::size_t FRAME_RING_BUFFER_MIN_BYTE_SIZE = 256 * 1024;
+
+FrameRingBuffer::FrameRingBuffer(Common::ILogger::Ptr logger,
+                                 VulkanObjsPtr vulkanObjs,
+                                 IBuffersPtr buffers,
+                                 PostExecutionOpsPtr postExecutionOps,
+                                 VkBufferUsageFlags vkUsageFlags,
+                                 std::string tag)
+    : m_logger(std::move(logger))
+    , m_vulkanObjs(std::move(vulkanObjs))
+    , m_buffers(std::move(buffers))
+    , m_postExecutionOps(std::move(postExecutionOps))
+    , m_vkUsageFlags(vkUsageFlags)
+    , m_tag(std::move(tag))
+{
+
+}
+
+void FrameRingBuffer::Destroy()
+{
+    if (m_buffer != nullptr)
+    {
+        m_buffers->DestroyBuffer(m_buffer->GetBufferId());
+        m_buffer = nullptr;
+    }
+
+    m_headByteOffset = 0;
+}
+
+void FrameRingBuffer::Reset()
+{
+    m_headByteOffset = 0;
+}
+
+std::expected<FrameRingBuffer::Allocation, bool> FrameRingBuffer::Allocate(const std::size_t& byteSize)
+{
+    if (byteSize == 0)
+    {
+        m_logger->Log(Common::LogLevel::Error, "FrameRingBuffer::Allocate: Zero byte allocation requested for: {}", m_tag);
+        return std::unexpected(false);
+    }
+
+    //
+    // Align the head to the device's required descriptor offset alignment
+    //
+    const auto& limits = m_vulkanObjs->GetPhysicalDevice()->GetPhysicalDeviceProperties().limits;
+
+    VkDeviceSize alignment = 1;
+
+    if (m_vkUsageFlags & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)
+    {
+        alignment = std::max(alignment, limits.minStorageBufferOffsetAlignment);
+    }
+    if (m_vkUsageFlags & VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT)
+    {
+        alignment = std::max(alignment, limits.minUniformBufferOffsetAlignment);
+    }
+
+    // Note that Vulkan guarantees these alignments are powers of two
+    const auto allocationByteOffset = (m_headByteOffset + (alignment - 1)) & ~(alignment - 1);
+
+    //
+    // Make sure the allocation fits, growing the buffer if needed
+    //
+    std::size_t byteOffset = allocationByteOffset;
+
+    if (m_buffer == nullptr || (allocationByteOffset + byteSize) > m_buffer->GetByteSize())
+    {
+        if (!EnsureCapacity(byteSize))
+        {
+            return std::unexpected(false);
+        }
+
+        // Growing gives us a brand-new buffer, so allocation restarts at its beginning
+        byteOffset = 0;
+    }
+
+    m_headByteOffset = byteOffset + byteSize;
+
+    Allocation allocation{};
+    allocation.vkBuffer = m_buffer->GetVkBuffer();
+    allocation.byteOffset = byteOffset;
+    allocation.byteSize = byteSize;
+    allocation.pMappedData = (unsigned char*)m_buffer->GetAllocation().vmaAllocationInfo.pMappedData + byteOffset;
+
+    return allocation;
+}
+
+std::expected<FrameRingBuffer::Allocation, bool> FrameRingBuffer::Write(const void* pData, const std::size_t& byteSize)
+{
+    const auto allocation = Allocate(byteSize);
+    if (!allocation)
+    {
+        return std::unexpected(allocation.error());
+    }
+
+    memcpy(allocation->pMappedData, pData, byteSize);
+
+    return allocation;
+}
+
+bool FrameRingBuffer::EnsureCapacity(const std::size_t& byteSize)
+{
+    //
+    // Size the new buffer to hold at least double what's needed, so that steadily growing
+    // usage doesn't cause a re-creation every frame
+    //
+    std::size_t newByteSize = std::max(byteSize * 2, FRAME_RING_BUFFER_MIN_BYTE_SIZE);
+
+    if (m_buffer != nullptr)
+    {
+        newByteSize = std::max(newByteSize, m_buffer->GetByteSize() * 2);
+    }
+
+    const auto bufferCreate = m_buffers->CreateBuffer(
+        m_vkUsageFlags,
+        VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT,
+        newByteSize,
+        m_tag
+    );
+    if (!bufferCreate)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "FrameRingBuffer::EnsureCapacity: Failed to create buffer of byte size {} for: {}", newByteSize, m_tag);
+        return false;
+    }
+
+    assert((*bufferCreate)->GetAllocation().vmaAllocationInfo.pMappedData != nullptr);
+
+    //
+    // Allocations made from the old buffer may still be referenced by commands recorded
+    // earlier in this frame, so only destroy it once the frame has finished executing
+    //
+    if (m_buffer != nullptr)
+    {
+        m_postExecutionOps->Enqueue_Current(BufferDeleteOp(m_buffers, m_buffer->GetBufferId()));
+    }
+
+    m_buffer = *bufferCreate;
+    m_headByteOffset = 0;
+
+    return true;
+}
+
+}
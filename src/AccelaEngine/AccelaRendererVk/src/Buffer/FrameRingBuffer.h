@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERERVK_SRC_BUFFER_FRAMERINGBUFFER_H
+#define LIBACCELARENDERERVK_SRC_BUFFER_FRAMERINGBUFFER_H
+
+#include "../ForwardDeclares.h"
+
+#include <Accela/Common/Log/ILogger.h>
+
+#include <vulkan/vulkan.h>
+
+#include <expected>
+#include <string>
+#include <cstddef>
+
+namespace Accela::Render
+{
+    /**
+     * Persistently mapped, CPU-visible buffer which transient per-draw data (bone palettes, draw
+     * payloads, etc.) is sub-allocated from while recording a frame's commands.
+     *
+     * Each frame-specific Renderer owns its own FrameRingBuffer, so the set of them forms a ring over
+     * the frames in flight; a given buffer is only ever written to while its frame is being recorded,
+     * and is only rewound (via Reset) once that frame's fence has been synced and the GPU can no longer
+     * be reading from it. Allocations are bumped linearly through the buffer, aligned to the device's
+     * minimum storage/uniform buffer offset alignment, and bound via descriptor buffer offsets.
+     *
+     * If an allocation doesn't fit, the buffer is re-created at a larger size and the old buffer is
+     * destroyed once the current frame has finished executing, as allocations made from it earlier in
+     * the frame may still be referenced by recorded commands.
+     */
+    class FrameRingBuffer
+    {
+        public:
+
+            struct Allocation
+            {
+                VkBuffer vkBuffer{VK_NULL_HANDLE};
+                std::size_t byteOffset{0};
+                std::size_t byteSize{0};
+                void* pMappedData{nullptr};
+            };
+
+        public:
+
+            FrameRingBuffer(Common::ILogger::Ptr logger,
+                            VulkanObjsPtr vulkanObjs,
+                            IBuffersPtr buffers,
+                            PostExecutionOpsPtr postExecutionOps,
+                            VkBufferUsageFlags vkUsageFlags,
+                            std::string tag);
+
+            /**
+             * Destroys the ring's buffer. Must only be called once the GPU is no longer using it.
+             */
+            void Destroy();
+
+            /**
+             * Rewinds the ring to the start of its buffer. Must only be called once the GPU has
+             * finished executing all work which referenced previous allocations.
+             */
+            void Reset();
+
+            /**
+             * Allocates a section of the buffer for the current frame. The returned allocation is
+             * mapped and may be written to directly until the frame is submitted.
+             *
+             * @param byteSize The number of bytes to allocate
+             *
+             * @return The allocation, or false on error
+             */
+            [[nodiscard]] std::expected<Allocation, bool> Allocate(const std::size_t& byteSize);
+
+            /**
+             * Convenience function which allocates a section of the buffer and copies the provided
+             * data into it.
+             */
+            [[nodiscard]] std::expected<Allocation, bool> Write(const void* pData, const std::size_t& byteSize);
+
+        private:
+
+            [[nodiscard]] bool EnsureCapacity(const std::size_t& byteSize);
+
+        private:
+
+            Common::ILogger::Ptr m_logger;
+            VulkanObjsPtr m_vulkanObjs;
+            IBuffersPtr m_buffers;
+            PostExecutionOpsPtr m_postExecutionOps;
+            VkBufferUsageFlags m_vkUsageFlags;
+            std::string m_tag;
+
+            BufferPtr m_buffer;
+            std::size_t m_headByteOffset{0};
+    };
+}
+
+#endif //LIBACCELARENDERERVK_SRC_BUFFER_FRAMERINGBUFFER_H
@@ -0,0 +1,409 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "UploadScheduler.h"
+#include "IBuffers.h"
+
+#include "../Metrics.h"
+#include "../VulkanObjs.h"
+#include "../PostExecutionOp.h"
+
+#include "../Util/VulkanFuncs.h"
+
+#include <format>
+#include <algorithm>
+#include <memory>
+#include <cassert>
+
+namespace Accela::Render
+{
+
+// Alignment of uploads within the staging ring; satisfies the texel/offset alignment of every copy we do
+static constexpr std::size_t UPLOAD_STAGING_ALIGNMENT = 16;
+
+UploadScheduler::UploadScheduler(Common::ILogger::Ptr logger,
+                                 Common::IMetrics::Ptr metrics,
+                                 VulkanObjsPtr vulkanObjs,
+                                 IBuffersPtr buffers,
+                                 PostExecutionOpsPtr postExecutionOps)
+    : m_logger(std::move(logger))
+    , m_metrics(std::move(metrics))
+    , m_vulkanObjs(std::move(vulkanObjs))
+    , m_buffers(std::move(buffers))
+    , m_postExecutionOps(std::move(postExecutionOps))
+{
+
+}
+
+bool UploadScheduler::Initialize(VulkanCommandPoolPtr transferCommandPool,
+                                 VkQueue vkTransferQueue,
+                                 std::size_t stagingByteSize,
+                                 std::size_t maxBatchByteSize)
+{
+    m_logger->Log(Common::LogLevel::Info, "UploadScheduler: Initializing");
+
+    m_transferCommandPool = std::move(transferCommandPool);
+    m_vkTransferQueue = vkTransferQueue;
+    m_maxBatchByteSize = std::max<std::size_t>(maxBatchByteSize, 1);
+
+    const auto bufferCreate = m_buffers->CreateBuffer(
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT,
+        stagingByteSize,
+        "UploadStaging"
+    );
+    if (!bufferCreate)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "UploadScheduler::Initialize: Failed to create staging buffer of byte size {}", stagingByteSize);
+        return false;
+    }
+
+    assert((*bufferCreate)->GetAllocation().vmaAllocationInfo.pMappedData != nullptr);
+
+    m_ringBuffer = *bufferCreate;
+    m_ringHeadByteOffset = 0;
+    m_ringTailByteOffset = 0;
+    m_ringUsedByteSize = 0;
+
+    SyncMetrics();
+
+    return true;
+}
+
+void UploadScheduler::Destroy()
+{
+    m_logger->Log(Common::LogLevel::Info, "UploadScheduler: Destroying");
+
+    //
+    // Fail any uploads which never made it into a batch
+    //
+    auto pendingUploads = std::move(m_pendingUploads);
+    m_pendingUploads.clear();
+    m_pendingByteSize = 0;
+
+    for (const auto& upload : pendingUploads)
+    {
+        if (upload.finishedFunc) { std::invoke(upload.finishedFunc, false); }
+    }
+
+    //
+    // Forget about in-flight batches; their post execution ops will still report their results
+    // when they're fulfilled, but there's no ring bookkeeping left for them to release
+    //
+    m_inFlightBatches.clear();
+
+    if (m_ringBuffer != nullptr)
+    {
+        m_buffers->DestroyBuffer(m_ringBuffer->GetBufferId());
+        m_ringBuffer = nullptr;
+    }
+
+    m_ringHeadByteOffset = 0;
+    m_ringTailByteOffset = 0;
+    m_ringUsedByteSize = 0;
+
+    m_transferCommandPool = nullptr;
+    m_vkTransferQueue = VK_NULL_HANDLE;
+
+    SyncMetrics();
+}
+
+void UploadScheduler::Enqueue(Upload upload)
+{
+    m_pendingByteSize += upload.byteSize;
+    m_pendingUploads.push_back(std::move(upload));
+
+    if (m_pendingByteSize >= m_maxBatchByteSize)
+    {
+        Flush();
+    }
+
+    SyncMetrics();
+}
+
+void UploadScheduler::Flush()
+{
+    if (m_ringBuffer == nullptr)
+    {
+        return;
+    }
+
+    while (!m_pendingUploads.empty())
+    {
+        SubmitBatch();
+    }
+
+    SyncMetrics();
+}
+
+void UploadScheduler::SubmitBatch()
+{
+    //
+    // Pull pending uploads into the batch, in order, until the batch is full. The batch always takes
+    // at least one upload, so uploads larger than the max batch size still make progress.
+    //
+    auto batchUploads = std::make_shared<std::vector<BatchUpload>>();
+
+    std::size_t batchByteSize = 0;
+    std::size_t batchRingByteSize = 0;
+
+    while (!m_pendingUploads.empty())
+    {
+        auto& upload = m_pendingUploads.front();
+
+        if (!batchUploads->empty() && (batchByteSize + upload.byteSize) > m_maxBatchByteSize)
+        {
+            break;
+        }
+
+        // Uploads are staged within the ring when possible. Uploads larger than the ring, or which
+        // don't fit because the ring is full of in-flight batches, fall back to a dedicated staging
+        // buffer rather than being held back, as render work recorded after a flush may rely on them.
+        auto staging = AllocateRingStaging(upload.byteSize, batchRingByteSize);
+        if (!staging)
+        {
+            staging = AllocateDedicatedStaging(upload);
+        }
+        if (!staging)
+        {
+            auto failedUpload = std::move(upload);
+            m_pendingUploads.pop_front();
+            m_pendingByteSize -= failedUpload.byteSize;
+            if (failedUpload.finishedFunc) { std::invoke(failedUpload.finishedFunc, false); }
+            continue;
+        }
+
+        if (upload.writeFunc && upload.byteSize > 0)
+        {
+            std::invoke(upload.writeFunc, staging->pMappedData);
+        }
+
+        batchByteSize += upload.byteSize;
+        m_pendingByteSize -= upload.byteSize;
+
+        batchUploads->push_back(BatchUpload{.upload = std::move(upload), .staging = *staging});
+        m_pendingUploads.pop_front();
+    }
+
+    if (batchUploads->empty())
+    {
+        return;
+    }
+
+    const auto batchId = m_nextBatchId++;
+
+    m_inFlightBatches.push_back(InFlightBatch{
+        .batchId = batchId,
+        .ringEndByteOffset = m_ringHeadByteOffset,
+        .ringByteSize = batchRingByteSize,
+        .finished = false
+    });
+
+    //
+    // Record every upload's copies into one command buffer, executed with one fence
+    //
+    auto recordResults = std::make_shared<std::vector<bool>>(batchUploads->size(), false);
+
+    const auto submitted = VulkanFuncs(m_logger, m_vulkanObjs).QueueSubmit(
+        "UploadBatch",
+        m_postExecutionOps,
+        m_vkTransferQueue,
+        m_transferCommandPool,
+        [=](const VulkanCommandBufferPtr& commandBuffer, VkFence vkFence){
+            bool allSuccessful = true;
+
+            for (std::size_t x = 0; x < batchUploads->size(); ++x)
+            {
+                const auto& batchUpload = (*batchUploads)[x];
+
+                (*recordResults)[x] = std::invoke(
+                    batchUpload.upload.recordFunc,
+                    commandBuffer,
+                    vkFence,
+                    batchUpload.staging.buffer,
+                    batchUpload.staging.byteOffset
+                );
+
+                allSuccessful = allSuccessful && (*recordResults)[x];
+            }
+
+            return allSuccessful;
+        },
+        [=,this](bool){
+            OnBatchFinished(batchId, *batchUploads, *recordResults);
+        },
+        EnqueueType::Frameless
+    );
+
+    // The post execution func is only skipped when nothing could be submitted at all
+    if (!submitted)
+    {
+        m_logger->Log(Common::LogLevel::Error, "UploadScheduler::SubmitBatch: Failed to submit upload batch");
+        OnBatchFinished(batchId, *batchUploads, std::vector<bool>(batchUploads->size(), false));
+    }
+}
+
+void UploadScheduler::OnBatchFinished(uint64_t batchId,
+                                      const std::vector<BatchUpload>& batchUploads,
+                                      const std::vector<bool>& results)
+{
+    //
+    // Report results and clean up any dedicated staging buffers
+    //
+    for (std::size_t x = 0; x < batchUploads.size(); ++x)
+    {
+        const auto& batchUpload = batchUploads[x];
+
+        if (batchUpload.staging.isDedicated)
+        {
+            m_buffers->DestroyBuffer(batchUpload.staging.buffer->GetBufferId());
+        }
+
+        if (batchUpload.upload.finishedFunc)
+        {
+            std::invoke(batchUpload.upload.finishedFunc, results[x]);
+        }
+    }
+
+    //
+    // Release ring space. Batches execute in submission order, but their post execution ops aren't
+    // guaranteed to be fulfilled in that order, so ring space is only released from the front, once
+    // every earlier batch has also finished.
+    //
+    const auto it = std::ranges::find_if(m_inFlightBatches, [&](const auto& batch){
+        return batch.batchId == batchId;
+    });
+    if (it == m_inFlightBatches.cend())
+    {
+        // Can happen if the scheduler was destroyed while the batch was in flight
+        return;
+    }
+
+    it->finished = true;
+
+    while (!m_inFlightBatches.empty() && m_inFlightBatches.front().finished)
+    {
+        const auto& batch = m_inFlightBatches.front();
+
+        m_ringUsedByteSize -= batch.ringByteSize;
+        m_ringTailByteOffset = batch.ringEndByteOffset;
+
+        m_inFlightBatches.pop_front();
+    }
+
+    if (m_ringUsedByteSize == 0)
+    {
+        // Nothing is in flight; restart at the beginning of the ring to avoid needless wrap-arounds
+        m_ringHeadByteOffset = 0;
+        m_ringTailByteOffset = 0;
+    }
+
+    SyncMetrics();
+}
+
+std::optional<UploadScheduler::StagingAllocation> UploadScheduler::AllocateRingStaging(std::size_t byteSize,
+                                                                                        std::size_t& ringByteSize)
+{
+    const auto ringCapacity = m_ringBuffer->GetByteSize();
+
+    if (byteSize == 0)
+    {
+        return StagingAllocation{.buffer = m_ringBuffer, .byteOffset = 0, .pMappedData = nullptr, .isDedicated = false};
+    }
+
+    const bool isEmpty = m_ringUsedByteSize == 0;
+    const bool isFull = !isEmpty && m_ringHeadByteOffset == m_ringTailByteOffset;
+
+    if (isFull)
+    {
+        return std::nullopt;
+    }
+
+    const auto alignedHead = (m_ringHeadByteOffset + (UPLOAD_STAGING_ALIGNMENT - 1)) & ~(UPLOAD_STAGING_ALIGNMENT - 1);
+
+    std::optional<std::size_t> allocationByteOffset;
+    std::size_t consumedByteSize = 0;
+
+    if (isEmpty || m_ringHeadByteOffset > m_ringTailByteOffset)
+    {
+        // Free space is [head, end of ring) and [start of ring, tail)
+        if (alignedHead + byteSize <= ringCapacity)
+        {
+            allocationByteOffset = alignedHead;
+            consumedByteSize = (alignedHead - m_ringHeadByteOffset) + byteSize;
+        }
+        else if (byteSize <= m_ringTailByteOffset)
+        {
+            // Wrap around; the space at the end of the ring is wasted until the batch is released
+            allocationByteOffset = 0;
+            consumedByteSize = (ringCapacity - m_ringHeadByteOffset) + byteSize;
+        }
+    }
+    else
+    {
+        // Free space is [head, tail)
+        if (alignedHead + byteSize <= m_ringTailByteOffset)
+        {
+            allocationByteOffset = alignedHead;
+            consumedByteSize = (alignedHead - m_ringHeadByteOffset) + byteSize;
+        }
+    }
+
+    if (!allocationByteOffset)
+    {
+        return std::nullopt;
+    }
+
+    m_ringHeadByteOffset = *allocationByteOffset + byteSize;
+    m_ringUsedByteSize += consumedByteSize;
+    ringByteSize += consumedByteSize;
+
+    StagingAllocation allocation{};
+    allocation.buffer = m_ringBuffer;
+    allocation.byteOffset = *allocationByteOffset;
+    allocation.pMappedData = (std::byte*)m_ringBuffer->GetAllocation().vmaAllocationInfo.pMappedData + *allocationByteOffset;
+    allocation.isDedicated = false;
+
+    return allocation;
+}
+
+std::optional<UploadScheduler::StagingAllocation> UploadScheduler::AllocateDedicatedStaging(const Upload& upload)
+{
+    const auto bufferCreate = m_buffers->CreateBuffer(
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT,
+        upload.byteSize,
+        std::format("UploadStaging-{}", upload.tag)
+    );
+    if (!bufferCreate)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "UploadScheduler::AllocateDedicatedStaging: Failed to create staging buffer of byte size {} for: {}",
+          upload.byteSize, upload.tag);
+        return std::nullopt;
+    }
+
+    StagingAllocation allocation{};
+    allocation.buffer = *bufferCreate;
+    allocation.byteOffset = 0;
+    allocation.pMappedData = (std::byte*)(*bufferCreate)->GetAllocation().vmaAllocationInfo.pMappedData;
+    allocation.isDedicated = true;
+
+    return allocation;
+}
+
+void UploadScheduler::SyncMetrics()
+{
+    m_metrics->SetCounterValue(Renderer_Uploads_Pending_Count, m_pendingUploads.size());
+    m_metrics->SetCounterValue(Renderer_Uploads_Pending_ByteSize, m_pendingByteSize);
+    m_metrics->SetCounterValue(Renderer_Uploads_InFlight_Batch_Count, m_inFlightBatches.size());
+    m_metrics->SetCounterValue(Renderer_Uploads_Staging_Used_ByteSize, m_ringUsedByteSize);
+}
+
+}
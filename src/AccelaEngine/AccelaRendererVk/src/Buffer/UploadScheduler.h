@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERERVK_SRC_BUFFER_UPLOADSCHEDULER_H
+#define LIBACCELARENDERERVK_SRC_BUFFER_UPLOADSCHEDULER_H
+
+#include "../ForwardDeclares.h"
+
+#include <Accela/Common/Log/ILogger.h>
+#include <Accela/Common/Metrics/IMetrics.h>
+
+#include <vulkan/vulkan.h>
+
+#include <functional>
+#include <string>
+#include <deque>
+#include <vector>
+#include <optional>
+#include <cstddef>
+#include <cstdint>
+
+namespace Accela::Render
+{
+    /**
+     * Coalesces CPU -> GPU data uploads (mesh data, image data, etc.) into batches.
+     *
+     * Rather than each upload creating its own staging buffer and doing its own queue submit with its
+     * own fence, uploads are queued up and, when flushed, their data is written into a persistent,
+     * persistently mapped, staging ring buffer and the copies out of it for many uploads are recorded
+     * into one command buffer, submitted with one fence. Batches are bounded in byte size, and a batch
+     * is submitted as soon as enough uploads are pending to fill one, so that large loads are spread
+     * over several submits rather than recorded all at once. Ring space is reclaimed once a batch's
+     * fence has signaled.
+     *
+     * Uploads which don't fit in the ring (larger than it, or the ring is full of in-flight batches)
+     * are given a dedicated staging buffer within their batch.
+     *
+     * Uploads are executed in the order they were enqueued, and a flush always submits every pending
+     * upload, so work submitted to the same queue after a flush can rely on the uploaded data.
+     */
+    class UploadScheduler
+    {
+        public:
+
+            /**
+             * Writes an upload's data into its (mapped) staging memory
+             */
+            using WriteFunc = std::function<void(std::byte* pStagingData)>;
+
+            /**
+             * Records the commands which copy an upload's data out of the staging buffer into its destination.
+             * Returns whether recording was successful.
+             */
+            using RecordFunc = std::function<bool(const VulkanCommandBufferPtr& commandBuffer,
+                                                  VkFence vkFence,
+                                                  const BufferPtr& stagingBuffer,
+                                                  std::size_t stagingByteOffset)>;
+
+            /**
+             * Invoked once an upload's batch has finished executing, with whether the upload was successful
+             */
+            using FinishedFunc = std::function<void(bool)>;
+
+            struct Upload
+            {
+                std::string tag;
+                std::size_t byteSize{0};
+                WriteFunc writeFunc;
+                RecordFunc recordFunc;
+                FinishedFunc finishedFunc;
+            };
+
+        public:
+
+            UploadScheduler(Common::ILogger::Ptr logger,
+                            Common::IMetrics::Ptr metrics,
+                            VulkanObjsPtr vulkanObjs,
+                            IBuffersPtr buffers,
+                            PostExecutionOpsPtr postExecutionOps);
+
+            /**
+             * @param transferCommandPool Command pool to allocate batch command buffers from
+             * @param vkTransferQueue The queue to submit batches to
+             * @param stagingByteSize Byte size of the staging ring
+             * @param maxBatchByteSize Maximum number of upload bytes submitted within one batch
+             */
+            bool Initialize(VulkanCommandPoolPtr transferCommandPool,
+                            VkQueue vkTransferQueue,
+                            std::size_t stagingByteSize,
+                            std::size_t maxBatchByteSize);
+
+            /**
+             * Fails any pending uploads and destroys the staging ring. Must only be called once the GPU is
+             * no longer executing batches.
+             */
+            void Destroy();
+
+            /**
+             * Queues an upload to be executed in a future batch. Automatically flushes if enough data is
+             * pending to fill a batch.
+             */
+            void Enqueue(Upload upload);
+
+            /**
+             * Submits all pending uploads, in as many batches as needed
+             */
+            void Flush();
+
+        private:
+
+            struct StagingAllocation
+            {
+                BufferPtr buffer;
+                std::size_t byteOffset{0};
+                std::byte* pMappedData{nullptr};
+                bool isDedicated{false};    // Whether the allocation has its own buffer, rather than being from the ring
+            };
+
+            struct BatchUpload
+            {
+                Upload upload;
+                StagingAllocation staging;
+            };
+
+            struct InFlightBatch
+            {
+                uint64_t batchId{0};
+                std::size_t ringEndByteOffset{0};   // Ring head position after the batch's allocations
+                std::size_t ringByteSize{0};        // Ring bytes consumed by the batch, including any wrap-around waste
+                bool finished{false};
+            };
+
+        private:
+
+            void SubmitBatch();
+            void OnBatchFinished(uint64_t batchId, const std::vector<BatchUpload>& batchUploads, const std::vector<bool>& results);
+
+            [[nodiscard]] std::optional<StagingAllocation> AllocateRingStaging(std::size_t byteSize, std::size_t& ringByteSize);
+            [[nodiscard]] std::optional<StagingAllocation> AllocateDedicatedStaging(const Upload& upload);
+
+            void SyncMetrics();
+
+        private:
+
+            Common::ILogger::Ptr m_logger;
+            Common::IMetrics::Ptr m_metrics;
+            VulkanObjsPtr m_vulkanObjs;
+            IBuffersPtr m_buffers;
+            PostExecutionOpsPtr m_postExecutionOps;
+
+            VulkanCommandPoolPtr m_transferCommandPool;
+            VkQueue m_vkTransferQueue{VK_NULL_HANDLE};
+            std::size_t m_maxBatchByteSize{0};
+
+            std::deque<Upload> m_pendingUploads;
+            std::size_t m_pendingByteSize{0};
+
+            // Staging ring state. Bytes in [tail, head), wrapping around the end of the ring, are in use.
+            BufferPtr m_ringBuffer;
+            std::size_t m_ringHeadByteOffset{0};
+            std::size_t m_ringTailByteOffset{0};
+            std::size_t m_ringUsedByteSize{0};
+
+            uint64_t m_nextBatchId{0};
+            std::deque<InFlightBatch> m_inFlightBatches;
+    };
+}
+
+#endif //LIBACCELARENDERERVK_SRC_BUFFER_UPLOADSCHEDULER_H
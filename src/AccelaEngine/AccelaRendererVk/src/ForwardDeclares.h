@@ -39,6 +39,8 @@ namespace Accela::Render
     class IBuffers; using IBuffersPtr = std::shared_ptr<IBuffers>;
     class Buffer; using BufferPtr = std::shared_ptr<Buffer>;
     class DataBuffer; using DataBufferPtr = std::shared_ptr<DataBuffer>;
+    class FrameRingBuffer; using FrameRingBufferPtr = std::shared_ptr<FrameRingBuffer>;
+    class UploadScheduler; using UploadSchedulerPtr = std::shared_ptr<UploadScheduler>;
     class IMeshes; using IMeshesPtr = std::shared_ptr<IMeshes>;
     class IFramebuffers; using IFramebuffersPtr = std::shared_ptr<IFramebuffers>;
     class IRenderables; using IRenderablesPtr = std::shared_ptr<IRenderables>;
@@ -8,14 +8,13 @@
 #define LIBACCELARENDERERVK_SRC_FRAMESTATE_H
 
 #include "ForwardDeclares.h"
-#include "InternalId.h"
-
-#include <Accela/Render/RenderSettings.h>
 
 #include <Accela/Common/Log/ILogger.h>
 
 #include <vulkan/vulkan.h>
 
+#include <cstdint>
+
 namespace Accela::Render
 {
     class FrameState
@@ -24,11 +23,9 @@ namespace Accela::Render
 
             FrameState(Common::ILogger::Ptr logger,
                        VulkanObjsPtr vulkanObjs,
-                       IRenderTargetsPtr renderTargets,
-                       IImagesPtr images,
                        uint8_t frameIndex);
 
-            bool Initialize(const RenderSettings& renderSettings);
+            bool Initialize();
             void Destroy();
 
             [[nodiscard]] uint8_t GetFrameIndex() const noexcept { return m_frameIndex; }
@@ -39,15 +36,11 @@ namespace Accela::Render
             [[nodiscard]] VkSemaphore GetRenderFinishedSemaphore() const noexcept { return m_renderFinishedSemaphore; }
             [[nodiscard]] VkSemaphore GetSwapChainBlitFinishedSemaphore() const noexcept { return m_swapChainBlitFinishedSemaphore; }
             [[nodiscard]] VkFence GetPipelineFence() const noexcept { return m_pipelineFence; }
-            [[nodiscard]] ImageId GetObjectDetailImageId() const noexcept { return m_objectDetailImageId; }
 
         private:
 
             Common::ILogger::Ptr m_logger;
             VulkanObjsPtr m_vulkanObjs;
-            IRenderTargetsPtr m_renderTargets;
-            ITexturesPtr m_textures;
-            IImagesPtr m_images;
 
             uint8_t m_frameIndex;
 
@@ -66,9 +59,6 @@ namespace Accela::Render
             VkSemaphore m_swapChainBlitFinishedSemaphore{VK_NULL_HANDLE};
             // Fence triggered when the pipeline has finished this frame's work
             VkFence m_pipelineFence{VK_NULL_HANDLE};
-
-            // Image that receives a copy of the object detail render output
-            ImageId m_objectDetailImageId;
     };
 }
 
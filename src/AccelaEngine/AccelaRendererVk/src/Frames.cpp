@@ -15,14 +15,9 @@
 namespace Accela::Render
 {
 
-Frames::Frames(Common::ILogger::Ptr logger,
-               VulkanObjsPtr vulkanObjs,
-               IRenderTargetsPtr renderTargets,
-               IImagesPtr images)
+Frames::Frames(Common::ILogger::Ptr logger, VulkanObjsPtr vulkanObjs)
     : m_logger(std::move(logger))
     , m_vulkanObjs(std::move(vulkanObjs))
-    , m_renderTargets(std::move(renderTargets))
-    , m_images(std::move(images))
 {
 
 }
@@ -76,8 +71,8 @@ bool Frames::CreateFrames(const RenderSettings& renderSettings)
 {
     for (uint32_t frameIndex = 0; frameIndex < renderSettings.framesInFlight; ++frameIndex)
     {
-        m_frames.emplace_back(m_logger, m_vulkanObjs, m_renderTargets, m_images, frameIndex);
-        if (!m_frames[frameIndex].Initialize(renderSettings))
+        m_frames.emplace_back(m_logger, m_vulkanObjs, frameIndex);
+        if (!m_frames[frameIndex].Initialize())
         {
             Destroy();
             return false;
@@ -31,10 +31,7 @@ namespace Accela::Render
     {
         public:
 
-            Frames(Common::ILogger::Ptr logger,
-                   VulkanObjsPtr vulkanObjs,
-                   IRenderTargetsPtr renderTargets,
-                   IImagesPtr images);
+            Frames(Common::ILogger::Ptr logger, VulkanObjsPtr vulkanObjs);
 
             bool Initialize(const RenderSettings& renderSettings, const VulkanSwapChainPtr& swapChain);
             void Destroy();
@@ -58,8 +55,6 @@ namespace Accela::Render
 
             Common::ILogger::Ptr m_logger;
             VulkanObjsPtr m_vulkanObjs;
-            IRenderTargetsPtr m_renderTargets;
-            IImagesPtr m_images;
 
             uint32_t m_currentFrameIndex{0};
             std::vector<FrameState> m_frames;
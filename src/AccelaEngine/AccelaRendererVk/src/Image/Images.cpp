@@ -11,6 +11,7 @@
 #include "../Metrics.h"
 
 #include "../Buffer/IBuffers.h"
+#include "../Buffer/UploadScheduler.h"
 #include "../VMA/IVMA.h"
 #include "../Util/VulkanFuncs.h"
 #include "../Util/Futures.h"
@@ -21,6 +22,10 @@
 
 #include <Accela/Render/IVulkanCalls.h>
 
+#include <algorithm>
+#include <vector>
+#include <cstring>
+
 namespace Accela::Render
 {
 
@@ -68,12 +73,14 @@ Images::Images(Common::ILogger::Ptr logger,
                Common::IMetrics::Ptr metrics,
                VulkanObjsPtr vulkanObjs,
                IBuffersPtr buffers,
-               PostExecutionOpsPtr postExecutionOps)
+               PostExecutionOpsPtr postExecutionOps,
+               UploadSchedulerPtr uploadScheduler)
    : m_logger(std::move(logger))
    , m_metrics(std::move(metrics))
    , m_vulkanObjs(std::move(vulkanObjs))
    , m_buffers(std::move(buffers))
    , m_postExecutionOps(std::move(postExecutionOps))
+   , m_uploadScheduler(std::move(uploadScheduler))
 {
 
 }
@@ -510,14 +517,20 @@ bool Images::TransferImageData(LoadedImage& loadedImage,
     bool generateMipMaps = false;
     const auto mipLevels = loadedImage.image.numMipLevels;
 
-    const bool generateMipMapsRequested = mipLevels > 1;
+    // Any mip levels baked into the data are copied directly to the image rather than being generated
+    const auto dataMipLevels = std::min(data->GetNumMipLevels(), mipLevels);
+
+    const bool generateMipMapsRequested = mipLevels > dataMipLevels;
 
     if (generateMipMapsRequested)
     {
-        const bool formatSupportsMipMaps = DoesImageFormatSupportMipMapGeneration(loadedImage.image.vkFormat);
+        // Mips are generated by blitting down from the base level, which block-compressed images don't support
+        const bool formatSupportsMipMaps = !data->IsBlockCompressed() &&
+                                           DoesImageFormatSupportMipMapGeneration(loadedImage.image.vkFormat);
         const bool imageSupportsMipMaps = loadedImage.image.numLayers == 1;
+        const bool dataSupportsMipMaps = dataMipLevels == 1;
 
-        generateMipMaps = formatSupportsMipMaps && imageSupportsMipMaps;
+        generateMipMaps = formatSupportsMipMaps && imageSupportsMipMaps && dataSupportsMipMaps;
 
         if (!generateMipMaps)
         {
@@ -526,91 +539,109 @@ bool Images::TransferImageData(LoadedImage& loadedImage,
         }
     }
 
-    VulkanFuncs vulkanFuncs(m_logger, m_vulkanObjs);
-
-    return vulkanFuncs.QueueSubmit<bool>(
-        std::format("TransferImageData-{}", loadedImage.id.id),
-        m_postExecutionOps,
-        m_vkTransferQueue,
-        m_transferCommandPool,
-        [&](const VulkanCommandBufferPtr& commandBuffer, VkFence vkFence)  {
-
-            // Mark the image as loading
-            if (m_imagesLoading.contains(loadedImage.id))
-            {
-                m_imagesLoading[loadedImage.id]++;
-            }
-            else
-            {
-                m_imagesLoading.insert({loadedImage.id, 1});
-            }
-
-            SyncMetrics();
-
-            // After the data transfer the image should be ready to be read by a shader
-            VkImageLayout finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-
-            // ... Unless we need to generate mipmaps, in which case it should be instead
-            // be put into transfer dest optimal for receiving mip data
-            if (generateMipMaps)
-            {
-                finalLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            }
-
-            //
-            // Transfer from the provided data to the image's base mip level
-            //
-            const auto transferResult = TransferImageData(
-                m_buffers,
-                m_postExecutionOps,
-                commandBuffer,
-                vkFence,
-                data,
-                loadedImage,
-                VK_IMAGE_ASPECT_COLOR_BIT,              // Transferring color data
-                loadedImage.vkImageLayout,              // Current image layout
-                finalLayout,                            // Final layout the image should be in after the transfer
-                VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT   // Earliest usage of the transferred data
+    // Mark the image as loading
+    if (m_imagesLoading.contains(loadedImage.id))
+    {
+        m_imagesLoading[loadedImage.id]++;
+    }
+    else
+    {
+        m_imagesLoading.insert({loadedImage.id, 1});
+    }
+
+    SyncMetrics();
+
+    //
+    // Queue the image's data to be uploaded in the next upload batch
+    //
+    const auto imageId = loadedImage.id;
+    const auto resultPromisePtr = std::make_shared<std::promise<bool>>(std::move(resultPromise));
+
+    UploadScheduler::Upload upload{};
+    upload.tag = std::format("TransferImageData-{}", loadedImage.id.id);
+    upload.byteSize = data->GetTotalByteSize();
+    upload.writeFunc = [=](std::byte* pStagingData) {
+        memcpy(pStagingData, data->GetPixelBytes().data(), data->GetTotalByteSize());
+    };
+    upload.recordFunc = [=,this](const VulkanCommandBufferPtr& commandBuffer,
+                                 VkFence,
+                                 const BufferPtr& stagingBuffer,
+                                 std::size_t stagingByteOffset) {
+        // Note that the image is looked up at record time, as its layout may have changed since
+        // the upload was queued
+        const auto it = m_images.find(imageId);
+        if (it == m_images.cend())
+        {
+            m_logger->Log(Common::LogLevel::Error,
+              "Images::TransferImageData: Image no longer exists at upload time: {}", imageId.id);
+            return false;
+        }
+
+        auto& image = it->second;
+
+        // After the data transfer the image should be ready to be read by a shader
+        VkImageLayout finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        // ... Unless we need to generate mipmaps, in which case it should be instead
+        // be put into transfer dest optimal for receiving mip data
+        if (generateMipMaps)
+        {
+            finalLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        }
+
+        //
+        // Transfer from the staged data to the image's base mip level, and any pre-baked mip levels
+        //
+        const auto transferResult = TransferImageData(
+            commandBuffer,
+            stagingBuffer,
+            stagingByteOffset,
+            data,
+            image,
+            VK_IMAGE_ASPECT_COLOR_BIT,              // Transferring color data
+            image.vkImageLayout,                    // Current image layout
+            finalLayout,                            // Final layout the image should be in after the transfer
+            VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT   // Earliest usage of the transferred data
+        );
+        if (!transferResult)
+        {
+            m_logger->Log(Common::LogLevel::Error, "Images::TransferImageData: Failed to transfer data to GPU image");
+            return false;
+        }
+
+        image.vkImageLayout = finalLayout;
+
+        //
+        // If requested, generate mip maps for the image's other mip levels
+        //
+        if (generateMipMaps)
+        {
+            VulkanFuncs(m_logger, m_vulkanObjs).GenerateMipMaps(
+                commandBuffer->GetVkCommandBuffer(),
+                image.image.size,
+                image.allocation.vkImage,
+                mipLevels,
+                VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
             );
-            if (!transferResult)
-            {
-                m_logger->Log(Common::LogLevel::Error, "Images::TransferImageData: Failed to transfer data to GPU image");
-                return false;
-            }
-
-            loadedImage.vkImageLayout = finalLayout;
-
-            //
-            // If requested, generate mip maps for the image's other mip levels
-            //
-            if (generateMipMaps)
-            {
-                vulkanFuncs.GenerateMipMaps(
-                    commandBuffer->GetVkCommandBuffer(),
-                    loadedImage.image.size,
-                    loadedImage.allocation.vkImage,
-                    mipLevels,
-                    VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                    VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
-                );
-            }
-
-            loadedImage.vkImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-
-            return true;
-        },
-        [=,this](bool commandsSuccessful){
-            return OnImageTransferFinished(commandsSuccessful, loadedImage, isInitialDataTransfer);
-        },
-        std::move(resultPromise),
-        EnqueueType::Frameless
-    );
+        }
+
+        image.vkImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        return true;
+    };
+    upload.finishedFunc = [=,this](bool uploadSuccessful) {
+        resultPromisePtr->set_value(OnImageTransferFinished(uploadSuccessful, loadedImage, isInitialDataTransfer));
+    };
+
+    m_uploadScheduler->Enqueue(std::move(upload));
+
+    return true;
 }
 
-bool Images::TransferImageData(const IBuffersPtr& buffers,
-                               const PostExecutionOpsPtr& postExecutionOps,
-                               const VulkanCommandBufferPtr& commandBuffer,
-                               VkFence vkExecutionFence,
+bool Images::TransferImageData(const VulkanCommandBufferPtr& commandBuffer,
+                               const BufferPtr& stagingBuffer,
+                               std::size_t stagingByteOffset,
                                const Common::ImageData::Ptr& sourceImageData,
                                const LoadedImage& destImage,
                                VkImageAspectFlags vkTransferImageAspectFlags,
@@ -620,36 +651,6 @@ bool Images::TransferImageData(const IBuffersPtr& buffers,
 {
     const auto vkDestImage = destImage.allocation.vkImage;
 
-    //
-    // Create a CPU-only staging buffer and fill it with the image data
-    //
-    const auto stagingBuffer = buffers->CreateBuffer(
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
-        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT,
-        sourceImageData->GetTotalByteSize(),
-        std::format("TransferStaging-{}", (uint64_t)vkDestImage)
-    );
-    if (!stagingBuffer.has_value())
-    {
-        m_logger->Log(Common::LogLevel::Error,
-                      "TransferImageData: Failed to create staging buffer for: {}", (uint64_t)vkDestImage);
-        return false;
-    }
-
-    BufferUpdate stagingUpdate{};
-    stagingUpdate.pData = (void*)sourceImageData->GetPixelBytes().data();
-    stagingUpdate.updateOffset = 0;
-    stagingUpdate.dataByteSize = sourceImageData->GetTotalByteSize();
-
-    if (!buffers->MappedUpdateBuffer(*stagingBuffer, {stagingUpdate}))
-    {
-        m_logger->Log(Common::LogLevel::Error,
-                      "TransferImageData: Failed to update staging buffer for: {}", (uint64_t)vkDestImage);
-        buffers->DestroyBuffer((*stagingBuffer)->GetBufferId());
-        return false;
-    }
-
     //
     // Pipeline barrier to prepare the dest image to receive new data
     //
@@ -671,30 +672,39 @@ bool Images::TransferImageData(const IBuffersPtr& buffers,
     RecordImageLayout(destImage.id, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
     //
-    // Copy the data from the staging buffer to the VkImage
+    // Copy the data from the staging buffer to the VkImage, one copy region per mip level the data contains
     //
-    VkExtent3D sourceExtent{};
-    sourceExtent.width = sourceImageData->GetPixelWidth();
-    sourceExtent.height = sourceImageData->GetPixelHeight();
-    sourceExtent.depth = 1;
-
-    VkBufferImageCopy copyRegion = {};
-    copyRegion.bufferOffset = 0;
-    copyRegion.bufferRowLength = 0;
-    copyRegion.bufferImageHeight = 0;
-    copyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    copyRegion.imageSubresource.mipLevel = 0;
-    copyRegion.imageSubresource.baseArrayLayer = 0;
-    copyRegion.imageSubresource.layerCount = sourceImageData->GetNumLayers();
-    copyRegion.imageExtent = sourceExtent;
+    const auto numCopyMipLevels = std::min(sourceImageData->GetNumMipLevels(), destImage.image.numMipLevels);
+
+    std::vector<VkBufferImageCopy> copyRegions;
+
+    for (uint32_t mipLevel = 0; mipLevel < numCopyMipLevels; ++mipLevel)
+    {
+        VkExtent3D sourceExtent{};
+        sourceExtent.width = sourceImageData->GetMipLevelPixelWidth(mipLevel);
+        sourceExtent.height = sourceImageData->GetMipLevelPixelHeight(mipLevel);
+        sourceExtent.depth = 1;
+
+        VkBufferImageCopy copyRegion = {};
+        copyRegion.bufferOffset = stagingByteOffset + sourceImageData->GetMipLevelByteOffset(mipLevel);
+        copyRegion.bufferRowLength = 0;
+        copyRegion.bufferImageHeight = 0;
+        copyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        copyRegion.imageSubresource.mipLevel = mipLevel;
+        copyRegion.imageSubresource.baseArrayLayer = 0;
+        copyRegion.imageSubresource.layerCount = sourceImageData->GetNumLayers();
+        copyRegion.imageExtent = sourceExtent;
+
+        copyRegions.push_back(copyRegion);
+    }
 
     m_vulkanObjs->GetCalls()->vkCmdCopyBufferToImage(
         commandBuffer->GetVkCommandBuffer(),
-        (*stagingBuffer)->GetVkBuffer(),
+        stagingBuffer->GetVkBuffer(),
         vkDestImage,
         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        1,
-        &copyRegion
+        static_cast<uint32_t>(copyRegions.size()),
+        copyRegions.data()
     );
 
     //
@@ -717,11 +727,6 @@ bool Images::TransferImageData(const IBuffersPtr& buffers,
 
     RecordImageLayout(destImage.id, vkFinalImageLayout);
 
-    //
-    // Record a task to clean up the staging buffer once the transfer work is complete
-    //
-    postExecutionOps->EnqueueFrameless(vkExecutionFence, BufferDeleteOp(buffers, (*stagingBuffer)->GetBufferId()));
-
     return true;
 }
 
@@ -28,7 +28,8 @@ namespace Accela::Render
                    Common::IMetrics::Ptr metrics,
                    VulkanObjsPtr vulkanObjs,
                    IBuffersPtr buffers,
-                   PostExecutionOpsPtr postExecutionOps);
+                   PostExecutionOpsPtr postExecutionOps,
+                   UploadSchedulerPtr uploadScheduler);
 
             bool Initialize(VulkanCommandPoolPtr transferCommandPool, VkQueue vkTransferQueue) override;
             void Destroy() override;
@@ -66,10 +67,9 @@ namespace Accela::Render
                                                  bool isInitialDataTransfer,
                                                  std::promise<bool> resultPromise);
 
-            [[nodiscard]] bool TransferImageData(const IBuffersPtr& buffers,
-                                                 const PostExecutionOpsPtr& postExecutionOps,
-                                                 const VulkanCommandBufferPtr& commandBuffer,
-                                                 VkFence vkExecutionFence,
+            [[nodiscard]] bool TransferImageData(const VulkanCommandBufferPtr& commandBuffer,
+                                                 const BufferPtr& stagingBuffer,
+                                                 std::size_t stagingByteOffset,
                                                  const Common::ImageData::Ptr& sourceImageData,
                                                  const LoadedImage& destImage,
                                                  VkImageAspectFlags vkTransferImageAspectFlags,
@@ -90,6 +90,7 @@ namespace Accela::Render
             VulkanObjsPtr m_vulkanObjs;
             IBuffersPtr m_buffers;
             PostExecutionOpsPtr m_postExecutionOps;
+            UploadSchedulerPtr m_uploadScheduler;
 
             VulkanCommandPoolPtr m_transferCommandPool;
             VkQueue m_vkTransferQueue{VK_NULL_HANDLE};
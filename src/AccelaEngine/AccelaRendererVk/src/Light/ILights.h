@@ -50,9 +50,14 @@ namespace Accela::Render
             /**
              * Invalidates the shadow maps for any lights which cover the specified areas.
              *
-             * @param boundingBoxes_worldSpace The world-space bounding boxes of areas to be invalidated
+             * Areas modified by static objects also invalidate the lights' cached static object shadow maps,
+             * whereas areas modified by dynamic objects only invalidate the lights' final shadow maps.
+             *
+             * @param staticBoundingBoxes_worldSpace The world-space bounding boxes of areas modified by static objects
+             * @param dynamicBoundingBoxes_worldSpace The world-space bounding boxes of areas modified by dynamic objects
              */
-            virtual void InvalidateShadowMapsByBounds(const std::vector<AABB>& boundingBoxes_worldSpace) = 0;
+            virtual void InvalidateShadowMapsByBounds(const std::vector<AABB>& staticBoundingBoxes_worldSpace,
+                                                      const std::vector<AABB>& dynamicBoundingBoxes_worldSpace) = 0;
 
             /**
              * Invalidates shadow maps for lights which depend on camera position (directional lights)
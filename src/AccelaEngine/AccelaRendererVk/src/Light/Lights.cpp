@@ -15,6 +15,7 @@
 
 #include <format>
 #include <algorithm>
+#include <iterator>
 #include <cassert>
 
 namespace Accela::Render
@@ -38,15 +39,15 @@ Lights::Lights(Common::ILogger::Ptr logger,
 
 void Lights::Destroy()
 {
-    for (const auto& light: m_lights)
+    for (auto& light: m_lights)
     {
-        if (light.second.shadowFrameBufferId)
-        {
-            m_framebuffers->DestroyFramebuffer(*light.second.shadowFrameBufferId, true);
-        }
+        DestroyShadowFramebuffers(light.second, true);
     }
 
     m_lights.clear();
+    m_sceneLightsBVH.clear();
+    m_shadowLightsBVH.RemoveAll();
+    m_lightTreeEntries.clear();
 }
 
 std::vector<LoadedLight> Lights::GetAllLights() const
@@ -65,21 +66,41 @@ std::vector<LoadedLight> Lights::GetSceneLights(const std::string& sceneName, co
 {
     std::vector<LoadedLight> result;
 
-    for (const auto& lightIt : m_lights)
+    const auto it = m_sceneLightsBVH.find(sceneName);
+    if (it == m_sceneLightsBVH.cend()) { return result; }
+
+    //
+    // Fetch the scene's lights whose max affect range overlaps the bounds of any of the view projections. Sorted,
+    // so that lights are returned in a consistent order between calls.
+    //
+    std::vector<LightId> candidateIds;
+
+    for (const auto& viewProjection : viewProjections)
     {
-        // If the light isn't for the requested scene, ignore it
-        if (lightIt.second.light.sceneName != sceneName)
-        {
-            continue;
-        }
+        std::ranges::copy(
+            it->second.FetchMatching(viewProjection.GetWorldSpaceAABB().GetVolume()),
+            std::back_inserter(candidateIds)
+        );
+    }
+
+    std::ranges::sort(candidateIds, {}, [](const LightId& lightId){ return lightId.id; });
+    const auto duplicates = std::ranges::unique(candidateIds);
+    candidateIds.erase(duplicates.begin(), duplicates.end());
+
+    //
+    // Refine the candidates against the lights' actual affect spheres
+    //
+    for (const auto& lightId : candidateIds)
+    {
+        const auto& loadedLight = m_lights.at(lightId);
 
         // If the light doesn't affect the view projection space, ignore it
-        if (!LightAffectsViewProjections(lightIt.second, viewProjections))
+        if (!LightAffectsViewProjections(loadedLight, viewProjections))
         {
             continue;
         }
 
-        result.push_back(lightIt.second);
+        result.push_back(loadedLight);
     }
 
     return result;
@@ -116,26 +137,19 @@ void Lights::ProcessAddedLights(const WorldUpdate& update, const VulkanCommandBu
             continue;
         }
 
-        std::optional<FrameBufferId> shadowFramebufferId;
+        auto loadedLight = LoadedLight(light, std::nullopt);
 
-        // If this light casts shadows, create a framebuffer for its shadow map
+        // If this light casts shadows, create framebuffers for its shadow map
         if (light.castsShadows)
         {
-            const auto framebufferExpect = CreateShadowFramebuffer(light, renderSettings);
-            if (!framebufferExpect)
+            if (!CreateShadowFramebuffers(loadedLight, renderSettings))
             {
                 m_logger->Log(Common::LogLevel::Error,
                   "Lights::ProcessAddedLights: Failed to create shadow framebuffer for light, id: ", light.lightId.id);
                 return;
             }
-            else
-            {
-                shadowFramebufferId = *framebufferExpect;
-            }
         }
 
-        auto loadedLight = LoadedLight(light, shadowFramebufferId);
-
         const auto shadowRenders = DetermineLightShadowRenders(loadedLight, RenderCamera{});
         if (!shadowRenders)
         {
@@ -147,6 +161,8 @@ void Lights::ProcessAddedLights(const WorldUpdate& update, const VulkanCommandBu
         loadedLight.shadowRenders = *shadowRenders;
 
         m_lights.insert({light.lightId, loadedLight});
+
+        IndexLight(loadedLight);
     }
 }
 
@@ -238,6 +254,7 @@ void Lights::ProcessUpdatedLights(const WorldUpdate& update, const VulkanCommand
             // TODO Perf: Only invalidate if light properties actually changed
             // TODO Perf: Only invalidate if something affecting shadow changed
             it->second.shadowInvalidated = true;
+            it->second.staticShadowInvalidated = true;
 
             // If the light's shadow map type changed recreate its framebuffer for the new type
             if (shadowMapTypeChanged)
@@ -248,6 +265,8 @@ void Lights::ProcessUpdatedLights(const WorldUpdate& update, const VulkanCommand
                         "Lights::ProcessUpdatedLights: Failed to recreate light framebuffer");
                 }
             }
+
+            IndexLight(it->second);
         }
         else
         {
@@ -269,11 +288,9 @@ void Lights::ProcessDeletedLights(const WorldUpdate& update, const VulkanCommand
             continue;
         }
 
-        if (it->second.shadowFrameBufferId)
-        {
-            m_framebuffers->DestroyFramebuffer(*it->second.shadowFrameBufferId, false);
-        }
+        DestroyShadowFramebuffers(it->second, false);
 
+        UnindexLight(lightId);
         m_lights.erase(lightId);
     }
 }
@@ -293,6 +310,9 @@ bool Lights::OnRenderSettingsChanged(const RenderSettings& renderSettings)
                 allSuccessful = false;
             }
         }
+
+        // Lights' affect ranges can depend on render settings
+        IndexLight(lightIt.second);
     }
 
     return allSuccessful;
@@ -305,37 +325,66 @@ std::vector<uint8_t> GetCubeFacesAffectedByLightCone(const Light& light)
     return std::vector<uint8_t>{0,1,2,3,4,5};
 }
 
-void Lights::InvalidateShadowMapsByBounds(const std::vector<AABB>& boundingBoxes_worldSpace)
+void Lights::InvalidateShadowMapsByBounds(const std::vector<AABB>& staticBoundingBoxes_worldSpace,
+                                          const std::vector<AABB>& dynamicBoundingBoxes_worldSpace)
 {
-    for (auto& lightIt : m_lights)
+    // Each updated bounding box is only tested against the shadow casting lights whose shadow renders' bounds overlap it
+    const auto fetchCandidateLights = [&](const AABB& boundingBox){
+        // Ignore bad/empty bounding boxes
+        if (boundingBox.IsEmpty()) { return std::vector<LightId>{}; }
+
+        return m_shadowLightsBVH.FetchMatching(boundingBox.GetVolume());
+    };
+
+    // Check if any of the updated static bounding boxes fall within any of a light's shadow maps. If
+    // so, both the light's cached static shadow map and its final shadow map need to be re-rendered.
+    for (const auto& boundingBox : staticBoundingBoxes_worldSpace)
     {
-        // If the light doesn't cast shadows, then there's no shadow map to be invalidated, ignore it
-        if (!lightIt.second.light.castsShadows) { continue; }
+        for (const auto& lightId : fetchCandidateLights(boundingBox))
+        {
+            auto& loadedLight = m_lights.at(lightId);
+
+            if (!loadedLight.staticShadowInvalidated && BoundsAffectShadowMap(loadedLight, boundingBox))
+            {
+                loadedLight.staticShadowInvalidated = true;
+                loadedLight.shadowInvalidated = true;
+            }
+        }
+    }
 
-        // Check if any of the updated bounding boxes fall within any of the light's shadow maps.
-        // If so, invalidate the affected shadow maps.
-        for (const auto& boundingBox : boundingBoxes_worldSpace)
+    // Check if any of the updated dynamic bounding boxes fall within any of a light's shadow maps. If
+    // so, only the light's final shadow map needs to be re-rendered.
+    for (const auto& boundingBox : dynamicBoundingBoxes_worldSpace)
+    {
+        for (const auto& lightId : fetchCandidateLights(boundingBox))
         {
-            // Ignore bad/empty bounding boxes
-            if (boundingBox.IsEmpty()) { continue; }
+            auto& loadedLight = m_lights.at(lightId);
 
-            switch (lightIt.second.shadowMapType)
+            if (!loadedLight.shadowInvalidated && BoundsAffectShadowMap(loadedLight, boundingBox))
             {
-                case ShadowMapType::Cascaded:
-                    InvalidateShadowMapsByBounds_Cascaded(lightIt.second, boundingBox.GetVolume());
-                break;
-                case ShadowMapType::Single:
-                    InvalidateShadowMapsByBounds_Single(lightIt.second, boundingBox.GetVolume());
-                break;
-                case ShadowMapType::Cube:
-                    InvalidateShadowMapsByBounds_Cube(lightIt.second, boundingBox.GetVolume());
-                break;
+                loadedLight.shadowInvalidated = true;
             }
         }
     }
 }
 
-void Lights::InvalidateShadowMapsByBounds_Single(LoadedLight& loadedLight, const Volume& volume_worldSpace)
+bool Lights::BoundsAffectShadowMap(const LoadedLight& loadedLight, const AABB& boundingBox_worldSpace)
+{
+    // Ignore bad/empty bounding boxes
+    if (boundingBox_worldSpace.IsEmpty()) { return false; }
+
+    switch (loadedLight.shadowMapType)
+    {
+        case ShadowMapType::Cascaded: return BoundsAffectShadowMap_Cascaded(loadedLight, boundingBox_worldSpace.GetVolume());
+        case ShadowMapType::Single: return BoundsAffectShadowMap_Single(loadedLight, boundingBox_worldSpace.GetVolume());
+        case ShadowMapType::Cube: return BoundsAffectShadowMap_Cube(loadedLight, boundingBox_worldSpace.GetVolume());
+    }
+
+    assert(false);
+    return true;
+}
+
+bool Lights::BoundsAffectShadowMap_Single(const LoadedLight& loadedLight, const Volume& volume_worldSpace)
 {
     const bool volumeTriviallyOutsideAllShadowRenders = std::ranges::all_of(loadedLight.shadowRenders, [&](const auto& shadowRender){
         return VolumeTriviallyOutsideProjection(
@@ -344,13 +393,10 @@ void Lights::InvalidateShadowMapsByBounds_Single(LoadedLight& loadedLight, const
         );
     });
 
-    if (!volumeTriviallyOutsideAllShadowRenders)
-    {
-        loadedLight.shadowInvalidated = true;
-    }
+    return !volumeTriviallyOutsideAllShadowRenders;
 }
 
-void Lights::InvalidateShadowMapsByBounds_Cascaded(LoadedLight& loadedLight, const Volume& volume_worldSpace)
+bool Lights::BoundsAffectShadowMap_Cascaded(const LoadedLight& loadedLight, const Volume& volume_worldSpace)
 {
     const bool volumeTriviallyOutsideAllShadowRenders = std::ranges::all_of(loadedLight.shadowRenders, [&](const auto& shadowRender){
         return VolumeTriviallyOutsideProjection(
@@ -359,13 +405,10 @@ void Lights::InvalidateShadowMapsByBounds_Cascaded(LoadedLight& loadedLight, con
         );
     });
 
-    if (!volumeTriviallyOutsideAllShadowRenders)
-    {
-        loadedLight.shadowInvalidated = true;
-    }
+    return !volumeTriviallyOutsideAllShadowRenders;
 }
 
-void Lights::InvalidateShadowMapsByBounds_Cube(LoadedLight& loadedLight, const Volume& volume_worldSpace)
+bool Lights::BoundsAffectShadowMap_Cube(const LoadedLight& loadedLight, const Volume& volume_worldSpace)
 {
     // Get the list of shadow map cube faces that the light's cone touches. We only need to evaluate
     // shadow renders that the light can possibly affect.
@@ -378,10 +421,7 @@ void Lights::InvalidateShadowMapsByBounds_Cube(LoadedLight& loadedLight, const V
         );
     });
 
-    if (!volumeTriviallyOutsideAllLitFaces)
-    {
-        loadedLight.shadowInvalidated = true;
-    }
+    return !volumeTriviallyOutsideAllLitFaces;
 }
 
 void Lights::UpdateShadowMapsForCamera(const RenderCamera& renderCamera)
@@ -403,7 +443,8 @@ void Lights::UpdateShadowMapsForCamera(const RenderCamera& renderCamera)
                     continue;
                 }
 
-                // Otherwise, as cascaded shadows depend on camera properties, update and invalidated the shadow renders
+                // Otherwise, as cascaded shadows depend on camera properties, update and invalidated the shadow renders.
+                // The cached static shadow renders are also invalidated, as the cascades' projections have moved.
                 const auto shadowRenders = DetermineLightShadowRenders(lightIt.second, renderCamera);
                 if (!shadowRenders)
                 {
@@ -414,6 +455,9 @@ void Lights::UpdateShadowMapsForCamera(const RenderCamera& renderCamera)
                 lightIt.second.shadowRenders = *shadowRenders;
                 lightIt.second.shadowRenderCamera = renderCamera;
                 lightIt.second.shadowInvalidated = true;
+                lightIt.second.staticShadowInvalidated = true;
+
+                IndexLight(lightIt.second);
             }
             break;
             case ShadowMapType::Single:
@@ -441,13 +485,24 @@ void Lights::OnShadowMapSynced(const LightId& lightId)
     }
 
     it->second.shadowInvalidated = false;
+    it->second.staticShadowInvalidated = false;
 }
 
-std::expected<FrameBufferId, bool> Lights::CreateShadowFramebuffer(const Light& light, const RenderSettings& renderSettings) const
+std::expected<FrameBufferId, bool> Lights::CreateShadowFramebuffer(const Light& light,
+                                                                   const RenderSettings& renderSettings,
+                                                                   ShadowCasters shadowCasters) const
 {
     const auto framebufferId = m_ids->frameBufferIds.GetId();
     const auto shadowFramebufferSize = GetShadowFramebufferSize(renderSettings);
-    const auto tag = std::format("Shadow-{}", light.lightId.id);
+    const auto tag = shadowCasters == ShadowCasters::Static ? std::format("ShadowStatic-{}", light.lightId.id)
+                                                            : std::format("Shadow-{}", light.lightId.id);
+
+    // When shadow caching is enabled, the light's static objects shadow map is copied into its final shadow
+    // map before moving objects are rendered on top of it
+    VkImageUsageFlags vkImageUsageFlags = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+
+    if (shadowCasters == ShadowCasters::Static) { vkImageUsageFlags |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT; }
+    else if (renderSettings.shadowCaching)      { vkImageUsageFlags |= VK_IMAGE_USAGE_TRANSFER_DST_BIT; }
 
     std::vector<std::pair<ImageDefinition, std::string>> attachments;
 
@@ -476,7 +531,7 @@ std::expected<FrameBufferId, bool> Lights::CreateShadowFramebuffer(const Light&
                 .vkImageType = VK_IMAGE_TYPE_2D,
                 .vkFormat = m_vulkanObjs->GetPhysicalDevice()->GetDepthBufferFormat(),
                 .vkImageTiling = VK_IMAGE_TILING_OPTIMAL,
-                .vkImageUsageFlags = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                .vkImageUsageFlags = vkImageUsageFlags,
                 .size = shadowFramebufferSize,
                 .numLayers = numLayers,
                 .vmaAllocationCreateFlags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT
@@ -500,7 +555,7 @@ std::expected<FrameBufferId, bool> Lights::CreateShadowFramebuffer(const Light&
                 .vkImageType = VK_IMAGE_TYPE_2D,
                 .vkFormat = m_vulkanObjs->GetPhysicalDevice()->GetDepthBufferFormat(),
                 .vkImageTiling = VK_IMAGE_TILING_OPTIMAL,
-                .vkImageUsageFlags = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                .vkImageUsageFlags = vkImageUsageFlags,
                 .size = shadowFramebufferSize,
                 .numLayers = 1,
                 .vmaAllocationCreateFlags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT
@@ -524,7 +579,7 @@ std::expected<FrameBufferId, bool> Lights::CreateShadowFramebuffer(const Light&
                 .vkImageType = VK_IMAGE_TYPE_2D,
                 .vkFormat = m_vulkanObjs->GetPhysicalDevice()->GetDepthBufferFormat(),
                 .vkImageTiling = VK_IMAGE_TILING_OPTIMAL,
-                .vkImageUsageFlags = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                .vkImageUsageFlags = vkImageUsageFlags,
                 .size = shadowFramebufferSize,
                 .numLayers = 6,
                 .cubeCompatible = true,
@@ -564,30 +619,159 @@ std::expected<FrameBufferId, bool> Lights::CreateShadowFramebuffer(const Light&
     return framebufferId;
 }
 
-bool Lights::RecreateShadowFramebuffer(LoadedLight& loadedLight, const RenderSettings& renderSettings) const
+bool Lights::CreateShadowFramebuffers(LoadedLight& loadedLight, const RenderSettings& renderSettings) const
+{
+    const auto framebufferExpect = CreateShadowFramebuffer(loadedLight.light, renderSettings, ShadowCasters::All);
+    if (!framebufferExpect)
+    {
+        return false;
+    }
+
+    loadedLight.shadowFrameBufferId = *framebufferExpect;
+
+    // If shadow caching is enabled, also create a framebuffer to hold the shadow map of only static objects
+    if (renderSettings.shadowCaching)
+    {
+        const auto staticFramebufferExpect = CreateShadowFramebuffer(loadedLight.light, renderSettings, ShadowCasters::Static);
+        if (!staticFramebufferExpect)
+        {
+            DestroyShadowFramebuffers(loadedLight, false);
+            return false;
+        }
+
+        loadedLight.staticShadowFrameBufferId = *staticFramebufferExpect;
+    }
+
+    loadedLight.shadowInvalidated = true;
+    loadedLight.staticShadowInvalidated = true;
+
+    return true;
+}
+
+void Lights::DestroyShadowFramebuffers(LoadedLight& loadedLight, bool destroyImmediately) const
 {
-    // Destroy any existing framebuffer
     if (loadedLight.shadowFrameBufferId)
     {
-        m_framebuffers->DestroyFramebuffer(*loadedLight.shadowFrameBufferId, false);
+        m_framebuffers->DestroyFramebuffer(*loadedLight.shadowFrameBufferId, destroyImmediately);
         loadedLight.shadowFrameBufferId = std::nullopt;
     }
 
-    // Create a new framebuffer
-    const auto framebufferExpect = CreateShadowFramebuffer(loadedLight.light, renderSettings);
-    if (!framebufferExpect)
+    if (loadedLight.staticShadowFrameBufferId)
+    {
+        m_framebuffers->DestroyFramebuffer(*loadedLight.staticShadowFrameBufferId, destroyImmediately);
+        loadedLight.staticShadowFrameBufferId = std::nullopt;
+    }
+}
+
+bool Lights::RecreateShadowFramebuffer(LoadedLight& loadedLight, const RenderSettings& renderSettings) const
+{
+    // Destroy any existing framebuffers
+    DestroyShadowFramebuffers(loadedLight, false);
+
+    // Create new framebuffers
+    if (!CreateShadowFramebuffers(loadedLight, renderSettings))
     {
         m_logger->Log(Common::LogLevel::Error,
           "Lights::RecreateShadowFramebuffer: Failed to create light shadow framebuffer, id: ", loadedLight.light.lightId.id);
         return false;
     }
 
-    loadedLight.shadowFrameBufferId = *framebufferExpect;
-    loadedLight.shadowInvalidated = true;
-
     return true;
 }
 
+void Lights::IndexLight(const LoadedLight& loadedLight)
+{
+    const auto& lightId = loadedLight.light.lightId;
+    auto& treeEntry = m_lightTreeEntries[lightId];
+
+    //
+    // Scene index. If the light moved to a different scene, it's moved to that scene's tree.
+    //
+    if (treeEntry.sceneProxyId != LightsBVH::NULL_PROXY && treeEntry.sceneName != loadedLight.light.sceneName)
+    {
+        m_sceneLightsBVH[treeEntry.sceneName].Remove(treeEntry.sceneProxyId);
+        treeEntry.sceneProxyId = LightsBVH::NULL_PROXY;
+    }
+
+    const auto affectVolume = GetLightAffectVolume(loadedLight);
+
+    if (treeEntry.sceneProxyId == LightsBVH::NULL_PROXY)
+    {
+        treeEntry.sceneName = loadedLight.light.sceneName;
+        treeEntry.sceneProxyId = m_sceneLightsBVH[treeEntry.sceneName].Insert(affectVolume, lightId);
+    }
+    else
+    {
+        m_sceneLightsBVH[treeEntry.sceneName].Update(treeEntry.sceneProxyId, affectVolume);
+    }
+
+    //
+    // Shadow index. Only lights which cast shadows have shadow renders to be invalidated.
+    //
+    const auto shadowVolume = GetShadowRendersVolume(loadedLight);
+
+    if (!shadowVolume)
+    {
+        if (treeEntry.shadowProxyId != LightsBVH::NULL_PROXY)
+        {
+            m_shadowLightsBVH.Remove(treeEntry.shadowProxyId);
+            treeEntry.shadowProxyId = LightsBVH::NULL_PROXY;
+        }
+    }
+    else if (treeEntry.shadowProxyId == LightsBVH::NULL_PROXY)
+    {
+        treeEntry.shadowProxyId = m_shadowLightsBVH.Insert(*shadowVolume, lightId);
+    }
+    else
+    {
+        m_shadowLightsBVH.Update(treeEntry.shadowProxyId, *shadowVolume);
+    }
+}
+
+void Lights::UnindexLight(const LightId& lightId)
+{
+    const auto it = m_lightTreeEntries.find(lightId);
+    if (it == m_lightTreeEntries.cend()) { return; }
+
+    if (it->second.sceneProxyId != LightsBVH::NULL_PROXY)
+    {
+        m_sceneLightsBVH[it->second.sceneName].Remove(it->second.sceneProxyId);
+    }
+
+    if (it->second.shadowProxyId != LightsBVH::NULL_PROXY)
+    {
+        m_shadowLightsBVH.Remove(it->second.shadowProxyId);
+    }
+
+    m_lightTreeEntries.erase(it);
+}
+
+Volume Lights::GetLightAffectVolume(const LoadedLight& loadedLight) const
+{
+    const auto maxAffectRange = GetLightMaxAffectRange(m_vulkanObjs->GetRenderSettings(), loadedLight.light);
+
+    return {
+        loadedLight.light.worldPos - glm::vec3(maxAffectRange),
+        loadedLight.light.worldPos + glm::vec3(maxAffectRange)
+    };
+}
+
+std::optional<Volume> Lights::GetShadowRendersVolume(const LoadedLight& loadedLight)
+{
+    if (!loadedLight.light.castsShadows || loadedLight.shadowRenders.empty()) { return std::nullopt; }
+
+    AABB shadowRendersAABB;
+
+    for (const auto& shadowRender : loadedLight.shadowRenders)
+    {
+        shadowRendersAABB.AddVolume(shadowRender.viewProjection.GetWorldSpaceAABB().GetVolume());
+    }
+
+    if (shadowRendersAABB.IsEmpty()) { return std::nullopt; }
+
+    return shadowRendersAABB.GetVolume();
+}
+
 bool Lights::LightAffectsViewProjections(const LoadedLight& loadedLight, const std::vector<ViewProjection>& viewProjections) const
 {
     const Sphere lightSphere(loadedLight.light.worldPos, GetLightMaxAffectRange(m_vulkanObjs->GetRenderSettings(), loadedLight.light));
@@ -9,6 +9,8 @@
 
 #include "ILights.h"
 
+#include "../Util/DynamicBVH.h"
+
 #include <Accela/Render/Ids.h>
 #include <Accela/Render/IOpenXR.h>
 
@@ -16,10 +18,13 @@
 #include <Accela/Common/Metrics/IMetrics.h>
 
 #include <expected>
+#include <string>
 #include <unordered_map>
 
 namespace Accela::Render
 {
+    using LightsBVH = DynamicBVH<LightId>;
+
     class Lights : public ILights
     {
         public:
@@ -40,10 +45,23 @@ namespace Accela::Render
             [[nodiscard]] std::optional<LoadedLight> GetLightById(const LightId& lightId) const override;
             void ProcessUpdate(const WorldUpdate& update, const VulkanCommandBufferPtr& commandBuffer, VkFence vkFence) override;
             [[nodiscard]] bool OnRenderSettingsChanged(const RenderSettings& renderSettings) override;
-            void InvalidateShadowMapsByBounds(const std::vector<AABB>& boundingBoxes_worldSpace) override;
+            void InvalidateShadowMapsByBounds(const std::vector<AABB>& staticBoundingBoxes_worldSpace,
+                                              const std::vector<AABB>& dynamicBoundingBoxes_worldSpace) override;
             void UpdateShadowMapsForCamera(const RenderCamera& renderCamera) override;
             void OnShadowMapSynced(const LightId& lightId) override;
 
+        private:
+
+            /**
+             * Where a light lives within the lights' spatial indices
+             */
+            struct LightTreeEntry
+            {
+                std::string sceneName;
+                LightsBVH::ProxyId sceneProxyId{LightsBVH::NULL_PROXY};
+                LightsBVH::ProxyId shadowProxyId{LightsBVH::NULL_PROXY};
+            };
+
         private:
 
             void ProcessAddedLights(const WorldUpdate& update, const VulkanCommandBufferPtr& commandBuffer, VkFence vkFence);
@@ -52,15 +70,25 @@ namespace Accela::Render
 
             [[nodiscard]] std::expected<std::vector<ShadowRender>, bool> DetermineLightShadowRenders(const LoadedLight& loadedLight, const RenderCamera& renderCamera);
 
-            [[nodiscard]] std::expected<FrameBufferId, bool> CreateShadowFramebuffer(const Light& light, const RenderSettings& renderSettings) const;
+            [[nodiscard]] std::expected<FrameBufferId, bool> CreateShadowFramebuffer(const Light& light,
+                                                                                     const RenderSettings& renderSettings,
+                                                                                     ShadowCasters shadowCasters) const;
+            [[nodiscard]] bool CreateShadowFramebuffers(LoadedLight& loadedLight, const RenderSettings& renderSettings) const;
+            void DestroyShadowFramebuffers(LoadedLight& loadedLight, bool destroyImmediately) const;
             [[nodiscard]] bool RecreateShadowFramebuffer(LoadedLight& loadedLight, const RenderSettings& renderSettings) const;
 
+            void IndexLight(const LoadedLight& loadedLight);
+            void UnindexLight(const LightId& lightId);
+            [[nodiscard]] Volume GetLightAffectVolume(const LoadedLight& loadedLight) const;
+            [[nodiscard]] static std::optional<Volume> GetShadowRendersVolume(const LoadedLight& loadedLight);
+
             [[nodiscard]] inline bool LightAffectsViewProjections(const LoadedLight& loadedLight,
                                                                   const std::vector<ViewProjection>& viewProjections) const;
 
-            static void InvalidateShadowMapsByBounds_Single(LoadedLight& loadedLight, const Volume& volume_worldSpace);
-            static void InvalidateShadowMapsByBounds_Cascaded(LoadedLight& loadedLight, const Volume& volume_worldSpace);
-            static void InvalidateShadowMapsByBounds_Cube(LoadedLight& loadedLight, const Volume& volume_worldSpace);
+            [[nodiscard]] static bool BoundsAffectShadowMap(const LoadedLight& loadedLight, const AABB& boundingBox_worldSpace);
+            [[nodiscard]] static bool BoundsAffectShadowMap_Single(const LoadedLight& loadedLight, const Volume& volume_worldSpace);
+            [[nodiscard]] static bool BoundsAffectShadowMap_Cascaded(const LoadedLight& loadedLight, const Volume& volume_worldSpace);
+            [[nodiscard]] static bool BoundsAffectShadowMap_Cube(const LoadedLight& loadedLight, const Volume& volume_worldSpace);
 
         private:
 
@@ -71,8 +99,16 @@ namespace Accela::Render
             IFramebuffersPtr m_framebuffers;
             Ids::Ptr m_ids;
 
-            // TODO: K-D Tree of light volumes for efficient fetching by volume
             std::unordered_map<LightId, LoadedLight> m_lights;
+
+            // Per-scene spatial index of the scene's lights, by the volume within their max affect range
+            std::unordered_map<std::string, LightsBVH> m_sceneLightsBVH;
+
+            // Spatial index of the shadow casting lights, by the volume covered by their shadow renders
+            LightsBVH m_shadowLightsBVH;
+
+            // Where each light lives within the spatial indices
+            std::unordered_map<LightId, LightTreeEntry> m_lightTreeEntries;
     };
 }
 
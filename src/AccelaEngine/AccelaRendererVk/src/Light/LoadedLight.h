@@ -30,6 +30,13 @@ namespace Accela::Render
         Cube        // Multi-viewed, cubic, shadow map
     };
 
+    enum class ShadowCasters
+    {
+        All,        // Every object which casts shadows
+        Static,     // Only shadow casting objects which have never moved
+        Dynamic     // Only shadow casting objects which have moved
+    };
+
     struct ShadowRender
     {
         // The world position the shadow render is taken from
@@ -71,12 +78,18 @@ namespace Accela::Render
         // If true, the light's shadow renders are out of date and need to be rendered
         bool shadowInvalidated{true};
 
+        // If true, the light's cached static object shadow renders are out of date and need to be rendered
+        bool staticShadowInvalidated{true};
+
         // Whether the light uses cascaded or cubic shadow maps
         ShadowMapType shadowMapType;
 
         // Framebuffer which binds shadow render(s) for the light
         std::optional<FrameBufferId> shadowFrameBufferId;
 
+        // Framebuffer which binds the cached shadow render(s) of only static objects, if shadow caching is enabled
+        std::optional<FrameBufferId> staticShadowFrameBufferId;
+
         // Details of each shadow render which is associated with the light
         std::vector<ShadowRender> shadowRenders;
 
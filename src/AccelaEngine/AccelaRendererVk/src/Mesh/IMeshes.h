@@ -34,6 +34,13 @@ namespace Accela::Render
             [[nodiscard]] virtual bool UpdateMesh(const Mesh::Ptr& mesh, std::promise<bool> resultPromise) = 0;
             [[nodiscard]] virtual std::optional<LoadedMesh> GetLoadedMesh(MeshId meshId) const = 0;
             virtual void DestroyMesh(MeshId meshId, bool destroyImmediately) = 0;
+
+            /**
+             * Performs an incremental step of compacting the buffers which hold immutable meshes; moves
+             * a mesh from the end of a buffer into free space left behind by destroyed meshes, and shrinks
+             * buffers which have trailing free space.
+             */
+            virtual void CompactImmutableBuffers() = 0;
     };
 }
 
@@ -14,12 +14,28 @@
 #include <Accela/Render/Id.h>
 
 #include <Accela/Render/Mesh/Mesh.h>
+#include <Accela/Render/Mesh/MeshLOD.h>
 
+#include <glm/glm.hpp>
+
+#include <array>
+#include <vector>
+#include <memory>
 #include <cstdint>
 #include <optional>
 
 namespace Accela::Render
 {
+    /**
+     * Compact CPU-side copy of a mesh's triangles, at its lowest detail LOD, which the mesh's occluder
+     * objects are rasterized from during CPU occlusion culling
+     */
+    struct OccluderGeometry
+    {
+        std::vector<glm::vec3> positions;
+        std::vector<uint32_t> indices;
+    };
+
     struct LoadedMesh
     {
         MeshId id{INVALID_ID};
@@ -43,6 +59,12 @@ namespace Accela::Render
         std::size_t dataByteSize{0};                // Total byte-size of the mesh's payload data (not of the buffer containing it)
 
         AABB boundingBox_modelSpace{};      // The mesh's axially-aligned, model space, bounding box
+
+        std::array<MeshLOD, MAX_MESH_LODS> lods{};  // The mesh's LODs. Index ranges are relative to indicesOffset.
+        std::size_t numLODs{0};                     // Number of valid entries in lods
+
+        // The mesh's occluder geometry, if it's simple enough to be used as an occluder
+        std::shared_ptr<const OccluderGeometry> occluderGeometry;
     };
 }
 
@@ -12,6 +12,7 @@
 #include "../Buffer/IBuffers.h"
 #include "../Buffer/CPUDataBuffer.h"
 #include "../Buffer/GPUDataBuffer.h"
+#include "../Buffer/UploadScheduler.h"
 
 #include "../Util/VulkanFuncs.h"
 #include "../Util/Futures.h"
@@ -22,22 +23,33 @@
 #include <format>
 #include <cstring>
 #include <algorithm>
+#include <unordered_map>
 
 namespace Accela::Render
 {
 
+// Meshes with no occluder-eligible LOD of at most this many triangles are too expensive to be used as occluders
+static constexpr uint32_t MAX_OCCLUDER_TRIANGLE_COUNT = 4096;
+
+// Maximum geometric error, relative to a mesh's bounding radius, that a simplified LOD may have and still be
+// used as an occluder. Simplified LODs aren't contained within the full detail mesh, so a LOD with more error
+// than this could occlude objects that the full detail mesh doesn't.
+static constexpr float MAX_OCCLUDER_LOD_ERROR = 0.005f;
+
 Meshes::Meshes(Common::ILogger::Ptr logger,
                Common::IMetrics::Ptr metrics,
                VulkanObjsPtr vulkanObjs,
                Ids::Ptr ids,
                PostExecutionOpsPtr postExecutionOps,
-               IBuffersPtr buffers)
+               IBuffersPtr buffers,
+               UploadSchedulerPtr uploadScheduler)
     : m_logger(std::move(logger))
     , m_metrics(std::move(metrics))
     , m_vulkanObjs(std::move(vulkanObjs))
     , m_ids(std::move(ids))
     , m_postExecutionOps(std::move(postExecutionOps))
     , m_buffers(std::move(buffers))
+    , m_uploadScheduler(std::move(uploadScheduler))
 {
 
 }
@@ -72,26 +84,22 @@ void Meshes::Destroy()
     //
     m_logger->Log(Common::LogLevel::Info, "Meshes: Destroying immutable buffers");
 
-    for (const auto& it : m_immutableMeshVertexBuffers)
-    {
-        m_buffers->DestroyBuffer(it.second->GetBuffer()->GetBufferId());
-    }
-    m_immutableMeshVertexBuffers.clear();
-
-    for (const auto& it : m_immutableMeshIndexBuffers)
+    for (const auto& it : m_immutableMeshBuffers)
     {
-        m_buffers->DestroyBuffer(it.second->GetBuffer()->GetBufferId());
-    }
-    m_immutableMeshIndexBuffers.clear();
+        m_buffers->DestroyBuffer(it.second.vertexBuffer.buffer->GetBuffer()->GetBufferId());
+        m_buffers->DestroyBuffer(it.second.indexBuffer.buffer->GetBuffer()->GetBufferId());
 
-    for (const auto& it : m_immutableMeshDataBuffers)
-    {
-        m_buffers->DestroyBuffer(it.second->GetBuffer()->GetBufferId());
+        if (it.second.dataBuffer)
+        {
+            m_buffers->DestroyBuffer(it.second.dataBuffer->buffer->GetBuffer()->GetBufferId());
+        }
     }
-    m_immutableMeshDataBuffers.clear();
+    m_immutableMeshBuffers.clear();
 
     m_meshesLoading.clear();
     m_meshesToDestroy.clear();
+    m_meshesRelocating.clear();
+    m_relocatedRangesPendingFree = 0;
 
     SyncMetrics();
 }
@@ -196,6 +204,8 @@ bool Meshes::LoadCPUMesh(const Mesh::Ptr& mesh)
     loadedMesh.dataByteOffset = 0;
     loadedMesh.dataByteSize = dataByteSize;
     loadedMesh.boundingBox_modelSpace = CalculateRenderBoundingBox(mesh);
+    SetLoadedMeshLODs(loadedMesh, mesh);
+    SetLoadedMeshOccluderGeometry(loadedMesh, mesh);
 
     if (!TransferCPUMeshData(loadedMesh, mesh))
     {
@@ -306,6 +316,8 @@ bool Meshes::LoadGPUMesh(const Mesh::Ptr& mesh, std::promise<bool> resultPromise
     loadedMesh.dataByteOffset = 0;
     loadedMesh.dataByteSize = dataByteSize;
     loadedMesh.boundingBox_modelSpace = CalculateRenderBoundingBox(mesh);
+    SetLoadedMeshLODs(loadedMesh, mesh);
+    SetLoadedMeshOccluderGeometry(loadedMesh, mesh);
 
     // Create a record of the mesh
     m_meshes.insert({mesh->id, loadedMesh});
@@ -320,21 +332,46 @@ bool Meshes::LoadImmutableMesh(const Mesh::Ptr& mesh, std::promise<bool> resultP
 {
     m_logger->Log(Common::LogLevel::Info, "Meshes: Loading immutable mesh {}", mesh->id.id);
 
-    const auto verticesPayload = GetVerticesPayload(mesh);
-    const auto indicesPayload = GetIndicesPayload(mesh);
-    const auto dataPayload = GetDataPayload(mesh);
+    auto verticesPayload = GetVerticesPayload(mesh);
+    auto indicesPayload = GetIndicesPayload(mesh);
+    auto dataPayload = GetDataPayload(mesh);
+
+    if (verticesPayload.empty() || indicesPayload.empty())
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "Meshes: LoadImmutableMesh: Mesh has no vertices or indices: {}", mesh->id.id);
+        return ErrorResult(resultPromise);
+    }
 
     //
     // Ensure immutable buffers exist for the mesh type
     //
-    const auto meshBuffers = EnsureImmutableBuffers(mesh->type);
-    if (!meshBuffers)
+    const auto meshBuffersExpect = EnsureImmutableBuffers(mesh->type);
+    if (!meshBuffersExpect)
     {
         m_logger->Log(Common::LogLevel::Info,
           "Meshes: Failed to ensure immutable mesh buffers for mesh type {}", (unsigned int)mesh->type);
         return ErrorResult(resultPromise);
     }
 
+    auto& meshBuffers = **meshBuffersExpect;
+
+    if (dataPayload && !meshBuffers.dataBuffer)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "Meshes: LoadImmutableMesh: Mesh has a data payload but its mesh type doesn't support one: {}", mesh->id.id);
+        return ErrorResult(resultPromise);
+    }
+
+    //
+    // Allocate ranges within the immutable buffers to hold the mesh's data
+    //
+    auto& vertexBuffer = meshBuffers.vertexBuffer;
+    auto& indexBuffer = meshBuffers.indexBuffer;
+
+    const auto verticesOffset = AllocateImmutableRange(vertexBuffer, GetVerticesCount(mesh), mesh->id);
+    const auto indicesOffset = AllocateImmutableRange(indexBuffer, GetIndicesCount(mesh), mesh->id);
+
     //
     // Record a record of the mesh and start a transfer of its data to the GPU
     //
@@ -343,213 +380,582 @@ bool Meshes::LoadImmutableMesh(const Mesh::Ptr& mesh, std::promise<bool> resultP
     loadedMesh.meshType = mesh->type;
     loadedMesh.usage = MeshUsage::Immutable;
 
-    loadedMesh.verticesBuffer = meshBuffers->vertexBuffer;
+    loadedMesh.verticesBuffer = vertexBuffer.buffer;
     loadedMesh.numVertices = GetVerticesCount(mesh);
-    loadedMesh.verticesByteOffset = meshBuffers->vertexBuffer->GetDataByteSize();
-    loadedMesh.verticesOffset = 0; // Set further below
+    loadedMesh.verticesByteOffset = verticesOffset * vertexBuffer.elementByteSize;
+    loadedMesh.verticesOffset = verticesOffset;
     loadedMesh.verticesByteSize = verticesPayload.size();
 
-    loadedMesh.indicesBuffer = meshBuffers->indexBuffer;
+    loadedMesh.indicesBuffer = indexBuffer.buffer;
     loadedMesh.numIndices = GetIndicesCount(mesh);
-    loadedMesh.indicesByteOffset = meshBuffers->indexBuffer->GetDataByteSize();
-    loadedMesh.indicesOffset = meshBuffers->indexBuffer->GetDataByteSize() / sizeof(uint32_t);
+    loadedMesh.indicesByteOffset = indicesOffset * indexBuffer.elementByteSize;
+    loadedMesh.indicesOffset = indicesOffset;
     loadedMesh.indicesByteSize = indicesPayload.size();
 
-    loadedMesh.dataBuffer = meshBuffers->dataBuffer;
+    loadedMesh.dataBuffer = std::nullopt; // Provided further below
     loadedMesh.dataByteOffset = 0; // Provided further below
     loadedMesh.dataByteSize = 0; // Provided further below
 
     loadedMesh.boundingBox_modelSpace = CalculateRenderBoundingBox(mesh);
+    SetLoadedMeshLODs(loadedMesh, mesh);
+    SetLoadedMeshOccluderGeometry(loadedMesh, mesh);
 
-    switch (mesh->type)
+    // The byte size each buffer needs to be in order to contain all of its allocated ranges
+    const auto verticesRequiredByteSize = vertexBuffer.allocator.GetHighWaterMark() * vertexBuffer.elementByteSize;
+    const auto indicesRequiredByteSize = indexBuffer.allocator.GetHighWaterMark() * indexBuffer.elementByteSize;
+    std::size_t dataRequiredByteSize = 0;
+
+    if (meshBuffers.dataBuffer)
     {
-        case MeshType::Static:
-        {
-            loadedMesh.verticesOffset = meshBuffers->vertexBuffer->GetDataByteSize() / sizeof(StaticMeshVertexPayload);
-        }
-        break;
-        case MeshType::Bone:
+        auto& dataBuffer = *meshBuffers.dataBuffer;
+
+        loadedMesh.dataBuffer = dataBuffer.buffer;
+
+        if (dataPayload)
         {
-            loadedMesh.verticesOffset = meshBuffers->vertexBuffer->GetDataByteSize() / sizeof(BoneMeshVertexPayload);
+            const auto numDataElements = (dataPayload->size() + dataBuffer.elementByteSize - 1) / dataBuffer.elementByteSize;
+
+            loadedMesh.dataByteOffset = AllocateImmutableRange(dataBuffer, numDataElements, mesh->id) * dataBuffer.elementByteSize;
+            loadedMesh.dataByteSize = dataPayload->size();
         }
-        break;
-    }
 
-    if (dataPayload)
-    {
-        loadedMesh.dataByteOffset = (*meshBuffers->dataBuffer)->GetDataByteSize();
-        loadedMesh.dataByteSize = dataPayload->size();
+        dataRequiredByteSize = dataBuffer.allocator.GetHighWaterMark() * dataBuffer.elementByteSize;
     }
 
-    // Create a record of the mesh
+    // Create a record of the mesh and mark it as loading
     m_meshes.insert({mesh->id, loadedMesh});
+    m_meshesLoading.insert(mesh->id);
 
     SyncMetrics();
 
-    VulkanFuncs vulkanFuncs(m_logger, m_vulkanObjs);
+    //
+    // Queue the mesh's data to be uploaded in the next upload batch. The vertices, indices, and
+    // data payloads are packed together into one upload, back to back within the staging memory.
+    //
+    const auto indicesStagingOffset = verticesPayload.size();
+    const auto dataStagingOffset = indicesStagingOffset + indicesPayload.size();
+    const auto dataByteSize = dataPayload ? dataPayload->size() : 0;
 
-    // Submit the work to transfer the mesh data
-    return vulkanFuncs.QueueSubmit<bool>(
-        std::format("LoadImmutableMesh-{}", mesh->id.id),
-        m_postExecutionOps,
-        m_vkTransferQueue,
-        m_transferCommandPool,
-        [=,this](const VulkanCommandBufferPtr& commandBuffer, VkFence vkFence) {
-            const auto executionContext = ExecutionContext::GPU(commandBuffer, vkFence);
+    auto payloads = std::make_shared<std::vector<std::vector<unsigned char>>>();
+    payloads->push_back(std::move(verticesPayload));
+    payloads->push_back(std::move(indicesPayload));
+    if (dataPayload) { payloads->push_back(std::move(*dataPayload)); }
 
-            // Mark the mesh as loading
-            m_meshesLoading.insert(loadedMesh.id);
+    const auto resultPromisePtr = std::make_shared<std::promise<bool>>(std::move(resultPromise));
 
-            bool allSuccessful = true;
+    UploadScheduler::Upload upload{};
+    upload.tag = std::format("LoadImmutableMesh-{}", mesh->id.id);
+    upload.byteSize = dataStagingOffset + dataByteSize;
+    upload.writeFunc = [=](std::byte* pStagingData) {
+        std::size_t byteOffset = 0;
 
-            if (!meshBuffers->vertexBuffer->PushBack(executionContext, BufferAppend{.pData = verticesPayload.data(), .dataByteSize = verticesPayload.size()}))
-            {
-                m_logger->Log(Common::LogLevel::Error, "LoadImmutableMesh: Failed to push into vertex buffer");
-                allSuccessful = false;
-            }
+        for (const auto& payload : *payloads)
+        {
+            memcpy(pStagingData + byteOffset, payload.data(), payload.size());
+            byteOffset += payload.size();
+        }
+    };
+    upload.recordFunc = [=,this](const VulkanCommandBufferPtr& commandBuffer,
+                                 VkFence vkFence,
+                                 const BufferPtr& stagingBuffer,
+                                 std::size_t stagingByteOffset) {
+        const auto executionContext = ExecutionContext::GPU(commandBuffer, vkFence);
+
+        bool allSuccessful = true;
+
+        // Note that the buffers may have been grown (re-created) since the upload was queued, so their
+        // current underlying buffers are looked up at record time
+        if (!EnsureImmutableBufferSize(executionContext, loadedMesh.verticesBuffer, verticesRequiredByteSize) ||
+            !m_buffers->CopyBufferData(
+                stagingBuffer,
+                stagingByteOffset,
+                loadedMesh.verticesByteSize,
+                loadedMesh.verticesBuffer->GetBuffer(),
+                loadedMesh.verticesByteOffset,
+                VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                commandBuffer))
+        {
+            m_logger->Log(Common::LogLevel::Error, "LoadImmutableMesh: Failed to write into vertex buffer");
+            allSuccessful = false;
+        }
+
+        if (!EnsureImmutableBufferSize(executionContext, loadedMesh.indicesBuffer, indicesRequiredByteSize) ||
+            !m_buffers->CopyBufferData(
+                stagingBuffer,
+                stagingByteOffset + indicesStagingOffset,
+                loadedMesh.indicesByteSize,
+                loadedMesh.indicesBuffer->GetBuffer(),
+                loadedMesh.indicesByteOffset,
+                VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                commandBuffer))
+        {
+            m_logger->Log(Common::LogLevel::Error, "LoadImmutableMesh: Failed to write into index buffer");
+            allSuccessful = false;
+        }
 
-            if (!meshBuffers->indexBuffer->PushBack(executionContext, BufferAppend{.pData = indicesPayload.data(), .dataByteSize = indicesPayload.size()}))
+        if (dataByteSize > 0)
+        {
+            if (!EnsureImmutableBufferSize(executionContext, *loadedMesh.dataBuffer, dataRequiredByteSize) ||
+                !m_buffers->CopyBufferData(
+                    stagingBuffer,
+                    stagingByteOffset + dataStagingOffset,
+                    dataByteSize,
+                    (*loadedMesh.dataBuffer)->GetBuffer(),
+                    loadedMesh.dataByteOffset,
+                    VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                    VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                    commandBuffer))
             {
-                m_logger->Log(Common::LogLevel::Error, "LoadImmutableMesh: Failed to push into index buffer");
+                m_logger->Log(Common::LogLevel::Error, "LoadImmutableMesh: Failed to write into data buffer");
                 allSuccessful = false;
             }
+        }
 
-            if (dataPayload)
-            {
-                if (!(*meshBuffers->dataBuffer)->PushBack(executionContext, BufferAppend{.pData = dataPayload->data(), .dataByteSize = dataPayload->size()}))
-                {
-                    m_logger->Log(Common::LogLevel::Error, "LoadImmutableMesh: Failed to push into data buffer");
-                    allSuccessful = false;
-                }
-            }
+        return allSuccessful;
+    };
+    upload.finishedFunc = [=,this](bool uploadSuccessful) {
+        resultPromisePtr->set_value(OnMeshTransferFinished(uploadSuccessful, loadedMesh, true));
+    };
 
-            return allSuccessful;
-        },
-        [=,this](bool commandsSuccessful)
-        {
-            return OnMeshTransferFinished(commandsSuccessful, loadedMesh, true);
-        },
-        std::move(resultPromise),
-        EnqueueType::Frameless
-    );
+    m_uploadScheduler->Enqueue(std::move(upload));
+
+    return true;
 }
 
-std::expected<Meshes::ImmutableMeshBuffers, bool> Meshes::EnsureImmutableBuffers(const MeshType& meshType)
+std::expected<Meshes::ImmutableMeshBuffers*, bool> Meshes::EnsureImmutableBuffers(const MeshType& meshType)
 {
+    const auto it = m_immutableMeshBuffers.find(meshType);
+    if (it != m_immutableMeshBuffers.cend())
+    {
+        return &it->second;
+    }
+
     ImmutableMeshBuffers immutableMeshBuffers{};
 
+    std::size_t vertexByteSize = 0;
+    bool hasDataPayload = false;
+
+    switch (meshType)
+    {
+        case MeshType::Static:
+        {
+            vertexByteSize = sizeof(StaticMeshVertexPayload);
+            hasDataPayload = false;
+        }
+        break;
+        case MeshType::Bone:
+        {
+            vertexByteSize = sizeof(BoneMeshVertexPayload);
+            hasDataPayload = true;
+        }
+        break;
+    }
+
     //
     // Vertex Buffer
     //
-    const auto vertexBufferIt = m_immutableMeshVertexBuffers.find(meshType);
-    if (vertexBufferIt == m_immutableMeshVertexBuffers.cend())
+    const auto verticesBufferExpect = GPUDataBuffer::Create(
+        m_buffers,
+        m_postExecutionOps,
+        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+        VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+        VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+        1024,
+        std::format("GPUImmutableMeshVertices-{}", (unsigned int)meshType)
+    );
+    if (!verticesBufferExpect)
     {
-        const auto verticesBufferExpect = GPUDataBuffer::Create(
+        m_logger->Log(Common::LogLevel::Error,
+          std::format("Meshes: Failed to create immutable vertices buffer for mesh type: {}", (unsigned int)meshType));
+        return std::unexpected(false);
+    }
+
+    immutableMeshBuffers.vertexBuffer.buffer = *verticesBufferExpect;
+    immutableMeshBuffers.vertexBuffer.elementByteSize = vertexByteSize;
+
+    //
+    // Index Buffer
+    //
+    const auto indicesBufferExpect = GPUDataBuffer::Create(
+        m_buffers,
+        m_postExecutionOps,
+        VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+        VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+        VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+        1024,
+        std::format("GPUImmutableMeshIndices-{}", (unsigned int)meshType)
+    );
+    if (!indicesBufferExpect)
+    {
+        m_logger->Log(Common::LogLevel::Error, "Meshes: Failed to create immutable indices buffer for mesh type {}", (unsigned int)meshType);
+
+        m_buffers->DestroyBuffer(immutableMeshBuffers.vertexBuffer.buffer->GetBuffer()->GetBufferId());
+
+        return std::unexpected(false);
+    }
+
+    immutableMeshBuffers.indexBuffer.buffer = *indicesBufferExpect;
+    immutableMeshBuffers.indexBuffer.elementByteSize = sizeof(uint32_t);
+
+    //
+    // (Optional) Data Buffer
+    //
+    if (hasDataPayload)
+    {
+        const auto dataBufferExpect = GPUDataBuffer::Create(
             m_buffers,
             m_postExecutionOps,
-            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-            VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
             VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+            VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
             1024,
-            std::format("GPUImmutableMeshVertices-{}", (unsigned int)meshType)
+            std::format("GPUImmutableMeshData-{}", (unsigned int)meshType)
         );
-        if (!verticesBufferExpect)
+        if (!dataBufferExpect)
         {
             m_logger->Log(Common::LogLevel::Error,
-              std::format("Meshes: Failed to create immutable vertices buffer for mesh type: {}", (unsigned int)meshType));
+              "Meshes: Failed to create immutable data buffer for mesh type {}", (unsigned int)meshType);
+
+            m_buffers->DestroyBuffer(immutableMeshBuffers.vertexBuffer.buffer->GetBuffer()->GetBufferId());
+            m_buffers->DestroyBuffer(immutableMeshBuffers.indexBuffer.buffer->GetBuffer()->GetBufferId());
+
             return std::unexpected(false);
         }
 
-        immutableMeshBuffers.vertexBuffer = *verticesBufferExpect;
-        m_immutableMeshVertexBuffers[meshType] = *verticesBufferExpect;
+        ImmutableBuffer dataBuffer{};
+        dataBuffer.buffer = *dataBufferExpect;
+        dataBuffer.elementByteSize = sizeof(BoneMeshDataPayload);
+
+        immutableMeshBuffers.dataBuffer = std::move(dataBuffer);
     }
-    else
+
+    return &m_immutableMeshBuffers.insert({meshType, std::move(immutableMeshBuffers)}).first->second;
+}
+
+std::size_t Meshes::AllocateImmutableRange(ImmutableBuffer& immutableBuffer, std::size_t numElements, MeshId meshId)
+{
+    auto offset = immutableBuffer.allocator.Allocate(numElements, meshId.id);
+
+    // If there's no free range large enough, grow the buffer's space and try again, which can't fail
+    if (!offset)
+    {
+        const auto capacity = immutableBuffer.allocator.GetCapacity();
+
+        immutableBuffer.allocator.Grow(std::max(capacity * 2, capacity + numElements));
+
+        offset = immutableBuffer.allocator.Allocate(numElements, meshId.id);
+        assert(offset);
+    }
+
+    return *offset;
+}
+
+bool Meshes::EnsureImmutableBufferSize(const ExecutionContext& executionContext, const DataBufferPtr& buffer, std::size_t byteSize)
+{
+    if (buffer->GetDataByteSize() >= byteSize)
+    {
+        return true;
+    }
+
+    return buffer->Resize(executionContext, byteSize);
+}
+
+Meshes::ImmutableBuffer* Meshes::GetImmutableBuffer(ImmutableMeshBuffers& meshBuffers, ImmutableBufferType bufferType)
+{
+    switch (bufferType)
+    {
+        case ImmutableBufferType::Vertex: return &meshBuffers.vertexBuffer;
+        case ImmutableBufferType::Index: return &meshBuffers.indexBuffer;
+        case ImmutableBufferType::Data: return meshBuffers.dataBuffer ? &*meshBuffers.dataBuffer : nullptr;
+    }
+
+    assert(false);
+    return nullptr;
+}
+
+void Meshes::FreeImmutableRange(MeshType meshType, ImmutableBufferType bufferType, std::size_t offset)
+{
+    // Note: The buffers may have already been destroyed if we're shutting down, in which case there's nothing to free
+    const auto it = m_immutableMeshBuffers.find(meshType);
+    if (it == m_immutableMeshBuffers.cend())
+    {
+        return;
+    }
+
+    auto* pImmutableBuffer = GetImmutableBuffer(it->second, bufferType);
+    if (pImmutableBuffer == nullptr)
+    {
+        return;
+    }
+
+    if (!pImmutableBuffer->allocator.Free(offset))
+    {
+        m_logger->Log(Common::LogLevel::Warning,
+          "Meshes: FreeImmutableRange: No range allocated at offset {} for mesh type {}", offset, (unsigned int)meshType);
+    }
+}
+
+void Meshes::FreeImmutableMeshRanges(const LoadedMesh& loadedMesh)
+{
+    FreeImmutableRange(loadedMesh.meshType, ImmutableBufferType::Vertex, loadedMesh.verticesOffset);
+    FreeImmutableRange(loadedMesh.meshType, ImmutableBufferType::Index, loadedMesh.indicesOffset);
+
+    if (loadedMesh.dataBuffer && loadedMesh.dataByteSize > 0)
+    {
+        const auto it = m_immutableMeshBuffers.find(loadedMesh.meshType);
+        if (it != m_immutableMeshBuffers.cend() && it->second.dataBuffer)
+        {
+            FreeImmutableRange(loadedMesh.meshType, ImmutableBufferType::Data, loadedMesh.dataByteOffset / it->second.dataBuffer->elementByteSize);
+        }
+    }
+
+    SyncMetrics();
+}
+
+void Meshes::CompactImmutableBuffers()
+{
+    // Only one mesh is relocated at a time, to keep the amount of work per step small
+    if (!m_meshesRelocating.empty())
     {
-        immutableMeshBuffers.vertexBuffer = vertexBufferIt->second;
+        return;
+    }
+
+    // A relocated mesh's old range stays allocated, and tagged with the mesh, until its deferred free runs. Wait
+    // for that before planning more relocations, or the old range could be planned as a relocation of the mesh
+    // again.
+    if (m_relocatedRangesPendingFree > 0)
+    {
+        return;
     }
 
     //
-    // Index Buffer
+    // Move a mesh from the end of a buffer into free space earlier in the buffer
     //
-    const auto indexBufferIt = m_immutableMeshIndexBuffers.find(meshType);
-    if (indexBufferIt == m_immutableMeshIndexBuffers.cend())
+    for (auto& it : m_immutableMeshBuffers)
     {
-        const auto indicesBufferExpect = GPUDataBuffer::Create(
-            m_buffers,
-            m_postExecutionOps,
-            VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-            VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
-            VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
-            1024,
-            std::format("GPUImmutableMeshIndices-{}", (unsigned int)meshType)
-        );
-        if (!indicesBufferExpect)
+        for (const auto bufferType : {ImmutableBufferType::Vertex, ImmutableBufferType::Index, ImmutableBufferType::Data})
         {
-            m_logger->Log(Common::LogLevel::Error, "Meshes: Failed to create immutable indices buffer for mesh type {}", (unsigned int)meshType);
+            auto* pImmutableBuffer = GetImmutableBuffer(it.second, bufferType);
+            if (pImmutableBuffer == nullptr) { continue; }
 
-            m_buffers->DestroyBuffer(immutableMeshBuffers.vertexBuffer->GetBuffer()->GetBufferId());
-            m_immutableMeshVertexBuffers.erase(meshType);
+            const auto relocation = pImmutableBuffer->allocator.PlanRelocation();
+            if (!relocation) { continue; }
 
-            return std::unexpected(false);
+            // Meshes which are still having their data transferred, or are pending destruction, are left where they are
+            const auto meshId = MeshId(static_cast<IdType>(relocation->userData));
+
+            if (m_meshesLoading.contains(meshId) || !m_meshes.contains(meshId))
+            {
+                (void)pImmutableBuffer->allocator.Free(relocation->toOffset);
+                continue;
+            }
+
+            if (RelocateImmutableMesh(it.first, bufferType, *relocation))
+            {
+                return;
+            }
         }
+    }
 
-        immutableMeshBuffers.indexBuffer = *indicesBufferExpect;
-        m_immutableMeshIndexBuffers[meshType] = *indicesBufferExpect;
+    //
+    // Nothing can be moved; release any free space at the end of the buffers
+    //
+    for (const auto& it : m_immutableMeshBuffers)
+    {
+        ShrinkImmutableBuffers(it.first);
     }
-    else
+}
+
+bool Meshes::RelocateImmutableMesh(MeshType meshType,
+                                   ImmutableBufferType bufferType,
+                                   const RangeAllocator::Relocation& relocation)
+{
+    auto* pImmutableBuffer = GetImmutableBuffer(m_immutableMeshBuffers.at(meshType), bufferType);
+
+    const auto meshId = MeshId(static_cast<IdType>(relocation.userData));
+    const auto loadedMesh = m_meshes.at(meshId);
+    const auto buffer = pImmutableBuffer->buffer;
+    const auto elementByteSize = pImmutableBuffer->elementByteSize;
+
+    VkPipelineStageFlagBits vkFirstUsageStage = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+    VkPipelineStageFlagBits vkLastUsageStage = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+
+    if (bufferType == ImmutableBufferType::Data)
     {
-        immutableMeshBuffers.indexBuffer = indexBufferIt->second;
+        vkLastUsageStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
     }
 
+    m_logger->Log(Common::LogLevel::Debug,
+      "Meshes: Relocating immutable mesh {} data from offset {} to offset {}", meshId.id, relocation.fromOffset, relocation.toOffset);
+
+    m_meshesRelocating.insert(meshId);
+    SyncMetrics();
+
+    VulkanFuncs vulkanFuncs(m_logger, m_vulkanObjs);
+
+    // Submit the work to copy the mesh's data to its new location. Note that the source and destination
+    // ranges never overlap, as the destination was a free range.
+    const bool submitSuccessful = vulkanFuncs.QueueSubmit(
+        std::format("RelocateImmutableMesh-{}", meshId.id),
+        m_postExecutionOps,
+        m_vkTransferQueue,
+        m_transferCommandPool,
+        [=,this](const VulkanCommandBufferPtr& commandBuffer, VkFence) {
+            return m_buffers->CopyBufferData(
+                buffer->GetBuffer(),
+                relocation.fromOffset * elementByteSize,
+                relocation.size * elementByteSize,
+                buffer->GetBuffer(),
+                relocation.toOffset * elementByteSize,
+                vkFirstUsageStage,
+                vkLastUsageStage,
+                commandBuffer
+            );
+        },
+        [=,this](bool commandsSuccessful)
+        {
+            OnImmutableMeshRelocated(commandsSuccessful, loadedMesh, bufferType, relocation);
+        },
+        EnqueueType::Frameless
+    );
+
+    if (!submitSuccessful)
+    {
+        m_logger->Log(Common::LogLevel::Error, "Meshes: Failed to submit relocation of immutable mesh {}", meshId.id);
+
+        m_meshesRelocating.erase(meshId);
+        (void)pImmutableBuffer->allocator.Free(relocation.toOffset);
+        return false;
+    }
+
+    return true;
+}
+
+void Meshes::OnImmutableMeshRelocated(bool relocationSuccessful,
+                                      const LoadedMesh& preRelocationMesh,
+                                      ImmutableBufferType bufferType,
+                                      const RangeAllocator::Relocation& relocation)
+{
+    const auto meshId = preRelocationMesh.id;
+    const auto meshType = preRelocationMesh.meshType;
+
+    m_meshesRelocating.erase(meshId);
+
     //
-    // (Optional) Data Buffer
+    // If the mesh was destroyed while it was being relocated, the range it was being moved into is released,
+    // and its (pre-relocation) objects are destroyed
     //
-    bool hasDataPayload = false;
+    if (m_meshesToDestroy.contains(meshId))
+    {
+        m_logger->Log(Common::LogLevel::Debug,
+          "Meshes::OnImmutableMeshRelocated: Mesh should be destroyed: {}", meshId.id);
 
-    switch (meshType)
+        m_meshesToDestroy.erase(meshId);
+
+        FreeImmutableRange(meshType, bufferType, relocation.toOffset);
+
+        m_postExecutionOps->Enqueue_Current([=, this]() { DestroyMeshObjects(preRelocationMesh); });
+
+        SyncMetrics();
+        return;
+    }
+
+    const auto buffersIt = m_immutableMeshBuffers.find(meshType);
+    const auto it = m_meshes.find(meshId);
+
+    if (!relocationSuccessful || buffersIt == m_immutableMeshBuffers.cend() || it == m_meshes.cend())
     {
-        case MeshType::Static: hasDataPayload = false; break;
-        case MeshType::Bone: hasDataPayload = true; break;
+        m_logger->Log(Common::LogLevel::Warning,
+          "Meshes::OnImmutableMeshRelocated: Relocation failed for mesh: {}", meshId.id);
+
+        FreeImmutableRange(meshType, bufferType, relocation.toOffset);
+        return;
     }
 
-    if (hasDataPayload)
+    //
+    // Point the mesh at its new location. Its old range is released once frames which might still be
+    // reading from it have finished.
+    //
+    auto& loadedMesh = it->second;
+
+    const auto elementByteSize = GetImmutableBuffer(buffersIt->second, bufferType)->elementByteSize;
+
+    switch (bufferType)
     {
-        const auto dataBufferIt = m_immutableMeshDataBuffers.find(meshType);
-        if (dataBufferIt == m_immutableMeshDataBuffers.cend())
+        case ImmutableBufferType::Vertex:
         {
-            const auto dataBufferExpect = GPUDataBuffer::Create(
-                m_buffers,
-                m_postExecutionOps,
-                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
-                VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
-                VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                1024,
-                std::format("GPUImmutableMeshData-{}", (unsigned int)meshType)
-            );
-            if (!dataBufferExpect)
-            {
-                m_logger->Log(Common::LogLevel::Error,
-                  "Meshes: Failed to create immutable data buffer for mesh type {}", (unsigned int)meshType);
+            loadedMesh.verticesOffset = relocation.toOffset;
+            loadedMesh.verticesByteOffset = relocation.toOffset * elementByteSize;
+        }
+        break;
+        case ImmutableBufferType::Index:
+        {
+            loadedMesh.indicesOffset = relocation.toOffset;
+            loadedMesh.indicesByteOffset = relocation.toOffset * elementByteSize;
+        }
+        break;
+        case ImmutableBufferType::Data:
+        {
+            loadedMesh.dataByteOffset = relocation.toOffset * elementByteSize;
+        }
+        break;
+    }
 
-                m_buffers->DestroyBuffer(immutableMeshBuffers.vertexBuffer->GetBuffer()->GetBufferId());
-                m_immutableMeshVertexBuffers.erase(meshType);
+    m_relocatedRangesPendingFree++;
 
-                m_buffers->DestroyBuffer(immutableMeshBuffers.indexBuffer->GetBuffer()->GetBufferId());
-                m_immutableMeshIndexBuffers.erase(meshType);
+    m_postExecutionOps->Enqueue_Current([=,this]() {
+        if (m_relocatedRangesPendingFree > 0) { m_relocatedRangesPendingFree--; }
+        FreeImmutableRange(meshType, bufferType, relocation.fromOffset);
+    });
 
-                return std::unexpected(false);
-            }
+    SyncMetrics();
+}
 
-            immutableMeshBuffers.dataBuffer = *dataBufferExpect;
-            m_immutableMeshDataBuffers[meshType] = *dataBufferExpect;
-        }
-        else
+void Meshes::ShrinkImmutableBuffers(MeshType meshType)
+{
+    auto& meshBuffers = m_immutableMeshBuffers.at(meshType);
+
+    std::vector<std::pair<DataBufferPtr, std::size_t>> toShrink;
+
+    for (const auto bufferType : {ImmutableBufferType::Vertex, ImmutableBufferType::Index, ImmutableBufferType::Data})
+    {
+        auto* pImmutableBuffer = GetImmutableBuffer(meshBuffers, bufferType);
+        if (pImmutableBuffer == nullptr) { continue; }
+
+        const auto byteSize = pImmutableBuffer->allocator.Trim() * pImmutableBuffer->elementByteSize;
+
+        if (byteSize < pImmutableBuffer->buffer->GetDataByteSize())
         {
-            immutableMeshBuffers.dataBuffer = dataBufferIt->second;
+            toShrink.emplace_back(pImmutableBuffer->buffer, byteSize);
         }
     }
 
-    return immutableMeshBuffers;
+    if (toShrink.empty())
+    {
+        return;
+    }
+
+    m_logger->Log(Common::LogLevel::Debug, "Meshes: Shrinking immutable buffers for mesh type {}", (unsigned int)meshType);
+
+    VulkanFuncs vulkanFuncs(m_logger, m_vulkanObjs);
+
+    (void)vulkanFuncs.QueueSubmit(
+        std::format("ShrinkImmutableBuffers-{}", (unsigned int)meshType),
+        m_postExecutionOps,
+        m_vkTransferQueue,
+        m_transferCommandPool,
+        [=](const VulkanCommandBufferPtr& commandBuffer, VkFence vkFence) {
+            const auto executionContext = ExecutionContext::GPU(commandBuffer, vkFence);
+
+            return std::ranges::all_of(toShrink, [&](const auto& shrink){
+                return shrink.first->Resize(executionContext, shrink.second);
+            });
+        },
+        std::nullopt,
+        EnqueueType::Frameless
+    );
 }
 
 std::vector<unsigned char> Meshes::GetVerticesPayload(const Mesh::Ptr& mesh)
@@ -688,6 +1094,8 @@ bool Meshes::UpdateMesh(const Mesh::Ptr& mesh, std::promise<bool> resultPromise)
     // Update CPU mesh state
     //
     it->second.boundingBox_modelSpace = CalculateRenderBoundingBox(mesh);
+    SetLoadedMeshLODs(it->second, mesh);
+    SetLoadedMeshOccluderGeometry(it->second, mesh);
 
     //
     // Update mesh buffer data
@@ -901,7 +1309,7 @@ void Meshes::DestroyMesh(MeshId meshId, bool destroyImmediately)
 
     // If a mesh's data transfer is still happening, we need to wait until the transfer has finished before
     // destroying the mesh's Vulkan objects. Mark the mesh as to be deleted and bail out.
-    if (m_meshesLoading.contains(meshId) && !destroyImmediately)
+    if ((m_meshesLoading.contains(meshId) || m_meshesRelocating.contains(meshId)) && !destroyImmediately)
     {
         m_logger->Log(Common::LogLevel::Debug, "Meshes: Postponing destroy of mesh: {}", meshId.id);
         m_meshesToDestroy.insert(meshId);
@@ -934,12 +1342,9 @@ void Meshes::DestroyMeshObjects(const LoadedMesh& loadedMesh)
         break;
         case MeshUsage::Immutable:
         {
-            // TODO: Currently don't support deleting immutable meshes. Need to keep better book-keeping
-            // so that we when destroy a mesh we can update the offsets as appropriate in the LoadedMeshes
-            // for the other meshes in the same immutable buffer that came after the deleted one. Also need
-            // to have logic to not destroy anything if we're shutting down; we don't want to queue up async
-            // GPU work if we're actively getting torn down, just rely on Meshes::Destroy() straight up
-            // destroying all the immutable buffers for us.
+            // Return the mesh's ranges to the immutable buffers' allocators; the space is re-used by future
+            // meshes and reclaimed by CompactImmutableBuffers. No GPU work is needed.
+            FreeImmutableMeshRanges(loadedMesh);
         }
         break;
     }
@@ -962,6 +1367,37 @@ void Meshes::SyncMetrics()
     }
 
     m_metrics->SetCounterValue(Renderer_Meshes_ByteSize, totalByteSize);
+
+    //
+    // Immutable buffer usage
+    //
+    m_metrics->SetCounterValue(Renderer_Meshes_Relocating_Count, m_meshesRelocating.size());
+
+    std::size_t immutableCapacityByteSize = 0;
+    std::size_t immutableFreeByteSize = 0;
+    std::size_t immutableFreeRangesCount = 0;
+    double maxFragmentation = 0.0;
+
+    for (auto& it : m_immutableMeshBuffers)
+    {
+        for (const auto bufferType : {ImmutableBufferType::Vertex, ImmutableBufferType::Index, ImmutableBufferType::Data})
+        {
+            const auto* pImmutableBuffer = GetImmutableBuffer(it.second, bufferType);
+            if (pImmutableBuffer == nullptr) { continue; }
+
+            const auto stats = pImmutableBuffer->allocator.GetStats();
+
+            immutableCapacityByteSize += stats.capacity * pImmutableBuffer->elementByteSize;
+            immutableFreeByteSize += stats.freeSize * pImmutableBuffer->elementByteSize;
+            immutableFreeRangesCount += stats.numFreeRanges;
+            maxFragmentation = std::max(maxFragmentation, (double)stats.fragmentation);
+        }
+    }
+
+    m_metrics->SetCounterValue(Renderer_Meshes_Immutable_Capacity_ByteSize, immutableCapacityByteSize);
+    m_metrics->SetCounterValue(Renderer_Meshes_Immutable_Free_ByteSize, immutableFreeByteSize);
+    m_metrics->SetCounterValue(Renderer_Meshes_Immutable_FreeRanges_Count, immutableFreeRangesCount);
+    m_metrics->SetDoubleValue(Renderer_Meshes_Immutable_Fragmentation, maxFragmentation);
 }
 
 template<typename T>
@@ -989,4 +1425,86 @@ AABB Meshes::CalculateRenderBoundingBox(const Mesh::Ptr& mesh)
     return {};
 }
 
+void Meshes::SetLoadedMeshLODs(LoadedMesh& loadedMesh, const Mesh::Ptr& mesh) const
+{
+    // By default, the mesh's full index range is its only LOD
+    loadedMesh.lods[0] = MeshLOD{.firstIndex = 0, .indexCount = static_cast<uint32_t>(loadedMesh.numIndices), .error = 0.0f};
+    loadedMesh.numLODs = 1;
+
+    if (mesh->lods.empty()) { return; }
+
+    const bool lodsValid = mesh->lods.size() <= MAX_MESH_LODS &&
+        std::ranges::all_of(mesh->lods, [&](const MeshLOD& lod){
+            return lod.indexCount > 0 && (std::size_t)lod.firstIndex + lod.indexCount <= loadedMesh.numIndices;
+        });
+
+    if (!lodsValid)
+    {
+        m_logger->Log(Common::LogLevel::Warning,
+          "Meshes::SetLoadedMeshLODs: Mesh {} has invalid LODs, ignoring them", mesh->id.id);
+        return;
+    }
+
+    std::ranges::copy(mesh->lods, loadedMesh.lods.begin());
+    loadedMesh.numLODs = mesh->lods.size();
+}
+
+void Meshes::SetLoadedMeshOccluderGeometry(LoadedMesh& loadedMesh, const Mesh::Ptr& mesh)
+{
+    loadedMesh.occluderGeometry = nullptr;
+
+    // Only static meshes can be occluders, as the CPU doesn't know the posed shape of bone meshes
+    if (mesh->type != MeshType::Static) { return; }
+
+    const auto staticMesh = std::dynamic_pointer_cast<StaticMesh>(mesh);
+    if (!staticMesh) { return; }
+
+    //
+    // Occluders are rasterized from the most detailed LOD which fits within the triangle budget, considering
+    // only the full detail LOD and simplified LODs whose geometric error is at most MAX_OCCLUDER_LOD_ERROR of
+    // the mesh's bounding radius. Meshes with no such LOD aren't used as occluders.
+    //
+    const MeshLOD* pLod = nullptr;
+
+    for (std::size_t x = 0; x < loadedMesh.numLODs; ++x)
+    {
+        const auto& candidate = loadedMesh.lods[x];
+
+        if (x > 0 && candidate.error > MAX_OCCLUDER_LOD_ERROR) { break; }
+        if (candidate.indexCount / 3 > MAX_OCCLUDER_TRIANGLE_COUNT) { continue; }
+
+        pLod = &candidate;
+        break;
+    }
+
+    if (pLod == nullptr) { return; }
+    const auto& lod = *pLod;
+
+    if ((std::size_t)lod.firstIndex + lod.indexCount > staticMesh->indices.size()) { return; }
+
+    //
+    // Copy the LOD's triangles, compacted down to only the vertices they reference
+    //
+    auto occluderGeometry = std::make_shared<OccluderGeometry>();
+    occluderGeometry->indices.reserve(lod.indexCount);
+
+    std::unordered_map<uint32_t, uint32_t> vertexRemap;
+
+    for (uint32_t x = lod.firstIndex; x < lod.firstIndex + lod.indexCount; ++x)
+    {
+        const auto vertexIndex = staticMesh->indices[x];
+        if (vertexIndex >= staticMesh->vertices.size()) { return; }
+
+        const auto [it, inserted] = vertexRemap.insert({vertexIndex, (uint32_t)occluderGeometry->positions.size()});
+        if (inserted)
+        {
+            occluderGeometry->positions.push_back(staticMesh->vertices[vertexIndex].position);
+        }
+
+        occluderGeometry->indices.push_back(it->second);
+    }
+
+    loadedMesh.occluderGeometry = std::move(occluderGeometry);
+}
+
 }
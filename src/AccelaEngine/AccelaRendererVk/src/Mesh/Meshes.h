@@ -13,6 +13,7 @@
 
 #include "../Util/ExecutionContext.h"
 #include "../Util/AABB.h"
+#include "../Util/RangeAllocator.h"
 
 #include <Accela/Render/Ids.h>
 
@@ -38,7 +39,8 @@ namespace Accela::Render
                    VulkanObjsPtr vulkanObjs,
                    Ids::Ptr ids,
                    PostExecutionOpsPtr postExecutionOps,
-                   IBuffersPtr buffers);
+                   IBuffersPtr buffers,
+                   UploadSchedulerPtr uploadScheduler);
 
             bool Initialize(VulkanCommandPoolPtr transferCommandPool,
                             VkQueue vkTransferQueue) override;
@@ -48,6 +50,7 @@ namespace Accela::Render
             [[nodiscard]] bool UpdateMesh(const Mesh::Ptr& mesh, std::promise<bool> resultPromise) override;
             [[nodiscard]] std::optional<LoadedMesh> GetLoadedMesh(MeshId meshId) const override;
             void DestroyMesh(MeshId meshId, bool destroyImmediately) override;
+            void CompactImmutableBuffers() override;
 
         private:
 
@@ -76,11 +79,29 @@ namespace Accela::Render
                 alignas(4) uint32_t numMeshBones{0};
             };
 
+            /**
+             * A GPU buffer shared by many immutable meshes, with an allocator which tracks which
+             * ranges of the buffer's elements are in use
+             */
+            struct ImmutableBuffer
+            {
+                DataBufferPtr buffer;
+                std::size_t elementByteSize{1};
+                RangeAllocator allocator;
+            };
+
             struct ImmutableMeshBuffers
             {
-                DataBufferPtr vertexBuffer;
-                DataBufferPtr indexBuffer;
-                std::optional<DataBufferPtr> dataBuffer;
+                ImmutableBuffer vertexBuffer;
+                ImmutableBuffer indexBuffer;
+                std::optional<ImmutableBuffer> dataBuffer;
+            };
+
+            enum class ImmutableBufferType
+            {
+                Vertex,
+                Index,
+                Data
             };
 
         private:
@@ -95,7 +116,23 @@ namespace Accela::Render
             [[nodiscard]] static std::size_t GetIndicesCount(const Mesh::Ptr& mesh);
             [[nodiscard]] static std::optional<std::vector<unsigned char>> GetDataPayload(const Mesh::Ptr& mesh);
 
-            [[nodiscard]] std::expected<ImmutableMeshBuffers, bool> EnsureImmutableBuffers(const MeshType& meshType);
+            [[nodiscard]] std::expected<ImmutableMeshBuffers*, bool> EnsureImmutableBuffers(const MeshType& meshType);
+            [[nodiscard]] static std::size_t AllocateImmutableRange(ImmutableBuffer& immutableBuffer, std::size_t numElements, MeshId meshId);
+            [[nodiscard]] static bool EnsureImmutableBufferSize(const ExecutionContext& executionContext,
+                                                                const DataBufferPtr& buffer,
+                                                                std::size_t byteSize);
+            [[nodiscard]] static ImmutableBuffer* GetImmutableBuffer(ImmutableMeshBuffers& meshBuffers, ImmutableBufferType bufferType);
+            void FreeImmutableRange(MeshType meshType, ImmutableBufferType bufferType, std::size_t offset);
+            void FreeImmutableMeshRanges(const LoadedMesh& loadedMesh);
+
+            [[nodiscard]] bool RelocateImmutableMesh(MeshType meshType,
+                                                     ImmutableBufferType bufferType,
+                                                     const RangeAllocator::Relocation& relocation);
+            void OnImmutableMeshRelocated(bool relocationSuccessful,
+                                          const LoadedMesh& preRelocationMesh,
+                                          ImmutableBufferType bufferType,
+                                          const RangeAllocator::Relocation& relocation);
+            void ShrinkImmutableBuffers(MeshType meshType);
 
             [[nodiscard]] bool TransferCPUMeshData(const LoadedMesh& loadedMesh, const Mesh::Ptr& newMeshData);
             [[nodiscard]] bool TransferGPUMeshData(const LoadedMesh& loadedMesh,
@@ -111,6 +148,8 @@ namespace Accela::Render
             void SyncMetrics();
 
             [[nodiscard]] static AABB CalculateRenderBoundingBox(const Mesh::Ptr& mesh);
+            void SetLoadedMeshLODs(LoadedMesh& loadedMesh, const Mesh::Ptr& mesh) const;
+            static void SetLoadedMeshOccluderGeometry(LoadedMesh& loadedMesh, const Mesh::Ptr& mesh);
 
         private:
 
@@ -120,6 +159,7 @@ namespace Accela::Render
             Ids::Ptr m_ids;
             PostExecutionOpsPtr m_postExecutionOps;
             IBuffersPtr m_buffers;
+            UploadSchedulerPtr m_uploadScheduler;
 
             VulkanCommandPoolPtr m_transferCommandPool;
             VkQueue m_vkTransferQueue{VK_NULL_HANDLE};
@@ -128,9 +168,11 @@ namespace Accela::Render
             std::unordered_set<MeshId> m_meshesLoading;
             std::unordered_set<MeshId> m_meshesToDestroy;
 
-            std::unordered_map<MeshType, DataBufferPtr> m_immutableMeshVertexBuffers;
-            std::unordered_map<MeshType, DataBufferPtr> m_immutableMeshIndexBuffers;
-            std::unordered_map<MeshType, DataBufferPtr> m_immutableMeshDataBuffers;
+            std::unordered_map<MeshType, ImmutableMeshBuffers> m_immutableMeshBuffers;
+            std::unordered_set<MeshId> m_meshesRelocating;
+            // Number of ranges that relocated meshes were moved out of, which are still allocated until frames
+            // which might be reading them have finished
+            std::size_t m_relocatedRangesPendingFree{0};
     };
 }
 
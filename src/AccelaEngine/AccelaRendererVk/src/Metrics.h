@@ -14,21 +14,39 @@ namespace Accela::Render
         static constexpr char Renderer_FrameRenderWork_Time[] = "Renderer_FrameRenderWork_Time";
         static constexpr char Renderer_Scene_Lights_Count[] = "Renderer_Scene_Lights_Count";
         static constexpr char Renderer_Scene_Shadow_Map_Count[] = "Renderer_Scene_Shadow_Map_Count";
+        static constexpr char Renderer_Shadow_Map_Renders_Count[] = "Renderer_Shadow_Map_Renders_Count";
+        static constexpr char Renderer_Shadow_Static_Map_Renders_Count[] = "Renderer_Shadow_Static_Map_Renders_Count";
         static constexpr char Renderer_Scene_Update_Time[] = "Renderer_Scene_Update_Time";
+        static constexpr char Renderer_Pick_Readback_ByteSize[] = "Renderer_Pick_Readback_ByteSize";
 
     // Object renderer
         static constexpr char Renderer_Object_Opaque_Objects_Rendered_Count[] = "Renderer_Object_Opaque_Objects_Rendered_Count";
         static constexpr char Renderer_Object_Opaque_RenderBatch_Count[] = "Renderer_Object_Opaque_RenderBatch_Count";
         static constexpr char Renderer_Object_Opaque_DrawCalls_Count[] = "Renderer_Object_Opaque_DrawCalls_Count";
+        static constexpr char Renderer_Object_Opaque_Triangles_Rendered_Count[] = "Renderer_Object_Opaque_Triangles_Rendered_Count";
+        static constexpr char Renderer_Object_Opaque_Occluders_Count[] = "Renderer_Object_Opaque_Occluders_Count";
+        static constexpr char Renderer_Object_Opaque_Occluder_Triangles_Count[] = "Renderer_Object_Opaque_Occluder_Triangles_Count";
+        static constexpr char Renderer_Object_Opaque_Occlusion_Tested_Count[] = "Renderer_Object_Opaque_Occlusion_Tested_Count";
+        static constexpr char Renderer_Object_Opaque_Occlusion_Culled_Count[] = "Renderer_Object_Opaque_Occlusion_Culled_Count";
         static constexpr char Renderer_Object_Transparent_Objects_Rendered_Count[] = "Renderer_Object_Transparent_Objects_Rendered_Count";
         static constexpr char Renderer_Object_Transparent_RenderBatch_Count[] = "Renderer_Object_Transparent_RenderBatch_Count";
         static constexpr char Renderer_Object_Transparent_DrawCalls_Count[] = "Renderer_Object_Transparent_DrawCalls_Count";
+        static constexpr char Renderer_Object_Transparent_Triangles_Rendered_Count[] = "Renderer_Object_Transparent_Triangles_Rendered_Count";
+        static constexpr char Renderer_Object_Transparent_Occluders_Count[] = "Renderer_Object_Transparent_Occluders_Count";
+        static constexpr char Renderer_Object_Transparent_Occluder_Triangles_Count[] = "Renderer_Object_Transparent_Occluder_Triangles_Count";
+        static constexpr char Renderer_Object_Transparent_Occlusion_Tested_Count[] = "Renderer_Object_Transparent_Occlusion_Tested_Count";
+        static constexpr char Renderer_Object_Transparent_Occlusion_Culled_Count[] = "Renderer_Object_Transparent_Occlusion_Culled_Count";
 
     // Meshes system
         static constexpr char Renderer_Meshes_Count[] = "Renderer_Meshes_Count";
         static constexpr char Renderer_Meshes_Loading_Count[] = "Renderer_Meshes_Loading_Count";
         static constexpr char Renderer_Meshes_ToDestroy_Count[] = "Renderer_Meshes_ToDestroy_Count";
         static constexpr char Renderer_Meshes_ByteSize[] = "Renderer_Meshes_ByteSize";
+        static constexpr char Renderer_Meshes_Relocating_Count[] = "Renderer_Meshes_Relocating_Count";
+        static constexpr char Renderer_Meshes_Immutable_Capacity_ByteSize[] = "Renderer_Meshes_Immutable_Capacity_ByteSize";
+        static constexpr char Renderer_Meshes_Immutable_Free_ByteSize[] = "Renderer_Meshes_Immutable_Free_ByteSize";
+        static constexpr char Renderer_Meshes_Immutable_FreeRanges_Count[] = "Renderer_Meshes_Immutable_FreeRanges_Count";
+        static constexpr char Renderer_Meshes_Immutable_Fragmentation[] = "Renderer_Meshes_Immutable_Fragmentation";
 
     // Images system
         static constexpr char Renderer_Images_Count[] = "Renderer_Images_Count";
@@ -48,6 +66,12 @@ namespace Accela::Render
         static constexpr char Renderer_Buffers_Count[] = "Renderer_Buffers_Count";
         static constexpr char Renderer_Buffers_ByteSize[] = "Renderer_Buffers_ByteSize";
 
+    // Upload scheduler
+        static constexpr char Renderer_Uploads_Pending_Count[] = "Renderer_Uploads_Pending_Count";
+        static constexpr char Renderer_Uploads_Pending_ByteSize[] = "Renderer_Uploads_Pending_ByteSize";
+        static constexpr char Renderer_Uploads_InFlight_Batch_Count[] = "Renderer_Uploads_InFlight_Batch_Count";
+        static constexpr char Renderer_Uploads_Staging_Used_ByteSize[] = "Renderer_Uploads_Staging_Used_ByteSize";
+
     // Memory usage
         static constexpr char Renderer_Memory_Usage[] = "Renderer_Memory_Usage";
         static constexpr char Renderer_Memory_Available[] = "Renderer_Memory_Available";
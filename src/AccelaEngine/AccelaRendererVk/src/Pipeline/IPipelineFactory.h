@@ -12,6 +12,9 @@
 #include "../ForwardDeclares.h"
 
 #include <expected>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace Accela::Render
 {
@@ -25,6 +28,14 @@ namespace Accela::Render
 
             virtual ~IPipelineFactory() = default;
 
+            /**
+             * @param pipelineCacheFilePath File that compiled pipeline data is persisted to between runs,
+             * or std::nullopt to not persist pipeline data.
+             *
+             * @return Whether the factory was initialized successfully
+             */
+            [[nodiscard]] virtual bool Initialize(const std::optional<std::string>& pipelineCacheFilePath) = 0;
+
             /**
              * @return The graphics pipeline, or nullptr on pipeline creation error
              */
@@ -37,6 +48,21 @@ namespace Accela::Render
             [[nodiscard]] virtual std::expected<VulkanPipelinePtr, bool> GetPipeline(const VulkanDevicePtr& device,
                                                                                      const ComputePipelineConfig& config) = 0;
 
+            /**
+             * Pre-creates pipelines for the provided configs on a background thread, so that they're
+             * ready by the time they're first requested. A request for a config that's still being
+             * warmed up blocks until its pipeline has been created.
+             */
+            virtual void WarmUp(const VulkanDevicePtr& device,
+                                const std::vector<GraphicsPipelineConfig>& graphicsConfigs,
+                                const std::vector<ComputePipelineConfig>& computeConfigs) = 0;
+
+            /**
+             * Writes the pipeline cache to disk if pipelines have been created since it was last
+             * written. Rate limited, so it's cheap to call often.
+             */
+            virtual void PersistCacheIfChanged() = 0;
+
             virtual void DestroyPipeline(const std::size_t& pipelineKey) = 0;
 
             /**
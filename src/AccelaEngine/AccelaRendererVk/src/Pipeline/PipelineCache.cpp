@@ -0,0 +1,288 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "PipelineCache.h"
+
+#include "../VulkanObjs.h"
+
+#include "../Vulkan/VulkanDevice.h"
+#include "../Vulkan/VulkanPhysicalDevice.h"
+
+#include <Accela/Render/IVulkanCalls.h>
+
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+
+namespace Accela::Render
+{
+
+static constexpr uint32_t PIPELINE_CACHE_FILE_MAGIC = 0x48435041; // "APCH"
+static constexpr uint32_t PIPELINE_CACHE_FILE_VERSION = 1;
+
+PipelineCache::PipelineCache(Common::ILogger::Ptr logger, VulkanObjsPtr vulkanObjs)
+    : m_logger(std::move(logger))
+    , m_vulkanObjs(std::move(vulkanObjs))
+{
+
+}
+
+bool PipelineCache::Initialize(const std::optional<std::string>& cacheFilePath)
+{
+    m_logger->Log(Common::LogLevel::Info, "PipelineCache: Initializing");
+
+    m_cacheFilePath = cacheFilePath;
+
+    //
+    // Load previously saved cache data, if any
+    //
+    std::optional<std::vector<std::byte>> cacheData;
+
+    if (m_cacheFilePath)
+    {
+        cacheData = LoadCacheData(*m_cacheFilePath);
+    }
+
+    //
+    // Create the pipeline cache
+    //
+    VkPipelineCacheCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+
+    if (cacheData)
+    {
+        createInfo.initialDataSize = cacheData->size();
+        createInfo.pInitialData = cacheData->data();
+    }
+
+    auto result = m_vulkanObjs->GetCalls()->vkCreatePipelineCache(
+        m_vulkanObjs->GetDevice()->GetVkDevice(), &createInfo, nullptr, &m_vkPipelineCache);
+
+    // If the driver rejected the saved data, fall back to an empty cache
+    if (result != VK_SUCCESS && cacheData)
+    {
+        m_logger->Log(Common::LogLevel::Warning,
+          "PipelineCache: Failed to create pipeline cache from saved data, result code: {}", (uint32_t)result);
+
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+
+        result = m_vulkanObjs->GetCalls()->vkCreatePipelineCache(
+            m_vulkanObjs->GetDevice()->GetVkDevice(), &createInfo, nullptr, &m_vkPipelineCache);
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "PipelineCache: vkCreatePipelineCache call failure, result code: {}", (uint32_t)result);
+        m_vkPipelineCache = VK_NULL_HANDLE;
+        return false;
+    }
+
+    return true;
+}
+
+void PipelineCache::Destroy()
+{
+    if (m_vkPipelineCache == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    m_logger->Log(Common::LogLevel::Info, "PipelineCache: Destroying");
+
+    (void)Save();
+
+    m_vulkanObjs->GetCalls()->vkDestroyPipelineCache(m_vulkanObjs->GetDevice()->GetVkDevice(), m_vkPipelineCache, nullptr);
+    m_vkPipelineCache = VK_NULL_HANDLE;
+}
+
+bool PipelineCache::Save() const
+{
+    if (!m_cacheFilePath || m_vkPipelineCache == VK_NULL_HANDLE)
+    {
+        return false;
+    }
+
+    //
+    // Fetch the cache's current data
+    //
+    const auto vkDevice = m_vulkanObjs->GetDevice()->GetVkDevice();
+
+    std::size_t dataByteSize = 0;
+
+    auto result = m_vulkanObjs->GetCalls()->vkGetPipelineCacheData(vkDevice, m_vkPipelineCache, &dataByteSize, nullptr);
+    if (result != VK_SUCCESS || dataByteSize == 0)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "PipelineCache::Save: Failed to query pipeline cache data size, result code: {}", (uint32_t)result);
+        return false;
+    }
+
+    std::vector<std::byte> data(dataByteSize);
+
+    result = m_vulkanObjs->GetCalls()->vkGetPipelineCacheData(vkDevice, m_vkPipelineCache, &dataByteSize, data.data());
+    if (result != VK_SUCCESS)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "PipelineCache::Save: Failed to fetch pipeline cache data, result code: {}", (uint32_t)result);
+        return false;
+    }
+
+    data.resize(dataByteSize);
+
+    //
+    // Write the header and data to a temporary file, then move it over the cache file, so that
+    // a crash mid-write can never leave a partially written cache file behind
+    //
+    FileHeader header = GetDeviceFileHeader();
+    header.dataByteSize = data.size();
+    header.dataChecksum = Checksum(data.data(), data.size());
+
+    const auto cacheFilePath = std::filesystem::path(*m_cacheFilePath);
+    const auto tempFilePath = std::filesystem::path(*m_cacheFilePath + ".tmp");
+
+    std::error_code ec;
+
+    if (cacheFilePath.has_parent_path())
+    {
+        std::filesystem::create_directories(cacheFilePath.parent_path(), ec);
+        if (ec)
+        {
+            m_logger->Log(Common::LogLevel::Error,
+              "PipelineCache::Save: Failed to create cache directory: {}", cacheFilePath.parent_path().string());
+            return false;
+        }
+    }
+
+    {
+        std::ofstream file(tempFilePath, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            m_logger->Log(Common::LogLevel::Error,
+              "PipelineCache::Save: Failed to open cache file for writing: {}", tempFilePath.string());
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+        file.write(reinterpret_cast<const char*>(data.data()), (std::streamsize)data.size());
+
+        if (!file)
+        {
+            m_logger->Log(Common::LogLevel::Error,
+              "PipelineCache::Save: Failed to write cache file: {}", tempFilePath.string());
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempFilePath, cacheFilePath, ec);
+    if (ec)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "PipelineCache::Save: Failed to replace cache file: {}", cacheFilePath.string());
+        std::filesystem::remove(tempFilePath, ec);
+        return false;
+    }
+
+    m_logger->Log(Common::LogLevel::Info, "PipelineCache: Saved {} bytes of pipeline cache data", data.size());
+
+    return true;
+}
+
+std::optional<std::vector<std::byte>> PipelineCache::LoadCacheData(const std::string& cacheFilePath) const
+{
+    std::ifstream file(cacheFilePath, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        m_logger->Log(Common::LogLevel::Info, "PipelineCache: No saved pipeline cache exists: {}", cacheFilePath);
+        return std::nullopt;
+    }
+
+    const auto fileByteSize = (std::size_t)file.tellg();
+    file.seekg(0);
+
+    //
+    // Validate the file's header against the current device
+    //
+    if (fileByteSize < sizeof(FileHeader))
+    {
+        m_logger->Log(Common::LogLevel::Warning, "PipelineCache: Ignoring truncated pipeline cache file: {}", cacheFilePath);
+        return std::nullopt;
+    }
+
+    FileHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(FileHeader));
+
+    const FileHeader deviceHeader = GetDeviceFileHeader();
+
+    const bool headerMatchesDevice =
+        header.magic == deviceHeader.magic &&
+        header.version == deviceHeader.version &&
+        header.vendorId == deviceHeader.vendorId &&
+        header.deviceId == deviceHeader.deviceId &&
+        header.driverVersion == deviceHeader.driverVersion &&
+        memcmp(header.pipelineCacheUUID, deviceHeader.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+
+    if (!headerMatchesDevice)
+    {
+        m_logger->Log(Common::LogLevel::Info,
+          "PipelineCache: Ignoring pipeline cache created by a different device or driver: {}", cacheFilePath);
+        return std::nullopt;
+    }
+
+    if (header.dataByteSize != fileByteSize - sizeof(FileHeader))
+    {
+        m_logger->Log(Common::LogLevel::Warning, "PipelineCache: Ignoring pipeline cache with invalid size: {}", cacheFilePath);
+        return std::nullopt;
+    }
+
+    //
+    // Read and validate the cache data
+    //
+    std::vector<std::byte> data(header.dataByteSize);
+    file.read(reinterpret_cast<char*>(data.data()), (std::streamsize)data.size());
+
+    if (!file || Checksum(data.data(), data.size()) != header.dataChecksum)
+    {
+        m_logger->Log(Common::LogLevel::Warning, "PipelineCache: Ignoring corrupt pipeline cache file: {}", cacheFilePath);
+        return std::nullopt;
+    }
+
+    m_logger->Log(Common::LogLevel::Info, "PipelineCache: Loaded {} bytes of pipeline cache data", data.size());
+
+    return data;
+}
+
+PipelineCache::FileHeader PipelineCache::GetDeviceFileHeader() const
+{
+    const auto& properties = m_vulkanObjs->GetPhysicalDevice()->GetPhysicalDeviceProperties();
+
+    FileHeader header{};
+    header.magic = PIPELINE_CACHE_FILE_MAGIC;
+    header.version = PIPELINE_CACHE_FILE_VERSION;
+    header.vendorId = properties.vendorID;
+    header.deviceId = properties.deviceID;
+    header.driverVersion = properties.driverVersion;
+    memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+    return header;
+}
+
+uint64_t PipelineCache::Checksum(const std::byte* pData, const std::size_t& byteSize)
+{
+    // 64-bit FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (std::size_t x = 0; x < byteSize; ++x)
+    {
+        hash ^= (uint64_t)pData[x];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+}
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERERVK_SRC_PIPELINE_PIPELINECACHE
+#define LIBACCELARENDERERVK_SRC_PIPELINE_PIPELINECACHE
+
+#include "../ForwardDeclares.h"
+
+#include <Accela/Common/Log/ILogger.h>
+
+#include <vulkan/vulkan.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace Accela::Render
+{
+    /**
+     * Wraps a VkPipelineCache which is persisted to disk between runs, so that the driver can skip
+     * recompiling pipelines it has compiled before.
+     *
+     * The cache data is written behind a header which records the vendor, device, driver version and
+     * pipeline cache UUID it was created with, along with a checksum of the data. A cache file which
+     * doesn't match the current device/driver, or which is corrupt, is discarded and the cache starts
+     * out empty.
+     */
+    class PipelineCache
+    {
+        public:
+
+            PipelineCache(Common::ILogger::Ptr logger, VulkanObjsPtr vulkanObjs);
+
+            /**
+             * Creates the pipeline cache, seeded with the data from the provided cache file, if it
+             * exists and is valid.
+             *
+             * @param cacheFilePath Path of the file the cache is loaded from and saved to, or std::nullopt
+             * to not persist the cache.
+             *
+             * @return Whether the pipeline cache was created successfully
+             */
+            [[nodiscard]] bool Initialize(const std::optional<std::string>& cacheFilePath);
+
+            /**
+             * Saves the pipeline cache to disk and destroys it
+             */
+            void Destroy();
+
+            /**
+             * Writes the current contents of the pipeline cache to the cache file
+             *
+             * @return Whether the cache was saved successfully
+             */
+            bool Save() const;
+
+            [[nodiscard]] VkPipelineCache GetVkPipelineCache() const noexcept { return m_vkPipelineCache; }
+
+        private:
+
+            struct FileHeader
+            {
+                uint32_t magic{0};
+                uint32_t version{0};
+                uint32_t vendorId{0};
+                uint32_t deviceId{0};
+                uint32_t driverVersion{0};
+                uint8_t pipelineCacheUUID[VK_UUID_SIZE]{};
+                uint64_t dataByteSize{0};
+                uint64_t dataChecksum{0};
+            };
+
+        private:
+
+            [[nodiscard]] std::optional<std::vector<std::byte>> LoadCacheData(const std::string& cacheFilePath) const;
+            [[nodiscard]] FileHeader GetDeviceFileHeader() const;
+
+            [[nodiscard]] static uint64_t Checksum(const std::byte* pData, const std::size_t& byteSize);
+
+        private:
+
+            Common::ILogger::Ptr m_logger;
+            VulkanObjsPtr m_vulkanObjs;
+
+            std::optional<std::string> m_cacheFilePath;
+            VkPipelineCache m_vkPipelineCache{VK_NULL_HANDLE};
+    };
+}
+
+#endif //LIBACCELARENDERERVK_SRC_PIPELINE_PIPELINECACHE
@@ -11,19 +11,43 @@
 #include "../Vulkan/VulkanPipeline.h"
 #include "../Vulkan/VulkanDevice.h"
 
+#include <Accela/Common/Thread/ThreadUtil.h>
+
 #include <functional>
+#include <format>
 
 namespace Accela::Render
 {
 
+// Minimum time between writes of the pipeline cache to disk while running
+static constexpr auto PIPELINE_CACHE_SAVE_INTERVAL = std::chrono::seconds(30);
+
 PipelineFactory::PipelineFactory(Common::ILogger::Ptr logger,
                                  VulkanObjsPtr vulkanObjs,
                                  IShadersPtr shaders)
     : m_logger(std::move(logger))
     , m_vulkanObjs(std::move(vulkanObjs))
     , m_shaders(std::move(shaders))
+    , m_pipelineCache(m_logger, m_vulkanObjs)
+{
+
+}
+
+bool PipelineFactory::Initialize(const std::optional<std::string>& pipelineCacheFilePath)
 {
+    m_logger->Log(Common::LogLevel::Info, "Pipelines: Initializing");
+
+    m_abortWarmUp = false;
+    m_pipelineCacheDirty = false;
+    m_lastPipelineCacheSave = std::chrono::steady_clock::now();
+
+    if (!m_pipelineCache.Initialize(pipelineCacheFilePath))
+    {
+        m_logger->Log(Common::LogLevel::Error, "Pipelines: Failed to initialize pipeline cache");
+        return false;
+    }
 
+    return true;
 }
 
 std::expected<VulkanPipelinePtr, bool> PipelineFactory::GetPipeline(const VulkanDevicePtr& device, const GraphicsPipelineConfig& config)
@@ -41,40 +65,182 @@ std::expected<VulkanPipelinePtr, bool> PipelineFactory::GetPipelineT(const Vulka
 {
     const auto pipelineKey = config.GetUniqueKey();
 
-    // Return an existing pipeline, if one exists
-    const auto pipelineIt = m_pipelines.find(pipelineKey);
-    if (pipelineIt != m_pipelines.cend())
     {
-        return pipelineIt->second;
+        std::unique_lock<std::mutex> lock(m_pipelinesMutex);
+
+        // If the pipeline is being warmed up, wait for the warm up to finish with it
+        m_pipelinesCv.wait(lock, [&](){ return !m_pendingPipelines.contains(pipelineKey); });
+
+        // Return an existing pipeline, if one exists
+        const auto pipelineIt = m_pipelines.find(pipelineKey);
+        if (pipelineIt != m_pipelines.cend())
+        {
+            return pipelineIt->second;
+        }
     }
 
     // Otherwise, create a new pipeline
+    const auto pipeline = CreatePipeline(device, config);
+    if (!pipeline)
+    {
+        m_logger->Log(Common::LogLevel::Fatal, "GetGraphicsPipeline: Failed to create pipeline");
+        return std::unexpected(false);
+    }
+
+    m_pipelineCacheDirty = true;
+
+    std::lock_guard<std::mutex> lock(m_pipelinesMutex);
+    m_pipelines.insert({pipelineKey, *pipeline});
+
+    return *pipeline;
+}
+
+template<typename ConfigType>
+std::expected<VulkanPipelinePtr, bool> PipelineFactory::CreatePipeline(const VulkanDevicePtr& device, const ConfigType& config)
+{
     m_logger->Log(Common::LogLevel::Debug, "Pipelines: Creating a new pipeline for config: {}", config.GetUniqueKey());
 
-    auto pipeline = std::make_shared<VulkanPipeline>(m_logger, m_vulkanObjs->GetCalls(), m_shaders, device);
+    auto pipeline = std::make_shared<VulkanPipeline>(
+        m_logger,
+        m_vulkanObjs->GetCalls(),
+        m_shaders,
+        device,
+        m_pipelineCache.GetVkPipelineCache()
+    );
     if (!pipeline->Create(config))
     {
-        m_logger->Log(Common::LogLevel::Fatal, "GetGraphicsPipeline: Failed to create pipeline");
         return std::unexpected(false);
     }
 
-    m_pipelines.insert({pipelineKey, pipeline});
-
     return pipeline;
 }
 
+void PipelineFactory::WarmUp(const VulkanDevicePtr& device,
+                             const std::vector<GraphicsPipelineConfig>& graphicsConfigs,
+                             const std::vector<ComputePipelineConfig>& computeConfigs)
+{
+    std::vector<GraphicsPipelineConfig> toWarmGraphics;
+    std::vector<ComputePipelineConfig> toWarmCompute;
+
+    //
+    // Mark the pipelines as pending up front, so that any request for them which comes in
+    // before the warm up thread gets to them waits on the warm up rather than racing it
+    //
+    {
+        std::lock_guard<std::mutex> lock(m_pipelinesMutex);
+
+        const auto markPending = [&](const auto& config, auto& toWarm) {
+            const auto pipelineKey = config.GetUniqueKey();
+            if (m_pipelines.contains(pipelineKey) || m_pendingPipelines.contains(pipelineKey)) { return; }
+
+            m_pendingPipelines.insert(pipelineKey);
+            toWarm.push_back(config);
+        };
+
+        for (const auto& config : graphicsConfigs) { markPending(config, toWarmGraphics); }
+        for (const auto& config : computeConfigs) { markPending(config, toWarmCompute); }
+    }
+
+    if (toWarmGraphics.empty() && toWarmCompute.empty())
+    {
+        return;
+    }
+
+    m_logger->Log(Common::LogLevel::Info,
+      "Pipelines: Warming up {} graphics and {} compute pipelines", toWarmGraphics.size(), toWarmCompute.size());
+
+    auto thread = std::thread([=, this](){
+        for (const auto& config : toWarmCompute) { WarmUpPipeline(device, config); }
+        for (const auto& config : toWarmGraphics) { WarmUpPipeline(device, config); }
+
+        // Persist the warmed up pipelines right away rather than relying on a clean shutdown
+        if (!m_abortWarmUp) { SavePipelineCache(); }
+    });
+
+    Common::SetThreadName(thread.native_handle(), std::format("PipelineWarmUp-{}", m_warmUpThreads.size()));
+
+    m_warmUpThreads.push_back(std::move(thread));
+}
+
+template<typename ConfigType>
+void PipelineFactory::WarmUpPipeline(const VulkanDevicePtr& device, const ConfigType& config)
+{
+    const auto pipelineKey = config.GetUniqueKey();
+
+    std::expected<VulkanPipelinePtr, bool> pipeline = std::unexpected(false);
+
+    if (!m_abortWarmUp)
+    {
+        pipeline = CreatePipeline(device, config);
+        if (!pipeline)
+        {
+            // Not fatal; the pipeline will be re-attempted, and the error reported, if it's ever requested
+            m_logger->Log(Common::LogLevel::Warning, "Pipelines: Failed to warm up pipeline {}", pipelineKey);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_pipelinesMutex);
+
+        if (pipeline)
+        {
+            m_pipelines.insert({pipelineKey, *pipeline});
+        }
+
+        m_pendingPipelines.erase(pipelineKey);
+    }
+
+    m_pipelinesCv.notify_all();
+}
+
+void PipelineFactory::PersistCacheIfChanged()
+{
+    if (!m_pipelineCacheDirty) { return; }
+
+    {
+        std::lock_guard<std::mutex> lock(m_pipelineCacheSaveMutex);
+        if (std::chrono::steady_clock::now() - m_lastPipelineCacheSave < PIPELINE_CACHE_SAVE_INTERVAL) { return; }
+    }
+
+    SavePipelineCache();
+}
+
+void PipelineFactory::SavePipelineCache()
+{
+    std::lock_guard<std::mutex> lock(m_pipelineCacheSaveMutex);
+
+    m_pipelineCacheDirty = false;
+    m_lastPipelineCacheSave = std::chrono::steady_clock::now();
+
+    (void)m_pipelineCache.Save();
+}
+
 void PipelineFactory::Destroy()
 {
     m_logger->Log(Common::LogLevel::Info, "Pipelines: Destroying pipelines");
 
+    // Stop any in-progress warm ups; pipelines which haven't started being created are skipped
+    m_abortWarmUp = true;
+
+    for (auto& thread : m_warmUpThreads)
+    {
+        if (thread.joinable()) { thread.join(); }
+    }
+    m_warmUpThreads.clear();
+
     while (!m_pipelines.empty())
     {
         DestroyPipeline(m_pipelines.cbegin()->first);
     }
+
+    // Persists the pipelines' compiled data for the next run
+    m_pipelineCache.Destroy();
 }
 
 void PipelineFactory::DestroyPipeline(const size_t& pipelineKey)
 {
+    std::lock_guard<std::mutex> lock(m_pipelinesMutex);
+
     const auto it = m_pipelines.find(pipelineKey);
     if (it == m_pipelines.cend())
     {
@@ -8,11 +8,18 @@
 #define LIBACCELARENDERERVK_SRC_PIPELINE_PIPELINEFACTORY
 
 #include "IPipelineFactory.h"
+#include "PipelineCache.h"
 
 #include "../ForwardDeclares.h"
 
 #include <Accela/Common/Log/ILogger.h>
 #include <unordered_map>
+#include <unordered_set>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
 
 namespace Accela::Render
 {
@@ -27,12 +34,20 @@ namespace Accela::Render
             //
             // IPipelineFactory
             //
+            [[nodiscard]] bool Initialize(const std::optional<std::string>& pipelineCacheFilePath) override;
+
             [[nodiscard]] std::expected<VulkanPipelinePtr, bool> GetPipeline(const VulkanDevicePtr& device,
                                                                              const GraphicsPipelineConfig& config) override;
 
             [[nodiscard]] std::expected<VulkanPipelinePtr, bool> GetPipeline(const VulkanDevicePtr& device,
                                                                              const ComputePipelineConfig& config) override;
 
+            void WarmUp(const VulkanDevicePtr& device,
+                        const std::vector<GraphicsPipelineConfig>& graphicsConfigs,
+                        const std::vector<ComputePipelineConfig>& computeConfigs) override;
+
+            void PersistCacheIfChanged() override;
+
             void DestroyPipeline(const std::size_t& pipelineKey) override;
 
             void Destroy() override;
@@ -42,14 +57,38 @@ namespace Accela::Render
             template <typename ConfigType>
             [[nodiscard]] std::expected<VulkanPipelinePtr, bool> GetPipelineT(const VulkanDevicePtr& device, const ConfigType& config);
 
+            template <typename ConfigType>
+            [[nodiscard]] std::expected<VulkanPipelinePtr, bool> CreatePipeline(const VulkanDevicePtr& device, const ConfigType& config);
+
+            template <typename ConfigType>
+            void WarmUpPipeline(const VulkanDevicePtr& device, const ConfigType& config);
+
+            void SavePipelineCache();
+
         private:
 
             Common::ILogger::Ptr m_logger;
             VulkanObjsPtr m_vulkanObjs;
             IShadersPtr m_shaders;
 
+            PipelineCache m_pipelineCache;
+
             // Config Hash -> Pipeline
             std::unordered_map<size_t, VulkanPipelinePtr> m_pipelines;
+
+            // Config hashes of pipelines which are queued for or in the middle of being warmed up
+            std::unordered_set<size_t> m_pendingPipelines;
+
+            std::mutex m_pipelinesMutex;
+            std::condition_variable m_pipelinesCv;
+
+            std::vector<std::thread> m_warmUpThreads;
+            std::atomic<bool> m_abortWarmUp{false};
+
+            // Whether pipelines were created since the pipeline cache was last written to disk
+            std::atomic<bool> m_pipelineCacheDirty{false};
+            std::mutex m_pipelineCacheSaveMutex;
+            std::chrono::steady_clock::time_point m_lastPipelineCacheSave;
     };
 }
 
@@ -20,11 +20,10 @@
 namespace Accela::Render
 {
 
-std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
+std::expected<GraphicsPipelineConfig, bool> BuildGraphicsPipelineConfig(
     const Common::ILogger::Ptr& logger,
     const VulkanObjsPtr& vulkanObjs,
     const IShadersPtr& shaders,
-    const IPipelineFactoryPtr& pipelines,
     const ProgramDefPtr& programDef,
     const VulkanRenderPassPtr& renderPass,
     const uint32_t& subpassIndex,
@@ -33,15 +32,14 @@ std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
     const PolygonFillMode& polygonFillMode,
     const DepthBias& depthBias,
     const std::optional<std::vector<PushConstantRange>>& pushConstantRanges,
-    const std::optional<std::size_t>& tag,
-    const std::optional<std::size_t>& oldPipelineHash)
+    const std::optional<std::size_t>& tag)
 {
     auto vulkanFuncs = VulkanFuncs(logger, vulkanObjs);
 
     const auto subpasses = renderPass->GetSubpasses();
     if (subpasses.size() < subpassIndex)
     {
-        logger->Log(Common::LogLevel::Error, "GetGraphicsPipeline: Invalid subpass index");
+        logger->Log(Common::LogLevel::Error, "BuildGraphicsPipelineConfig: Invalid subpass index");
         return std::unexpected(false);
     }
 
@@ -64,7 +62,7 @@ std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
 
         if (attachmentIndex >= renderPassAttachments.size())
         {
-            logger->Log(Common::LogLevel::Error, "GetGraphicsPipeline: Color attachment ref index out of bounds");
+            logger->Log(Common::LogLevel::Error, "BuildGraphicsPipelineConfig: Color attachment ref index out of bounds");
             return std::unexpected(false);
         }
 
@@ -104,7 +102,7 @@ std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
         const auto shaderModuleOpt = shaders->GetShaderModule(shaderName);
         if (!shaderModuleOpt)
         {
-            logger->Log(Common::LogLevel::Error, "GetGraphicsPipeline: Failed to find shader: {}", shaderName);
+            logger->Log(Common::LogLevel::Error, "BuildGraphicsPipelineConfig: Failed to find shader: {}", shaderName);
             return std::unexpected(false);
         }
 
@@ -124,7 +122,7 @@ std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
             break;
             case ShaderType::Compute:
             {
-                logger->Log(Common::LogLevel::Error, "GetGraphicsPipeline: Compute shader provided: {}", shaderName);
+                logger->Log(Common::LogLevel::Error, "BuildGraphicsPipelineConfig: Compute shader provided: {}", shaderName);
                 return std::unexpected(false);
             }
         }
@@ -135,7 +133,7 @@ std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
     //
     if (!programDef->GetVertexInputBindingDescription().has_value())
     {
-        logger->Log(Common::LogLevel::Error, "GetGraphicsPipeline: Program doesn't have vertex input binding description: {}", programDef->GetProgramName());
+        logger->Log(Common::LogLevel::Error, "BuildGraphicsPipelineConfig: Program doesn't have vertex input binding description: {}", programDef->GetProgramName());
         return std::unexpected(false);
     }
 
@@ -181,12 +179,50 @@ std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
     const auto programVkDescriptorSetLayouts = programDef->GetVkDescriptorSetLayouts();
     pipelineConfig.vkDescriptorSetLayouts = programVkDescriptorSetLayouts;
 
+    return pipelineConfig;
+}
+
+std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
+    const Common::ILogger::Ptr& logger,
+    const VulkanObjsPtr& vulkanObjs,
+    const IShadersPtr& shaders,
+    const IPipelineFactoryPtr& pipelines,
+    const ProgramDefPtr& programDef,
+    const VulkanRenderPassPtr& renderPass,
+    const uint32_t& subpassIndex,
+    const Viewport& viewport,
+    const CullFace& cullFace,
+    const PolygonFillMode& polygonFillMode,
+    const DepthBias& depthBias,
+    const std::optional<std::vector<PushConstantRange>>& pushConstantRanges,
+    const std::optional<std::size_t>& tag,
+    const std::optional<std::size_t>& oldPipelineHash)
+{
+    const auto pipelineConfig = BuildGraphicsPipelineConfig(
+        logger,
+        vulkanObjs,
+        shaders,
+        programDef,
+        renderPass,
+        subpassIndex,
+        viewport,
+        cullFace,
+        polygonFillMode,
+        depthBias,
+        pushConstantRanges,
+        tag
+    );
+    if (!pipelineConfig)
+    {
+        return std::unexpected(false);
+    }
+
     //
     // Delete the old pipeline, if different
     //
     // TODO: Verify that this is no longer needed and add metrics around number of created pipelines
     (void)oldPipelineHash;
-    /*if (oldPipelineHash.has_value() && pipelineConfig.GetUniqueKey() != oldPipelineHash.value())
+    /*if (oldPipelineHash.has_value() && pipelineConfig->GetUniqueKey() != oldPipelineHash.value())
     {
         pipelines->DestroyPipeline(*oldPipelineHash);
     }*/
@@ -194,7 +230,7 @@ std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
     //
     // Create/Get the pipeline
     //
-    auto pipeline = pipelines->GetPipeline(vulkanObjs->GetDevice(), pipelineConfig);
+    auto pipeline = pipelines->GetPipeline(vulkanObjs->GetDevice(), *pipelineConfig);
     if (pipeline == nullptr)
     {
         logger->Log(Common::LogLevel::Error, "GetGraphicsPipeline: Failed to create or retrieve rendering pipeline");
@@ -204,18 +240,13 @@ std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
     return pipeline;
 }
 
-std::expected<VulkanPipelinePtr, bool> GetComputePipeline(
+std::expected<ComputePipelineConfig, bool> BuildComputePipelineConfig(
     const Common::ILogger::Ptr& logger,
-    const VulkanObjsPtr& vulkanObjs,
     const IShadersPtr& shaders,
-    const IPipelineFactoryPtr& pipelines,
     const ProgramDefPtr& programDef,
     const std::optional<std::vector<PushConstantRange>>& pushConstantRanges,
-    const std::optional<std::size_t>& tag,
-    const std::optional<std::size_t>& oldPipelineHash)
+    const std::optional<std::size_t>& tag)
 {
-    auto vulkanFuncs = VulkanFuncs(logger, vulkanObjs);
-
     //
     // General configuration
     //
@@ -233,7 +264,7 @@ std::expected<VulkanPipelinePtr, bool> GetComputePipeline(
     if (programShaderNames.size() != 1)
     {
         logger->Log(Common::LogLevel::Error,
-            "GetComputePipeline: Compute program requires exactly 1 shader: {}", programDef->GetProgramName());
+            "BuildComputePipelineConfig: Compute program requires exactly 1 shader: {}", programDef->GetProgramName());
         return std::unexpected(false);
     }
 
@@ -242,13 +273,13 @@ std::expected<VulkanPipelinePtr, bool> GetComputePipeline(
     const auto shaderModuleOpt = shaders->GetShaderModule(shaderName);
     if (!shaderModuleOpt)
     {
-        logger->Log(Common::LogLevel::Error, "GetComputePipeline: Failed to find shader: {}", shaderName);
+        logger->Log(Common::LogLevel::Error, "BuildComputePipelineConfig: Failed to find shader: {}", shaderName);
         return std::unexpected(false);
     }
 
     if ((*shaderModuleOpt)->GetShaderSpec()->shaderType != ShaderType::Compute)
     {
-        logger->Log(Common::LogLevel::Error, "GetComputePipeline: Program has a non-compute shader: {}", shaderName);
+        logger->Log(Common::LogLevel::Error, "BuildComputePipelineConfig: Program has a non-compute shader: {}", shaderName);
         return std::unexpected(false);
     }
 
@@ -280,12 +311,31 @@ std::expected<VulkanPipelinePtr, bool> GetComputePipeline(
     const auto programVkDescriptorSetLayouts = programDef->GetVkDescriptorSetLayouts();
     pipelineConfig.vkDescriptorSetLayouts = programVkDescriptorSetLayouts;
 
+    return pipelineConfig;
+}
+
+std::expected<VulkanPipelinePtr, bool> GetComputePipeline(
+    const Common::ILogger::Ptr& logger,
+    const VulkanObjsPtr& vulkanObjs,
+    const IShadersPtr& shaders,
+    const IPipelineFactoryPtr& pipelines,
+    const ProgramDefPtr& programDef,
+    const std::optional<std::vector<PushConstantRange>>& pushConstantRanges,
+    const std::optional<std::size_t>& tag,
+    const std::optional<std::size_t>& oldPipelineHash)
+{
+    const auto pipelineConfig = BuildComputePipelineConfig(logger, shaders, programDef, pushConstantRanges, tag);
+    if (!pipelineConfig)
+    {
+        return std::unexpected(false);
+    }
+
     //
     // Delete the old pipeline, if different
     //
     // TODO: Verify that this is no longer needed and add metrics around number of created pipelines
     (void)oldPipelineHash;
-    /*if (oldPipelineHash.has_value() && pipelineConfig.GetUniqueKey() != oldPipelineHash.value())
+    /*if (oldPipelineHash.has_value() && pipelineConfig->GetUniqueKey() != oldPipelineHash.value())
     {
         pipelines->DestroyPipeline(*oldPipelineHash);
     }*/
@@ -293,7 +343,7 @@ std::expected<VulkanPipelinePtr, bool> GetComputePipeline(
     //
     // Create/Get the pipeline
     //
-    auto pipeline = pipelines->GetPipeline(vulkanObjs->GetDevice(), pipelineConfig);
+    auto pipeline = pipelines->GetPipeline(vulkanObjs->GetDevice(), *pipelineConfig);
     if (pipeline == nullptr)
     {
         logger->Log(Common::LogLevel::Error, "GetComputePipeline: Failed to create or retrieve rendering pipeline");
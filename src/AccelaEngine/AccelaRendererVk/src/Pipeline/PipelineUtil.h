@@ -25,6 +25,35 @@
 
 namespace Accela::Render
 {
+    /**
+     * Builds the config of the graphics pipeline which renders the provided program, without creating the pipeline
+     */
+    [[nodiscard]] std::expected<GraphicsPipelineConfig, bool> BuildGraphicsPipelineConfig(
+        const Common::ILogger::Ptr& logger,
+        const VulkanObjsPtr& vulkanObjs,
+        const IShadersPtr& shaders,
+        const ProgramDefPtr& programDef,
+        const VulkanRenderPassPtr& renderPass,
+        const uint32_t& subpassIndex,
+        const Viewport& viewport,
+        const CullFace& cullFace = CullFace::Back,
+        const PolygonFillMode& polygonFillMode = PolygonFillMode::Fill,
+        const DepthBias& depthBias = DepthBias::Disabled,
+        const std::optional<std::vector<PushConstantRange>>& pushConstantRanges = std::nullopt,
+        const std::optional<std::size_t>& tag = std::nullopt
+    );
+
+    /**
+     * Builds the config of the compute pipeline which runs the provided program, without creating the pipeline
+     */
+    [[nodiscard]] std::expected<ComputePipelineConfig, bool> BuildComputePipelineConfig(
+        const Common::ILogger::Ptr& logger,
+        const IShadersPtr& shaders,
+        const ProgramDefPtr& programDef,
+        const std::optional<std::vector<PushConstantRange>>& pushConstantRanges = std::nullopt,
+        const std::optional<std::size_t>& tag = std::nullopt
+    );
+
     [[nodiscard]] std::expected<VulkanPipelinePtr, bool> GetGraphicsPipeline(
         const Common::ILogger::Ptr& logger,
         const VulkanObjsPtr& vulkanObjs,
@@ -10,6 +10,10 @@
 #include "../Buffer/GPUItemBuffer.h"
 #include "../Mesh/IMeshes.h"
 #include "../Light/ILights.h"
+#include "../Util/GeometryUtil.h"
+
+#include <span>
+#include <cmath>
 
 namespace Accela::Render
 {
@@ -79,8 +83,12 @@ void ObjectRenderables::ProcessUpdate(const WorldUpdate& update,
     ProcessDeletedObjects(update, modifiedShadowWorldAreas, commandBuffer, vkFence);
 
     // Tell the lighting system about the world-space bounds of every object that was added, updated,
-    // or deleted, and it in turn will invalidate the shadow maps of any lights that cover those bounds
-    m_lights->InvalidateShadowMapsByBounds(modifiedShadowWorldAreas.boundingBoxes_worldSpace);
+    // or deleted, and it in turn will invalidate the shadow maps of any lights that cover those bounds.
+    // Only static objects invalidate the lights' cached static object shadow maps.
+    m_lights->InvalidateShadowMapsByBounds(
+        modifiedShadowWorldAreas.staticBoundingBoxes_worldSpace,
+        modifiedShadowWorldAreas.dynamicBoundingBoxes_worldSpace
+    );
 }
 
 void ObjectRenderables::ProcessAddedObjects(const WorldUpdate& update,
@@ -133,6 +141,8 @@ void ObjectRenderables::ProcessAddedObjects(const WorldUpdate& update,
     if (m_objects.size() < highestId)
     {
         m_objects.resize(highestId);
+        m_objectCameraLODs.resize(highestId, NO_LOD);
+        m_objectTreeEntries.resize(highestId);
     }
 
     for (const auto& object : update.toAddObjectRenderables)
@@ -146,14 +156,21 @@ void ObjectRenderables::ProcessAddedObjects(const WorldUpdate& update,
         {
             objectData.boundingBox_worldSpace = *aabbExpect;
 
+            // Newly added objects are always static
             if (object.shadowPass)
             {
-                modifiedShadowWorldAreas.boundingBoxes_worldSpace.push_back(objectData.boundingBox_worldSpace);
+                modifiedShadowWorldAreas.Add(objectData.boundingBox_worldSpace, false);
             }
         }
 
         m_objects[object.objectId.id - 1] = objectData;
-        m_objectsRTree[object.sceneName].Insert(aabbExpect->GetVolume(), object.objectId);
+        m_objectCameraLODs[object.objectId.id - 1] = NO_LOD;
+
+        if (aabbExpect)
+        {
+            InsertIntoTree(object, aabbExpect->GetVolume());
+            m_objectsBounds[object.sceneName].Insert(object.objectId.id, aabbExpect->GetVolume());
+        }
     }
 }
 
@@ -217,31 +234,50 @@ void ObjectRenderables::ProcessUpdatedObjects(const WorldUpdate& update,
         updatedData.boundingBox_worldSpace = *aabbExpect;
 
         const bool aabbInvalidated = existingObject.boundingBox_worldSpace != updatedData.boundingBox_worldSpace;
+        const bool sceneChanged = existingObject.renderable.sceneName != toUpdateObjectRenderable.sceneName;
+        const bool wasDynamic = IsObjectDynamic(toUpdateObjectRenderable.objectId);
 
-        // If the object's AABB changed, update its spatial data in the object r-tree
-        if (aabbInvalidated)
+        // Update the object's spatial data in the scene trees, moving it between scenes if it changed scene
+        if (sceneChanged)
         {
-            m_objectsRTree[toUpdateObjectRenderable.sceneName].Remove(
+            RemoveFromTree(toUpdateObjectRenderable.objectId, existingObject.renderable.sceneName);
+            InsertIntoTree(toUpdateObjectRenderable, updatedData.boundingBox_worldSpace.GetVolume());
+        }
+        else if (aabbInvalidated)
+        {
+            MoveInTree(
+                toUpdateObjectRenderable,
                 existingObject.boundingBox_worldSpace.GetVolume(),
-                toUpdateObjectRenderable.objectId
-            );
-
-            m_objectsRTree[toUpdateObjectRenderable.sceneName].Insert(
-                updatedData.boundingBox_worldSpace.GetVolume(),
-                toUpdateObjectRenderable.objectId
+                updatedData.boundingBox_worldSpace.GetVolume()
             );
+        }
 
+        if (aabbInvalidated)
+        {
+            // The object's old bounds are classified by whether the object was dynamic before it moved, so that a
+            // static object moving for the first time removes itself from cached static shadow maps
             if (existingObject.renderable.shadowPass)
             {
-                modifiedShadowWorldAreas.boundingBoxes_worldSpace.push_back(existingObject.boundingBox_worldSpace);
+                modifiedShadowWorldAreas.Add(existingObject.boundingBox_worldSpace, wasDynamic);
             }
 
             if (updatedData.renderable.shadowPass)
             {
-                modifiedShadowWorldAreas.boundingBoxes_worldSpace.push_back(updatedData.boundingBox_worldSpace);
+                modifiedShadowWorldAreas.Add(updatedData.boundingBox_worldSpace, IsObjectDynamic(toUpdateObjectRenderable.objectId));
             }
         }
 
+        // Update the object's packed bounds, moving them between scenes if the object changed scene
+        if (sceneChanged)
+        {
+            m_objectsBounds[existingObject.renderable.sceneName].Remove(toUpdateObjectRenderable.objectId.id);
+        }
+
+        m_objectsBounds[toUpdateObjectRenderable.sceneName].Insert(
+            toUpdateObjectRenderable.objectId.id,
+            updatedData.boundingBox_worldSpace.GetVolume()
+        );
+
         // Update the object's CPU data
         existingObject = updatedData;
     }
@@ -275,21 +311,70 @@ void ObjectRenderables::ProcessDeletedObjects(const WorldUpdate& update,
         {
             if (renderableObject.renderable.shadowPass)
             {
-                modifiedShadowWorldAreas.boundingBoxes_worldSpace.push_back(renderableObject.boundingBox_worldSpace);
+                modifiedShadowWorldAreas.Add(renderableObject.boundingBox_worldSpace, IsObjectDynamic(toDeleteId));
             }
         }
 
         renderableObject.isValid = false;
+        m_objectCameraLODs[toDeleteId.id - 1] = NO_LOD;
 
-        m_objectsRTree[renderableObject.renderable.sceneName].Remove(
-            renderableObject.boundingBox_worldSpace.GetVolume(),
-            toDeleteId
-        );
+        RemoveFromTree(toDeleteId, renderableObject.renderable.sceneName);
+
+        m_objectsBounds[renderableObject.renderable.sceneName].Remove(toDeleteId.id);
 
         m_ids->objectIds.ReturnId(toDeleteId);
     }
 }
 
+uint8_t ObjectRenderables::SelectObjectLOD(ObjectId objectId,
+                                           const LoadedMesh& loadedMesh,
+                                           const ViewProjection& viewProjection,
+                                           const RenderSettings& renderSettings,
+                                           bool isCameraView) const
+{
+    if (loadedMesh.numLODs <= 1 || objectId.id == INVALID_ID || objectId.id > m_objects.size()) { return 0; }
+
+    const auto& boundingBox_worldSpace = m_objects[objectId.id - 1].boundingBox_worldSpace;
+    if (boundingBox_worldSpace.IsEmpty()) { return 0; }
+
+    //
+    // Project the object's bounding sphere into the view. LOD errors are relative to the mesh's bounding
+    // radius, so the radius' projected size in pixels is the number of pixels per unit of LOD error. The
+    // projection's y scale and clip-space w make this work for both perspective and orthographic projections.
+    //
+    const auto boundingVolume = boundingBox_worldSpace.GetVolume();
+    const auto boundingCenter_worldSpace = (boundingVolume.min + boundingVolume.max) * 0.5f;
+    const auto boundingRadius = glm::length(boundingVolume.max - boundingVolume.min) * 0.5f;
+
+    const auto projection = viewProjection.projectionTransform->GetProjectionMatrix();
+    const auto boundingCenter_clipSpace = projection * viewProjection.viewTransform * glm::vec4(boundingCenter_worldSpace, 1.0f);
+
+    // If the view is within the object's bounds, render it at full detail
+    if (boundingCenter_clipSpace.w <= boundingRadius * std::abs(projection[3][3] - 1.0f)) { return 0; }
+
+    const auto halfScreenHeightPixels = static_cast<float>(renderSettings.resolution.h) * 0.5f;
+    const auto pixelsPerError = boundingRadius * std::abs(projection[1][1]) / boundingCenter_clipSpace.w * halfScreenHeightPixels;
+
+    const auto lods = std::span<const MeshLOD>(loadedMesh.lods.data(), loadedMesh.numLODs);
+
+    if (!isCameraView)
+    {
+        return SelectMeshLOD(lods, pixelsPerError, renderSettings.objectLODMaxPixelError, 0.0f, std::nullopt);
+    }
+
+    auto& cameraLOD = m_objectCameraLODs[objectId.id - 1];
+
+    cameraLOD = SelectMeshLOD(
+        lods,
+        pixelsPerError,
+        renderSettings.objectLODMaxPixelError,
+        renderSettings.objectLODHysteresis,
+        cameraLOD == NO_LOD ? std::nullopt : std::optional<uint8_t>(cameraLOD)
+    );
+
+    return cameraLOD;
+}
+
 ObjectPayload ObjectRenderables::ObjectToPayload(const ObjectRenderable& object)
 {
     ObjectPayload payload{};
@@ -351,9 +436,73 @@ std::expected<AABB, bool> ObjectRenderables::GetObjectAABB(const ObjectRenderabl
     return objectWorldSpaceAABB;
 }
 
-const ObjectsRTree& ObjectRenderables::GetDataRTree(const std::string& sceneName) const noexcept
+bool ObjectRenderables::IsObjectDynamic(ObjectId objectId) const
+{
+    if (objectId.id == INVALID_ID || objectId.id > m_objectTreeEntries.size()) { return false; }
+
+    return m_objectTreeEntries[objectId.id - 1].isDynamic;
+}
+
+void ObjectRenderables::InsertIntoTree(const ObjectRenderable& object, const Volume& volume)
+{
+    auto& treeEntry = m_objectTreeEntries[object.objectId.id - 1];
+
+    treeEntry.isDynamic = false;
+    treeEntry.proxyId = m_objectsBVH[object.sceneName].staticTree.Insert(volume, object.objectId);
+}
+
+void ObjectRenderables::MoveInTree(const ObjectRenderable& object, const Volume& oldVolume, const Volume& newVolume)
+{
+    auto& treeEntry = m_objectTreeEntries[object.objectId.id - 1];
+
+    // Objects without previously valid bounds were never put into the tree
+    if (treeEntry.proxyId == ObjectsBVH::NULL_PROXY)
+    {
+        InsertIntoTree(object, newVolume);
+        return;
+    }
+
+    auto& sceneBVH = m_objectsBVH[object.sceneName];
+
+    // First time the object has moved; it's no longer considered static
+    if (!treeEntry.isDynamic)
+    {
+        sceneBVH.staticTree.Remove(treeEntry.proxyId);
+
+        treeEntry.isDynamic = true;
+        treeEntry.proxyId = sceneBVH.dynamicTree.Insert(newVolume, object.objectId);
+        return;
+    }
+
+    sceneBVH.dynamicTree.Update(treeEntry.proxyId, newVolume, newVolume.GetCenterPoint() - oldVolume.GetCenterPoint());
+}
+
+void ObjectRenderables::RemoveFromTree(ObjectId objectId, const std::string& sceneName)
+{
+    auto& treeEntry = m_objectTreeEntries[objectId.id - 1];
+    if (treeEntry.proxyId == ObjectsBVH::NULL_PROXY) { return; }
+
+    auto& sceneBVH = m_objectsBVH[sceneName];
+
+    if (treeEntry.isDynamic) { sceneBVH.dynamicTree.Remove(treeEntry.proxyId); }
+    else                     { sceneBVH.staticTree.Remove(treeEntry.proxyId); }
+
+    treeEntry = {};
+}
+
+std::vector<ObjectId> ObjectRenderables::FetchSceneObjectIds(const std::string& sceneName,
+                                                             const std::function<bool(const Volume&)>& volumeTest) const
 {
-    return m_objectsRTree.at(sceneName);
+    const auto it = m_objectsBVH.find(sceneName);
+    if (it == m_objectsBVH.cend()) { return {}; }
+
+    auto objectIds = it->second.staticTree.FetchMatching(volumeTest);
+
+    it->second.dynamicTree.Query(volumeTest, [&](const ObjectId& objectId){
+        objectIds.push_back(objectId);
+    });
+
+    return objectIds;
 }
 
 [[nodiscard]] std::vector<ObjectRenderable> ObjectRenderables::GetVisibleObjects(const std::string& sceneName, const Volume& volume) const
@@ -384,14 +533,150 @@ std::vector<AABB> ObjectRenderables::GetVisibleObjectsAABBs(const std::string& s
     return visibleAABBs;
 }
 
-std::vector<RenderableData<ObjectRenderable>> ObjectRenderables::GetVisibleRenderableData(const std::string& sceneName, const Volume& volume) const
+ViewVisibleObjects ObjectRenderables::GetVisibleObjects(const std::string& sceneName, const std::vector<Frustum>& frustums_worldSpace) const
 {
-    if (!m_objectsRTree.contains(sceneName)) { return {}; }
+    ViewVisibleObjects visibleObjects{};
+    visibleObjects.viewObjectIndices.resize(frustums_worldSpace.size());
+
+    const auto it = m_objectsBounds.find(sceneName);
+    if (it == m_objectsBounds.cend()) { return visibleObjects; }
 
     //
-    // Query the objects r-tree for the ids of the objects within the specified volume of space
+    // Cull the scene's objects against each view's frustum, and merge the objects within each view into
+    // one list of objects, each of which is only included once no matter how many views it's within
     //
-    const auto sceneRenderableIdsInVolume = m_objectsRTree.at(sceneName).FetchMatching(volume);
+    std::vector<uint32_t> objectIndices(m_objects.size(), UINT32_MAX);
+    std::vector<uint32_t> viewObjectIds;
+
+    for (std::size_t v = 0; v < frustums_worldSpace.size(); ++v)
+    {
+        viewObjectIds.clear();
+        it->second.Cull(frustums_worldSpace[v], viewObjectIds);
+
+        auto& viewObjectIndices = visibleObjects.viewObjectIndices[v];
+        viewObjectIndices.reserve(viewObjectIds.size());
+
+        for (const auto& id : viewObjectIds)
+        {
+            const auto& renderableObject = m_objects[id - 1];
+            if (!renderableObject.isValid) { continue; }
+
+            auto& objectIndex = objectIndices[id - 1];
+            if (objectIndex == UINT32_MAX)
+            {
+                objectIndex = (uint32_t)visibleObjects.objects.size();
+                visibleObjects.objects.push_back(renderableObject.renderable);
+            }
+
+            viewObjectIndices.push_back(objectIndex);
+        }
+    }
+
+    return visibleObjects;
+}
+
+std::vector<ObjectId> ObjectRenderables::GetObjectsAlongRay(const std::string& sceneName, const Ray& ray_worldSpace) const
+{
+    //
+    // Walk the scene's trees, only descending into the nodes whose bounds the ray passes through
+    //
+    const auto candidateIds = FetchSceneObjectIds(sceneName, [&](const Volume& volume){
+        return DistanceToVolume(ray_worldSpace, volume).has_value();
+    });
+
+    //
+    // Refine the candidates against their tighter, model space, bounds
+    //
+    std::vector<std::pair<ObjectId, float>> hits;
+    hits.reserve(candidateIds.size());
+
+    for (const auto& id : candidateIds)
+    {
+        const auto& renderableObject = m_objects[id.id - 1];
+
+        // Filter out renderables that have been deleted / are invalid
+        if (!renderableObject.isValid)
+        {
+            continue;
+        }
+
+        const auto distance = GetRayDistanceToObject(ray_worldSpace, renderableObject);
+        if (distance)
+        {
+            hits.emplace_back(id, *distance);
+        }
+    }
+
+    std::ranges::sort(hits, [](const auto& a, const auto& b){ return a.second < b.second; });
+
+    std::vector<ObjectId> objectIds;
+    objectIds.reserve(hits.size());
+
+    std::ranges::transform(hits, std::back_inserter(objectIds), [](const auto& hit){
+        return hit.first;
+    });
+
+    return objectIds;
+}
+
+std::optional<float> ObjectRenderables::GetRayDistanceToObject(const Ray& ray_worldSpace,
+                                                               const RenderableData<ObjectRenderable>& object) const
+{
+    const auto meshOpt = m_meshes->GetLoadedMesh(object.renderable.meshId);
+
+    // Bone transforms can move vertices outside the mesh's model space bounds, and only the object's
+    // world space bounds account for them, so fall back to testing against those
+    if (!meshOpt || object.renderable.boneTransforms)
+    {
+        return DistanceToVolume(ray_worldSpace, object.boundingBox_worldSpace.GetVolume());
+    }
+
+    //
+    // Transform the ray into the object's model space and test it against the mesh's bounds there, which,
+    // unlike the world space AABB, aren't inflated by the object's rotation
+    //
+    const auto worldToModel = glm::inverse(object.renderable.modelTransform);
+
+    const auto origin_modelSpace = glm::vec3(worldToModel * glm::vec4(ray_worldSpace.originPoint, 1.0f));
+
+    Ray ray_modelSpace(origin_modelSpace, glm::vec3(0));
+
+    if (ray_worldSpace.length)
+    {
+        const auto end_worldSpace = ray_worldSpace.originPoint + (ray_worldSpace.dirUnit * *ray_worldSpace.length);
+        const auto delta_modelSpace = glm::vec3(worldToModel * glm::vec4(end_worldSpace, 1.0f)) - origin_modelSpace;
+        const auto length_modelSpace = glm::length(delta_modelSpace);
+        if (length_modelSpace <= 0.0f) { return std::nullopt; }
+
+        ray_modelSpace.dirUnit = delta_modelSpace / length_modelSpace;
+        ray_modelSpace.length = length_modelSpace;
+    }
+    else
+    {
+        ray_modelSpace.dirUnit = glm::normalize(glm::vec3(worldToModel * glm::vec4(ray_worldSpace.dirUnit, 0.0f)));
+    }
+
+    const auto distance_modelSpace = DistanceToVolume(ray_modelSpace, meshOpt->boundingBox_modelSpace.GetVolume());
+    if (!distance_modelSpace)
+    {
+        return std::nullopt;
+    }
+
+    // Convert the hit point back to world space to get the world space distance to it
+    const auto hitPoint_modelSpace = ray_modelSpace.originPoint + (ray_modelSpace.dirUnit * *distance_modelSpace);
+    const auto hitPoint_worldSpace = glm::vec3(object.renderable.modelTransform * glm::vec4(hitPoint_modelSpace, 1.0f));
+
+    return glm::distance(ray_worldSpace.originPoint, hitPoint_worldSpace);
+}
+
+std::vector<RenderableData<ObjectRenderable>> ObjectRenderables::GetVisibleRenderableData(const std::string& sceneName, const Volume& volume) const
+{
+    //
+    // Query the scene's trees for the ids of the objects within the specified volume of space
+    //
+    const auto sceneRenderableIdsInVolume = FetchSceneObjectIds(sceneName, [&](const Volume& nodeVolume){
+        return Intersects(nodeVolume, volume);
+    });
 
     //
     // Transform the list of volume objects ids to renderables by accessing the objects list
@@ -409,6 +694,12 @@ std::vector<RenderableData<ObjectRenderable>> ObjectRenderables::GetVisibleRende
             continue;
         }
 
+        // Moving objects are found by their fat tree bounds, which can extend beyond the object
+        if (!Intersects(renderableObject.boundingBox_worldSpace.GetVolume(), volume))
+        {
+            continue;
+        }
+
         visibleRenderables.push_back(renderableObject);
     }
 
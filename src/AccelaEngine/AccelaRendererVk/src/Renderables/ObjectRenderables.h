@@ -14,9 +14,15 @@
 #include "../Renderer/RendererCommon.h"
 #include "../Buffer/ItemBuffer.h"
 #include "../Util/KDTree.h"
-#include "../Util/RTree.h"
+#include "../Util/DynamicBVH.h"
+#include "../Util/Ray.h"
+#include "../Util/ViewProjection.h"
+#include "../Util/Frustum.h"
+#include "../Util/PackedBounds.h"
+#include "../Mesh/LoadedMesh.h"
 
 #include <Accela/Render/Ids.h>
+#include <Accela/Render/RenderSettings.h>
 
 #include <Accela/Render/Task/WorldUpdate.h>
 
@@ -25,12 +31,28 @@
 #include <vulkan/vulkan.h>
 
 #include <expected>
+#include <functional>
 #include <memory>
 #include <unordered_map>
+#include <vector>
+#include <cstdint>
 
 namespace Accela::Render
 {
-    using ObjectsRTree = RTree<ObjectId, float, 3>;
+    using ObjectsBVH = DynamicBVH<ObjectId>;
+
+    /**
+     * The objects within a set of view frustums
+     */
+    struct ViewVisibleObjects
+    {
+        // The objects which are within at least one of the views
+        std::vector<ObjectRenderable> objects;
+
+        // For each view, indices into objects of the objects which are within that view. Multiview renders still
+        // draw all of objects into every view; these only narrow per-view work such as occlusion testing.
+        std::vector<std::vector<uint32_t>> viewObjectIndices;
+    };
 
     class ObjectRenderables
     {
@@ -50,18 +72,84 @@ namespace Accela::Render
             void ProcessUpdate(const WorldUpdate& update, const VulkanCommandBufferPtr& commandBuffer, VkFence vkFence);
 
             [[nodiscard]] const std::vector<RenderableData<ObjectRenderable>>& GetData() const { return m_objects; }
-            [[nodiscard]] const ObjectsRTree& GetDataRTree(const std::string& sceneName) const noexcept;
             [[nodiscard]] std::shared_ptr<ItemBuffer<ObjectPayload>> GetObjectPayloadBuffer() const { return m_objectPayloadBuffer; };
 
             [[nodiscard]] std::vector<ObjectRenderable> GetVisibleObjects(const std::string& sceneName, const Volume& volume) const;
             [[nodiscard]] std::vector<AABB> GetVisibleObjectsAABBs(const std::string& sceneName, const Volume& volume) const;
 
+            /**
+             * Frustum culls the scene's objects against each of the provided (world space) view frustums individually.
+             */
+            [[nodiscard]] ViewVisibleObjects GetVisibleObjects(const std::string& sceneName, const std::vector<Frustum>& frustums_worldSpace) const;
+
+            /**
+             * @return The ids of the scene's objects whose bounds the (world space) ray passes through, ordered nearest first
+             */
+            [[nodiscard]] std::vector<ObjectId> GetObjectsAlongRay(const std::string& sceneName, const Ray& ray_worldSpace) const;
+
+            /**
+             * Selects the LOD of its mesh that an object should be rendered with, for a view, from the projected
+             * screen-space size of the object's bounds and the errors of its mesh's LODs.
+             *
+             * The LOD selected for an object's camera views is remembered, and used for hysteresis the next
+             * time a camera LOD is selected for the object. Other (shadow) views select statelessly.
+             *
+             * Hysteresis assumes a single camera is rendered per frame: there's one remembered LOD per object,
+             * rather than one per view. The camera's views (e.g. both eyes of a multiview render) share the LOD
+             * selected for the first of them, and each object is only drawn by one of the g-passes, so that holds
+             * today; rendering several cameras per frame would need the remembered LODs kept per camera.
+             *
+             * @return The index of the LOD to render, within loadedMesh's LODs
+             */
+            [[nodiscard]] uint8_t SelectObjectLOD(ObjectId objectId,
+                                                  const LoadedMesh& loadedMesh,
+                                                  const ViewProjection& viewProjection,
+                                                  const RenderSettings& renderSettings,
+                                                  bool isCameraView) const;
+
+            /**
+             * @return Whether the object is dynamic; whether its bounds have changed since it was added to its scene
+             */
+            [[nodiscard]] bool IsObjectDynamic(ObjectId objectId) const;
+
         private:
 
             struct ModifiedWorldAreas
             {
-                // The world-space bounding boxes of ObjectRenderables which were added, updated, or deleted
-                std::vector<AABB> boundingBoxes_worldSpace;
+                // The world-space bounding boxes of static ObjectRenderables which were added, updated, or deleted
+                std::vector<AABB> staticBoundingBoxes_worldSpace;
+
+                // The world-space bounding boxes of dynamic ObjectRenderables which were updated or deleted
+                std::vector<AABB> dynamicBoundingBoxes_worldSpace;
+
+                void Add(const AABB& boundingBox_worldSpace, bool isDynamic)
+                {
+                    if (isDynamic) { dynamicBoundingBoxes_worldSpace.push_back(boundingBox_worldSpace); }
+                    else           { staticBoundingBoxes_worldSpace.push_back(boundingBox_worldSpace); }
+                }
+            };
+
+            // Distance that the bounds of moving objects are expanded by within the dynamic tree, so that
+            // small movements don't have to modify the tree
+            static constexpr float DYNAMIC_OBJECTS_FAT_MARGIN = 0.1f;
+
+            /**
+             * A scene's spatial index. Objects start out in the static tree, which has tight bounds, and
+             * are moved to the dynamic tree, which has fat bounds, the first time their bounds change.
+             */
+            struct SceneObjectsBVH
+            {
+                ObjectsBVH staticTree{0.0f};
+                ObjectsBVH dynamicTree{DYNAMIC_OBJECTS_FAT_MARGIN};
+            };
+
+            /**
+             * Where an object lives within its scene's spatial index
+             */
+            struct ObjectTreeEntry
+            {
+                bool isDynamic{false};
+                ObjectsBVH::ProxyId proxyId{ObjectsBVH::NULL_PROXY};
             };
 
         private:
@@ -72,9 +160,20 @@ namespace Accela::Render
 
             static ObjectPayload ObjectToPayload(const ObjectRenderable& object);
             [[nodiscard]] std::expected<AABB, bool> GetObjectAABB(const ObjectRenderable& object) const;
+            [[nodiscard]] std::optional<float> GetRayDistanceToObject(const Ray& ray_worldSpace, const RenderableData<ObjectRenderable>& object) const;
 
             [[nodiscard]] std::vector<RenderableData<ObjectRenderable>> GetVisibleRenderableData(const std::string& sceneName, const Volume& volume) const;
 
+            void InsertIntoTree(const ObjectRenderable& object, const Volume& volume);
+            void MoveInTree(const ObjectRenderable& object, const Volume& oldVolume, const Volume& newVolume);
+            void RemoveFromTree(ObjectId objectId, const std::string& sceneName);
+
+            /**
+             * @return The ids of the scene's objects, from both of its trees, whose tree bounds pass the test
+             */
+            [[nodiscard]] std::vector<ObjectId> FetchSceneObjectIds(const std::string& sceneName,
+                                                                    const std::function<bool(const Volume&)>& volumeTest) const;
+
         private:
 
             Common::ILogger::Ptr m_logger;
@@ -88,10 +187,22 @@ namespace Accela::Render
             // In-memory representation of the scene. Entries in this vector directly map to entries
             // in the GPU payload buffer.
             std::vector<RenderableData<ObjectRenderable>> m_objects;
-            std::unordered_map<std::string, ObjectsRTree> m_objectsRTree;
+
+            // Per-scene spatial index of the scene's objects, and where each object (by id) lives within it
+            std::unordered_map<std::string, SceneObjectsBVH> m_objectsBVH;
+            std::vector<ObjectTreeEntry> m_objectTreeEntries;
+
+            // Per-scene world space bounds of the scene's objects, keyed by object id, for frustum culling
+            std::unordered_map<std::string, PackedBounds> m_objectsBounds;
 
             // In-GPU representation of the scene's objects
             std::shared_ptr<ItemBuffer<ObjectPayload>> m_objectPayloadBuffer;
+
+            // The LOD each object was last rendered with in a camera view (NO_LOD if none). Render-time
+            // selection state rather than scene data, so it's updated while rendering. Only valid while a
+            // single camera is rendered per frame; see SelectObjectLOD.
+            static constexpr uint8_t NO_LOD = UINT8_MAX;
+            mutable std::vector<uint8_t> m_objectCameraLODs;
     };
 }
 
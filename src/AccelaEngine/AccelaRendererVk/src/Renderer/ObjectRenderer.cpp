@@ -11,6 +11,7 @@
 
 #include "../Buffer/IBuffers.h"
 #include "../Buffer/CPUItemBuffer.h"
+#include "../Buffer/FrameRingBuffer.h"
 #include "../Program/IPrograms.h"
 #include "../Pipeline/PipelineUtil.h"
 #include "../Pipeline/IPipelineFactory.h"
@@ -20,6 +21,8 @@
 #include "../Texture/ITextures.h"
 #include "../Image/IImages.h"
 #include "../Light/ILights.h"
+#include "../Util/RadixSort.h"
+#include "../Util/Frustum.h"
 
 #include "../Vulkan/VulkanDebug.h"
 #include "../Vulkan/VulkanFramebuffer.h"
@@ -33,10 +36,21 @@
 #include <algorithm>
 #include <set>
 #include <ranges>
+#include <iterator>
 
 namespace Accela::Render
 {
 
+// Width of the CPU occlusion culling depth buffer. Its height follows the render resolution's aspect ratio.
+static constexpr uint32_t OCCLUSION_BUFFER_WIDTH = 256;
+
+// Max number of occluder triangles rasterized into each view's occlusion buffer
+static constexpr std::size_t MAX_OCCLUDER_TRIANGLES_PER_VIEW = 32768;
+
+static constexpr uint64_t SortKeyFieldMask(unsigned int numBits)
+{
+    return (uint64_t{1} << numBits) - 1;
+}
 
 ObjectRenderer::ObjectRenderer(Common::ILogger::Ptr logger,
                                Common::IMetrics::Ptr metrics,
@@ -88,6 +102,8 @@ void ObjectRenderer::Destroy()
     }
     m_programPipelineHashes.clear();
 
+    m_gpassOcclusionBuffers = std::nullopt;
+
     Renderer::Destroy();
 }
 
@@ -103,6 +119,9 @@ void ObjectRenderer::Render(const std::string& sceneName,
 {
     CmdBufferSectionLabel sectionLabel(m_vulkanObjs->GetCalls(), commandBuffer, "ObjectRenderer");
 
+    // A new frame's g-passes are starting; occlusion buffers from the previous frame are stale
+    if (renderType == RenderType::GpassDeferred) { m_gpassOcclusionBuffers = std::nullopt; }
+
     // Early bail out if there's no objects to be rendered
     if (m_renderables->GetObjects().GetData().empty()) { return; }
 
@@ -112,7 +131,7 @@ void ObjectRenderer::Render(const std::string& sceneName,
     //
     // Compile render batches from the scene's objects
     //
-    const auto renderBatches = CompileRenderBatches(sceneName, renderType, viewProjections);
+    const auto renderBatches = CompileRenderBatches(sceneName, renderType, viewProjections, shadowRenderData);
 
     //
     // Render each render batch
@@ -134,43 +153,48 @@ void ObjectRenderer::Render(const std::string& sceneName,
         m_metrics->SetCounterValue(Renderer_Object_Opaque_Objects_Rendered_Count, renderMetrics.numObjectRendered);
         m_metrics->SetCounterValue(Renderer_Object_Opaque_RenderBatch_Count, renderBatches.size());
         m_metrics->SetCounterValue(Renderer_Object_Opaque_DrawCalls_Count, renderMetrics.numDrawCalls);
+        m_metrics->SetCounterValue(Renderer_Object_Opaque_Triangles_Rendered_Count, renderMetrics.numTrianglesRendered);
     }
     else if (renderType == RenderType::GpassForward)
     {
         m_metrics->SetCounterValue(Renderer_Object_Transparent_Objects_Rendered_Count, renderMetrics.numObjectRendered);
         m_metrics->SetCounterValue(Renderer_Object_Transparent_RenderBatch_Count, renderBatches.size());
         m_metrics->SetCounterValue(Renderer_Object_Transparent_DrawCalls_Count, renderMetrics.numDrawCalls);
+        m_metrics->SetCounterValue(Renderer_Object_Transparent_Triangles_Rendered_Count, renderMetrics.numTrianglesRendered);
     }
 }
 
 std::vector<ObjectRenderer::ObjectRenderBatch> ObjectRenderer::CompileRenderBatches(
     const std::string& sceneName,
     const RenderType& renderType,
-    const std::vector<ViewProjection>& viewProjections) const
+    const std::vector<ViewProjection>& viewProjections,
+    const std::optional<ShadowRenderData>& shadowRenderData)
 {
     //
     // Compile the list of objects that should be rendered
     //
-    const auto objectsToRender = GetObjectsToRender(sceneName, renderType, viewProjections);
+    const auto objectsToRender = GetObjectsToRender(sceneName, renderType, viewProjections, shadowRenderData);
 
     //
     // Transform the objects to be rendered into sorted render batches
     //
-    return ObjectsToRenderBatches(renderType, objectsToRender);
+    return ObjectsToRenderBatches(renderType, viewProjections, objectsToRender);
 }
 
 std::vector<ObjectRenderable> ObjectRenderer::GetObjectsToRender(const std::string& sceneName,
                                                                  const RenderType& renderType,
-                                                                 const std::vector<ViewProjection>& viewProjections) const
+                                                                 const std::vector<ViewProjection>& viewProjections,
+                                                                 const std::optional<ShadowRenderData>& shadowRenderData)
 {
     const auto objectRenderDistance = m_vulkanObjs->GetRenderSettings().objectRenderDistance;
 
-    AABB totalViewSpaceAABB;
-
     //
-    // As we can be rendering for any number of view projections, create one total view space AABB which encompasses
-    // the AABBs of all the render view projections
+    // We can be rendering for any number of view projections (eyes, shadow cascades, cube faces), each of which
+    // is culled against individually
     //
+    std::vector<Frustum> viewFrustums_worldSpace;
+    viewFrustums_worldSpace.reserve(viewProjections.size());
+
     for (const auto& viewProjection : viewProjections)
     {
         // Adjust the far plane of the view projection so that we're only looking at objects within the max object render distance.
@@ -186,20 +210,38 @@ std::vector<ObjectRenderable> ObjectRenderer::GetObjectsToRender(const std::stri
             m_logger->Log(Common::LogLevel::Error, "GetObjectsToRender: Failed to reduce far plane distance");
         }
 
-        // Add this view projection's AABB to the total view space AABB
-        totalViewSpaceAABB.AddVolume(objectViewProjection.GetWorldSpaceAABB().GetVolume());
+        viewFrustums_worldSpace.push_back(Frustum::FromTransformation(objectViewProjection.GetTransformation()));
     }
 
     //
-    // Query ObjectRenderables for all valid objects in the scene within the bounds of the total view projection
+    // Query ObjectRenderables for all valid objects in the scene within any of the view frustums.
     //
-    auto objectsToRender = m_renderables->GetObjects()
-        .GetVisibleObjects(sceneName, totalViewSpaceAABB.GetVolume());
+    // Note that the views are rendered together, via multiview, so every object within any of the views is drawn
+    // into all of them; the per-view object lists only narrow which occlusion buffers objects are tested against.
+    //
+    auto visibleObjects = m_renderables->GetObjects().GetVisibleObjects(sceneName, viewFrustums_worldSpace);
+    auto& objectsToRender = visibleObjects.objects;
+
+    //
+    // Gather the objects which occlude other objects. Done before the objects are filtered by the render operation,
+    // as occluders hide objects from every camera pass, not just from the pass which renders them. Shadow passes
+    // aren't occlusion culled, as objects hidden from a light can still cast shadows into the camera's view.
+    //
+    const bool occlusionCulling = renderType != RenderType::Shadow && m_vulkanObjs->GetRenderSettings().objectOcclusionCulling;
+
+    std::vector<ObjectRenderable> occluders;
+
+    if (occlusionCulling)
+    {
+        std::ranges::copy_if(objectsToRender, std::back_inserter(occluders), [&](const ObjectRenderable& objectRenderable){
+            return IsOccluder(objectRenderable);
+        });
+    }
 
     //
     // Filter the objects by the render operation we're performing
     //
-    auto filteredObjectsView = objectsToRender | std::ranges::views::filter([&](const ObjectRenderable& objectRenderable){
+    const auto shouldRenderObject = [&](const ObjectRenderable& objectRenderable){
         //
         // If we're doing a shadow pass and the object shouldn't be included in shadow passes, filter it out
         //
@@ -208,6 +250,20 @@ std::vector<ObjectRenderable> ObjectRenderer::GetObjectsToRender(const std::stri
             return false;
         }
 
+        //
+        // If we're doing a shadow pass for only static or only dynamic objects, filter out the other kind
+        //
+        if (renderType == RenderType::Shadow && shadowRenderData && shadowRenderData->shadowCasters != ShadowCasters::All)
+        {
+            const bool isDynamic = m_renderables->GetObjects().IsObjectDynamic(objectRenderable.objectId);
+            const bool wantDynamic = shadowRenderData->shadowCasters == ShadowCasters::Dynamic;
+
+            if (isDynamic != wantDynamic)
+            {
+                return false;
+            }
+        }
+
         const auto loadedMaterial = m_materials->GetLoadedMaterial(objectRenderable.materialId);
         if (!loadedMaterial)
         {
@@ -247,156 +303,418 @@ std::vector<ObjectRenderable> ObjectRenderer::GetObjectsToRender(const std::stri
         }
 
         return true;
-    });
+    };
 
-    objectsToRender = std::vector<ObjectRenderable>(filteredObjectsView.begin(), filteredObjectsView.end());
+    std::vector<bool> renderObjects(objectsToRender.size());
 
-    return objectsToRender;
-}
+    for (std::size_t x = 0; x < objectsToRender.size(); ++x)
+    {
+        renderObjects[x] = shouldRenderObject(objectsToRender[x]);
+    }
 
-std::function<bool(const ObjectRenderer::ObjectRenderBatch&, const ObjectRenderer::ObjectRenderBatch&)> ObjectRenderer::BatchSortFunc =
-    [](const ObjectRenderer::ObjectRenderBatch& a, const ObjectRenderer::ObjectRenderBatch& b)
-{
-    // a
-    const auto aProgramName = a.params.programDef->GetProgramName();
-    const auto aMaterialId = a.params.loadedMaterial.material->materialId;
-    const auto aMaterialType = a.params.loadedMaterial.material->type;
-    BufferId aMeshDataBufferId{};
-    if (a.params.meshDataBuffer)
+    //
+    // Filter out objects which are hidden behind occluders
+    //
+    if (occlusionCulling)
     {
-        aMeshDataBufferId = (*a.params.meshDataBuffer)->GetBuffer()->GetBufferId();
+        CullOccludedObjects(sceneName, renderType, viewProjections, occluders, visibleObjects, renderObjects);
     }
 
-    // b
-    const auto bProgramName = b.params.programDef->GetProgramName();
-    const auto bMaterialId = b.params.loadedMaterial.material->materialId;
-    const auto bMaterialType = b.params.loadedMaterial.material->type;
-    BufferId bMeshDataBufferId{};
-    if (b.params.meshDataBuffer)
+    // Note: Filtered in place, rather than copying the objects to be rendered into a new vector
+    std::size_t numObjectsToRender = 0;
+
+    for (std::size_t x = 0; x < objectsToRender.size(); ++x)
     {
-        bMeshDataBufferId = (*b.params.meshDataBuffer)->GetBuffer()->GetBufferId();
+        if (!renderObjects[x]) { continue; }
+
+        if (x != numObjectsToRender)
+        {
+            objectsToRender[numObjectsToRender] = std::move(objectsToRender[x]);
+        }
+
+        numObjectsToRender++;
     }
 
-    //
-    // Sort batches by program, then by material type, then by material, then by (optional) mesh data buffer
-    //
-    return  std::tie(aProgramName, aMaterialType, aMaterialId, aMeshDataBufferId) <
-            std::tie(bProgramName, bMaterialType, bMaterialId, bMeshDataBufferId);
-};
+    objectsToRender.resize(numObjectsToRender);
 
-std::vector<ObjectRenderer::ObjectRenderBatch> ObjectRenderer::ObjectsToRenderBatches(const RenderType& renderType,
-                                                                                      const std::vector<ObjectRenderable>& objects) const
+    return std::move(visibleObjects.objects);
+}
+
+bool ObjectRenderer::IsOccluder(const ObjectRenderable& object) const
 {
-    //
-    // Add every object to its appropriate render batch
-    //
-    std::unordered_map<ObjectRenderBatch::Key, ObjectRenderBatch> renderBatches;
+    if (!object.occluder) { return false; }
+
+    // Only fully opaque objects can hide what's behind them
+    const auto loadedMaterial = m_materials->GetLoadedMaterial(object.materialId);
+    if (!loadedMaterial) { return false; }
+
+    const auto objectMaterial = std::dynamic_pointer_cast<ObjectMaterial>(loadedMaterial->material);
+    if (!objectMaterial || objectMaterial->properties.alphaMode != AlphaMode::Opaque) { return false; }
+
+    // Only meshes simple enough to be occluders have occluder geometry
+    const auto loadedMesh = m_meshes->GetLoadedMesh(object.meshId);
+
+    return loadedMesh && loadedMesh->occluderGeometry;
+}
+
+void ObjectRenderer::CullOccludedObjects(const std::string& sceneName,
+                                         const RenderType& renderType,
+                                         const std::vector<ViewProjection>& viewProjections,
+                                         const std::vector<ObjectRenderable>& occluders,
+                                         const ViewVisibleObjects& visibleObjects,
+                                         std::vector<bool>& renderObjects)
+{
+    std::vector<OcclusionStats> viewStats(viewProjections.size());
+    std::size_t numCulled = 0;
 
-    for (const auto& object : objects)
+    if (!occluders.empty() && !viewProjections.empty())
     {
         //
-        // Get the object's batch parameters
+        // Fetch an occlusion buffer, with the occluders rasterized into it, for each view
         //
-        const auto renderBatchParams = GetRenderBatchParams(renderType, object);
-        const auto drawBatchParams = GetDrawBatchParams(object);
+        const auto& viewsOcclusionBuffers = GetViewsOcclusionBuffers(sceneName, renderType, viewProjections, occluders);
+        const auto& occlusionBuffers = viewsOcclusionBuffers.occlusionBuffers;
 
-        if (!renderBatchParams || !drawBatchParams)
+        for (std::size_t v = 0; v < viewProjections.size(); ++v)
         {
-            continue;
+            viewStats[v].numOccluders = viewsOcclusionBuffers.viewStats[v].numOccluders;
+            viewStats[v].numOccluderTriangles = viewsOcclusionBuffers.viewStats[v].numOccluderTriangles;
         }
 
-        const auto renderBatchKey = GetBatchKey(*renderBatchParams);
-        const auto drawBatchKey = GetBatchKey(*drawBatchParams);
-
         //
-        // Insert the object into its render batch, or create the render batch if it doesn't exist yet
+        // Cull objects which are occluded within every view they're within. Occluders themselves are never culled;
+        // their bounds hug their own rasterized triangles too closely to be reliably tested against them.
         //
-        const auto renderBatchIt = renderBatches.find(renderBatchKey);
-        if (renderBatchIt != renderBatches.cend())
+        const auto& objects = visibleObjects.objects;
+        const auto& objectsData = m_renderables->GetObjects().GetData();
+
+        std::vector<bool> unoccluded(objects.size(), false);
+
+        for (std::size_t v = 0; v < occlusionBuffers.size(); ++v)
         {
-            AddObjectToRenderBatch(object, drawBatchKey, *drawBatchParams, renderBatchIt->second);
+            for (const auto& objectIndex : visibleObjects.viewObjectIndices[v])
+            {
+                if (!renderObjects[objectIndex] || unoccluded[objectIndex]) { continue; }
+
+                const auto& object = objects[objectIndex];
+
+                if (object.occluder || object.objectId.id > objectsData.size())
+                {
+                    unoccluded[objectIndex] = true;
+                    continue;
+                }
+
+                viewStats[v].numTested++;
+
+                const auto volume_worldSpace = objectsData[object.objectId.id - 1].boundingBox_worldSpace.GetVolume();
+
+                if (occlusionBuffers[v].IsVisible(volume_worldSpace))
+                {
+                    unoccluded[objectIndex] = true;
+                }
+            }
         }
-        else
-        {
-            const auto renderBatch = CreateRenderBatch(
-                object,
-                drawBatchKey,
-                *drawBatchParams,
-                renderBatchKey,
-                *renderBatchParams
-            );
 
-            renderBatches.insert({renderBatchKey, renderBatch});
+        for (std::size_t x = 0; x < objects.size(); ++x)
+        {
+            if (renderObjects[x] && !unoccluded[x])
+            {
+                renderObjects[x] = false;
+                numCulled++;
+            }
         }
     }
 
     //
-    // Transform the batches map to a batches vector
+    // Metrics; per-view statistics are summed across the views
     //
-    std::vector<ObjectRenderBatch> batchesVec;
-    batchesVec.reserve(renderBatches.size());
+    OcclusionStats totalStats{};
 
-    std::ranges::transform(renderBatches, std::back_inserter(batchesVec),[](const auto& kv){
-        return kv.second;
-    });
+    for (const auto& stats : viewStats)
+    {
+        totalStats.numOccluders += stats.numOccluders;
+        totalStats.numOccluderTriangles += stats.numOccluderTriangles;
+        totalStats.numTested += stats.numTested;
+    }
+
+    if (renderType == RenderType::GpassDeferred)
+    {
+        m_metrics->SetCounterValue(Renderer_Object_Opaque_Occluders_Count, totalStats.numOccluders);
+        m_metrics->SetCounterValue(Renderer_Object_Opaque_Occluder_Triangles_Count, totalStats.numOccluderTriangles);
+        m_metrics->SetCounterValue(Renderer_Object_Opaque_Occlusion_Tested_Count, totalStats.numTested);
+        m_metrics->SetCounterValue(Renderer_Object_Opaque_Occlusion_Culled_Count, numCulled);
+    }
+    else if (renderType == RenderType::GpassForward)
+    {
+        m_metrics->SetCounterValue(Renderer_Object_Transparent_Occluders_Count, totalStats.numOccluders);
+        m_metrics->SetCounterValue(Renderer_Object_Transparent_Occluder_Triangles_Count, totalStats.numOccluderTriangles);
+        m_metrics->SetCounterValue(Renderer_Object_Transparent_Occlusion_Tested_Count, totalStats.numTested);
+        m_metrics->SetCounterValue(Renderer_Object_Transparent_Occlusion_Culled_Count, numCulled);
+    }
+}
+
+const ObjectRenderer::ViewsOcclusionBuffers& ObjectRenderer::GetViewsOcclusionBuffers(
+    const std::string& sceneName,
+    const RenderType& renderType,
+    const std::vector<ViewProjection>& viewProjections,
+    const std::vector<ObjectRenderable>& occluders)
+{
+    std::vector<glm::mat4> viewProjectionTransforms;
+    viewProjectionTransforms.reserve(viewProjections.size());
+
+    for (const auto& viewProjection : viewProjections)
+    {
+        viewProjectionTransforms.push_back(viewProjection.GetTransformation());
+    }
 
     //
-    // Sort the render batches for efficient rendering with minimal descriptor set changes
+    // GpassForward renders the same views as the GpassDeferred render before it in the frame, which sees the same
+    // occluders, so it reuses that render's occlusion buffers. GpassDeferred always rasterizes its own, so buffers
+    // are never carried over from a previous frame.
     //
-    std::ranges::sort(batchesVec, BatchSortFunc);
+    if (renderType == RenderType::GpassForward &&
+        m_gpassOcclusionBuffers &&
+        m_gpassOcclusionBuffers->sceneName == sceneName &&
+        m_gpassOcclusionBuffers->viewProjectionTransforms == viewProjectionTransforms)
+    {
+        return *m_gpassOcclusionBuffers;
+    }
+
+    const auto& resolution = m_vulkanObjs->GetRenderSettings().resolution;
+    const auto bufferHeight = std::max(1U, (OCCLUSION_BUFFER_WIDTH * resolution.h) / std::max(1U, resolution.w));
+
+    ViewsOcclusionBuffers viewsOcclusionBuffers{};
+    viewsOcclusionBuffers.sceneName = sceneName;
+    viewsOcclusionBuffers.viewProjectionTransforms = std::move(viewProjectionTransforms);
+    viewsOcclusionBuffers.occlusionBuffers.reserve(viewProjections.size());
+    viewsOcclusionBuffers.viewStats.resize(viewProjections.size());
+
+    for (std::size_t v = 0; v < viewProjections.size(); ++v)
+    {
+        auto& occlusionBuffer = viewsOcclusionBuffers.occlusionBuffers.emplace_back(OCCLUSION_BUFFER_WIDTH, bufferHeight);
+        viewsOcclusionBuffers.viewStats[v] = RasterizeOccluders(viewProjections[v], occluders, occlusionBuffer);
+    }
 
-    return batchesVec;
+    m_gpassOcclusionBuffers = std::move(viewsOcclusionBuffers);
+
+    return *m_gpassOcclusionBuffers;
 }
 
-void ObjectRenderer::AddObjectToRenderBatch(const ObjectRenderable& object,
-                                            const ObjectDrawBatch::Key& drawBatchKey,
-                                            const ObjectDrawBatchParams& drawBatchParams,
-                                            ObjectRenderBatch& renderBatch)
+ObjectRenderer::OcclusionStats ObjectRenderer::RasterizeOccluders(const ViewProjection& viewProjection,
+                                                                  const std::vector<ObjectRenderable>& occluders,
+                                                                  OcclusionBuffer& occlusionBuffer) const
 {
+    OcclusionStats stats{};
+
+    occlusionBuffer.Reset(viewProjection.GetTransformation());
+
     //
-    // Add the object to an existing draw batch, if possible
+    // Rasterize the occluders nearest first, as near occluders hide the most, until the view's triangle budget
+    // is spent
     //
-    for (auto& drawBatch : renderBatch.drawBatches)
+    std::vector<std::pair<float, const ObjectRenderable*>> sortedOccluders;
+    sortedOccluders.reserve(occluders.size());
+
+    for (const auto& occluder : occluders)
     {
-        if (drawBatch.key == drawBatchKey)
-        {
-            drawBatch.objects.push_back(object);
-            return;
-        }
+        const float viewDepth = -(viewProjection.viewTransform * occluder.modelTransform[3]).z;
+        sortedOccluders.emplace_back(viewDepth, &occluder);
     }
 
+    std::ranges::sort(sortedOccluders, {}, [](const auto& sortedOccluder){ return sortedOccluder.first; });
+
+    for (const auto& sortedOccluder : sortedOccluders)
+    {
+        const auto& occluder = *sortedOccluder.second;
+
+        const auto loadedMesh = m_meshes->GetLoadedMesh(occluder.meshId);
+        if (!loadedMesh || !loadedMesh->occluderGeometry) { continue; }
+
+        const auto& occluderGeometry = *loadedMesh->occluderGeometry;
+
+        if (stats.numOccluderTriangles + (occluderGeometry.indices.size() / 3) > MAX_OCCLUDER_TRIANGLES_PER_VIEW) { continue; }
+
+        // Match the GPU, which only renders an object's back faces when its material is two sided
+        const auto loadedMaterial = m_materials->GetLoadedMaterial(occluder.materialId);
+        if (!loadedMaterial) { continue; }
+
+        const auto objectMaterial = std::dynamic_pointer_cast<ObjectMaterial>(loadedMaterial->material);
+        if (!objectMaterial) { continue; }
+
+        stats.numOccluderTriangles += occlusionBuffer.RasterizeOccluder(
+            occluderGeometry.positions,
+            occluderGeometry.indices,
+            occluder.modelTransform,
+            !objectMaterial->properties.twoSided
+        );
+        stats.numOccluders++;
+    }
+
+    return stats;
+}
+
+std::vector<ObjectRenderer::ObjectSortItem> ObjectRenderer::GetSortedObjects(const RenderType& renderType,
+                                                                           const std::vector<ViewProjection>& viewProjections,
+                                                                           const std::vector<ObjectRenderable>& objects) const
+{
+    //
+    // Loaded meshes (whose types determine the program used to render objects, and whose LODs are selected
+    // from), looked up once per mesh rather than once per object
+    //
+    std::unordered_map<MeshId, std::optional<LoadedMesh>> loadedMeshes;
+
+    //
+    // Mesh LODs are selected relative to the first view projection. Only camera views maintain LOD hysteresis
+    // state; shadow views select their LODs independently.
+    //
+    const auto& renderSettings = m_vulkanObjs->GetRenderSettings();
+    const bool isCameraView = renderType != RenderType::Shadow;
+
     //
-    // Otherwise, create a new draw batch
+    // Objects are ordered by depth relative to the first view projection, normalized over the
+    // object render distance
     //
-    ObjectDrawBatch drawBatch{};
-    drawBatch.key = drawBatchKey;
-    drawBatch.params = drawBatchParams;
-    drawBatch.objects.push_back(object);
+    const glm::mat4 viewTransform = viewProjections.empty() ? glm::mat4(1.0f) : viewProjections.front().viewTransform;
+    const float maxDepth = std::max(renderSettings.objectRenderDistance, 1.0f);
+    constexpr auto maxDepthValue = SortKeyFieldMask(SortKey_DepthBits);
+
+    std::vector<ObjectSortItem> sortItems;
+    sortItems.reserve(objects.size());
+
+    for (uint32_t x = 0; x < objects.size(); ++x)
+    {
+        const auto& object = objects[x];
+
+        auto loadedMeshIt = loadedMeshes.find(object.meshId);
+        if (loadedMeshIt == loadedMeshes.cend())
+        {
+            loadedMeshIt = loadedMeshes.insert({object.meshId, m_meshes->GetLoadedMesh(object.meshId)}).first;
+        }
+
+        // Objects whose mesh isn't loaded can't be rendered
+        if (!loadedMeshIt->second) { continue; }
+
+        const auto& loadedMesh = *loadedMeshIt->second;
+
+        uint8_t lod = 0;
+        if (!viewProjections.empty())
+        {
+            lod = m_renderables->GetObjects().SelectObjectLOD(
+                object.objectId, loadedMesh, viewProjections.front(), renderSettings, isCameraView
+            );
+        }
+
+        const float viewDepth = -(viewTransform * object.modelTransform[3]).z;
+        const auto depth = static_cast<SortKey>(std::clamp(viewDepth / maxDepth, 0.0f, 1.0f) * static_cast<float>(maxDepthValue));
 
-    renderBatch.drawBatches.push_back(drawBatch);
+        const SortKey batchKey =
+            ((static_cast<SortKey>(loadedMesh.meshType) & SortKeyFieldMask(SortKey_ProgramBits)) << SortKey_ProgramShift) |
+            ((static_cast<SortKey>(object.materialId.id) & SortKeyFieldMask(SortKey_MaterialBits)) << SortKey_MaterialShift) |
+            ((static_cast<SortKey>(object.meshId.id) & SortKeyFieldMask(SortKey_MeshBits)) << SortKey_MeshShift) |
+            ((static_cast<SortKey>(lod) & SortKeyFieldMask(SortKey_LODBits)) << SortKey_LODShift);
+
+        SortKey key = batchKey | depth;
+
+        // Translucent objects are drawn back to front, regardless of what they're drawn with, so that they
+        // blend correctly. Batches then only form from runs of objects that can be drawn together.
+        if (renderType == RenderType::GpassForward)
+        {
+            key = ((maxDepthValue - depth) << (64 - SortKey_DepthBits)) | (batchKey >> SortKey_DepthBits);
+        }
+
+        sortItems.push_back({.key = key, .batchKey = batchKey, .objectIndex = x, .lod = lod});
+    }
+
+    RadixSort64(sortItems, [](const ObjectSortItem& item){ return item.key; });
+
+    return sortItems;
 }
 
-ObjectRenderer::ObjectRenderBatch ObjectRenderer::CreateRenderBatch(
-    const ObjectRenderable& object,
-    const ObjectDrawBatch::Key& drawBatchKey,
-    const ObjectDrawBatchParams& drawBatchParams,
-    const ObjectRenderBatch::Key& renderBatchKey,
-    const ObjectRenderBatchParams& renderBatchParams)
+std::vector<ObjectRenderer::ObjectRenderBatch> ObjectRenderer::ObjectsToRenderBatches(const RenderType& renderType,
+                                                                                      const std::vector<ViewProjection>& viewProjections,
+                                                                                      const std::vector<ObjectRenderable>& objects) const
 {
-    ObjectDrawBatch drawBatch{};
-    drawBatch.key = drawBatchKey;
-    drawBatch.params = drawBatchParams;
-    drawBatch.objects.push_back(object);
+    //
+    // Sort the objects by their sort keys, which places objects that can be rendered together next to each other
+    //
+    const auto sortedObjects = GetSortedObjects(renderType, viewProjections, objects);
+
+    //
+    // Walk the sorted objects, starting a new render batch whenever the program/material/mesh data changes, and a
+    // new (instanced) draw batch whenever the mesh or mesh LOD changes. Note that the actual ids are compared in addition to the
+    // keys, as ids can be truncated within the keys.
+    //
+    std::vector<ObjectRenderBatch> renderBatches;
+
+    std::optional<SortKey> curRenderBatchKey;
+    std::optional<SortKey> curDrawBatchKey;
+    BufferId curMeshDataBufferId{};
+    MaterialId curMaterialId{};
+    MeshId curMeshId{};
+    uint8_t curLOD{0};
+
+    for (const auto& sortItem : sortedObjects)
+    {
+        const auto& object = objects[sortItem.objectIndex];
+
+        const auto renderBatchKey = sortItem.batchKey >> SortKey_MaterialShift;
+        const auto drawBatchKey = sortItem.batchKey >> SortKey_LODShift;
 
-    // TODO! When running translucent forward pass need to sort objects by
-    //  distance from camera, probably need to have only 1 batch per object?
+        const bool newDrawBatch = !curDrawBatchKey ||
+                                  *curDrawBatchKey != drawBatchKey ||
+                                  object.meshId != curMeshId ||
+                                  sortItem.lod != curLOD ||
+                                  object.materialId != curMaterialId;
+        if (newDrawBatch)
+        {
+            curDrawBatchKey = std::nullopt;
+
+            const auto drawBatchParams = GetDrawBatchParams(object);
+            if (!drawBatchParams) { continue; }
+
+            BufferId meshDataBufferId{};
+            if (drawBatchParams->loadedMesh.dataBuffer)
+            {
+                meshDataBufferId = (*drawBatchParams->loadedMesh.dataBuffer)->GetBuffer()->GetBufferId();
+            }
+
+            const bool newRenderBatch = !curRenderBatchKey ||
+                                        *curRenderBatchKey != renderBatchKey ||
+                                        object.materialId != curMaterialId ||
+                                        meshDataBufferId != curMeshDataBufferId;
+            if (newRenderBatch)
+            {
+                curRenderBatchKey = std::nullopt;
 
-    ObjectRenderBatch renderBatch{};
-    renderBatch.key = renderBatchKey;
-    renderBatch.params = renderBatchParams;
-    renderBatch.drawBatches.push_back(drawBatch);
+                const auto renderBatchParams = GetRenderBatchParams(renderType, object, drawBatchParams->loadedMesh);
+                if (!renderBatchParams) { continue; }
 
-    return renderBatch;
+                ObjectRenderBatch renderBatch{};
+                renderBatch.params = *renderBatchParams;
+                renderBatches.push_back(std::move(renderBatch));
+
+                curRenderBatchKey = renderBatchKey;
+                curMeshDataBufferId = meshDataBufferId;
+            }
+
+            ObjectDrawBatch drawBatch{};
+            drawBatch.params = *drawBatchParams;
+            drawBatch.lod = sortItem.lod;
+            drawBatch.firstInstance = static_cast<uint32_t>(renderBatches.back().instances.size());
+            renderBatches.back().drawBatches.push_back(drawBatch);
+
+            curDrawBatchKey = drawBatchKey;
+            curMaterialId = object.materialId;
+            curMeshId = object.meshId;
+            curLOD = sortItem.lod;
+        }
+
+        auto& renderBatch = renderBatches.back();
+        renderBatch.instances.push_back(object.objectId);
+        renderBatch.drawBatches.back().instanceCount++;
+    }
+
+    return renderBatches;
 }
 
 std::expected<ProgramDefPtr, bool> ObjectRenderer::GetMeshProgramDef(const RenderType& renderType, const LoadedMesh& loadedMesh) const
@@ -483,29 +801,27 @@ void ObjectRenderer::RenderBatch(const std::string& sceneName,
     if (!BindDescriptorSet3(bindState, renderBatch, commandBuffer)) { return; }
 
     //
-    // Draw
+    // Draw; one instanced draw per mesh LOD in the batch
     //
-    std::size_t instanceIndex = 0;
-
     for (const auto& drawBatch : renderBatch.drawBatches)
     {
         const auto& drawBatchMesh = drawBatch.params.loadedMesh;
+        const auto& drawBatchLOD = drawBatchMesh.lods[std::min<std::size_t>(drawBatch.lod, drawBatchMesh.numLODs - 1)];
 
         BindVertexBuffer(bindState, commandBuffer, drawBatchMesh.verticesBuffer->GetBuffer());
         BindIndexBuffer(bindState, commandBuffer, drawBatchMesh.indicesBuffer->GetBuffer());
 
         commandBuffer->CmdDrawIndexed(
-            drawBatchMesh.numIndices,
-            drawBatch.objects.size(),
-            drawBatchMesh.indicesOffset,
+            drawBatchLOD.indexCount,
+            drawBatch.instanceCount,
+            drawBatchMesh.indicesOffset + drawBatchLOD.firstIndex,
             (int32_t)drawBatchMesh.verticesOffset,
-            instanceIndex
+            drawBatch.firstInstance
         );
 
-        instanceIndex += drawBatch.objects.size();
-
-        renderMetrics.numObjectRendered += drawBatch.objects.size();
+        renderMetrics.numObjectRendered += drawBatch.instanceCount;
         renderMetrics.numDrawCalls++;
+        renderMetrics.numTrianglesRendered += (std::size_t)(drawBatchLOD.indexCount / 3) * drawBatch.instanceCount;
     }
 }
 
@@ -1155,59 +1471,37 @@ bool ObjectRenderer::BindDescriptorSet3_DrawData(const BindState& bindState,
                                                  const VulkanDescriptorSetPtr& drawDescriptorSet,
                                                  const BufferId& batchMeshDataBufferId) const
 {
-    std::size_t renderBatchNumObjects = 0;
-
-    for (const auto& drawBatch : renderBatch.drawBatches)
-    {
-        renderBatchNumObjects += drawBatch.objects.size();
-    }
-
     //
-    // Create a per-render CPU buffer to hold draw data
+    // Allocate space in the frame's ring buffer to hold draw data
     //
-    const auto drawDataBufferExpect = CPUItemBuffer<ObjectDrawPayload>::Create(
-        m_buffers,
-        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
-        renderBatchNumObjects,
-        std::format("ObjectRenderer-DrawData-{}-{}-{}", m_frameIndex, batchMeshDataBufferId.id, renderBatch.params.loadedMaterial.material->materialId.id)
-    );
-    if (!drawDataBufferExpect)
+    const auto drawDataAllocation = m_frameRingBuffer->Allocate(renderBatch.instances.size() * sizeof(ObjectDrawPayload));
+    if (!drawDataAllocation)
     {
-        m_logger->Log(Common::LogLevel::Error, "ObjectRenderer::BindDescriptorSet3_DrawData: Failed to create draw data buffer");
+        m_logger->Log(Common::LogLevel::Error,
+          "ObjectRenderer::BindDescriptorSet3_DrawData: Failed to allocate draw data for mesh data buffer {}", batchMeshDataBufferId.id);
         return false;
     }
-    const auto& drawDataBuffer = *drawDataBufferExpect;
 
     //
-    // Convert the batch objects to be rendered to DrawPayloads
+    // Convert the batch objects to be rendered to DrawPayloads, written directly into the mapped allocation
     //
-    std::vector<ObjectDrawPayload> drawPayloads;
+    auto* pDrawPayloads = static_cast<ObjectDrawPayload*>(drawDataAllocation->pMappedData);
 
-    for (const auto& drawBatch : renderBatch.drawBatches)
-    {
-        std::ranges::transform(drawBatch.objects, std::back_inserter(drawPayloads), [&](const ObjectRenderable& object) {
-            ObjectDrawPayload drawPayload{};
-            drawPayload.dataIndex = object.objectId.id - 1;
-            drawPayload.materialIndex = renderBatch.params.loadedMaterial.payloadIndex;
-            return drawPayload;
-        });
-    }
-
-    drawDataBuffer->PushBack(ExecutionContext::CPU(), drawPayloads);
+    std::ranges::transform(renderBatch.instances, pDrawPayloads, [&](const ObjectId& objectId) {
+        ObjectDrawPayload drawPayload{};
+        drawPayload.dataIndex = objectId.id - 1;
+        drawPayload.materialIndex = renderBatch.params.loadedMaterial.payloadIndex;
+        return drawPayload;
+    });
 
     drawDescriptorSet->WriteBufferBind(
         (*bindState.programDef)->GetBindingDetailsByName("i_drawData"),
         VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-        drawDataBuffer->GetBuffer()->GetVkBuffer(),
-        0,
-        0
+        drawDataAllocation->vkBuffer,
+        drawDataAllocation->byteOffset,
+        drawDataAllocation->byteSize
     );
 
-    //
-    // Cleanup
-    //
-    m_postExecutionOps->Enqueue_Current(BufferDeleteOp(m_buffers, drawDataBuffer->GetBuffer()->GetBufferId()));
-
     return true;
 }
 
@@ -1239,8 +1533,8 @@ bool ObjectRenderer::BindDescriptorSet3_BoneData(const BindState& bindState,
     //
     const auto& objectsData = m_renderables->GetObjects().GetData();
 
-    const auto sampleBoneTransforms =
-        objectsData[renderBatch.drawBatches.at(0).objects.at(0).objectId.id - 1]
+    const auto& sampleBoneTransforms =
+        objectsData[renderBatch.instances.at(0).id - 1]
             .renderable.boneTransforms;
 
     // If there's no bone data to be bound, nothing to do
@@ -1252,68 +1546,46 @@ bool ObjectRenderer::BindDescriptorSet3_BoneData(const BindState& bindState,
     //
     // Compile bone data for the render batch
     //
-    std::size_t renderBatchNumObjects = 0;
-
-    for (const auto& drawBatch : renderBatch.drawBatches)
-    {
-        renderBatchNumObjects += drawBatch.objects.size();
-    }
+    const auto renderBatchNumObjects = renderBatch.instances.size();
 
     const auto meshNumBones = sampleBoneTransforms->size();
     const auto meshBonesByteSize = meshNumBones * sizeof(glm::mat4);
 
-    std::vector<glm::mat4> allObjectsBoneTransforms;
-    allObjectsBoneTransforms.resize(renderBatchNumObjects * meshNumBones);
-
-    std::size_t boneTransformIndex = 0;
-
-    for (const auto& drawBatch : renderBatch.drawBatches)
+    //
+    // Allocate space in the frame's ring buffer to hold the batch's bone palettes
+    //
+    const auto boneDataAllocation = m_frameRingBuffer->Allocate(renderBatchNumObjects * meshBonesByteSize);
+    if (!boneDataAllocation)
     {
-        for (const auto& object : drawBatch.objects)
-        {
-            memcpy(
-                (unsigned char *)allObjectsBoneTransforms.data() + (boneTransformIndex * meshBonesByteSize),
-                objectsData[object.objectId.id - 1].renderable.boneTransforms->data(),
-                meshBonesByteSize
-            );
-
-            boneTransformIndex++;
-        }
+        m_logger->Log(Common::LogLevel::Error,
+          "ObjectRenderer::BindDescriptorSet3_BoneData: Failed to allocate bone data for material {}",
+          renderBatch.params.loadedMaterial.material->materialId.id);
+        return false;
     }
 
     //
-    // Create and update a buffer to hold bone transforms
+    // Copy each object's bone palette directly into the mapped allocation
     //
-    const auto boneTransformsBufferExpect = CPUItemBuffer<glm::mat4>::Create(
-        m_buffers,
-        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
-        allObjectsBoneTransforms.size(),
-        std::format("ObjectRenderer-DS3-BoneTransforms-{}-{}", renderBatch.params.loadedMaterial.material->materialId.id, m_frameIndex)
-    );
-    if (!boneTransformsBufferExpect)
+    for (std::size_t x = 0; x < renderBatch.instances.size(); ++x)
     {
-        m_logger->Log(Common::LogLevel::Error, "ObjectRenderer::UpdateDrawDescriptorSet_BoneData: Failed to create bone data buffer");
-        return false;
+        memcpy(
+            (unsigned char *)boneDataAllocation->pMappedData + (x * meshBonesByteSize),
+            objectsData[renderBatch.instances[x].id - 1].renderable.boneTransforms->data(),
+            meshBonesByteSize
+        );
     }
 
-    (*boneTransformsBufferExpect)->Update(ExecutionContext::CPU(), 0, allObjectsBoneTransforms);
-
     //
     // Bind bone data
     //
     drawDescriptorSet->WriteBufferBind(
         (*bindState.programDef)->GetBindingDetailsByName("i_boneData"),
         VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-        (*boneTransformsBufferExpect)->GetBuffer()->GetVkBuffer(),
-        0,
-        0
+        boneDataAllocation->vkBuffer,
+        boneDataAllocation->byteOffset,
+        boneDataAllocation->byteSize
     );
 
-    //
-    // Cleanup
-    //
-    m_postExecutionOps->Enqueue_Current(BufferDeleteOp(m_buffers, (*boneTransformsBufferExpect)->GetBuffer()->GetBufferId()));
-
     return true;
 }
 
@@ -1473,21 +1745,16 @@ std::expected<ObjectRenderer::ObjectDrawBatchParams, bool> ObjectRenderer::GetDr
 }
 
 std::expected<ObjectRenderer::ObjectRenderBatchParams, bool> ObjectRenderer::GetRenderBatchParams(const RenderType& renderType,
-                                                                                                 const ObjectRenderable& object) const
+                                                                                                 const ObjectRenderable& object,
+                                                                                                 const LoadedMesh& loadedMesh) const
 {
-    const auto loadedMeshOpt = m_meshes->GetLoadedMesh(object.meshId);
-    if (!loadedMeshOpt)
-    {
-        return std::unexpected(false);
-    }
-
     const auto loadedMaterialOpt = m_materials->GetLoadedMaterial(object.materialId);
     if (!loadedMaterialOpt)
     {
         return std::unexpected(false);
     }
 
-    const auto programDefExpect = GetMeshProgramDef(renderType, *loadedMeshOpt);
+    const auto programDefExpect = GetMeshProgramDef(renderType, loadedMesh);
     if (!programDefExpect)
     {
         return std::unexpected(false);
@@ -1496,27 +1763,9 @@ std::expected<ObjectRenderer::ObjectRenderBatchParams, bool> ObjectRenderer::Get
     ObjectRenderBatchParams params{};
     params.programDef = *programDefExpect;
     params.loadedMaterial = *loadedMaterialOpt;
-    params.meshDataBuffer = loadedMeshOpt->dataBuffer;
+    params.meshDataBuffer = loadedMesh.dataBuffer;
 
     return params;
 }
 
-ObjectRenderer::ObjectDrawBatch::Key ObjectRenderer::GetBatchKey(const ObjectDrawBatchParams& params)
-{
-    return std::hash<std::string>{}(std::format("{}", params.loadedMesh.id.id));
-}
-
-ObjectRenderer::ObjectRenderBatch::Key ObjectRenderer::GetBatchKey(const ObjectRenderBatchParams& params)
-{
-    BufferId meshDataBufferId{};
-
-    if (params.meshDataBuffer)
-    {
-        meshDataBufferId = (*params.meshDataBuffer)->GetBuffer()->GetBufferId();
-    }
-
-    return std::hash<std::string>{}(std::format("{}-{}-{}",
-        params.programDef->GetProgramName(), params.loadedMaterial.material->materialId.id, meshDataBufferId.id));
-}
-
 }
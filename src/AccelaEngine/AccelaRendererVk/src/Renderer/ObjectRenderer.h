@@ -16,6 +16,7 @@
 #include "../Mesh/LoadedMesh.h"
 #include "../Material/LoadedMaterial.h"
 #include "../Util/ViewProjection.h"
+#include "../Util/OcclusionBuffer.h"
 #include "../Renderables/RenderableData.h"
 
 #include <Accela/Render/Task/RenderParams.h>
@@ -28,22 +29,29 @@
 #include <utility>
 #include <algorithm>
 #include <functional>
+#include <string>
 
 namespace Accela::Render
 {
+    struct ViewVisibleObjects;
+
     class ObjectRenderer : public Renderer
     {
         public:
 
             struct ShadowRenderData
             {
-                ShadowRenderData(ShadowMapType _shadowMapType, float _lightMaxAffectRange)
+                ShadowRenderData(ShadowMapType _shadowMapType,
+                                 float _lightMaxAffectRange,
+                                 ShadowCasters _shadowCasters = ShadowCasters::All)
                     : shadowMapType(_shadowMapType)
                     , lightMaxAffectRange(_lightMaxAffectRange)
+                    , shadowCasters(_shadowCasters)
                 { }
 
                 ShadowMapType shadowMapType;
                 float lightMaxAffectRange;
+                ShadowCasters shadowCasters; // Which of the shadow casting objects are rendered
             };
 
         public:
@@ -80,19 +88,61 @@ namespace Accela::Render
 
         private:
 
+            /**
+             * 64-bit, radix-sortable, key which determines the order objects are rendered in. From most
+             * to least significant bits: [ program : 2 | material : 24 | mesh : 21 | lod : 3 | depth : 14 ]
+             *
+             * Consecutive objects which share a program and material are rendered in the same render
+             * batch, and consecutive objects which also share a mesh and mesh LOD are drawn with one
+             * instanced draw.
+             * Depth orders the instances within a draw, front to back. Ids which don't fit within their
+             * field are truncated, which costs extra batches but never merges objects which can't be
+             * drawn together.
+             *
+             * Translucent objects have to be drawn back to front across all batches to blend correctly, so
+             * for them the (inverted) depth is moved to the most significant bits, and the remaining fields
+             * only group objects at the same quantized depth.
+             */
+            using SortKey = uint64_t;
+
+            static constexpr unsigned int SortKey_DepthBits = 14;
+            static constexpr unsigned int SortKey_LODBits = 3;
+            static constexpr unsigned int SortKey_MeshBits = 21;
+            static constexpr unsigned int SortKey_MaterialBits = 24;
+            static constexpr unsigned int SortKey_ProgramBits = 2;
+
+            static constexpr unsigned int SortKey_LODShift = SortKey_DepthBits;
+            static constexpr unsigned int SortKey_MeshShift = SortKey_LODShift + SortKey_LODBits;
+            static constexpr unsigned int SortKey_MaterialShift = SortKey_MeshShift + SortKey_MeshBits;
+            static constexpr unsigned int SortKey_ProgramShift = SortKey_MaterialShift + SortKey_MaterialBits;
+
+            static_assert(SortKey_ProgramShift + SortKey_ProgramBits == 64);
+            static_assert((1U << SortKey_LODBits) >= MAX_MESH_LODS);
+
+            struct ObjectSortItem
+            {
+                SortKey key{0};         // Key the objects are sorted by
+                SortKey batchKey{0};    // Key in the standard layout, which batches are formed from
+                uint32_t objectIndex{0};
+                uint8_t lod{0};
+            };
+
             struct ObjectDrawBatchParams
             {
                 LoadedMesh loadedMesh;
             };
 
-            // A draw batch contains all objects which can be drawn with the same draw call
+            // A draw batch contains all objects which can be drawn with the same (instanced) draw call
             struct ObjectDrawBatch
             {
-                using Key = std::size_t;
-
-                Key key;
                 ObjectDrawBatchParams params;
-                std::vector<ObjectRenderable> objects;
+
+                // The mesh LOD which the draw batch draws
+                uint8_t lod{0};
+
+                // Range of the render batch's instances which the draw batch draws
+                uint32_t firstInstance{0};
+                uint32_t instanceCount{0};
             };
 
             struct ObjectRenderBatchParams
@@ -105,17 +155,35 @@ namespace Accela::Render
             // A render batch contains all objects which can be drawn with the same DS data bound
             struct ObjectRenderBatch
             {
-                using Key = std::size_t;
-
-                Key key;
                 ObjectRenderBatchParams params;
                 std::vector<ObjectDrawBatch> drawBatches;
+
+                // The objects drawn by the batch, in draw order. Entry i is drawn as instance i.
+                std::vector<ObjectId> instances;
+            };
+
+            // Per-view statistics of a CPU occlusion culling pass
+            struct OcclusionStats
+            {
+                std::size_t numOccluders{0};            // Occluders rasterized into the view's occlusion buffer
+                std::size_t numOccluderTriangles{0};    // Occluder triangles rasterized into the view's occlusion buffer
+                std::size_t numTested{0};               // Objects tested against the view's occlusion buffer
+            };
+
+            // Occlusion buffers rasterized for a set of views, which the g-passes rendering those views share
+            struct ViewsOcclusionBuffers
+            {
+                std::string sceneName;
+                std::vector<glm::mat4> viewProjectionTransforms;
+                std::vector<OcclusionBuffer> occlusionBuffers;
+                std::vector<OcclusionStats> viewStats;
             };
 
             struct RenderMetrics
             {
                 std::size_t numObjectRendered{0};
                 std::size_t numDrawCalls{0};
+                std::size_t numTrianglesRendered{0};
             };
 
         private:
@@ -126,35 +194,47 @@ namespace Accela::Render
 
             [[nodiscard]] std::vector<ObjectRenderBatch> CompileRenderBatches(const std::string& sceneName,
                                                                               const RenderType& renderType,
-                                                                              const std::vector<ViewProjection>& viewProjections) const;
+                                                                              const std::vector<ViewProjection>& viewProjections,
+                                                                              const std::optional<ShadowRenderData>& shadowRenderData);
 
             [[nodiscard]] std::vector<ObjectRenderable> GetObjectsToRender(const std::string& sceneName,
                                                                            const RenderType& renderType,
-                                                                           const std::vector<ViewProjection>& viewProjections) const;
+                                                                           const std::vector<ViewProjection>& viewProjections,
+                                                                           const std::optional<ShadowRenderData>& shadowRenderData);
+
+            [[nodiscard]] bool IsOccluder(const ObjectRenderable& object) const;
+
+            void CullOccludedObjects(const std::string& sceneName,
+                                     const RenderType& renderType,
+                                     const std::vector<ViewProjection>& viewProjections,
+                                     const std::vector<ObjectRenderable>& occluders,
+                                     const ViewVisibleObjects& visibleObjects,
+                                     std::vector<bool>& renderObjects);
+
+            [[nodiscard]] const ViewsOcclusionBuffers& GetViewsOcclusionBuffers(const std::string& sceneName,
+                                                                               const RenderType& renderType,
+                                                                               const std::vector<ViewProjection>& viewProjections,
+                                                                               const std::vector<ObjectRenderable>& occluders);
+
+            [[nodiscard]] OcclusionStats RasterizeOccluders(const ViewProjection& viewProjection,
+                                                            const std::vector<ObjectRenderable>& occluders,
+                                                            OcclusionBuffer& occlusionBuffer) const;
 
             [[nodiscard]] std::vector<ObjectRenderBatch> ObjectsToRenderBatches(const RenderType& renderType,
+                                                                                const std::vector<ViewProjection>& viewProjections,
                                                                                 const std::vector<ObjectRenderable>& objects) const;
 
-            static void AddObjectToRenderBatch(const ObjectRenderable& object,
-                                               const ObjectDrawBatch::Key& drawBatchKey,
-                                               const ObjectDrawBatchParams& drawBatchParams,
-                                               ObjectRenderBatch& renderBatch);
-
-            [[nodiscard]] static ObjectRenderBatch CreateRenderBatch(const ObjectRenderable& object,
-                                                                     const ObjectDrawBatch::Key& drawBatchKey,
-                                                                     const ObjectDrawBatchParams& drawBatchParams,
-                                                                     const ObjectRenderBatch::Key& renderBatchKey,
-                                                                     const ObjectRenderBatchParams& renderBatchParams);
+            [[nodiscard]] std::vector<ObjectSortItem> GetSortedObjects(const RenderType& renderType,
+                                                                       const std::vector<ViewProjection>& viewProjections,
+                                                                       const std::vector<ObjectRenderable>& objects) const;
 
             [[nodiscard]] std::expected<ProgramDefPtr, bool> GetMeshProgramDef(const RenderType& renderType,
                                                                               const LoadedMesh& loadedMesh) const;
 
             [[nodiscard]] std::expected<ObjectDrawBatchParams, bool> GetDrawBatchParams(const ObjectRenderable& object) const;
             [[nodiscard]] std::expected<ObjectRenderBatchParams, bool> GetRenderBatchParams(const RenderType& renderType,
-                                                                                           const ObjectRenderable& object) const;
-
-            [[nodiscard]] static ObjectDrawBatch::Key GetBatchKey(const ObjectDrawBatchParams& params);
-            [[nodiscard]] static ObjectRenderBatch::Key GetBatchKey(const ObjectRenderBatchParams& params);
+                                                                                           const ObjectRenderable& object,
+                                                                                           const LoadedMesh& loadedMesh) const;
 
             //
             // Rendering
@@ -290,9 +370,11 @@ namespace Accela::Render
 
         private:
 
-            static std::function<bool(const ObjectRenderBatch&, const ObjectRenderBatch&)> BatchSortFunc;
-
             std::unordered_map<std::string, std::size_t> m_programPipelineHashes;
+
+            // The occlusion buffers rasterized by the most recent GpassDeferred render, which the GpassForward
+            // render that follows it within the same frame reuses rather than rasterizing the occluders again
+            std::optional<ViewsOcclusionBuffers> m_gpassOcclusionBuffers;
     };
 }
 
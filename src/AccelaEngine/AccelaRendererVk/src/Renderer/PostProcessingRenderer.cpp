@@ -115,19 +115,14 @@ void PostProcessingRenderer::Render(const VulkanCommandBufferPtr& commandBuffer,
     //
     // Fetch Pipeline
     //
-    const std::vector<PushConstantRange> pushConstantRanges = {
-        {VK_SHADER_STAGE_COMPUTE_BIT, 0, (uint32_t)effect.pushPayload.size()}
-    };
+    const auto pipelineConfig = BuildPipelineConfig(effect);
+    if (!pipelineConfig)
+    {
+        m_logger->Log(Common::LogLevel::Error, "PostProcessingRenderer: Failed to build pipeline config");
+        return;
+    }
 
-    const auto pipeline = GetComputePipeline(
-        m_logger,
-        m_vulkanObjs,
-        m_shaders,
-        m_pipelines,
-        programDef,
-        pushConstantRanges,
-        m_frameIndex
-    );
+    const auto pipeline = m_pipelines->GetPipeline(m_vulkanObjs->GetDevice(), *pipelineConfig);
     if (!pipeline)
     {
         m_logger->Log(Common::LogLevel::Error, "PostProcessingRenderer: Failed to retrieve pipeline");
@@ -247,6 +242,22 @@ void PostProcessingRenderer::Render(const VulkanCommandBufferPtr& commandBuffer,
     commandBuffer->CmdDispatch(workGroupSize.first, workGroupSize.second, POST_PROCESS_LOCAL_SIZE_Z);
 }
 
+std::expected<ComputePipelineConfig, bool> PostProcessingRenderer::BuildPipelineConfig(const PostProcessEffect& effect) const
+{
+    const auto programDef = m_programs->GetProgramDef(effect.programName);
+    if (programDef == nullptr)
+    {
+        m_logger->Log(Common::LogLevel::Error, "PostProcessingRenderer: No such program exists: {}", effect.programName);
+        return std::unexpected(false);
+    }
+
+    const std::vector<PushConstantRange> pushConstantRanges = {
+        {VK_SHADER_STAGE_COMPUTE_BIT, 0, (uint32_t)effect.pushPayload.size()}
+    };
+
+    return BuildComputePipelineConfig(m_logger, m_shaders, programDef, pushConstantRanges, m_frameIndex);
+}
+
 std::pair<uint32_t, uint32_t> PostProcessingRenderer::CalculateWorkGroupSize() const
 {
     std::optional<unsigned int> workGroupSizeX;
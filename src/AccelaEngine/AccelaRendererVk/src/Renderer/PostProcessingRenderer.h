@@ -12,6 +12,7 @@
 #include "../ForwardDeclares.h"
 
 #include "../Framebuffer/FramebufferObjs.h"
+#include "../Pipeline/PipelineConfig.h"
 
 #include <Accela/Render/Ids.h>
 #include <Accela/Render/RenderSettings.h>
@@ -70,6 +71,11 @@ namespace Accela::Render
                         const LoadedImage& outputImage,
                         const PostProcessEffect& effect);
 
+            /**
+             * @return The config of the pipeline that Render(..) uses to run the given effect
+             */
+            [[nodiscard]] std::expected<ComputePipelineConfig, bool> BuildPipelineConfig(const PostProcessEffect& effect) const;
+
         private:
 
             [[nodiscard]] std::pair<uint32_t, uint32_t> CalculateWorkGroupSize() const;
@@ -9,10 +9,13 @@
 #include "../PostExecutionOp.h"
 
 #include "../Buffer/CPUItemBuffer.h"
+#include "../Buffer/FrameRingBuffer.h"
 #include "../Program/ProgramDef.h"
 
 #include "../Vulkan/VulkanDescriptorSet.h"
 
+#include <format>
+
 namespace Accela::Render
 {
 
@@ -62,6 +65,15 @@ bool Renderer::Initialize(const RenderSettings& renderSettings)
         VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT
     );
 
+    m_frameRingBuffer = std::make_shared<FrameRingBuffer>(
+        m_logger,
+        m_vulkanObjs,
+        m_buffers,
+        m_postExecutionOps,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        std::format("FrameRing-{}", m_frameIndex)
+    );
+
     m_renderSettings = renderSettings;
 
     return true;
@@ -76,6 +88,12 @@ void Renderer::Destroy()
         m_descriptorSets->Destroy();
         m_descriptorSets = nullptr;
     }
+
+    if (m_frameRingBuffer != nullptr)
+    {
+        m_frameRingBuffer->Destroy();
+        m_frameRingBuffer = nullptr;
+    }
 }
 
 bool Renderer::OnRenderSettingsChanged(const RenderSettings& renderSettings)
@@ -87,6 +105,7 @@ bool Renderer::OnRenderSettingsChanged(const RenderSettings& renderSettings)
 void Renderer::OnFrameSynced()
 {
     m_descriptorSets->MarkCachedSetsNotInUse();
+    m_frameRingBuffer->Reset();
 }
 
 }
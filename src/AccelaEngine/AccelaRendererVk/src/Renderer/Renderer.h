@@ -73,6 +73,9 @@ namespace Accela::Render
             uint8_t m_frameIndex;
 
             DescriptorSetsPtr m_descriptorSets;
+
+            // Transient per-draw data for this renderer's frame; rewound whenever the frame is synced
+            FrameRingBufferPtr m_frameRingBuffer;
             RenderSettings m_renderSettings{};
     };
 }
@@ -176,30 +176,14 @@ void SwapChainBlitRenderer::Render(const VulkanCommandBufferPtr& commandBuffer,
         return;
     }
 
-    const auto viewport = Viewport(0, 0, swapChainFramebuffer->GetSize()->w, swapChainFramebuffer->GetSize()->h);
-
-    std::vector<PushConstantRange> pushConstantRanges;
-
-    pushConstantRanges = {
-        {VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(SwapChainBlitPushPayload)}
-    };
+    const auto pipelineConfig = BuildPipelineConfig(renderPass, *swapChainFramebuffer->GetSize());
+    if (!pipelineConfig)
+    {
+        m_logger->Log(Common::LogLevel::Error, "SwapChainBlitRenderer: Failed to build pipeline config");
+        return;
+    }
 
-    const auto pipeline = GetGraphicsPipeline(
-        m_logger,
-        m_vulkanObjs,
-        m_shaders,
-        m_pipelines,
-        m_programDef,
-        renderPass,
-        0,
-        viewport,
-        CullFace::Back,
-        PolygonFillMode::Fill,
-        DepthBias::Disabled,
-        pushConstantRanges,
-        m_frameIndex,
-        m_pipelineHash
-    );
+    const auto pipeline = m_pipelines->GetPipeline(m_vulkanObjs->GetDevice(), *pipelineConfig);
     if (!pipeline)
     {
         m_logger->Log(Common::LogLevel::Error, "SwapChainBlitRenderer: Failed to retrieve pipeline");
@@ -235,6 +219,32 @@ void SwapChainBlitRenderer::Render(const VulkanCommandBufferPtr& commandBuffer,
     commandBuffer->CmdDrawIndexed(loadedMesh->numIndices, 1, 0, 0, 0);
 }
 
+std::expected<GraphicsPipelineConfig, bool> SwapChainBlitRenderer::BuildPipelineConfig(
+    const VulkanRenderPassPtr& renderPass,
+    const USize& framebufferSize) const
+{
+    const auto viewport = Viewport(0, 0, framebufferSize.w, framebufferSize.h);
+
+    const std::vector<PushConstantRange> pushConstantRanges = {
+        {VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(SwapChainBlitPushPayload)}
+    };
+
+    return BuildGraphicsPipelineConfig(
+        m_logger,
+        m_vulkanObjs,
+        m_shaders,
+        m_programDef,
+        renderPass,
+        0,
+        viewport,
+        CullFace::Back,
+        PolygonFillMode::Fill,
+        DepthBias::Disabled,
+        pushConstantRanges,
+        m_frameIndex
+    );
+}
+
 bool SwapChainBlitRenderer::ConfigureMeshFor(const RenderSettings& renderSettings, const USize& targetSize)
 {
     if ((m_renderSize && m_targetSize && m_presentScaling) &&
@@ -12,6 +12,7 @@
 #include "../ForwardDeclares.h"
 
 #include "../Framebuffer/FramebufferObjs.h"
+#include "../Pipeline/PipelineConfig.h"
 
 #include <Accela/Render/Ids.h>
 #include <Accela/Render/RenderSettings.h>
@@ -54,6 +55,13 @@ namespace Accela::Render
                         const LoadedImage& renderImage,
                         const LoadedImage& screenImage);
 
+            /**
+             * @return The config of the pipeline that Render(..) uses to blit to a framebuffer of the given size
+             */
+            [[nodiscard]] std::expected<GraphicsPipelineConfig, bool> BuildPipelineConfig(
+                const VulkanRenderPassPtr& renderPass,
+                const USize& framebufferSize) const;
+
         private:
 
             struct SwapChainBlitPushPayload
@@ -14,8 +14,10 @@
 #include "Pipeline/PipelineFactory.h"
 #include "Texture/Textures.h"
 #include "Buffer/Buffers.h"
+#include "Buffer/UploadScheduler.h"
 #include "Util/VulkanFuncs.h"
 #include "Util/Synchronization.h"
+#include "Util/Ray.h"
 #include "Mesh/Meshes.h"
 #include "Framebuffer/Framebuffers.h"
 #include "Renderables/Renderables.h"
@@ -48,10 +50,18 @@
 #include <algorithm>
 #include <stack>
 #include <array>
+#include <unordered_map>
+#include <cstring>
 
 namespace Accela::Render
 {
 
+// Byte size of the persistent staging ring which mesh and image uploads are staged through
+static constexpr std::size_t UPLOAD_STAGING_BYTE_SIZE = 64 * 1024 * 1024;
+
+// Byte size of pending uploads at which a batch is submitted, without waiting for the next frame
+static constexpr std::size_t UPLOAD_BATCH_MAX_BYTE_SIZE = 16 * 1024 * 1024;
+
 RendererVk::RendererVk(std::string appName,
                        uint32_t appVersion,
                        Common::ILogger::Ptr logger,
@@ -67,15 +77,16 @@ RendererVk::RendererVk(std::string appName,
     , m_pipelines(std::make_shared<PipelineFactory>(m_logger, m_vulkanObjs, m_shaders))
     , m_postExecutionOps(std::make_shared<PostExecutionOps>(m_logger, m_vulkanObjs))
     , m_buffers(std::make_shared<Buffers>(m_logger, m_metrics, m_vulkanObjs, m_postExecutionOps))
-    , m_images(std::make_shared<Images>(m_logger, m_metrics, m_vulkanObjs, m_buffers, m_postExecutionOps))
+    , m_uploadScheduler(std::make_shared<UploadScheduler>(m_logger, m_metrics, m_vulkanObjs, m_buffers, m_postExecutionOps))
+    , m_images(std::make_shared<Images>(m_logger, m_metrics, m_vulkanObjs, m_buffers, m_postExecutionOps, m_uploadScheduler))
     , m_textures(std::make_shared<Textures>(m_logger, m_metrics, m_vulkanObjs, m_images, m_buffers, m_postExecutionOps, m_ids))
-    , m_meshes(std::make_shared<Meshes>(m_logger, m_metrics, m_vulkanObjs, m_ids, m_postExecutionOps, m_buffers))
+    , m_meshes(std::make_shared<Meshes>(m_logger, m_metrics, m_vulkanObjs, m_ids, m_postExecutionOps, m_buffers, m_uploadScheduler))
     , m_framebuffers(std::make_shared<Framebuffers>(m_logger, m_ids, m_vulkanObjs, m_images, m_postExecutionOps))
     , m_materials(std::make_shared<Materials>(m_logger, m_metrics, m_vulkanObjs, m_postExecutionOps, m_ids, m_textures, m_buffers))
     , m_lights(std::make_shared<Lights>(m_logger, m_metrics, m_vulkanObjs, m_openXR, m_framebuffers, m_ids))
     , m_renderTargets(std::make_shared<RenderTargets>(m_logger, m_vulkanObjs, m_postExecutionOps, m_framebuffers, m_images, m_ids))
     , m_renderables(std::make_shared<Renderables>(m_logger, m_ids, m_postExecutionOps, m_textures, m_buffers, m_meshes, m_lights))
-    , m_frames(m_logger, m_vulkanObjs, m_renderTargets, m_images)
+    , m_frames(m_logger, m_vulkanObjs)
     , m_renderState(m_logger, m_vulkanObjs->GetCalls(), m_images)
     , m_swapChainRenderers(m_logger, m_metrics, m_ids, m_postExecutionOps, m_vulkanObjs, m_programs, m_shaders, m_pipelines, m_buffers, m_materials, m_images, m_textures, m_meshes, m_lights, m_renderables)
     , m_spriteRenderers(m_logger, m_metrics, m_ids, m_postExecutionOps, m_vulkanObjs, m_programs, m_shaders, m_pipelines, m_buffers, m_materials, m_images, m_textures, m_meshes, m_lights, m_renderables)
@@ -127,8 +138,10 @@ bool RendererVk::OnInitialize(const RenderInit& renderInit, const RenderSettings
 
     if (!m_postExecutionOps->Initialize(renderSettings)) { return false; }
     if (!LoadShaders(renderInit.shaders)) { return false; }
+    if (!m_pipelines->Initialize(renderInit.pipelineCacheFilePath)) { return false; }
     if (!CreatePrograms()) { return false; }
     if (!m_buffers->Initialize()) { return false; }
+    if (!m_uploadScheduler->Initialize(transferCommandPool, transferQueue, UPLOAD_STAGING_BYTE_SIZE, UPLOAD_BATCH_MAX_BYTE_SIZE)) { return false; }
     if (!m_images->Initialize(transferCommandPool, transferQueue)) { return false; }
     if (!m_textures->Initialize()) { return false; }
     if (!m_meshes->Initialize(transferCommandPool, transferQueue)) { return false; }
@@ -144,6 +157,8 @@ bool RendererVk::OnInitialize(const RenderInit& renderInit, const RenderSettings
     if (!m_rawTriangleRenderers.Initialize(renderSettings)) { return false; }
     if (!m_postProcessingRenderers.Initialize(renderSettings)) { return false; }
 
+    WarmUpPipelines(renderSettings);
+
     //
     // Now that our internal systems are up and running, tell OpenXR, so it can do final init work that depends
     // on vulkan objects having been created
@@ -178,6 +193,7 @@ bool RendererVk::OnShutdown()
 
     m_openXR->Destroy();
 
+    m_uploadScheduler->Destroy();
     m_postExecutionOps->Destroy();
 
     m_postProcessingRenderers.Destroy();
@@ -205,7 +221,7 @@ bool RendererVk::OnShutdown()
     m_shaders->Destroy();
     m_vulkanObjs->Destroy();
 
-    m_latestObjectDetailImageId = std::nullopt;
+    m_pickRenderTargetId = std::nullopt;
 
     m_vulkanObjs->WaitForDeviceIdle();
 
@@ -263,6 +279,15 @@ void RendererVk::OnIdle()
     // execution ops to see if any non-frame work (e.g. texture transfers) can
     // be finished out, without having to wait for frame renders to be requested
     m_postExecutionOps->FulfillReady();
+
+    // Submit any uploads which were queued since the last frame, rather than leaving them to wait for one
+    m_uploadScheduler->Flush();
+
+    // Use idle time to incrementally reclaim space left behind by destroyed immutable meshes
+    m_meshes->CompactImmutableBuffers();
+
+    // Persist any pipelines compiled since the last save, so a crash doesn't lose them
+    m_pipelines->PersistCacheIfChanged();
 }
 
 void RendererVk::OnCreateTexture(std::promise<bool> resultPromise,
@@ -321,6 +346,12 @@ bool RendererVk::OnCreateRenderTarget(RenderTargetId renderTargetId, const std::
 bool RendererVk::OnDestroyRenderTarget(RenderTargetId renderTargetId)
 {
     m_renderTargets->DestroyRenderTarget(renderTargetId, false);
+
+    if (m_pickRenderTargetId == renderTargetId)
+    {
+        m_pickRenderTargetId = std::nullopt;
+    }
+
     return true;
 }
 
@@ -375,6 +406,9 @@ bool RendererVk::OnRenderFrame(RenderGraph::Ptr renderGraph)
     // Mark the current frame's work as finished/synced and fulfill any pending work for it
     m_postExecutionOps->SetFrameSynced(currentFrame.GetFrameIndex(), framePipelineFence);
 
+    // Submit all pending resource uploads ahead of the frame's render work, which may use them
+    m_uploadScheduler->Flush();
+
     // Reset the frame's execution fence
     m_vulkanObjs->GetCalls()->vkResetFences(m_vulkanObjs->GetDevice()->GetVkDevice(), 1, &framePipelineFence);
 
@@ -392,15 +426,6 @@ bool RendererVk::OnRenderFrame(RenderGraph::Ptr renderGraph)
     graphicsCommandPool->ResetCommandBuffer(renderCommandBuffer, false);
     graphicsCommandPool->ResetCommandBuffer(currentFrame.GetSwapChainBlitCommandBuffer(), false);
 
-    //////////////////////////////////////////
-    // Update the latest object detail buffer
-    //////////////////////////////////////////
-
-    {
-        std::lock_guard<std::mutex> lock(m_latestObjectDetailTextureIdMutex);
-        m_latestObjectDetailImageId = currentFrame.GetObjectDetailImageId();
-    }
-
     ////////////////////////////////////
     // Start recording render commands
     ////////////////////////////////////
@@ -474,6 +499,42 @@ bool RendererVk::OnRenderFrame(RenderGraph::Ptr renderGraph)
     return graphProcessSuccess;
 }
 
+void RendererVk::WarmUpPipelines(const RenderSettings& renderSettings)
+{
+    //
+    // Start compiling, in the background, the pipelines which are needed every frame regardless of
+    // scene content, so that the first frames don't stall on them. Pipelines which depend on scene
+    // content are created on demand, and mostly come straight out of the persisted pipeline cache.
+    //
+    std::vector<GraphicsPipelineConfig> graphicsConfigs;
+    std::vector<ComputePipelineConfig> computeConfigs;
+
+    const auto swapChainFramebuffer = m_vulkanObjs->GetSwapChainFrameBuffer(0);
+
+    const std::vector<PostProcessEffect> postProcessEffects = {
+        ColorCorrectionEffect(renderSettings, {ColorCorrection::GammaCorrection}),
+        FXAAEffect(renderSettings)
+    };
+
+    for (uint8_t frameIndex = 0; frameIndex < renderSettings.framesInFlight; ++frameIndex)
+    {
+        if (swapChainFramebuffer != nullptr && swapChainFramebuffer->GetSize())
+        {
+            const auto config = m_swapChainRenderers.GetRendererForFrame(frameIndex)
+                .BuildPipelineConfig(m_vulkanObjs->GetSwapChainBlitRenderPass(), *swapChainFramebuffer->GetSize());
+            if (config) { graphicsConfigs.push_back(*config); }
+        }
+
+        for (const auto& effect : postProcessEffects)
+        {
+            const auto config = m_postProcessingRenderers.GetRendererForFrame(frameIndex).BuildPipelineConfig(effect);
+            if (config) { computeConfigs.push_back(*config); }
+        }
+    }
+
+    m_pipelines->WarmUp(m_vulkanObjs->GetDevice(), graphicsConfigs, computeConfigs);
+}
+
 bool RendererVk::RenderGraphFunc_RenderScene(const RenderGraphNode::Ptr& node)
 {
     //
@@ -618,8 +679,6 @@ void RendererVk::RunSceneRender(const std::string& sceneName,
 
     const auto postProcessingOutputImage = *m_images->GetImage(renderTarget.postProcessOutputImage);
 
-    const auto frameObjectDetailResultImage = *m_images->GetImage(currentFrame.GetObjectDetailImageId());
-
     //////////////////////////
     // GPass Render Pass
     //////////////////////////
@@ -721,17 +780,11 @@ bool RendererVk::RenderGraphFunc_Present(const uint32_t& swapChainImageIndex, co
     }
 
     const auto gPassColorImage = gPassFramebufferObjs->GetAttachmentImage(Offscreen_Attachment_Color)->first;
-    const auto gPassObjectDetailAttachment = gPassFramebufferObjs->GetAttachmentImage(Offscreen_Attachment_ObjectDetail);
-    const auto gPassObjectDetailImage = gPassObjectDetailAttachment->first;
     const auto screenColorImage = screenFramebufferObjs->GetAttachmentImage(Screen_Attachment_Color)->first;
-    const auto frameObjectDetailResultImage = *m_images->GetImage(currentFrame.GetObjectDetailImageId());
-
-    //////////////////////////
-    // Object Detail Transfer
-    //////////////////////////
 
-    // The final object detail image is transferred to per-frame CPU-mapped image for client access
-    TransferObjectDetailImage(gPassObjectDetailImage, frameObjectDetailResultImage, renderCommandBuffer);
+    // Pick requests read back from whichever render target was most recently presented. Nothing is copied
+    // back here; only the regions that are requested are copied back, when they're requested.
+    m_pickRenderTargetId = renderTargetId;
 
     ////////////////////////////////////////////////////
     // Finish the Render work command buffer and submit it
@@ -1248,69 +1301,6 @@ bool RendererVk::OnWorldUpdate(const WorldUpdate& update)
     return true;
 }
 
-void RendererVk::TransferObjectDetailImage(const LoadedImage& gPassObjectDetailImage,
-                                           const LoadedImage& frameObjectDetailImage,
-                                           const VulkanCommandBufferPtr& commandBuffer)
-{
-    CmdBufferSectionLabel sectionLabel(m_vulkanObjs->GetCalls(), commandBuffer, "TransferObjectDetailImage");
-
-    const auto renderSettings = m_vulkanObjs->GetRenderSettings();
-    const auto presentLayerIndex = (uint32_t)renderSettings.presentEye;
-
-    // Prepare access to the object detail image
-    m_renderState.PrepareOperation(commandBuffer, RenderOperation({
-        // We're going to transfer from the gpass object detail image
-        {gPassObjectDetailImage.id, ImageAccess(
-            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-            BarrierPoint(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT),
-            BarrierPoint(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT),
-            Layers(0, gPassObjectDetailImage.image.numLayers),
-            Levels(0, 1),
-            VK_IMAGE_ASPECT_COLOR_BIT
-        )},
-        // We're going to transfer to the frame object detail result image
-        {frameObjectDetailImage.id, ImageAccess(
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            BarrierPoint(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT),
-            BarrierPoint(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT),
-            Layers(0, 1),
-            Levels(0, 1),
-            VK_IMAGE_ASPECT_COLOR_BIT
-        )}
-    }));
-
-    //
-    // Copy the gpass object detail image to the linearly tiled, host-accessible, per-frame object
-    // detail image.
-    //
-    VkImageCopy vkImageCopy{};
-    vkImageCopy.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    vkImageCopy.srcSubresource.mipLevel = 0;
-    vkImageCopy.srcSubresource.baseArrayLayer = presentLayerIndex;
-    vkImageCopy.srcSubresource.layerCount = 1;
-    vkImageCopy.srcOffset = {0, 0, 0};
-    vkImageCopy.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    vkImageCopy.dstSubresource.mipLevel = 0;
-    vkImageCopy.dstSubresource.baseArrayLayer = 0;
-    vkImageCopy.dstSubresource.layerCount = 1;
-    vkImageCopy.dstOffset = {0, 0, 0};
-    vkImageCopy.extent.width = gPassObjectDetailImage.image.size.w;
-    vkImageCopy.extent.height = gPassObjectDetailImage.image.size.h;
-    vkImageCopy.extent.depth = 1;
-
-    m_vulkanObjs->GetCalls()->vkCmdCopyImage(
-        commandBuffer->GetVkCommandBuffer(),
-        gPassObjectDetailImage.allocation.vkImage,
-        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-        frameObjectDetailImage.allocation.vkImage,
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        1,
-        &vkImageCopy
-    );
-}
-
 bool RendererVk::OnSurfaceChanged()
 {
     m_logger->Log(Common::LogLevel::Info, "OnSurfaceChanged: Notified surface changed");
@@ -1354,42 +1344,249 @@ bool RendererVk::OnChangeRenderSettings(const RenderSettings& renderSettings)
     if (!m_lights->OnRenderSettingsChanged(renderSettings)) { allSuccessful = false; }
     if (!m_renderTargets->OnRenderSettingsChanged(renderSettings)) { allSuccessful = false; }
 
-    m_latestObjectDetailImageId = std::nullopt;
+    // Render targets are recreated at the new resolution, so there's no presented output to pick from
+    // until the next frame is presented
+    m_pickRenderTargetId = std::nullopt;
 
     return allSuccessful;
 }
 
-std::optional<ObjectId> RendererVk::GetTopObjectAtRenderPoint(const glm::vec2& renderPoint) const
+void RendererVk::OnPickRenderRect(std::promise<std::vector<ObjectId>> resultPromise, const URect& renderRect)
 {
-    // Warning! All of this in run on engine thread, not render thread, to provide an instant answer
-    // rather than an asynchronous answer. Can fail in scenarios such as parallel render settings change.
+    // Nothing has been presented yet, so there's nothing to pick from
+    if (!m_pickRenderTargetId)
+    {
+        resultPromise.set_value({});
+        return;
+    }
+
+    const auto renderTarget = m_renderTargets->GetRenderTarget(*m_pickRenderTargetId);
+    if (!renderTarget)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "RendererVk::OnPickRenderRect: No such render target exists: {}", m_pickRenderTargetId->id);
+        resultPromise.set_value({});
+        return;
+    }
+
+    const auto gPassFramebufferObjs = m_framebuffers->GetFramebufferObjs(renderTarget->gPassFramebuffer);
+    if (!gPassFramebufferObjs)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "RendererVk::OnPickRenderRect: No such gpass framebuffer exists: {}", renderTarget->gPassFramebuffer.id);
+        resultPromise.set_value({});
+        return;
+    }
 
-    std::lock_guard<std::mutex> lock(m_latestObjectDetailTextureIdMutex);
+    const auto gPassObjectDetailImage = gPassFramebufferObjs->GetAttachmentImage(Offscreen_Attachment_ObjectDetail)->first;
 
-    if (!m_latestObjectDetailImageId)
+    //
+    // Clamp the requested region to the bounds of the object detail image
+    //
+    const auto imageSize = gPassObjectDetailImage.image.size;
+
+    URect region{};
+    region.x = std::min(renderRect.x, imageSize.w);
+    region.y = std::min(renderRect.y, imageSize.h);
+    region.w = std::min(renderRect.w, imageSize.w - region.x);
+    region.h = std::min(renderRect.h, imageSize.h - region.y);
+
+    if (region.w == 0 || region.h == 0)
     {
-        return std::nullopt;
+        resultPromise.set_value({});
+        return;
     }
 
-    const auto objectDetailImage = m_images->GetImage(*m_latestObjectDetailImageId);
-    if (!objectDetailImage)
+    //
+    // Create a host-readable buffer sized to hold only the requested region's pixels
+    //
+    const auto readbackByteSize = (std::size_t)region.w * region.h * m_renderTargets->GetObjectDetailPerPixelByteSize();
+
+    const auto readbackBufferExpect = m_buffers->CreateBuffer(
+        VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT,
+        readbackByteSize,
+        "PickReadback"
+    );
+    if (!readbackBufferExpect)
     {
         m_logger->Log(Common::LogLevel::Error,
-          "RendererVk::GetTopObjectAtRenderPoint: Failed to fetch latest object detail image: {}", m_latestObjectDetailImageId->id);
-        return std::nullopt;
+          "RendererVk::OnPickRenderRect: Failed to create readback buffer of byte size: {}", readbackByteSize);
+        resultPromise.set_value({});
+        return;
     }
+    const auto readbackBuffer = *readbackBufferExpect;
 
-    const auto pObjectDetailImage = (unsigned char*)objectDetailImage->allocation.vmaAllocationInfo.pMappedData;
+    m_metrics->SetCounterValue(Renderer_Pick_Readback_ByteSize, readbackByteSize);
 
-    const auto pixelByteStartOffset =
-        ((unsigned int)renderPoint.x +
-        ((unsigned int)renderPoint.y * m_vulkanObjs->GetRenderSettings().resolution.w))
-        * m_renderTargets->GetObjectDetailPerPixelByteSize();
+    //
+    // Copy the region back, and read the object ids out of it once the copy has finished. The copy is
+    // submitted behind whatever frame work is already in flight, and completes as soon as that work has,
+    // without waiting on any further frames being rendered.
+    //
+    VulkanFuncs vulkanFuncs(m_logger, m_vulkanObjs);
 
-    // Note that ObjectId is stored in the first 4 of 8 bytes of each object detail pixel (material id is the second half)
-    const IdType objectId = *(pObjectDetailImage + pixelByteStartOffset);
+    const bool submitted = vulkanFuncs.QueueSubmit<std::vector<ObjectId>>(
+        "PickRenderRect",
+        m_postExecutionOps,
+        m_vulkanObjs->GetDevice()->GetVkGraphicsQueue(),
+        m_vulkanObjs->GetTransferCommandPool(),
+        [&,this](const VulkanCommandBufferPtr& commandBuffer, VkFence)
+        {
+            RecordPickReadback(commandBuffer, gPassObjectDetailImage, region, readbackBuffer);
+            return true;
+        },
+        [=,this](bool commandsSuccessful)
+        {
+            std::vector<ObjectId> objectIds;
 
-    return ObjectId(objectId);
+            if (commandsSuccessful)
+            {
+                objectIds = ReadPickedObjectIds(readbackBuffer);
+            }
+
+            m_buffers->DestroyBuffer(readbackBuffer->GetBufferId());
+
+            return objectIds;
+        },
+        std::move(resultPromise),
+        EnqueueType::Frameless
+    );
+
+    if (!submitted)
+    {
+        m_logger->Log(Common::LogLevel::Error, "RendererVk::OnPickRenderRect: Failed to submit readback work");
+        m_buffers->DestroyBuffer(readbackBuffer->GetBufferId());
+    }
+}
+
+void RendererVk::RecordPickReadback(const VulkanCommandBufferPtr& commandBuffer,
+                                    const LoadedImage& objectDetailImage,
+                                    const URect& region,
+                                    const BufferPtr& readbackBuffer)
+{
+    CmdBufferSectionLabel sectionLabel(m_vulkanObjs->GetCalls(), commandBuffer, "PickReadback");
+
+    const auto presentLayerIndex = (uint32_t)m_vulkanObjs->GetRenderSettings().presentEye;
+
+    // Prepare access to the object detail image
+    m_renderState.PrepareOperation(commandBuffer, RenderOperation({
+        // We're going to transfer from the gpass object detail image
+        {objectDetailImage.id, ImageAccess(
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            BarrierPoint(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT),
+            BarrierPoint(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT),
+            Layers(0, objectDetailImage.image.numLayers),
+            Levels(0, 1),
+            VK_IMAGE_ASPECT_COLOR_BIT
+        )}
+    }));
+
+    //
+    // Copy only the requested region of the presented layer into the tightly packed readback buffer
+    //
+    VkBufferImageCopy vkBufferImageCopy{};
+    vkBufferImageCopy.bufferOffset = 0;
+    vkBufferImageCopy.bufferRowLength = 0;
+    vkBufferImageCopy.bufferImageHeight = 0;
+    vkBufferImageCopy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    vkBufferImageCopy.imageSubresource.mipLevel = 0;
+    vkBufferImageCopy.imageSubresource.baseArrayLayer = presentLayerIndex;
+    vkBufferImageCopy.imageSubresource.layerCount = 1;
+    vkBufferImageCopy.imageOffset = {(int32_t)region.x, (int32_t)region.y, 0};
+    vkBufferImageCopy.imageExtent = {region.w, region.h, 1};
+
+    m_vulkanObjs->GetCalls()->vkCmdCopyImageToBuffer(
+        commandBuffer->GetVkCommandBuffer(),
+        objectDetailImage.allocation.vkImage,
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        readbackBuffer->GetVkBuffer(),
+        1,
+        &vkBufferImageCopy
+    );
+
+    // Make the copied data visible to host reads once the work has finished
+    VkMemoryBarrier vkMemoryBarrier{};
+    vkMemoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    vkMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vkMemoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+
+    m_vulkanObjs->GetCalls()->vkCmdPipelineBarrier(
+        commandBuffer->GetVkCommandBuffer(),
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_HOST_BIT,
+        0,
+        1, &vkMemoryBarrier,
+        0, nullptr,
+        0, nullptr
+    );
+}
+
+std::vector<ObjectId> RendererVk::ReadPickedObjectIds(const BufferPtr& readbackBuffer) const
+{
+    // The readback memory isn't necessarily host coherent
+    m_vulkanObjs->GetVMA()->InvalidateAllocation(readbackBuffer->GetVmaAllocation(), 0, VK_WHOLE_SIZE);
+
+    const auto bytes = m_buffers->MappedReadBuffer(readbackBuffer, BufferRead{
+        .readOffset = 0,
+        .readByteSize = readbackBuffer->GetByteSize()
+    });
+
+    //
+    // Count how many of the region's pixels each object covers. Note that ObjectId is stored in the
+    // first 4 of 8 bytes of each object detail pixel (material id is the second half).
+    //
+    const auto perPixelByteSize = m_renderTargets->GetObjectDetailPerPixelByteSize();
+
+    std::unordered_map<IdType, std::size_t> objectPixelCounts;
+
+    for (std::size_t byteOffset = 0; byteOffset + perPixelByteSize <= bytes.size(); byteOffset += perPixelByteSize)
+    {
+        IdType objectId{INVALID_ID};
+        memcpy(&objectId, bytes.data() + byteOffset, sizeof(objectId));
+
+        if (objectId != INVALID_ID)
+        {
+            objectPixelCounts[objectId]++;
+        }
+    }
+
+    std::vector<std::pair<IdType, std::size_t>> sortedCounts(objectPixelCounts.cbegin(), objectPixelCounts.cend());
+
+    std::ranges::sort(sortedCounts, [](const auto& a, const auto& b){
+        if (a.second != b.second) { return a.second > b.second; }
+        return a.first < b.first;
+    });
+
+    std::vector<ObjectId> objectIds;
+    objectIds.reserve(sortedCounts.size());
+
+    std::ranges::transform(sortedCounts, std::back_inserter(objectIds), [](const auto& count){
+        return ObjectId(count.first);
+    });
+
+    return objectIds;
+}
+
+std::vector<ObjectId> RendererVk::OnPickRay(const std::string& sceneName,
+                                            const glm::vec3& rayStart_worldSpace,
+                                            const glm::vec3& rayEnd_worldSpace)
+{
+    const auto rayLength = glm::distance(rayStart_worldSpace, rayEnd_worldSpace);
+    if (rayLength <= 0.0f)
+    {
+        return {};
+    }
+
+    const auto ray_worldSpace = Ray(
+        rayStart_worldSpace,
+        (rayEnd_worldSpace - rayStart_worldSpace) / rayLength,
+        rayLength
+    );
+
+    return m_renderables->GetObjects().GetObjectsAlongRay(sceneName, ray_worldSpace);
 }
 
 void RendererVk::RefreshShadowMapsAsNeeded(const RenderParams& renderParams, const VulkanCommandBufferPtr& commandBuffer)
@@ -1405,6 +1602,9 @@ void RendererVk::RefreshShadowMapsAsNeeded(const RenderParams& renderParams, con
     // Loop over all lights and run shadow renders for any which cast shadows and which have an
     // invalidated shadow map
     //
+    std::size_t shadowMapRenders = 0;
+    std::size_t staticShadowMapRenders = 0;
+
     for (const auto& loadedLight : m_lights->GetAllLights())
     {
         const bool lightCastsShadows = loadedLight.light.castsShadows && loadedLight.shadowFrameBufferId;
@@ -1415,32 +1615,28 @@ void RendererVk::RefreshShadowMapsAsNeeded(const RenderParams& renderParams, con
             continue;
         }
 
-        if (!RefreshShadowMap(renderParams, commandBuffer, loadedLight))
+        if (!RefreshShadowMap(renderParams, commandBuffer, loadedLight, staticShadowMapRenders))
         {
             m_logger->Log(Common::LogLevel::Error,
               "RefreshShadowMapsAsNeeded: Failed to refresh shadow map for light id: {}", loadedLight.light.lightId.id);
+            continue;
         }
+
+        shadowMapRenders++;
     }
+
+    m_metrics->SetCounterValue(Renderer_Shadow_Map_Renders_Count, shadowMapRenders);
+    m_metrics->SetCounterValue(Renderer_Shadow_Static_Map_Renders_Count, staticShadowMapRenders);
 }
 
 bool RendererVk::RefreshShadowMap(const RenderParams& renderParams,
                                   const VulkanCommandBufferPtr& commandBuffer,
-                                  const LoadedLight& loadedLight)
+                                  const LoadedLight& loadedLight,
+                                  std::size_t& staticShadowMapRenders)
 {
     //
     // Gather data / validation
     //
-    auto& currentFrame = m_frames.GetCurrentFrame();
-
-    VulkanRenderPassPtr shadowRenderPass{};
-
-    switch (loadedLight.shadowMapType)
-    {
-        case ShadowMapType::Cascaded: { shadowRenderPass = m_vulkanObjs->GetShadowCascadedRenderPass(); } break;
-        case ShadowMapType::Single: { shadowRenderPass = m_vulkanObjs->GetShadowSingleRenderPass(); } break;
-        case ShadowMapType::Cube: { shadowRenderPass = m_vulkanObjs->GetShadowCubeRenderPass(); } break;
-    }
-
     if (!loadedLight.shadowFrameBufferId)
     {
         m_logger->Log(Common::LogLevel::Warning,
@@ -1461,19 +1657,117 @@ bool RendererVk::RefreshShadowMap(const RenderParams& renderParams,
 
     const auto shadowMapImage = shadowFramebuffer->GetAttachmentImages()->at(0).first;
 
-    const float lightMaxAffectRange = GetLightMaxAffectRange(m_vulkanObjs->GetRenderSettings(), loadedLight.light);
+    CmdBufferSectionLabel sectionLabel(m_vulkanObjs->GetCalls(), commandBuffer, std::format("ShadowMapRender-Light-{}", loadedLight.light.lightId.id));
 
     //
-    // Set up and run a shadow render for the light for each shadow map cube face that's invalidated
+    // If the light doesn't cache a shadow map of its static objects, render every shadow casting object into its shadow map
     //
+    if (!loadedLight.staticShadowFrameBufferId)
+    {
+        if (!RenderShadowMap(renderParams, commandBuffer, loadedLight, *shadowFramebuffer, shadowMapImage, ShadowCasters::All))
+        {
+            return false;
+        }
+
+        m_lights->OnShadowMapSynced(loadedLight.light.lightId);
+
+        return true;
+    }
+
+    //
+    // Otherwise, the light's shadow map is its cached static objects shadow map with its dynamic objects rendered on top
+    //
+    const auto staticShadowFramebufferId = *loadedLight.staticShadowFrameBufferId;
+    const auto staticShadowFramebuffer = m_framebuffers->GetFramebufferObjs(staticShadowFramebufferId);
+
+    if (!staticShadowFramebuffer || staticShadowFramebuffer->GetAttachmentImages()->size() != 1)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "RendererVk::RefreshShadowMap: Static shadow framebuffer doesn't exist or wrong attachment count, light id: {}, fb id: {}",
+              loadedLight.light.lightId.id, staticShadowFramebufferId.id);
+        return false;
+    }
+
+    const auto staticShadowMapImage = staticShadowFramebuffer->GetAttachmentImages()->at(0).first;
+
+    // Re-render the cached static objects shadow map, only if static objects within it have changed
+    if (loadedLight.staticShadowInvalidated)
+    {
+        if (!RenderShadowMap(renderParams, commandBuffer, loadedLight, *staticShadowFramebuffer, staticShadowMapImage, ShadowCasters::Static))
+        {
+            return false;
+        }
+
+        staticShadowMapRenders++;
+    }
+
+    // Restore the light's shadow map to the cached static objects shadow map
+    CopyShadowMap(commandBuffer, staticShadowMapImage, shadowMapImage);
+
+    // Render dynamic objects on top of the restored static objects depth
+    if (!RenderShadowMap(renderParams, commandBuffer, loadedLight, *shadowFramebuffer, shadowMapImage, ShadowCasters::Dynamic))
+    {
+        return false;
+    }
+
+    //
+    // Mark the light's shadow maps as now synced
+    //
+    m_lights->OnShadowMapSynced(loadedLight.light.lightId);
+
+    return true;
+}
+
+bool RendererVk::RenderShadowMap(const RenderParams& renderParams,
+                                 const VulkanCommandBufferPtr& commandBuffer,
+                                 const LoadedLight& loadedLight,
+                                 const FramebufferObjs& shadowFramebuffer,
+                                 const LoadedImage& shadowMapImage,
+                                 ShadowCasters shadowCasters)
+{
+    auto& currentFrame = m_frames.GetCurrentFrame();
+
+    // Dynamic objects are rendered on top of the static objects depth that was copied into the shadow map,
+    // rather than into a cleared shadow map
+    const bool loadExistingDepth = shadowCasters == ShadowCasters::Dynamic;
+
+    VulkanRenderPassPtr shadowRenderPass{};
+    VulkanRenderPassPtr shadowLoadRenderPass{};
+
+    switch (loadedLight.shadowMapType)
     {
-        CmdBufferSectionLabel sectionLabel(m_vulkanObjs->GetCalls(), commandBuffer, std::format("ShadowMapRender-Light-{}", loadedLight.light.lightId.id));
+        case ShadowMapType::Cascaded:
+        {
+            shadowRenderPass = m_vulkanObjs->GetShadowCascadedRenderPass();
+            shadowLoadRenderPass = m_vulkanObjs->GetShadowCascadedLoadRenderPass();
+        }
+        break;
+        case ShadowMapType::Single:
+        {
+            shadowRenderPass = m_vulkanObjs->GetShadowSingleRenderPass();
+            shadowLoadRenderPass = m_vulkanObjs->GetShadowSingleLoadRenderPass();
+        }
+        break;
+        case ShadowMapType::Cube:
+        {
+            shadowRenderPass = m_vulkanObjs->GetShadowCubeRenderPass();
+            shadowLoadRenderPass = m_vulkanObjs->GetShadowCubeLoadRenderPass();
+        }
+        break;
+    }
+
+    const float lightMaxAffectRange = GetLightMaxAffectRange(m_vulkanObjs->GetRenderSettings(), loadedLight.light);
 
-        if (!StartRenderPass(shadowRenderPass, *shadowFramebuffer, commandBuffer)) { return false; }
+    //
+    // Set up and run a shadow render for the light, for each of its shadow renders
+    //
+    if (!StartRenderPass(loadExistingDepth ? shadowLoadRenderPass : shadowRenderPass, shadowFramebuffer, commandBuffer)) { return false; }
 
-            //
-            // Clear any existing shadow map data
-            //
+        //
+        // Clear any existing shadow map data
+        //
+        if (!loadExistingDepth)
+        {
             VkClearAttachment vkClearAttachment{};
             vkClearAttachment.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
             vkClearAttachment.clearValue.depthStencil.depth = 1.0f;
@@ -1485,39 +1779,91 @@ bool RendererVk::RefreshShadowMap(const RenderParams& renderParams,
             vkClearRect.layerCount = 1;
 
             commandBuffer->CmdClearAttachments({vkClearAttachment}, {vkClearRect});
+        }
 
-            //
-            // Render the shadow map
-            //
-            std::vector<ViewProjection> shadowViewProjections;
+        //
+        // Render the shadow map
+        //
+        std::vector<ViewProjection> shadowViewProjections;
 
-            for (const auto& shadowRender : loadedLight.shadowRenders)
-            {
-                shadowViewProjections.push_back(shadowRender.viewProjection);
-            }
+        for (const auto& shadowRender : loadedLight.shadowRenders)
+        {
+            shadowViewProjections.push_back(shadowRender.viewProjection);
+        }
 
-            m_objectRenderers.GetRendererForFrame(currentFrame.GetFrameIndex())
-                .Render(
-                    loadedLight.light.sceneName,
-                    RenderType::Shadow,
-                    renderParams,
-                    commandBuffer,
-                    shadowRenderPass,
-                    shadowFramebuffer->GetFramebuffer(),
-                    shadowViewProjections,
-                    {},
-                    ObjectRenderer::ShadowRenderData(loadedLight.shadowMapType, lightMaxAffectRange)
-                );
+        // Note that the (non-load) shadow render pass is always provided for the render, even when the load render
+        // pass is active, as the two are compatible, and so they can share the same shadow pipelines
+        m_objectRenderers.GetRendererForFrame(currentFrame.GetFrameIndex())
+            .Render(
+                loadedLight.light.sceneName,
+                RenderType::Shadow,
+                renderParams,
+                commandBuffer,
+                shadowRenderPass,
+                shadowFramebuffer.GetFramebuffer(),
+                shadowViewProjections,
+                {},
+                ObjectRenderer::ShadowRenderData(loadedLight.shadowMapType, lightMaxAffectRange, shadowCasters)
+            );
 
-        EndRenderPass(commandBuffer);
-    }
+    EndRenderPass(commandBuffer);
 
+    return true;
+}
+
+void RendererVk::CopyShadowMap(const VulkanCommandBufferPtr& commandBuffer,
+                               const LoadedImage& srcShadowMapImage,
+                               const LoadedImage& dstShadowMapImage)
+{
     //
-    // Mark the light's shadow map as now synced
+    // Prepare a transfer operation from the source shadow map to the destination shadow map
     //
-    m_lights->OnShadowMapSynced(loadedLight.light.lightId);
+    m_renderState.PrepareOperation(commandBuffer, RenderOperation({
+        {srcShadowMapImage.id, ImageAccess(
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            BarrierPoint(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT),
+            BarrierPoint(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT),
+            Layers(0, srcShadowMapImage.image.numLayers),
+            Levels(0, 1),
+            VK_IMAGE_ASPECT_DEPTH_BIT
+        )},
+        {dstShadowMapImage.id, ImageAccess(
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            BarrierPoint(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT),
+            BarrierPoint(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT),
+            Layers(0, dstShadowMapImage.image.numLayers),
+            Levels(0, 1),
+            VK_IMAGE_ASPECT_DEPTH_BIT
+        )}
+    }));
 
-    return true;
+    //
+    // Copy the depth of every layer (cascade/cube face) of the shadow map
+    //
+    VkImageCopy vkImageCopy{};
+    vkImageCopy.srcSubresource.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+    vkImageCopy.srcSubresource.mipLevel = 0;
+    vkImageCopy.srcSubresource.baseArrayLayer = 0;
+    vkImageCopy.srcSubresource.layerCount = srcShadowMapImage.image.numLayers;
+    vkImageCopy.srcOffset = {0, 0, 0};
+    vkImageCopy.dstSubresource.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+    vkImageCopy.dstSubresource.mipLevel = 0;
+    vkImageCopy.dstSubresource.baseArrayLayer = 0;
+    vkImageCopy.dstSubresource.layerCount = dstShadowMapImage.image.numLayers;
+    vkImageCopy.dstOffset = {0, 0, 0};
+    vkImageCopy.extent = {dstShadowMapImage.image.size.w, dstShadowMapImage.image.size.h, 1};
+
+    m_vulkanObjs->GetCalls()->vkCmdCopyImage(
+        commandBuffer->GetVkCommandBuffer(),
+        srcShadowMapImage.allocation.vkImage,
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        dstShadowMapImage.allocation.vkImage,
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        1,
+        &vkImageCopy
+    );
 }
 
 void RendererVk::BlitEyeRendersToOpenXR(const VulkanCommandBufferPtr& commandBuffer, const LoadedImage& renderImage)
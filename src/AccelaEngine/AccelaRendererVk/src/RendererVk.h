@@ -45,8 +45,6 @@ namespace Accela::Render
                        IVulkanContextPtr vulkanContext,
                        IOpenXR::Ptr openXR);
 
-            [[nodiscard]] std::optional<ObjectId> GetTopObjectAtRenderPoint(const glm::vec2& renderPoint) const override;
-
         protected:
 
             void OnIdle() override;
@@ -74,11 +72,17 @@ namespace Accela::Render
             bool OnWorldUpdate(const WorldUpdate& update) override;
             bool OnSurfaceChanged() override;
             bool OnChangeRenderSettings(const RenderSettings& renderSettings) override;
+            void OnPickRenderRect(std::promise<std::vector<ObjectId>> resultPromise,
+                                  const URect& renderRect) override;
+            std::vector<ObjectId> OnPickRay(const std::string& sceneName,
+                                            const glm::vec3& rayStart_worldSpace,
+                                            const glm::vec3& rayEnd_worldSpace) override;
 
         private:
 
             bool LoadShaders(const std::vector<ShaderSpec>& shaders);
             bool CreatePrograms();
+            void WarmUpPipelines(const RenderSettings& renderSettings);
 
             bool RenderGraphFunc_RenderScene(const RenderGraphNode::Ptr& node);
             bool RenderGraphFunc_Present(const uint32_t& swapChainImageIndex, const RenderGraphNode::Ptr& node);
@@ -98,7 +102,19 @@ namespace Accela::Render
 
             [[nodiscard]] bool RefreshShadowMap(const RenderParams& renderParams,
                                                 const VulkanCommandBufferPtr& commandBuffer,
-                                                const LoadedLight& loadedLight);
+                                                const LoadedLight& loadedLight,
+                                                std::size_t& staticShadowMapRenders);
+
+            [[nodiscard]] bool RenderShadowMap(const RenderParams& renderParams,
+                                               const VulkanCommandBufferPtr& commandBuffer,
+                                               const LoadedLight& loadedLight,
+                                               const FramebufferObjs& shadowFramebuffer,
+                                               const LoadedImage& shadowMapImage,
+                                               ShadowCasters shadowCasters);
+
+            void CopyShadowMap(const VulkanCommandBufferPtr& commandBuffer,
+                               const LoadedImage& srcShadowMapImage,
+                               const LoadedImage& dstShadowMapImage);
 
             void RunSceneRender(const std::string& sceneName,
                                 const RenderTarget& renderTarget,
@@ -124,9 +140,12 @@ namespace Accela::Render
                                       const LoadedImage& renderImage,
                                       const LoadedImage& screenImage);
 
-            void TransferObjectDetailImage(const LoadedImage& gPassObjectDetailImage,
-                                           const LoadedImage& frameObjectDetailImage,
-                                           const VulkanCommandBufferPtr& commandBuffer);
+            void RecordPickReadback(const VulkanCommandBufferPtr& commandBuffer,
+                                    const LoadedImage& objectDetailImage,
+                                    const URect& region,
+                                    const BufferPtr& readbackBuffer);
+
+            [[nodiscard]] std::vector<ObjectId> ReadPickedObjectIds(const BufferPtr& readbackBuffer) const;
 
             void BlitEyeRendersToOpenXR(const VulkanCommandBufferPtr& commandBuffer, const LoadedImage& renderImage);
 
@@ -139,6 +158,7 @@ namespace Accela::Render
             IPipelineFactoryPtr m_pipelines;
             PostExecutionOpsPtr m_postExecutionOps;
             IBuffersPtr m_buffers;
+            UploadSchedulerPtr m_uploadScheduler;
             IImagesPtr m_images;
             ITexturesPtr m_textures;
             IMeshesPtr m_meshes;
@@ -151,8 +171,8 @@ namespace Accela::Render
             Frames m_frames;
             RenderState m_renderState;
 
-            mutable std::mutex m_latestObjectDetailTextureIdMutex;
-            std::optional<ImageId> m_latestObjectDetailImageId;
+            // The render target most recently presented, which pick requests read back from
+            std::optional<RenderTargetId> m_pickRenderTargetId;
 
             RendererGroup<SwapChainBlitRenderer> m_swapChainRenderers;
             RendererGroup<SpriteRenderer> m_spriteRenderers;
@@ -94,6 +94,14 @@ bool Textures::CreateTexture(const TextureDefinition& textureDefinition, std::pr
 
     m_logger->Log(Common::LogLevel::Debug, "CreateTexture: Creating texture: {}", textureDefinition.texture.id.id);
 
+    if (textureDefinition.texture.format != Format::RGBA32 &&
+        !m_vulkanObjs->GetPhysicalDevice()->GetPhysicalDeviceFeatures().textureCompressionBC)
+    {
+        m_logger->Log(Common::LogLevel::Error,
+          "CreateTexture: Texture is block-compressed, but the device doesn't support BC textures: {}", textureDefinition.texture.id.id);
+        return ErrorResult(resultPromise);
+    }
+
     const auto imageDefinition = TextureDefToImageDef(textureDefinition);
 
     const auto imageIdExpect = m_images->CreateFilledImage(imageDefinition, textureDefinition.texture.data, std::move(resultPromise));
@@ -317,13 +325,42 @@ ImageDefinition Textures::TextureDefToImageDef(const TextureDefinition& textureD
         case Format::RGBA32:
             vkImageFormat = VK_FORMAT_R8G8B8A8_SRGB;
         break;
+        case Format::BC1:
+            vkImageFormat = VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+        break;
+        case Format::BC3:
+            vkImageFormat = VK_FORMAT_BC3_SRGB_BLOCK;
+        break;
+        case Format::BC5:
+            // Two channel data (e.g. normal map XY), which is never sRGB encoded
+            vkImageFormat = VK_FORMAT_BC5_UNORM_BLOCK;
+        break;
+        case Format::BC7:
+            vkImageFormat = VK_FORMAT_BC7_SRGB_BLOCK;
+        break;
+    }
+
+    uint32_t numMipLevels = textureDefinition.texture.numMipLevels ? *textureDefinition.texture.numMipLevels : 1;
+
+    // Whether the texture's mip levels will be generated on the GPU from its base level, rather than being
+    // provided, pre-baked, by its data. Block-compressed images can't be blitted to, so never have mips generated.
+    bool generatesMipLevels = numMipLevels > 1;
+
+    if (const auto& data = textureDefinition.texture.data)
+    {
+        if (data->IsBlockCompressed())
+        {
+            numMipLevels = std::min(numMipLevels, data->GetNumMipLevels());
+        }
+
+        generatesMipLevels = numMipLevels > data->GetNumMipLevels() && !data->IsBlockCompressed();
     }
 
     // Textures are universally sampled and have their image data transfered to them
     VkImageUsageFlags vkImageUsageFlags = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 
-    // If the texture has mip levels, mark it as a transfer source for the mip-mapping blit transfers
-    if (textureDefinition.texture.numMipLevels)
+    // If the texture generates mip levels, mark it as a transfer source for the mip-mapping blit transfers
+    if (generatesMipLevels)
     {
         vkImageUsageFlags = vkImageUsageFlags | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
     }
@@ -336,7 +373,7 @@ ImageDefinition Textures::TextureDefToImageDef(const TextureDefinition& textureD
         .vkImageUsageFlags = vkImageUsageFlags,
         .size = textureDefinition.texture.pixelSize,
         .numLayers = textureDefinition.texture.numLayers,
-        .numMipLevels = textureDefinition.texture.numMipLevels ? *textureDefinition.texture.numMipLevels : 1,
+        .numMipLevels = numMipLevels,
         .cubeCompatible = textureDefinition.texture.cubicTexture
     };
 
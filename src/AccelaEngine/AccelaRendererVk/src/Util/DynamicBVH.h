@@ -0,0 +1,562 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERERVK_SRC_UTIL_DYNAMICBVH_H
+#define LIBACCELARENDERERVK_SRC_UTIL_DYNAMICBVH_H
+
+#include "Volume.h"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Render
+{
+    /**
+     * Dynamic AABB tree (binary bounding volume hierarchy) over volumes which move over time.
+     *
+     * Leaves store "fat" bounds: the bounds they were inserted/updated with, expanded by a margin and by
+     * the entry's predicted movement. While an entry's bounds stay within its fat bounds, updating it
+     * doesn't touch the tree at all. When an entry leaves its fat bounds but moves only a little (its new
+     * fat bounds still overlap its old ones), its leaf is refit in place and its ancestors' bounds are
+     * recomputed, rather than the leaf being removed and re-inserted. Only entries which jump a larger
+     * distance are re-inserted.
+     *
+     * Inserts choose their position in the tree with a surface area heuristic, and every node whose bounds
+     * are recomputed (by an insert, remove, or refit) is given a chance to rotate its children with its
+     * grandchildren if doing so reduces the surface area of the tree, which keeps the tree balanced
+     * incrementally as entries move, rather than needing periodic rebuilds.
+     *
+     * Entries are referenced by the proxy id returned when they're inserted, which stays valid until
+     * the entry is removed.
+     *
+     * @tparam DATATYPE The data associated with each entry; should be small and cheap to copy (e.g. an id)
+     */
+    template <typename DATATYPE>
+    class DynamicBVH
+    {
+        public:
+
+            using ProxyId = int32_t;
+
+            static constexpr ProxyId NULL_PROXY = -1;
+
+        public:
+
+            /**
+             * @param fatMargin Distance leaf bounds are expanded by, in every direction, beyond the bounds
+             * entries are inserted/updated with. Trees over entries which never move should use 0.
+             * @param displacementMultiplier Multiple of an update's displacement that its fat bounds are
+             * additionally expanded by, in the direction of the displacement.
+             */
+            explicit DynamicBVH(float fatMargin = 0.0f, float displacementMultiplier = 2.0f)
+                : m_fatMargin(fatMargin)
+                , m_displacementMultiplier(displacementMultiplier)
+            { }
+
+            /**
+             * Inserts an entry into the tree.
+             *
+             * @return The entry's proxy id, for updating/removing it
+             */
+            ProxyId Insert(const Volume& volume, const DATATYPE& data)
+            {
+                const ProxyId proxyId = AllocateNode();
+
+                auto& node = m_nodes[proxyId];
+                node.volume = Fatten(volume, glm::vec3(0));
+                node.data = data;
+                node.height = 0;
+
+                InsertLeaf(proxyId);
+
+                m_size++;
+
+                return proxyId;
+            }
+
+            /**
+             * Removes an entry from the tree
+             */
+            void Remove(ProxyId proxyId)
+            {
+                assert(IsLeaf(proxyId));
+
+                RemoveLeaf(proxyId);
+                FreeNode(proxyId);
+
+                m_size--;
+            }
+
+            /**
+             * Updates the bounds of an entry.
+             *
+             * @param proxyId The entry's proxy id
+             * @param volume The entry's new bounds
+             * @param displacement How far the entry moved since its last update, used to predict its next
+             * movement when expanding its fat bounds
+             *
+             * @return Whether the tree was modified. False if the entry is still within its fat bounds.
+             */
+            bool Update(ProxyId proxyId, const Volume& volume, const glm::vec3& displacement = glm::vec3(0))
+            {
+                assert(IsLeaf(proxyId));
+
+                auto& node = m_nodes[proxyId];
+
+                if (Contains(node.volume, volume))
+                {
+                    return false;
+                }
+
+                const auto fatVolume = Fatten(volume, displacement);
+
+                // Small motion; refit the leaf and its ancestors in place
+                if (Overlaps(node.volume, fatVolume))
+                {
+                    node.volume = fatVolume;
+                    RefitAncestors(node.parent);
+                    return true;
+                }
+
+                // Large motion; re-insert the leaf wherever it now fits best
+                RemoveLeaf(proxyId);
+                m_nodes[proxyId].volume = fatVolume;
+                InsertLeaf(proxyId);
+
+                return true;
+            }
+
+            /**
+             * Removes all entries from the tree
+             */
+            void RemoveAll()
+            {
+                m_nodes.clear();
+                m_root = NULL_PROXY;
+                m_freeList = NULL_PROXY;
+                m_size = 0;
+            }
+
+            [[nodiscard]] const DATATYPE& GetData(ProxyId proxyId) const { return m_nodes[proxyId].data; }
+            [[nodiscard]] const Volume& GetFatVolume(ProxyId proxyId) const { return m_nodes[proxyId].volume; }
+
+            /**
+             * @return The number of entries in the tree
+             */
+            [[nodiscard]] std::size_t GetSize() const noexcept { return m_size; }
+
+            /**
+             * @return The height of the tree; 0 for an empty tree or a tree with a single entry
+             */
+            [[nodiscard]] int32_t GetHeight() const noexcept { return m_root == NULL_PROXY ? 0 : m_nodes[m_root].height; }
+
+            /**
+             * @return The summed surface area of the tree's internal nodes, relative to the surface area
+             * of its root. Lower is better; useful for judging the quality of the tree.
+             */
+            [[nodiscard]] float GetAreaRatio() const
+            {
+                if (m_root == NULL_PROXY) { return 0.0f; }
+
+                const float rootArea = SurfaceArea(m_nodes[m_root].volume);
+                if (rootArea <= 0.0f) { return 0.0f; }
+
+                float totalArea = 0.0f;
+
+                for (const auto& node : m_nodes)
+                {
+                    if (node.height > 0)
+                    {
+                        totalArea += SurfaceArea(node.volume);
+                    }
+                }
+
+                return totalArea / rootArea;
+            }
+
+            /**
+             * Visits all entries whose (fat) bounds pass a test. Subtrees whose bounds fail the test are
+             * skipped, so the test must pass for any volume which contains a volume that passes it.
+             *
+             * @param volumeTest bool(const Volume&) test of a node's bounds
+             * @param visitor void(const DATATYPE&) called for each entry whose bounds pass the test
+             */
+            template <typename VolumeTest, typename Visitor>
+            void Query(const VolumeTest& volumeTest, const Visitor& visitor) const
+            {
+                if (m_root == NULL_PROXY || !volumeTest(m_nodes[m_root].volume)) { return; }
+
+                // Nodes whose bounds have passed the test, and which are yet to be visited
+                std::vector<ProxyId> stack;
+                stack.reserve(64);
+                stack.push_back(m_root);
+
+                while (!stack.empty())
+                {
+                    const auto& node = m_nodes[stack.back()];
+                    stack.pop_back();
+
+                    if (node.height == 0)
+                    {
+                        visitor(node.data);
+                        continue;
+                    }
+
+                    if (volumeTest(m_nodes[node.child1].volume)) { stack.push_back(node.child1); }
+                    if (volumeTest(m_nodes[node.child2].volume)) { stack.push_back(node.child2); }
+                }
+            }
+
+            /**
+             * @return The data of all entries whose (fat) bounds overlap the volume
+             */
+            [[nodiscard]] std::vector<DATATYPE> FetchMatching(const Volume& volume) const
+            {
+                std::vector<DATATYPE> results;
+
+                Query(
+                    [&](const Volume& nodeVolume){ return Overlaps(nodeVolume, volume); },
+                    [&](const DATATYPE& data){ results.push_back(data); }
+                );
+
+                return results;
+            }
+
+            /**
+             * @return The data of all entries whose (fat) bounds pass a test. See Query for test requirements.
+             */
+            [[nodiscard]] std::vector<DATATYPE> FetchMatching(const std::function<bool(const Volume&)>& volumeTest) const
+            {
+                std::vector<DATATYPE> results;
+
+                Query(volumeTest, [&](const DATATYPE& data){ results.push_back(data); });
+
+                return results;
+            }
+
+        private:
+
+            struct Node
+            {
+                // Union of the children's bounds for internal nodes, fat bounds for leaves
+                Volume volume;
+
+                DATATYPE data{};
+
+                // Parent node while allocated; next free node while in the free list
+                ProxyId parent{NULL_PROXY};
+
+                ProxyId child1{NULL_PROXY};
+                ProxyId child2{NULL_PROXY};
+
+                // 0 for leaves, -1 for free nodes
+                int32_t height{-1};
+            };
+
+        private:
+
+            [[nodiscard]] bool IsLeaf(ProxyId nodeId) const
+            {
+                return nodeId >= 0 && static_cast<std::size_t>(nodeId) < m_nodes.size() && m_nodes[nodeId].height == 0;
+            }
+
+            [[nodiscard]] static Volume Union(const Volume& a, const Volume& b)
+            {
+                return {glm::min(a.min, b.min), glm::max(a.max, b.max)};
+            }
+
+            [[nodiscard]] static bool Contains(const Volume& outer, const Volume& inner)
+            {
+                return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+                       outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+            }
+
+            [[nodiscard]] static bool Overlaps(const Volume& a, const Volume& b)
+            {
+                return a.min.x <= b.max.x && a.min.y <= b.max.y && a.min.z <= b.max.z &&
+                       a.max.x >= b.min.x && a.max.y >= b.min.y && a.max.z >= b.min.z;
+            }
+
+            // Half of the volume's surface area, which is all that's needed for comparing costs
+            [[nodiscard]] static float SurfaceArea(const Volume& volume)
+            {
+                const auto extent = volume.max - volume.min;
+                return (extent.x * extent.y) + (extent.y * extent.z) + (extent.z * extent.x);
+            }
+
+            [[nodiscard]] Volume Fatten(const Volume& volume, const glm::vec3& displacement) const
+            {
+                Volume fatVolume(volume.min - glm::vec3(m_fatMargin), volume.max + glm::vec3(m_fatMargin));
+
+                const auto predicted = displacement * m_displacementMultiplier;
+
+                fatVolume.min += glm::min(predicted, glm::vec3(0));
+                fatVolume.max += glm::max(predicted, glm::vec3(0));
+
+                return fatVolume;
+            }
+
+            ProxyId AllocateNode()
+            {
+                if (m_freeList == NULL_PROXY)
+                {
+                    m_nodes.emplace_back();
+                    return static_cast<ProxyId>(m_nodes.size() - 1);
+                }
+
+                const ProxyId nodeId = m_freeList;
+                m_freeList = m_nodes[nodeId].parent;
+                m_nodes[nodeId] = Node{};
+
+                return nodeId;
+            }
+
+            void FreeNode(ProxyId nodeId)
+            {
+                m_nodes[nodeId] = Node{};
+                m_nodes[nodeId].parent = m_freeList;
+                m_freeList = nodeId;
+            }
+
+            void InsertLeaf(ProxyId leafId)
+            {
+                if (m_root == NULL_PROXY)
+                {
+                    m_root = leafId;
+                    m_nodes[leafId].parent = NULL_PROXY;
+                    return;
+                }
+
+                //
+                // Descend the tree to find the best sibling for the leaf, by the surface area heuristic: the
+                // cost of pairing the leaf with a node is the area of the new parent node, plus the area that
+                // pairing adds to all of the node's ancestors
+                //
+                const Volume leafVolume = m_nodes[leafId].volume;
+
+                ProxyId siblingId = m_root;
+
+                while (m_nodes[siblingId].height > 0)
+                {
+                    const auto& node = m_nodes[siblingId];
+
+                    const float area = SurfaceArea(node.volume);
+                    const float combinedArea = SurfaceArea(Union(node.volume, leafVolume));
+
+                    // Cost of making the leaf a sibling of this node
+                    const float cost = 2.0f * combinedArea;
+
+                    // Cost added to every ancestor of anything below this node
+                    const float inheritanceCost = 2.0f * (combinedArea - area);
+
+                    const auto childCost = [&](ProxyId childId){
+                        const auto& child = m_nodes[childId];
+                        const float unionArea = SurfaceArea(Union(leafVolume, child.volume));
+
+                        if (child.height == 0) { return unionArea + inheritanceCost; }
+
+                        return (unionArea - SurfaceArea(child.volume)) + inheritanceCost;
+                    };
+
+                    const float cost1 = childCost(node.child1);
+                    const float cost2 = childCost(node.child2);
+
+                    if (cost < cost1 && cost < cost2)
+                    {
+                        break;
+                    }
+
+                    siblingId = cost1 < cost2 ? node.child1 : node.child2;
+                }
+
+                //
+                // Create a new parent for the leaf and its sibling
+                //
+                const ProxyId oldParentId = m_nodes[siblingId].parent;
+                const ProxyId newParentId = AllocateNode();
+
+                auto& newParent = m_nodes[newParentId];
+                newParent.parent = oldParentId;
+                newParent.volume = Union(leafVolume, m_nodes[siblingId].volume);
+                newParent.height = m_nodes[siblingId].height + 1;
+                newParent.child1 = siblingId;
+                newParent.child2 = leafId;
+
+                m_nodes[siblingId].parent = newParentId;
+                m_nodes[leafId].parent = newParentId;
+
+                if (oldParentId == NULL_PROXY)
+                {
+                    m_root = newParentId;
+                }
+                else
+                {
+                    auto& oldParent = m_nodes[oldParentId];
+
+                    if (oldParent.child1 == siblingId) { oldParent.child1 = newParentId; }
+                    else                               { oldParent.child2 = newParentId; }
+                }
+
+                RefitAncestors(oldParentId);
+            }
+
+            void RemoveLeaf(ProxyId leafId)
+            {
+                if (leafId == m_root)
+                {
+                    m_root = NULL_PROXY;
+                    return;
+                }
+
+                //
+                // Replace the leaf's parent with the leaf's sibling
+                //
+                const ProxyId parentId = m_nodes[leafId].parent;
+                const ProxyId grandParentId = m_nodes[parentId].parent;
+                const ProxyId siblingId = m_nodes[parentId].child1 == leafId ? m_nodes[parentId].child2 : m_nodes[parentId].child1;
+
+                m_nodes[siblingId].parent = grandParentId;
+                m_nodes[leafId].parent = NULL_PROXY;
+
+                FreeNode(parentId);
+
+                if (grandParentId == NULL_PROXY)
+                {
+                    m_root = siblingId;
+                    return;
+                }
+
+                auto& grandParent = m_nodes[grandParentId];
+
+                if (grandParent.child1 == parentId) { grandParent.child1 = siblingId; }
+                else                                { grandParent.child2 = siblingId; }
+
+                RefitAncestors(grandParentId);
+            }
+
+            /**
+             * Recomputes the bounds and heights of a node and all of its ancestors, rotating each of them
+             * as they're visited
+             */
+            void RefitAncestors(ProxyId nodeId)
+            {
+                while (nodeId != NULL_PROXY)
+                {
+                    RefitNode(nodeId);
+                    Rotate(nodeId);
+
+                    nodeId = m_nodes[nodeId].parent;
+                }
+            }
+
+            void RefitNode(ProxyId nodeId)
+            {
+                auto& node = m_nodes[nodeId];
+                const auto& child1 = m_nodes[node.child1];
+                const auto& child2 = m_nodes[node.child2];
+
+                node.volume = Union(child1.volume, child2.volume);
+                node.height = 1 + std::max(child1.height, child2.height);
+            }
+
+            /**
+             * Considers swapping each of a node's children with each of its other child's children, and
+             * performs the swap which reduces the surface area of the (child) node being changed the most,
+             * if any do.
+             *
+             *       A                A
+             *     /   \            /   \
+             *    B     C    ->    F     C
+             *         / \              / \
+             *        F   G            B   G
+             */
+            void Rotate(ProxyId nodeAId)
+            {
+                const auto& nodeA = m_nodes[nodeAId];
+
+                const ProxyId nodeBId = nodeA.child1;
+                const ProxyId nodeCId = nodeA.child2;
+
+                const auto& nodeB = m_nodes[nodeBId];
+                const auto& nodeC = m_nodes[nodeCId];
+
+                if (nodeB.height < 1 && nodeC.height < 1)
+                {
+                    return;
+                }
+
+                // Swaps a child of A (the "uncle") with a child of A's other child (the "nephew")
+                struct Rotation
+                {
+                    ProxyId uncleId{NULL_PROXY};
+                    ProxyId nephewId{NULL_PROXY};
+                    float areaDelta{0.0f};
+                };
+
+                Rotation best{};
+
+                const auto consider = [&](ProxyId uncleId, ProxyId auntId){
+                    const auto& aunt = m_nodes[auntId];
+                    if (aunt.height < 1) { return; }
+
+                    const float auntArea = SurfaceArea(aunt.volume);
+                    const auto& uncleVolume = m_nodes[uncleId].volume;
+
+                    // Swapping the uncle with the aunt's child1 leaves the aunt bounding the uncle and child2, and vice versa
+                    const float areaDelta1 = SurfaceArea(Union(uncleVolume, m_nodes[aunt.child2].volume)) - auntArea;
+                    const float areaDelta2 = SurfaceArea(Union(uncleVolume, m_nodes[aunt.child1].volume)) - auntArea;
+
+                    if (areaDelta1 < best.areaDelta) { best = {uncleId, aunt.child1, areaDelta1}; }
+                    if (areaDelta2 < best.areaDelta) { best = {uncleId, aunt.child2, areaDelta2}; }
+                };
+
+                consider(nodeBId, nodeCId);
+                consider(nodeCId, nodeBId);
+
+                if (best.uncleId == NULL_PROXY)
+                {
+                    return;
+                }
+
+                //
+                // Perform the swap
+                //
+                const ProxyId auntId = m_nodes[best.nephewId].parent;
+
+                auto& aunt = m_nodes[auntId];
+                if (aunt.child1 == best.nephewId) { aunt.child1 = best.uncleId; }
+                else                              { aunt.child2 = best.uncleId; }
+
+                auto& a = m_nodes[nodeAId];
+                if (a.child1 == best.uncleId) { a.child1 = best.nephewId; }
+                else                          { a.child2 = best.nephewId; }
+
+                m_nodes[best.uncleId].parent = auntId;
+                m_nodes[best.nephewId].parent = nodeAId;
+
+                RefitNode(auntId);
+                RefitNode(nodeAId);
+            }
+
+        private:
+
+            float m_fatMargin;
+            float m_displacementMultiplier;
+
+            std::vector<Node> m_nodes;
+            ProxyId m_root{NULL_PROXY};
+            ProxyId m_freeList{NULL_PROXY};
+            std::size_t m_size{0};
+    };
+}
+
+#endif //LIBACCELARENDERERVK_SRC_UTIL_DYNAMICBVH_H
@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERERVK_SRC_UTIL_FRUSTUM_H
+#define LIBACCELARENDERERVK_SRC_UTIL_FRUSTUM_H
+
+#include <glm/glm.hpp>
+
+#include <array>
+
+namespace Accela::Render
+{
+    /**
+     * A view frustum, as the six planes which bound it. A point p is inside a plane if
+     * dot(plane.xyz, p) + plane.w >= 0.
+     */
+    struct Frustum
+    {
+        /**
+         * Extracts the frustum planes of a transformation (such as a view projection), in the space
+         * which the transformation transforms from.
+         *
+         * The near plane is taken as z >= -w, which is the near plane of a [-1,1] depth range projection, and
+         * lies just behind the near plane of a [0,1] depth range projection, so either is bounded conservatively.
+         */
+        [[nodiscard]] static Frustum FromTransformation(const glm::mat4& transformation)
+        {
+            const auto row = [&](int r){
+                return glm::vec4(transformation[0][r], transformation[1][r], transformation[2][r], transformation[3][r]);
+            };
+
+            Frustum frustum{};
+            frustum.planes[0] = row(3) + row(0); // Left
+            frustum.planes[1] = row(3) - row(0); // Right
+            frustum.planes[2] = row(3) + row(1); // Bottom
+            frustum.planes[3] = row(3) - row(1); // Top
+            frustum.planes[4] = row(3) + row(2); // Near
+            frustum.planes[5] = row(3) - row(2); // Far
+
+            return frustum;
+        }
+
+        std::array<glm::vec4, 6> planes{};
+    };
+}
+
+#endif //LIBACCELARENDERERVK_SRC_UTIL_FRUSTUM_H
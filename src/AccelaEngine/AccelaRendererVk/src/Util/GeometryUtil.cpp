@@ -8,6 +8,8 @@
 
 #include <algorithm>
 #include <ranges>
+#include <limits>
+#include <cmath>
 
 namespace Accela::Render
 {
@@ -133,6 +135,37 @@ std::optional<glm::vec3> Intersection(const Ray& ray, const Plane& plane, bool a
     return ray.originPoint + (ray.dirUnit * *distance);
 }
 
+std::optional<float> DistanceToVolume(const Ray& ray, const Volume& volume) noexcept
+{
+    float tMin = 0.0f;
+    float tMax = ray.length ? *ray.length : std::numeric_limits<float>::max();
+
+    // Slab test: clip the ray's [tMin, tMax] range against each axis' pair of volume planes
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const float origin = ray.originPoint[axis];
+        const float dir = ray.dirUnit[axis];
+
+        // Ray is parallel to this axis' planes; it's either always or never between them
+        if (std::abs(dir) <= .000001f)
+        {
+            if (origin < volume.min[axis] || origin > volume.max[axis]) { return std::nullopt; }
+            continue;
+        }
+
+        float t1 = (volume.min[axis] - origin) / dir;
+        float t2 = (volume.max[axis] - origin) / dir;
+        if (t1 > t2) { std::swap(t1, t2); }
+
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+
+        if (tMin > tMax) { return std::nullopt; }
+    }
+
+    return tMin;
+}
+
 std::vector<glm::vec3> TransformedProjectionBounds(const Projection::Ptr& projection, const glm::mat4& transform)
 {
     std::vector<glm::vec3> transformedPoints;
@@ -100,6 +100,15 @@ namespace Accela::Render
      */
     [[nodiscard]] std::optional<glm::vec3> Intersection(const Ray& ray, const Plane& plane, bool allowedBackwardsTravel);
 
+    /**
+     * Calculates the distance along a ray at which it enters a volume. Only forwards travel along the ray
+     * is considered, and if the ray has a length, only travel up to that length.
+     *
+     * @return The distance along the ray to the volume (0.0f if the ray starts within the volume), or
+     * std::nullopt if the ray doesn't intersect the volume
+     */
+    [[nodiscard]] std::optional<float> DistanceToVolume(const Ray& ray, const Volume& volume) noexcept;
+
     /**
      * Applies the provided transform to the provided projection's (view-space) bounding points, and returns the
      * transformed bounding points.
@@ -0,0 +1,354 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "OcclusionBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cfloat>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define ACCELA_OCCLUSION_SSE
+    #include <emmintrin.h>
+#endif
+
+namespace Accela::Render
+{
+
+// Depth of pixels which no occluder covers
+static constexpr float EMPTY_DEPTH = FLT_MAX;
+
+// Triangles with less than this (pixel) area are skipped
+static constexpr float MIN_TRIANGLE_AREA = 1e-6f;
+
+//
+// Signed distance of a clip space point from the near plane. Uses the OpenGL convention (z >= -w), which for
+// a [0,1] depth range projection is a plane slightly nearer than the true near plane, so either is handled
+// conservatively.
+//
+static inline float NearPlaneDistance(const glm::vec4& v_clipSpace) noexcept
+{
+    return v_clipSpace.z + v_clipSpace.w;
+}
+
+OcclusionBuffer::OcclusionBuffer(uint32_t width, uint32_t height)
+    : m_width(std::max(width, 1U))
+    , m_height(std::max(height, 1U))
+    , m_stride((m_width + 3U) & ~3U)
+    , m_depths((std::size_t)m_stride * m_height, EMPTY_DEPTH)
+{
+
+}
+
+void OcclusionBuffer::Reset(const glm::mat4& viewProjection)
+{
+    m_viewProjection = viewProjection;
+    std::fill(m_depths.begin(), m_depths.end(), EMPTY_DEPTH);
+}
+
+std::size_t OcclusionBuffer::RasterizeOccluder(std::span<const glm::vec3> positions_modelSpace,
+                                               std::span<const uint32_t> indices,
+                                               const glm::mat4& modelTransform,
+                                               bool cullBackFaces)
+{
+    const glm::mat4 modelToClip = m_viewProjection * modelTransform;
+
+    std::vector<glm::vec4> positions_clipSpace;
+    positions_clipSpace.reserve(positions_modelSpace.size());
+
+    for (const auto& position : positions_modelSpace)
+    {
+        positions_clipSpace.push_back(modelToClip * glm::vec4(position, 1.0f));
+    }
+
+    std::size_t numTriangles = 0;
+
+    for (std::size_t x = 0; x + 2 < indices.size(); x += 3)
+    {
+        if (indices[x] >= positions_clipSpace.size() ||
+            indices[x + 1] >= positions_clipSpace.size() ||
+            indices[x + 2] >= positions_clipSpace.size())
+        {
+            continue;
+        }
+
+        RasterizeClippedTriangle(
+            positions_clipSpace[indices[x]],
+            positions_clipSpace[indices[x + 1]],
+            positions_clipSpace[indices[x + 2]],
+            cullBackFaces
+        );
+
+        numTriangles++;
+    }
+
+    return numTriangles;
+}
+
+void OcclusionBuffer::RasterizeClippedTriangle(const glm::vec4& v0_clipSpace,
+                                               const glm::vec4& v1_clipSpace,
+                                               const glm::vec4& v2_clipSpace,
+                                               bool cullBackFaces)
+{
+    const std::array<glm::vec4, 3> triangle{v0_clipSpace, v1_clipSpace, v2_clipSpace};
+    const std::array<float, 3> distances{
+        NearPlaneDistance(v0_clipSpace),
+        NearPlaneDistance(v1_clipSpace),
+        NearPlaneDistance(v2_clipSpace)
+    };
+
+    //
+    // Clip the triangle against the near plane, which produces up to four vertices. (Triangles don't need to be
+    // clipped against the other planes, as their screen bounds are clamped to the buffer when rasterizing).
+    //
+    std::array<glm::vec4, 4> clipped{};
+    std::size_t numClipped = 0;
+
+    for (std::size_t x = 0; x < 3; ++x)
+    {
+        const std::size_t next = (x + 1) % 3;
+
+        if (distances[x] >= 0.0f)
+        {
+            clipped[numClipped++] = triangle[x];
+        }
+
+        if ((distances[x] >= 0.0f) != (distances[next] >= 0.0f))
+        {
+            const float t = distances[x] / (distances[x] - distances[next]);
+            clipped[numClipped++] = triangle[x] + ((triangle[next] - triangle[x]) * t);
+        }
+    }
+
+    if (numClipped < 3) { return; }
+
+    //
+    // Anything at or behind the near plane has w of (nearly) zero for a perspective projection, which can't be
+    // projected to the screen; such a triangle lies almost entirely outside the view anyway
+    //
+    for (std::size_t x = 0; x < numClipped; ++x)
+    {
+        if (clipped[x].w <= FLT_EPSILON) { return; }
+    }
+
+    const auto v0_screenSpace = ClipToScreenSpace(clipped[0]);
+    const auto v1_screenSpace = ClipToScreenSpace(clipped[1]);
+    const auto v2_screenSpace = ClipToScreenSpace(clipped[2]);
+
+    RasterizeTriangle(v0_screenSpace, v1_screenSpace, v2_screenSpace, cullBackFaces);
+
+    if (numClipped == 4)
+    {
+        RasterizeTriangle(v0_screenSpace, v2_screenSpace, ClipToScreenSpace(clipped[3]), cullBackFaces);
+    }
+}
+
+glm::vec3 OcclusionBuffer::ClipToScreenSpace(const glm::vec4& v_clipSpace) const noexcept
+{
+    const glm::vec3 v_ndc = glm::vec3(v_clipSpace) / v_clipSpace.w;
+
+    return {
+        ((v_ndc.x * 0.5f) + 0.5f) * (float)m_width,
+        ((v_ndc.y * 0.5f) + 0.5f) * (float)m_height,
+        v_ndc.z
+    };
+}
+
+void OcclusionBuffer::RasterizeTriangle(const glm::vec3& v0_screenSpace,
+                                        const glm::vec3& v1_screenSpace,
+                                        const glm::vec3& v2_screenSpace,
+                                        bool cullBackFaces)
+{
+    glm::vec3 v0 = v0_screenSpace;
+    glm::vec3 v1 = v1_screenSpace;
+    glm::vec3 v2 = v2_screenSpace;
+
+    //
+    // Screen space matches Vulkan's framebuffer space, in which a front facing (counter-clockwise) triangle has
+    // a negative area as computed here. Back facing triangles are skipped when back faces are culled, as the GPU
+    // would skip them. Front facing triangles are flipped so that the inside of every rasterized triangle has
+    // positive edge function values.
+    //
+    float area = ((v1.x - v0.x) * (v2.y - v0.y)) - ((v1.y - v0.y) * (v2.x - v0.x));
+    if (std::abs(area) < MIN_TRIANGLE_AREA) { return; }
+
+    if (area > 0.0f && cullBackFaces) { return; }
+
+    if (area < 0.0f)
+    {
+        std::swap(v1, v2);
+        area = -area;
+    }
+
+    //
+    // Range of pixels whose centers the triangle's bounds cover, clamped to the buffer
+    //
+    const float minX = std::min({v0.x, v1.x, v2.x});
+    const float maxX = std::max({v0.x, v1.x, v2.x});
+    const float minY = std::min({v0.y, v1.y, v2.y});
+    const float maxY = std::max({v0.y, v1.y, v2.y});
+
+    const auto startX = (int64_t)std::max(std::ceil(minX - 0.5f), 0.0f);
+    const auto endX = (int64_t)std::min(std::floor(maxX - 0.5f), (float)m_width - 1.0f);
+    const auto startY = (int64_t)std::max(std::ceil(minY - 0.5f), 0.0f);
+    const auto endY = (int64_t)std::min(std::floor(maxY - 0.5f), (float)m_height - 1.0f);
+
+    if (startX > endX || startY > endY) { return; }
+
+    //
+    // Edge functions, e(x, y) = a*x + b*y + c, which are positive on the inside of each edge, and the
+    // depth plane, z(x, y) = a*x + b*y + c, from the barycentric weights the edge functions give
+    //
+    struct Plane2D
+    {
+        float a, b, c;
+
+        [[nodiscard]] float At(float x, float y) const noexcept { return (a * x) + (b * y) + c; }
+    };
+
+    const auto edgeFunction = [](const glm::vec3& va, const glm::vec3& vb){
+        const float a = -(vb.y - va.y);
+        const float b = vb.x - va.x;
+        return Plane2D{a, b, -((a * va.x) + (b * va.y))};
+    };
+
+    const Plane2D e0 = edgeFunction(v1, v2); // Weight of v0
+    const Plane2D e1 = edgeFunction(v2, v0); // Weight of v1
+    const Plane2D e2 = edgeFunction(v0, v1); // Weight of v2
+
+    const float invArea = 1.0f / area;
+
+    const Plane2D depth{
+        ((e0.a * v0.z) + (e1.a * v1.z) + (e2.a * v2.z)) * invArea,
+        ((e0.b * v0.z) + (e1.b * v1.z) + (e2.b * v2.z)) * invArea,
+        ((e0.c * v0.z) + (e1.c * v1.z) + (e2.c * v2.z)) * invArea
+    };
+
+    //
+    // Rasterize, four pixels at a time, from the aligned block containing the first pixel. Pixels in a block
+    // which are outside the triangle's bounds are outside the triangle, or are row padding, so need no masking.
+    //
+    const int64_t startBlockX = startX & ~(int64_t)3;
+
+    for (int64_t y = startY; y <= endY; ++y)
+    {
+        const float pixelY = (float)y + 0.5f;
+        float* pRow = m_depths.data() + (y * m_stride);
+
+    #ifdef ACCELA_OCCLUSION_SSE
+        const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+        const __m128 zero = _mm_setzero_ps();
+
+        const __m128 e0Step = _mm_set1_ps(e0.a * 4.0f);
+        const __m128 e1Step = _mm_set1_ps(e1.a * 4.0f);
+        const __m128 e2Step = _mm_set1_ps(e2.a * 4.0f);
+        const __m128 depthStep = _mm_set1_ps(depth.a * 4.0f);
+
+        const __m128 blockX = _mm_add_ps(_mm_set1_ps((float)startBlockX), laneOffsets);
+
+        __m128 e0Values = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(e0.a), blockX), _mm_set1_ps((e0.b * pixelY) + e0.c));
+        __m128 e1Values = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(e1.a), blockX), _mm_set1_ps((e1.b * pixelY) + e1.c));
+        __m128 e2Values = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(e2.a), blockX), _mm_set1_ps((e2.b * pixelY) + e2.c));
+        __m128 depthValues = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(depth.a), blockX), _mm_set1_ps((depth.b * pixelY) + depth.c));
+
+        for (int64_t x = startBlockX; x <= endX; x += 4)
+        {
+            const __m128 inside = _mm_and_ps(
+                _mm_and_ps(_mm_cmpge_ps(e0Values, zero), _mm_cmpge_ps(e1Values, zero)),
+                _mm_cmpge_ps(e2Values, zero)
+            );
+
+            if (_mm_movemask_ps(inside) != 0)
+            {
+                const __m128 existing = _mm_load_ps(pRow + x);
+                const __m128 nearest = _mm_min_ps(existing, depthValues);
+                _mm_store_ps(pRow + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, existing)));
+            }
+
+            e0Values = _mm_add_ps(e0Values, e0Step);
+            e1Values = _mm_add_ps(e1Values, e1Step);
+            e2Values = _mm_add_ps(e2Values, e2Step);
+            depthValues = _mm_add_ps(depthValues, depthStep);
+        }
+    #else
+        for (int64_t x = startBlockX; x <= endX; ++x)
+        {
+            const float pixelX = (float)x + 0.5f;
+
+            if (e0.At(pixelX, pixelY) < 0.0f || e1.At(pixelX, pixelY) < 0.0f || e2.At(pixelX, pixelY) < 0.0f) { continue; }
+
+            pRow[x] = std::min(pRow[x], depth.At(pixelX, pixelY));
+        }
+    #endif
+    }
+}
+
+bool OcclusionBuffer::IsVisible(const Volume& volume_worldSpace) const
+{
+    //
+    // Project the volume's corners to find the screen area it covers and its nearest depth. If any corner is
+    // in front of the near plane, the volume surrounds the viewer, and is always considered visible.
+    //
+    float minX = FLT_MAX, maxX = -FLT_MAX;
+    float minY = FLT_MAX, maxY = -FLT_MAX;
+    float minDepth = FLT_MAX;
+
+    for (const auto& point_worldSpace : volume_worldSpace.GetBoundingPoints())
+    {
+        const auto point_clipSpace = m_viewProjection * glm::vec4(point_worldSpace, 1.0f);
+
+        if (NearPlaneDistance(point_clipSpace) < 0.0f || point_clipSpace.w <= FLT_EPSILON) { return true; }
+
+        const auto point_screenSpace = ClipToScreenSpace(point_clipSpace);
+
+        minX = std::min(minX, point_screenSpace.x);
+        maxX = std::max(maxX, point_screenSpace.x);
+        minY = std::min(minY, point_screenSpace.y);
+        maxY = std::max(maxY, point_screenSpace.y);
+        minDepth = std::min(minDepth, point_screenSpace.z);
+    }
+
+    //
+    // Range of pixels the volume's screen bounds touch. Deliberately includes every pixel the bounds
+    // partially cover, rather than only the pixels whose centers they cover, to stay conservative.
+    //
+    const auto startX = (int64_t)std::max(std::floor(minX), 0.0f);
+    const auto endX = (int64_t)std::min(std::floor(maxX), (float)m_width - 1.0f);
+    const auto startY = (int64_t)std::max(std::floor(minY), 0.0f);
+    const auto endY = (int64_t)std::min(std::floor(maxY), (float)m_height - 1.0f);
+
+    // Volumes which are off screen aren't occluded by anything in the buffer; leave them to frustum culling
+    if (startX > endX || startY > endY) { return true; }
+
+    //
+    // The volume is visible if its nearest depth is in front of the occluders' depth at any pixel it covers
+    //
+    for (int64_t y = startY; y <= endY; ++y)
+    {
+        const float* pRow = m_depths.data() + (y * m_stride);
+
+        int64_t x = startX;
+
+    #ifdef ACCELA_OCCLUSION_SSE
+        const __m128 volumeDepth = _mm_set1_ps(minDepth);
+
+        for (; x + 3 <= endX; x += 4)
+        {
+            if (_mm_movemask_ps(_mm_cmple_ps(volumeDepth, _mm_loadu_ps(pRow + x))) != 0) { return true; }
+        }
+    #endif
+
+        for (; x <= endX; ++x)
+        {
+            if (minDepth <= pRow[x]) { return true; }
+        }
+    }
+
+    return false;
+}
+
+}
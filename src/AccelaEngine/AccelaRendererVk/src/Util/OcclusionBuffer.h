@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERERVK_SRC_UTIL_OCCLUSIONBUFFER_H
+#define LIBACCELARENDERERVK_SRC_UTIL_OCCLUSIONBUFFER_H
+
+#include "Volume.h"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Render
+{
+    /**
+     * Low resolution, CPU-side, depth buffer used for software occlusion culling.
+     *
+     * A small set of occluder meshes is rasterized into the buffer, after which object bounds can be tested
+     * against it; objects whose bounds are behind the occluders at every pixel they cover can't be seen. Depth
+     * is NDC depth (smaller is nearer), and rasterization and depth tests process four pixels at a time with SSE
+     * where available.
+     *
+     * Occluders are rasterized at pixel centers, so objects which would only be visible through sub-pixel gaps
+     * between occluders may be culled. Otherwise the tests are conservative; anything which can't be proven to be
+     * occluded is reported as visible.
+     *
+     * Has no GPU dependencies, so can be used (and benchmarked) headless.
+     */
+    class OcclusionBuffer
+    {
+        public:
+
+            /**
+             * @param width Width of the buffer, in pixels
+             * @param height Height of the buffer, in pixels
+             */
+            OcclusionBuffer(uint32_t width, uint32_t height);
+
+            /**
+             * Clears the buffer and sets the (world space to clip space) transform which subsequent occluders
+             * and tests are projected with.
+             */
+            void Reset(const glm::mat4& viewProjection);
+
+            /**
+             * Rasterizes an occluder mesh into the buffer.
+             *
+             * @param positions_modelSpace The occluder's model space vertex positions
+             * @param indices The occluder's triangle list indices
+             * @param modelTransform The occluder's model to world space transform
+             * @param cullBackFaces Whether the occluder's back facing triangles are skipped, as they are when the
+             * GPU renders an occluder which isn't two sided. Front faces are counter-clockwise, as on the GPU.
+             *
+             * @return The number of triangles that were rasterized
+             */
+            std::size_t RasterizeOccluder(std::span<const glm::vec3> positions_modelSpace,
+                                          std::span<const uint32_t> indices,
+                                          const glm::mat4& modelTransform,
+                                          bool cullBackFaces);
+
+            /**
+             * @return Whether any part of the (world space) volume is potentially visible past the buffer's occluders
+             */
+            [[nodiscard]] bool IsVisible(const Volume& volume_worldSpace) const;
+
+            [[nodiscard]] uint32_t GetWidth() const noexcept { return m_width; }
+            [[nodiscard]] uint32_t GetHeight() const noexcept { return m_height; }
+
+            /**
+             * @return The buffer's depth at the given pixel
+             */
+            [[nodiscard]] float GetDepth(uint32_t x, uint32_t y) const noexcept { return m_depths[(y * m_stride) + x]; }
+
+        private:
+
+            void RasterizeClippedTriangle(const glm::vec4& v0_clipSpace, const glm::vec4& v1_clipSpace, const glm::vec4& v2_clipSpace, bool cullBackFaces);
+            void RasterizeTriangle(const glm::vec3& v0_screenSpace, const glm::vec3& v1_screenSpace, const glm::vec3& v2_screenSpace, bool cullBackFaces);
+
+            [[nodiscard]] glm::vec3 ClipToScreenSpace(const glm::vec4& v_clipSpace) const noexcept;
+
+        private:
+
+            uint32_t m_width;
+            uint32_t m_height;
+            uint32_t m_stride; // Row stride, padded to a multiple of four pixels
+
+            glm::mat4 m_viewProjection{1.0f};
+
+            std::vector<float> m_depths;
+    };
+}
+
+#endif //LIBACCELARENDERERVK_SRC_UTIL_OCCLUSIONBUFFER_H
@@ -0,0 +1,264 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "PackedBounds.h"
+
+#include <array>
+#include <bit>
+#include <cfloat>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define ACCELA_CULL_SSE
+    #include <emmintrin.h>
+
+    // AVX2 code is compiled per-function and selected at runtime, so it doesn't need to be enabled for the build
+    #if defined(__GNUC__) || defined(__clang__)
+        #define ACCELA_CULL_AVX2
+        #include <immintrin.h>
+    #endif
+#endif
+
+namespace Accela::Render
+{
+
+// Slots are allocated in blocks of the widest SIMD width
+static constexpr std::size_t SLOT_BLOCK_SIZE = 8;
+
+static constexpr uint32_t INVALID_SLOT = UINT32_MAX;
+
+//
+// For each frustum plane, the bounds arrays which hold its positive vertex (the corner of a volume furthest
+// along the plane's normal). If the positive vertex is outside a plane, the whole volume is.
+//
+struct PlaneVertexArrays
+{
+    const float* pX;
+    const float* pY;
+    const float* pZ;
+};
+
+#ifdef ACCELA_CULL_AVX2
+static bool CPUSupportsAVX2()
+{
+    static const bool supportsAVX2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return supportsAVX2;
+}
+
+__attribute__((target("avx2,fma")))
+static void CullAVX2(const Frustum& frustum,
+                     const std::array<PlaneVertexArrays, 6>& planeVertexArrays,
+                     std::size_t numBlocks,
+                     const uint32_t* pKeys,
+                     std::size_t numKeys,
+                     std::vector<uint32_t>& keys)
+{
+    for (std::size_t block = 0; block < numBlocks; ++block)
+    {
+        const std::size_t slot = block * 8;
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+        for (std::size_t p = 0; p < 6; ++p)
+        {
+            const auto& plane = frustum.planes[p];
+            const auto& arrays = planeVertexArrays[p];
+
+            __m256 distance = _mm256_set1_ps(plane.w);
+            distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.x), _mm256_loadu_ps(arrays.pX + slot), distance);
+            distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.y), _mm256_loadu_ps(arrays.pY + slot), distance);
+            distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.z), _mm256_loadu_ps(arrays.pZ + slot), distance);
+
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+
+            if (_mm256_movemask_ps(inside) == 0) { break; }
+        }
+
+        auto insideMask = (uint32_t)_mm256_movemask_ps(inside);
+
+        while (insideMask != 0)
+        {
+            const auto lane = (std::size_t)std::countr_zero(insideMask);
+            if (slot + lane < numKeys) { keys.push_back(pKeys[slot + lane]); }
+            insideMask &= insideMask - 1;
+        }
+    }
+}
+#endif
+
+#ifdef ACCELA_CULL_SSE
+static void CullSSE(const Frustum& frustum,
+                    const std::array<PlaneVertexArrays, 6>& planeVertexArrays,
+                    std::size_t numBlocks,
+                    const uint32_t* pKeys,
+                    std::size_t numKeys,
+                    std::vector<uint32_t>& keys)
+{
+    for (std::size_t block = 0; block < numBlocks; ++block)
+    {
+        const std::size_t slot = block * 4;
+
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+        for (std::size_t p = 0; p < 6; ++p)
+        {
+            const auto& plane = frustum.planes[p];
+            const auto& arrays = planeVertexArrays[p];
+
+            __m128 distance = _mm_set1_ps(plane.w);
+            distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.x), _mm_loadu_ps(arrays.pX + slot)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.y), _mm_loadu_ps(arrays.pY + slot)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.z), _mm_loadu_ps(arrays.pZ + slot)));
+
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+
+            if (_mm_movemask_ps(inside) == 0) { break; }
+        }
+
+        auto insideMask = (uint32_t)_mm_movemask_ps(inside);
+
+        while (insideMask != 0)
+        {
+            const auto lane = (std::size_t)std::countr_zero(insideMask);
+            if (slot + lane < numKeys) { keys.push_back(pKeys[slot + lane]); }
+            insideMask &= insideMask - 1;
+        }
+    }
+}
+#endif
+
+void PackedBounds::Insert(uint32_t key, const Volume& volume)
+{
+    if (key >= m_keySlots.size())
+    {
+        m_keySlots.resize(key + 1, INVALID_SLOT);
+    }
+
+    auto slot = m_keySlots[key];
+
+    if (slot == INVALID_SLOT)
+    {
+        slot = (uint32_t)m_keys.size();
+        m_keys.push_back(key);
+        m_keySlots[key] = slot;
+
+        // Grow the bounds arrays by a block of empty volumes when they're full
+        if (m_minX.size() < m_keys.size())
+        {
+            const std::size_t newSize = m_minX.size() + SLOT_BLOCK_SIZE;
+
+            for (auto* pArray : {&m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ})
+            {
+                pArray->resize(newSize);
+            }
+
+            for (std::size_t x = slot; x < newSize; ++x)
+            {
+                ClearSlot(x);
+            }
+        }
+    }
+
+    SetSlot(slot, volume);
+}
+
+void PackedBounds::Remove(uint32_t key)
+{
+    if (key >= m_keySlots.size() || m_keySlots[key] == INVALID_SLOT) { return; }
+
+    const auto slot = m_keySlots[key];
+    const auto lastSlot = (uint32_t)(m_keys.size() - 1);
+
+    //
+    // Move the last volume into the removed volume's slot
+    //
+    if (slot != lastSlot)
+    {
+        const auto lastKey = m_keys[lastSlot];
+
+        m_minX[slot] = m_minX[lastSlot]; m_minY[slot] = m_minY[lastSlot]; m_minZ[slot] = m_minZ[lastSlot];
+        m_maxX[slot] = m_maxX[lastSlot]; m_maxY[slot] = m_maxY[lastSlot]; m_maxZ[slot] = m_maxZ[lastSlot];
+
+        m_keys[slot] = lastKey;
+        m_keySlots[lastKey] = slot;
+    }
+
+    ClearSlot(lastSlot);
+    m_keys.pop_back();
+    m_keySlots[key] = INVALID_SLOT;
+}
+
+void PackedBounds::SetSlot(std::size_t slot, const Volume& volume)
+{
+    m_minX[slot] = volume.min.x; m_minY[slot] = volume.min.y; m_minZ[slot] = volume.min.z;
+    m_maxX[slot] = volume.max.x; m_maxY[slot] = volume.max.y; m_maxZ[slot] = volume.max.z;
+}
+
+void PackedBounds::ClearSlot(std::size_t slot)
+{
+    // An inverted, maximally sized, volume; its positive vertex is outside of every plane
+    m_minX[slot] = FLT_MAX; m_minY[slot] = FLT_MAX; m_minZ[slot] = FLT_MAX;
+    m_maxX[slot] = -FLT_MAX; m_maxY[slot] = -FLT_MAX; m_maxZ[slot] = -FLT_MAX;
+}
+
+void PackedBounds::Cull(const Frustum& frustum, std::vector<uint32_t>& keys) const
+{
+    if (m_keys.empty()) { return; }
+
+    std::array<PlaneVertexArrays, 6> planeVertexArrays{};
+
+    for (std::size_t p = 0; p < 6; ++p)
+    {
+        const auto& plane = frustum.planes[p];
+
+        planeVertexArrays[p] = PlaneVertexArrays{
+            .pX = plane.x >= 0.0f ? m_maxX.data() : m_minX.data(),
+            .pY = plane.y >= 0.0f ? m_maxY.data() : m_minY.data(),
+            .pZ = plane.z >= 0.0f ? m_maxZ.data() : m_minZ.data()
+        };
+    }
+
+    // Slots are only ever handed out up to the end of the last used block
+    const std::size_t numSlots = ((m_keys.size() + SLOT_BLOCK_SIZE - 1) / SLOT_BLOCK_SIZE) * SLOT_BLOCK_SIZE;
+
+#ifdef ACCELA_CULL_AVX2
+    if (CPUSupportsAVX2())
+    {
+        CullAVX2(frustum, planeVertexArrays, numSlots / 8, m_keys.data(), m_keys.size(), keys);
+        return;
+    }
+#endif
+
+#ifdef ACCELA_CULL_SSE
+    CullSSE(frustum, planeVertexArrays, numSlots / 4, m_keys.data(), m_keys.size(), keys);
+#else
+    CullScalar(frustum, keys);
+#endif
+}
+
+void PackedBounds::CullScalar(const Frustum& frustum, std::vector<uint32_t>& keys) const
+{
+    for (std::size_t slot = 0; slot < m_keys.size(); ++slot)
+    {
+        bool inside = true;
+
+        for (const auto& plane : frustum.planes)
+        {
+            const float x = plane.x >= 0.0f ? m_maxX[slot] : m_minX[slot];
+            const float y = plane.y >= 0.0f ? m_maxY[slot] : m_minY[slot];
+            const float z = plane.z >= 0.0f ? m_maxZ[slot] : m_minZ[slot];
+
+            if ((plane.x * x) + (plane.y * y) + (plane.z * z) + plane.w < 0.0f)
+            {
+                inside = false;
+                break;
+            }
+        }
+
+        if (inside) { keys.push_back(m_keys[slot]); }
+    }
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERERVK_SRC_UTIL_PACKEDBOUNDS_H
+#define LIBACCELARENDERERVK_SRC_UTIL_PACKEDBOUNDS_H
+
+#include "Volume.h"
+#include "Frustum.h"
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Render
+{
+    /**
+     * A set of keyed, axis-aligned, bounding volumes, stored as a structure of arrays so that they can be
+     * frustum culled many at a time with SIMD.
+     *
+     * Culling tests every stored volume, with AVX2 (eight volumes at a time) when the CPU supports it, SSE
+     * (four at a time) otherwise, or a scalar fallback on non-x86 platforms. Volumes are kept densely packed;
+     * removing a volume moves the last volume into its place.
+     *
+     * Keys are expected to be small, dense, integers, such as renderable ids.
+     */
+    class PackedBounds
+    {
+        public:
+
+            /**
+             * Adds a volume for the key, or replaces the key's existing volume
+             */
+            void Insert(uint32_t key, const Volume& volume);
+
+            /**
+             * Removes the key's volume, if it has one
+             */
+            void Remove(uint32_t key);
+
+            /**
+             * @return The number of volumes stored
+             */
+            [[nodiscard]] std::size_t GetSize() const noexcept { return m_keys.size(); }
+
+            /**
+             * Appends to keys the key of every stored volume which is at least partially within the frustum.
+             *
+             * Conservative; volumes which are outside the frustum, but not outside any single plane of it (such
+             * as volumes just beyond a frustum's corner), are reported as within it.
+             */
+            void Cull(const Frustum& frustum, std::vector<uint32_t>& keys) const;
+
+        private:
+
+            void SetSlot(std::size_t slot, const Volume& volume);
+            void ClearSlot(std::size_t slot);
+
+            void CullScalar(const Frustum& frustum, std::vector<uint32_t>& keys) const;
+
+        private:
+
+            // Volume bounds per slot. Padded with empty volumes to a multiple of the SIMD width, so that
+            // the culling loops never need to handle partial blocks of volumes.
+            std::vector<float> m_minX, m_minY, m_minZ;
+            std::vector<float> m_maxX, m_maxY, m_maxZ;
+
+            std::vector<uint32_t> m_keys;       // The key of the volume in each (used) slot
+            std::vector<uint32_t> m_keySlots;   // The slot of each key's volume, indexed by key
+    };
+}
+
+#endif //LIBACCELARENDERERVK_SRC_UTIL_PACKEDBOUNDS_H
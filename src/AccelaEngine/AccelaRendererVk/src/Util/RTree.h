@@ -112,6 +112,10 @@ class RTree
         std::vector<DATATYPE> FetchMatching(const Volume& volume) const;
         std::vector<DATATYPE> FetchMatching(const ELEMTYPE a_min[NUMDIMS], const ELEMTYPE a_max[NUMDIMS]) const;
 
+        /// Find all entries whose bounds pass a test. Subtrees whose bounds fail the test are skipped, so the
+        /// test must pass for any volume which contains a volume that passes it (e.g. a ray intersection test).
+        std::vector<DATATYPE> FetchMatching(const std::function<bool(const Volume&)>& volumeTest) const;
+
         /// Remove all entries from tree
         void RemoveAll();
 
@@ -758,6 +762,52 @@ std::vector<DATATYPE> RTREE_QUAL::FetchMatching(const ELEMTYPE a_min[NUMDIMS], c
     return found;
 }
 
+RTREE_TEMPLATE
+std::vector<DATATYPE> RTREE_QUAL::FetchMatching(const std::function<bool(const Volume&)>& volumeTest) const
+{
+    static_assert(NUMDIMS == 3, "Volume tests require a 3D tree");
+
+    const auto rectToVolume = [](const Rect& rect){
+        return Volume(
+            {rect.m_min[0], rect.m_min[1], rect.m_min[2]},
+            {rect.m_max[0], rect.m_max[1], rect.m_max[2]}
+        );
+    };
+
+    std::vector<DATATYPE> found;
+
+    std::queue<Node*> toProcess;
+    toProcess.push(m_root);
+
+    while (!toProcess.empty())
+    {
+        Node* a_node = toProcess.front();
+        toProcess.pop();
+
+        assert(a_node);
+        assert(a_node->m_level >= 0);
+
+        for (int index = 0; index < a_node->m_count; ++index)
+        {
+            if (!volumeTest(rectToVolume(a_node->m_branch[index].m_rect)))
+            {
+                continue;
+            }
+
+            if (a_node->IsInternalNode())
+            {
+                toProcess.push(a_node->m_branch[index].m_child);
+            }
+            else
+            {
+                found.push_back(a_node->m_branch[index].m_data);
+            }
+        }
+    }
+
+    return found;
+}
+
 // Search in an index tree or subtree for all data retangles that overlap the argument rectangle.
 RTREE_TEMPLATE
 void
@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERERVK_SRC_UTIL_RADIXSORT_H
+#define LIBACCELARENDERERVK_SRC_UTIL_RADIXSORT_H
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Render
+{
+    /**
+     * Stable LSD radix sort of items by a 64 bit key, one byte per pass.
+     *
+     * Histograms for all eight bytes are built in a single pass over the input, and passes for
+     * bytes which hold the same value in every key are skipped entirely, so keys with unused
+     * high bits (or fields which don't vary) don't cost anything to sort by.
+     *
+     * @param items The items to be sorted
+     * @param keyFunc Returns the uint64_t key of an item
+     */
+    template <typename T, typename KeyFunc>
+    void RadixSort64(std::vector<T>& items, const KeyFunc& keyFunc)
+    {
+        // Not worth the histogram passes for small inputs
+        if (items.size() <= 64)
+        {
+            std::ranges::stable_sort(items, [&](const T& a, const T& b){ return keyFunc(a) < keyFunc(b); });
+            return;
+        }
+
+        std::array<std::array<std::size_t, 256>, 8> histograms{};
+
+        for (const auto& item : items)
+        {
+            const uint64_t key = keyFunc(item);
+
+            for (unsigned int byte = 0; byte < 8; ++byte)
+            {
+                histograms[byte][(key >> (byte * 8)) & 0xFF]++;
+            }
+        }
+
+        std::vector<T> scratch(items.size());
+
+        auto* pSrc = &items;
+        auto* pDst = &scratch;
+
+        for (unsigned int byte = 0; byte < 8; ++byte)
+        {
+            auto& histogram = histograms[byte];
+
+            // If every key has the same value for this byte, the pass wouldn't change the order
+            const auto firstKeyByte = (keyFunc((*pSrc)[0]) >> (byte * 8)) & 0xFF;
+            if (histogram[firstKeyByte] == items.size()) { continue; }
+
+            // Convert counts to starting offsets
+            std::size_t offset = 0;
+            for (auto& count : histogram)
+            {
+                const auto bucketCount = count;
+                count = offset;
+                offset += bucketCount;
+            }
+
+            for (const auto& item : *pSrc)
+            {
+                (*pDst)[histogram[(keyFunc(item) >> (byte * 8)) & 0xFF]++] = item;
+            }
+
+            std::swap(pSrc, pDst);
+        }
+
+        if (pSrc != &items)
+        {
+            items.swap(scratch);
+        }
+    }
+}
+
+#endif //LIBACCELARENDERERVK_SRC_UTIL_RADIXSORT_H
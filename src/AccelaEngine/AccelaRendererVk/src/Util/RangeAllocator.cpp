@@ -0,0 +1,448 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "RangeAllocator.h"
+
+#include <bit>
+#include <algorithm>
+#include <cassert>
+
+namespace Accela::Render
+{
+
+RangeAllocator::RangeAllocator(std::size_t capacity)
+{
+    m_freeHeads.fill(INVALID_BLOCK);
+
+    Grow(capacity);
+}
+
+std::optional<std::size_t> RangeAllocator::Allocate(std::size_t size, uint64_t userData)
+{
+    if (size == 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto blockIndex = FindFreeBlock(size);
+    if (blockIndex == INVALID_BLOCK)
+    {
+        return std::nullopt;
+    }
+
+    return AllocateFromBlock(blockIndex, size, userData);
+}
+
+bool RangeAllocator::Free(std::size_t offset)
+{
+    const auto it = m_allocations.find(offset);
+    if (it == m_allocations.cend())
+    {
+        return false;
+    }
+
+    auto blockIndex = it->second;
+    m_allocations.erase(it);
+
+    m_blocks[blockIndex].isFree = true;
+    m_blocks[blockIndex].userData = 0;
+    m_usedSize -= m_blocks[blockIndex].size;
+
+    //
+    // Coalesce with free neighbours
+    //
+    const auto prevBlockIndex = m_blocks[blockIndex].prevPhysical;
+    if (prevBlockIndex != INVALID_BLOCK && m_blocks[prevBlockIndex].isFree)
+    {
+        RemoveFreeBlock(prevBlockIndex);
+        blockIndex = MergeWithNext(prevBlockIndex);
+    }
+
+    const auto nextBlockIndex = m_blocks[blockIndex].nextPhysical;
+    if (nextBlockIndex != INVALID_BLOCK && m_blocks[nextBlockIndex].isFree)
+    {
+        RemoveFreeBlock(nextBlockIndex);
+        blockIndex = MergeWithNext(blockIndex);
+    }
+
+    InsertFreeBlock(blockIndex);
+
+    return true;
+}
+
+void RangeAllocator::Grow(std::size_t capacity)
+{
+    if (capacity <= m_capacity)
+    {
+        return;
+    }
+
+    const auto growSize = capacity - m_capacity;
+
+    // If the space ends with free space, extend it
+    if (m_lastBlock != INVALID_BLOCK && m_blocks[m_lastBlock].isFree)
+    {
+        RemoveFreeBlock(m_lastBlock);
+        m_blocks[m_lastBlock].size += growSize;
+        InsertFreeBlock(m_lastBlock);
+    }
+    // Otherwise, append a new free block
+    else
+    {
+        const auto blockIndex = CreateBlock();
+
+        auto& block = m_blocks[blockIndex];
+        block.offset = m_capacity;
+        block.size = growSize;
+        block.isFree = true;
+        block.prevPhysical = m_lastBlock;
+
+        if (m_lastBlock != INVALID_BLOCK)
+        {
+            m_blocks[m_lastBlock].nextPhysical = blockIndex;
+        }
+
+        m_lastBlock = blockIndex;
+
+        InsertFreeBlock(blockIndex);
+    }
+
+    m_capacity = capacity;
+}
+
+std::size_t RangeAllocator::Trim()
+{
+    if (m_lastBlock == INVALID_BLOCK || !m_blocks[m_lastBlock].isFree)
+    {
+        return m_capacity;
+    }
+
+    const auto trimBlockIndex = m_lastBlock;
+
+    RemoveFreeBlock(trimBlockIndex);
+
+    m_capacity = m_blocks[trimBlockIndex].offset;
+    m_lastBlock = m_blocks[trimBlockIndex].prevPhysical;
+
+    if (m_lastBlock != INVALID_BLOCK)
+    {
+        m_blocks[m_lastBlock].nextPhysical = INVALID_BLOCK;
+    }
+
+    ReleaseBlock(trimBlockIndex);
+
+    return m_capacity;
+}
+
+std::optional<RangeAllocator::Relocation> RangeAllocator::PlanRelocation()
+{
+    if (m_lastBlock == INVALID_BLOCK)
+    {
+        return std::nullopt;
+    }
+
+    //
+    // Find the last allocated block. As free blocks are always coalesced, it's either the last block
+    // or the one immediately before it.
+    //
+    auto candidateIndex = m_lastBlock;
+    auto trailingFreeIndex = INVALID_BLOCK;
+
+    if (m_blocks[candidateIndex].isFree)
+    {
+        trailingFreeIndex = candidateIndex;
+        candidateIndex = m_blocks[candidateIndex].prevPhysical;
+    }
+
+    if (candidateIndex == INVALID_BLOCK)
+    {
+        return std::nullopt;
+    }
+
+    Relocation relocation{};
+    relocation.userData = m_blocks[candidateIndex].userData;
+    relocation.fromOffset = m_blocks[candidateIndex].offset;
+    relocation.size = m_blocks[candidateIndex].size;
+
+    //
+    // Find a free block to move it into. The trailing free block is hidden from the search, which
+    // leaves only free blocks that come before the candidate.
+    //
+    if (trailingFreeIndex != INVALID_BLOCK) { RemoveFreeBlock(trailingFreeIndex); }
+    const auto targetIndex = FindFreeBlock(relocation.size);
+    if (trailingFreeIndex != INVALID_BLOCK) { InsertFreeBlock(trailingFreeIndex); }
+
+    if (targetIndex == INVALID_BLOCK)
+    {
+        return std::nullopt;
+    }
+
+    relocation.toOffset = AllocateFromBlock(targetIndex, relocation.size, relocation.userData);
+
+    assert(relocation.toOffset < relocation.fromOffset);
+
+    return relocation;
+}
+
+std::size_t RangeAllocator::GetHighWaterMark() const noexcept
+{
+    if (m_lastBlock == INVALID_BLOCK)
+    {
+        return 0;
+    }
+
+    if (m_blocks[m_lastBlock].isFree)
+    {
+        return m_blocks[m_lastBlock].offset;
+    }
+
+    return m_capacity;
+}
+
+RangeAllocator::Stats RangeAllocator::GetStats() const
+{
+    Stats stats{};
+    stats.capacity = m_capacity;
+    stats.usedSize = m_usedSize;
+    stats.freeSize = m_capacity - m_usedSize;
+    stats.highWaterMark = GetHighWaterMark();
+    stats.numAllocations = m_allocations.size();
+    stats.numFreeRanges = m_numFreeBlocks;
+
+    // The largest free block lives in the highest non-empty free list
+    if (m_flBitmap != 0)
+    {
+        const auto fl = static_cast<unsigned int>(63 - std::countl_zero(m_flBitmap));
+        const auto sl = static_cast<unsigned int>(31 - std::countl_zero(m_slBitmaps[fl]));
+
+        for (auto blockIndex = m_freeHeads[(fl * SL_COUNT) + sl]; blockIndex != INVALID_BLOCK; blockIndex = m_blocks[blockIndex].nextFree)
+        {
+            stats.largestFreeSize = std::max(stats.largestFreeSize, m_blocks[blockIndex].size);
+        }
+    }
+
+    if (stats.freeSize > 0)
+    {
+        stats.fragmentation = 1.0f - (static_cast<float>(stats.largestFreeSize) / static_cast<float>(stats.freeSize));
+    }
+
+    return stats;
+}
+
+RangeAllocator::Mapping RangeAllocator::GetMapping(std::size_t size)
+{
+    if (size < SL_COUNT)
+    {
+        return {.fl = 0, .sl = static_cast<unsigned int>(size)};
+    }
+
+    const auto log2 = static_cast<unsigned int>(std::bit_width(size) - 1);
+
+    return {
+        .fl = log2 - SL_BITS + 1,
+        .sl = static_cast<unsigned int>(size >> (log2 - SL_BITS)) - SL_COUNT
+    };
+}
+
+uint32_t RangeAllocator::FindFreeBlock(std::size_t size) const
+{
+    //
+    // Round the size up to the next list boundary, so that any block in the found list is guaranteed
+    // to be large enough
+    //
+    auto searchSize = size;
+
+    if (size >= SL_COUNT)
+    {
+        const auto log2 = static_cast<unsigned int>(std::bit_width(size) - 1);
+        searchSize += (std::size_t{1} << (log2 - SL_BITS)) - 1;
+    }
+
+    const auto mapping = GetMapping(searchSize);
+
+    unsigned int fl = mapping.fl;
+    uint32_t slBitmap = m_slBitmaps[fl] & (~0U << mapping.sl);
+
+    if (slBitmap == 0)
+    {
+        const uint64_t flBitmap = (fl + 1 < FL_COUNT) ? (m_flBitmap & (~uint64_t{0} << (fl + 1))) : 0;
+
+        if (flBitmap != 0)
+        {
+            fl = static_cast<unsigned int>(std::countr_zero(flBitmap));
+            slBitmap = m_slBitmaps[fl];
+        }
+    }
+
+    if (slBitmap != 0)
+    {
+        return m_freeHeads[(fl * SL_COUNT) + static_cast<unsigned int>(std::countr_zero(slBitmap))];
+    }
+
+    //
+    // Nothing in the larger lists; fall back to searching the size's own list, which can contain
+    // blocks which are large enough
+    //
+    const auto exactMapping = GetMapping(size);
+
+    for (auto blockIndex = m_freeHeads[(exactMapping.fl * SL_COUNT) + exactMapping.sl];
+         blockIndex != INVALID_BLOCK;
+         blockIndex = m_blocks[blockIndex].nextFree)
+    {
+        if (m_blocks[blockIndex].size >= size)
+        {
+            return blockIndex;
+        }
+    }
+
+    return INVALID_BLOCK;
+}
+
+void RangeAllocator::InsertFreeBlock(uint32_t blockIndex)
+{
+    const auto mapping = GetMapping(m_blocks[blockIndex].size);
+    const auto listIndex = (mapping.fl * SL_COUNT) + mapping.sl;
+
+    auto& block = m_blocks[blockIndex];
+    block.prevFree = INVALID_BLOCK;
+    block.nextFree = m_freeHeads[listIndex];
+
+    if (block.nextFree != INVALID_BLOCK)
+    {
+        m_blocks[block.nextFree].prevFree = blockIndex;
+    }
+
+    m_freeHeads[listIndex] = blockIndex;
+
+    m_flBitmap |= (uint64_t{1} << mapping.fl);
+    m_slBitmaps[mapping.fl] |= (1U << mapping.sl);
+
+    m_numFreeBlocks++;
+}
+
+void RangeAllocator::RemoveFreeBlock(uint32_t blockIndex)
+{
+    const auto mapping = GetMapping(m_blocks[blockIndex].size);
+    const auto listIndex = (mapping.fl * SL_COUNT) + mapping.sl;
+
+    auto& block = m_blocks[blockIndex];
+
+    if (block.prevFree != INVALID_BLOCK) { m_blocks[block.prevFree].nextFree = block.nextFree; }
+    if (block.nextFree != INVALID_BLOCK) { m_blocks[block.nextFree].prevFree = block.prevFree; }
+
+    if (m_freeHeads[listIndex] == blockIndex)
+    {
+        m_freeHeads[listIndex] = block.nextFree;
+
+        if (m_freeHeads[listIndex] == INVALID_BLOCK)
+        {
+            m_slBitmaps[mapping.fl] &= ~(1U << mapping.sl);
+
+            if (m_slBitmaps[mapping.fl] == 0)
+            {
+                m_flBitmap &= ~(uint64_t{1} << mapping.fl);
+            }
+        }
+    }
+
+    block.prevFree = INVALID_BLOCK;
+    block.nextFree = INVALID_BLOCK;
+
+    m_numFreeBlocks--;
+}
+
+uint32_t RangeAllocator::CreateBlock()
+{
+    if (!m_unusedBlocks.empty())
+    {
+        const auto blockIndex = m_unusedBlocks.back();
+        m_unusedBlocks.pop_back();
+
+        m_blocks[blockIndex] = Block{};
+        return blockIndex;
+    }
+
+    m_blocks.emplace_back();
+    return static_cast<uint32_t>(m_blocks.size() - 1);
+}
+
+void RangeAllocator::ReleaseBlock(uint32_t blockIndex)
+{
+    m_unusedBlocks.push_back(blockIndex);
+}
+
+std::size_t RangeAllocator::AllocateFromBlock(uint32_t blockIndex, std::size_t size, uint64_t userData)
+{
+    RemoveFreeBlock(blockIndex);
+
+    //
+    // Split off any excess into a new free block which follows the allocated one
+    //
+    if (m_blocks[blockIndex].size > size)
+    {
+        // Note: May invalidate references into m_blocks
+        const auto remainderIndex = CreateBlock();
+
+        auto& block = m_blocks[blockIndex];
+        auto& remainder = m_blocks[remainderIndex];
+
+        remainder.offset = block.offset + size;
+        remainder.size = block.size - size;
+        remainder.isFree = true;
+        remainder.prevPhysical = blockIndex;
+        remainder.nextPhysical = block.nextPhysical;
+
+        if (remainder.nextPhysical != INVALID_BLOCK)
+        {
+            m_blocks[remainder.nextPhysical].prevPhysical = remainderIndex;
+        }
+        else
+        {
+            m_lastBlock = remainderIndex;
+        }
+
+        block.nextPhysical = remainderIndex;
+        block.size = size;
+
+        InsertFreeBlock(remainderIndex);
+    }
+
+    auto& block = m_blocks[blockIndex];
+    block.isFree = false;
+    block.userData = userData;
+
+    m_allocations.insert({block.offset, blockIndex});
+    m_usedSize += size;
+
+    return block.offset;
+}
+
+uint32_t RangeAllocator::MergeWithNext(uint32_t blockIndex)
+{
+    const auto nextBlockIndex = m_blocks[blockIndex].nextPhysical;
+
+    auto& block = m_blocks[blockIndex];
+    const auto& nextBlock = m_blocks[nextBlockIndex];
+
+    block.size += nextBlock.size;
+    block.nextPhysical = nextBlock.nextPhysical;
+
+    if (block.nextPhysical != INVALID_BLOCK)
+    {
+        m_blocks[block.nextPhysical].prevPhysical = blockIndex;
+    }
+
+    if (m_lastBlock == nextBlockIndex)
+    {
+        m_lastBlock = blockIndex;
+    }
+
+    ReleaseBlock(nextBlockIndex);
+
+    return blockIndex;
+}
+
+}
@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef LIBACCELARENDERERVK_SRC_UTIL_RANGEALLOCATOR_H
+#define LIBACCELARENDERERVK_SRC_UTIL_RANGEALLOCATOR_H
+
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+namespace Accela::Render
+{
+    /**
+     * TLSF (two-level segregated fit) allocator of ranges within a linear address space.
+     *
+     * Manages offsets only; it has no knowledge of what backs the space, so callers map offsets onto
+     * whatever storage they own (e.g. elements of a GPU buffer). Allocation and freeing are O(1), and
+     * freed ranges are coalesced with neighbouring free ranges.
+     *
+     * The space can be grown when an allocation doesn't fit, and trailing free space can be trimmed
+     * off. PlanRelocation supports incrementally compacting the space towards its start, so that
+     * trailing space can be reclaimed.
+     *
+     * Not thread safe.
+     */
+    class RangeAllocator
+    {
+        public:
+
+            static constexpr uint32_t INVALID_BLOCK = UINT32_MAX;
+
+            /**
+             * A proposed move of an allocation to a lower offset. The destination range has already been
+             * allocated; once the range's data has been moved the caller must Free(fromOffset).
+             */
+            struct Relocation
+            {
+                uint64_t userData{0};
+                std::size_t fromOffset{0};
+                std::size_t toOffset{0};
+                std::size_t size{0};
+            };
+
+            struct Stats
+            {
+                std::size_t capacity{0};            // Total size of the space
+                std::size_t usedSize{0};            // Total size of allocated ranges
+                std::size_t freeSize{0};            // Total size of free ranges
+                std::size_t largestFreeSize{0};     // Size of the largest free range
+                std::size_t highWaterMark{0};       // End of the last allocated range
+                std::size_t numAllocations{0};      // Number of allocated ranges
+                std::size_t numFreeRanges{0};       // Number of free ranges
+
+                // 0.0 when all free space is one contiguous range, approaching 1.0 as free space is split
+                // into many small ranges
+                float fragmentation{0.0f};
+            };
+
+        public:
+
+            explicit RangeAllocator(std::size_t capacity = 0);
+
+            /**
+             * Allocates a range of the given size.
+             *
+             * @param size The size of the range. Must be non-zero.
+             * @param userData Arbitrary data to associate with the range, reported back in Relocations
+             *
+             * @return The offset of the allocated range, or std::nullopt if no free range is large enough
+             */
+            [[nodiscard]] std::optional<std::size_t> Allocate(std::size_t size, uint64_t userData = 0);
+
+            /**
+             * Frees the range which was allocated at the given offset.
+             *
+             * @return False if no range is allocated at the offset
+             */
+            bool Free(std::size_t offset);
+
+            /**
+             * Grows the space to the given capacity. No-op if the space is already at least that large.
+             */
+            void Grow(std::size_t capacity);
+
+            /**
+             * Releases free space at the end of the space.
+             *
+             * @return The space's new capacity
+             */
+            std::size_t Trim();
+
+            /**
+             * Attempts to move the last allocated range into a free range which is located before it. If
+             * successful, the destination range is allocated and the relocation is returned.
+             */
+            [[nodiscard]] std::optional<Relocation> PlanRelocation();
+
+            [[nodiscard]] std::size_t GetCapacity() const noexcept { return m_capacity; }
+            [[nodiscard]] std::size_t GetUsedSize() const noexcept { return m_usedSize; }
+            [[nodiscard]] std::size_t GetHighWaterMark() const noexcept;
+            [[nodiscard]] Stats GetStats() const;
+
+        private:
+
+            static constexpr unsigned int SL_BITS = 4;
+            static constexpr unsigned int SL_COUNT = 1U << SL_BITS;
+            static constexpr unsigned int FL_COUNT = 64;
+
+            struct Block
+            {
+                std::size_t offset{0};
+                std::size_t size{0};
+                uint64_t userData{0};
+                bool isFree{false};
+
+                // Neighbouring blocks within the space
+                uint32_t prevPhysical{INVALID_BLOCK};
+                uint32_t nextPhysical{INVALID_BLOCK};
+
+                // Neighbouring blocks within the block's free list (when free)
+                uint32_t prevFree{INVALID_BLOCK};
+                uint32_t nextFree{INVALID_BLOCK};
+            };
+
+            struct Mapping
+            {
+                unsigned int fl{0};
+                unsigned int sl{0};
+            };
+
+        private:
+
+            [[nodiscard]] static Mapping GetMapping(std::size_t size);
+            [[nodiscard]] uint32_t FindFreeBlock(std::size_t size) const;
+
+            void InsertFreeBlock(uint32_t blockIndex);
+            void RemoveFreeBlock(uint32_t blockIndex);
+
+            [[nodiscard]] uint32_t CreateBlock();
+            void ReleaseBlock(uint32_t blockIndex);
+
+            [[nodiscard]] std::size_t AllocateFromBlock(uint32_t blockIndex, std::size_t size, uint64_t userData);
+            uint32_t MergeWithNext(uint32_t blockIndex);
+
+        private:
+
+            std::size_t m_capacity{0};
+            std::size_t m_usedSize{0};
+            std::size_t m_numFreeBlocks{0};
+
+            std::vector<Block> m_blocks;
+            std::vector<uint32_t> m_unusedBlocks;
+
+            // The block which ends at the end of the space
+            uint32_t m_lastBlock{INVALID_BLOCK};
+
+            // Free list heads, indexed by [fl * SL_COUNT + sl], and bitmaps of which lists are non-empty
+            uint64_t m_flBitmap{0};
+            std::array<uint32_t, FL_COUNT> m_slBitmaps{};
+            std::array<uint32_t, FL_COUNT * SL_COUNT> m_freeHeads{};
+
+            // Offset -> block index of allocated ranges
+            std::unordered_map<std::size_t, uint32_t> m_allocations;
+    };
+}
+
+#endif //LIBACCELARENDERERVK_SRC_UTIL_RANGEALLOCATOR_H
@@ -45,6 +45,7 @@ namespace Accela::Render
 
             virtual VkResult MapMemory(VmaAllocation allocation, void** ppData) const = 0;
             virtual void UnmapMemory(VmaAllocation allocation) const = 0;
+            virtual VkResult InvalidateAllocation(VmaAllocation allocation, VkDeviceSize offset, VkDeviceSize size) const = 0;
     };
 }
 
@@ -80,4 +80,9 @@ void VMA::UnmapMemory(VmaAllocation allocation) const
     vmaUnmapMemory(m_vma, allocation);
 }
 
+VkResult VMA::InvalidateAllocation(VmaAllocation allocation, VkDeviceSize offset, VkDeviceSize size) const
+{
+    return vmaInvalidateAllocation(m_vma, allocation, offset, size);
+}
+
 }
@@ -49,6 +49,7 @@ namespace Accela::Render
 
             VkResult MapMemory(VmaAllocation allocation, void** ppData) const override;
             void UnmapMemory(VmaAllocation allocation) const override;
+            VkResult InvalidateAllocation(VmaAllocation allocation, VkDeviceSize offset, VkDeviceSize size) const override;
 
         private:
 
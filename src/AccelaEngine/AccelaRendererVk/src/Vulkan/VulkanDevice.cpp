@@ -77,6 +77,12 @@ bool VulkanDevice::Create(const VulkanPhysicalDevicePtr& physicalDevice,
         deviceFeatures.features.fillModeNonSolid = VK_TRUE;
     }
 
+    if (physicalDevice->GetPhysicalDeviceFeatures().textureCompressionBC)
+    {
+        m_logger->Log(Common::LogLevel::Info, "VulkanDevice::Create: Enabling textureCompressionBC feature");
+        deviceFeatures.features.textureCompressionBC = VK_TRUE;
+    }
+
     // Required device extensions
     std::set<std::string> extensions;
     if (!m_vulkanContext->GetRequiredDeviceExtensions(physicalDevice->GetVkPhysicalDevice(), extensions))
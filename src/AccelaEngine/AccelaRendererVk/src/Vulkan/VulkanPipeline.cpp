@@ -15,11 +15,16 @@
 namespace Accela::Render
 {
 
-VulkanPipeline::VulkanPipeline(Common::ILogger::Ptr logger, IVulkanCallsPtr vk, IShadersPtr shaders, VulkanDevicePtr device)
+VulkanPipeline::VulkanPipeline(Common::ILogger::Ptr logger,
+                               IVulkanCallsPtr vk,
+                               IShadersPtr shaders,
+                               VulkanDevicePtr device,
+                               VkPipelineCache vkPipelineCache)
     : m_logger(std::move(logger))
     , m_vk(std::move(vk))
     , m_shaders(std::move(shaders))
     , m_device(std::move(device))
+    , m_vkPipelineCache(vkPipelineCache)
 {
 
 }
@@ -368,7 +373,7 @@ bool VulkanPipeline::Create(const GraphicsPipelineConfig& config)
         pipelineInfo.pTessellationState = &tessellationStateCreateInfo;
     }
 
-    result = m_vk->vkCreateGraphicsPipelines(m_device->GetVkDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_vkPipeline);
+    result = m_vk->vkCreateGraphicsPipelines(m_device->GetVkDevice(), m_vkPipelineCache, 1, &pipelineInfo, nullptr, &m_vkPipeline);
     if (result != VK_SUCCESS)
     {
         m_logger->Log(Common::LogLevel::Error,
@@ -457,7 +462,7 @@ bool VulkanPipeline::Create(const ComputePipelineConfig& config)
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE; // Optional
     pipelineInfo.basePipelineIndex = -1; // Optional
 
-    result = m_vk->vkCreateComputePipelines(m_device->GetVkDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_vkPipeline);
+    result = m_vk->vkCreateComputePipelines(m_device->GetVkDevice(), m_vkPipelineCache, 1, &pipelineInfo, nullptr, &m_vkPipeline);
     if (result != VK_SUCCESS)
     {
         m_logger->Log(Common::LogLevel::Error,
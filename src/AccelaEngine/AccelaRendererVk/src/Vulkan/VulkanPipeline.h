@@ -24,7 +24,14 @@ namespace Accela::Render
     {
         public:
 
-            VulkanPipeline(Common::ILogger::Ptr logger, IVulkanCallsPtr vk, IShadersPtr shaders, VulkanDevicePtr device);
+            /**
+             * @param vkPipelineCache Pipeline cache to create the pipeline through, or VK_NULL_HANDLE for none
+             */
+            VulkanPipeline(Common::ILogger::Ptr logger,
+                           IVulkanCallsPtr vk,
+                           IShadersPtr shaders,
+                           VulkanDevicePtr device,
+                           VkPipelineCache vkPipelineCache);
 
             /**
              * Create this vulkan pipeline as a graphics pipeline
@@ -77,6 +84,7 @@ namespace Accela::Render
             IVulkanCallsPtr m_vk;
             IShadersPtr m_shaders;
             VulkanDevicePtr m_device;
+            VkPipelineCache m_vkPipelineCache;
 
             PipelineType m_type{PipelineType::Graphics};
             std::size_t m_uniqueKey{0};
@@ -83,6 +83,9 @@ bool VulkanCalls::InitDeviceCalls(VkDevice vkDevice)
     FIND_DEVICE_CALL(vkCreateGraphicsPipelines)
     FIND_DEVICE_CALL(vkCreateComputePipelines)
     FIND_DEVICE_CALL(vkDestroyPipeline)
+    FIND_DEVICE_CALL(vkCreatePipelineCache)
+    FIND_DEVICE_CALL(vkDestroyPipelineCache)
+    FIND_DEVICE_CALL(vkGetPipelineCacheData)
     FIND_DEVICE_CALL(vkCreateFramebuffer)
     FIND_DEVICE_CALL(vkDestroyFramebuffer)
     FIND_DEVICE_CALL(vkCreateCommandPool)
@@ -462,6 +465,22 @@ void VulkanCalls::vkDestroyPipeline(VkDevice device, VkPipeline pipeline, const
     return m_vkDestroyPipeline(device, pipeline, pAllocator);
 }
 
+VkResult VulkanCalls::vkCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo *pCreateInfo,
+                                            const VkAllocationCallbacks *pAllocator, VkPipelineCache *pPipelineCache) const
+{
+    return m_vkCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+
+void VulkanCalls::vkDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks *pAllocator) const
+{
+    return m_vkDestroyPipelineCache(device, pipelineCache, pAllocator);
+}
+
+VkResult VulkanCalls::vkGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t *pDataSize, void *pData) const
+{
+    return m_vkGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
+}
+
 VkResult VulkanCalls::vkCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo *pCreateInfo,
                                           const VkAllocationCallbacks *pAllocator, VkFramebuffer *pFramebuffer) const
 {
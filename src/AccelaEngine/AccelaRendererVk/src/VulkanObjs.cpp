@@ -62,6 +62,9 @@ VulkanRenderPassPtr VulkanObjs::GetSwapChainBlitRenderPass() const noexcept { re
 VulkanRenderPassPtr VulkanObjs::GetShadowCascadedRenderPass() const noexcept { return m_shadowCascadedRenderPass; }
 VulkanRenderPassPtr VulkanObjs::GetShadowSingleRenderPass() const noexcept { return m_shadowSingleRenderPass; }
 VulkanRenderPassPtr VulkanObjs::GetShadowCubeRenderPass() const noexcept { return m_shadowCubeRenderPass; }
+VulkanRenderPassPtr VulkanObjs::GetShadowCascadedLoadRenderPass() const noexcept { return m_shadowCascadedLoadRenderPass; }
+VulkanRenderPassPtr VulkanObjs::GetShadowSingleLoadRenderPass() const noexcept { return m_shadowSingleLoadRenderPass; }
+VulkanRenderPassPtr VulkanObjs::GetShadowCubeLoadRenderPass() const noexcept { return m_shadowCubeLoadRenderPass; }
 
 bool VulkanObjs::Initialize(bool enableValidationLayers,
                             const RenderSettings& renderSettings,
@@ -154,21 +157,21 @@ bool VulkanObjs::Initialize(bool enableValidationLayers,
         return false;
     }
 
-    if (!CreateShadowCascadedRenderPass())
+    if (!CreateShadowCascadedRenderPasses())
     {
-        m_logger->Log(Common::LogLevel::Error, "VulkanObjs: Failed to create shadow cascaded render pass");
+        m_logger->Log(Common::LogLevel::Error, "VulkanObjs: Failed to create shadow cascaded render passes");
         return false;
     }
 
-    if (!CreateShadowSingleRenderPass())
+    if (!CreateShadowSingleRenderPasses())
     {
-        m_logger->Log(Common::LogLevel::Error, "VulkanObjs: Failed to create shadow single render pass");
+        m_logger->Log(Common::LogLevel::Error, "VulkanObjs: Failed to create shadow single render passes");
         return false;
     }
 
-    if (!CreateShadowCubeRenderPass())
+    if (!CreateShadowCubeRenderPasses())
     {
-        m_logger->Log(Common::LogLevel::Error, "VulkanObjs: Failed to create shadow cube render pass");
+        m_logger->Log(Common::LogLevel::Error, "VulkanObjs: Failed to create shadow cube render passes");
         return false;
     }
 
@@ -179,9 +182,9 @@ void VulkanObjs::Destroy()
 {
     m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Destroying Vulkan objects");
 
-    DestroyShadowCubeRenderPass();
-    DestroyShadowSingleRenderPass();
-    DestroyShadowCascadedRenderPass();
+    DestroyShadowCubeRenderPasses();
+    DestroyShadowSingleRenderPasses();
+    DestroyShadowCascadedRenderPasses();
     DestroyScreenRenderPass();
     DestroyGPassRenderPass();
     DestroySwapChainFrameBuffers();
@@ -924,9 +927,9 @@ void VulkanObjs::DestroySwapChainBlitRenderPass()
     }
 }
 
-bool VulkanObjs::CreateShadowCascadedRenderPass()
+bool VulkanObjs::CreateShadowCascadedRenderPasses()
 {
-    m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Creating shadow cascaded render pass");
+    m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Creating shadow cascaded render passes");
 
     if (!m_renderSettings) { return false; }
 
@@ -941,14 +944,30 @@ bool VulkanObjs::CreateShadowCascadedRenderPass()
         viewMasks,
         correlationMask,
         numLayers,
+        false,
         "ShadowCascaded"
     );
 
-    return m_shadowCascadedRenderPass != nullptr;
+    m_shadowCascadedLoadRenderPass = CreateShadowRenderPass(
+        viewMasks,
+        correlationMask,
+        numLayers,
+        true,
+        "ShadowCascadedLoad"
+    );
+
+    return m_shadowCascadedRenderPass != nullptr && m_shadowCascadedLoadRenderPass != nullptr;
 }
 
-void VulkanObjs::DestroyShadowCascadedRenderPass()
+void VulkanObjs::DestroyShadowCascadedRenderPasses()
 {
+    if (m_shadowCascadedLoadRenderPass != nullptr)
+    {
+        m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Destroying shadow cascaded load render pass");
+        m_shadowCascadedLoadRenderPass->Destroy();
+        m_shadowCascadedLoadRenderPass = nullptr;
+    }
+
     if (m_shadowCascadedRenderPass != nullptr)
     {
         m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Destroying shadow cascaded render pass");
@@ -957,9 +976,9 @@ void VulkanObjs::DestroyShadowCascadedRenderPass()
     }
 }
 
-bool VulkanObjs::CreateShadowSingleRenderPass()
+bool VulkanObjs::CreateShadowSingleRenderPasses()
 {
-    m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Creating shadow single render pass");
+    m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Creating shadow single render passes");
 
     if (!m_renderSettings) { return false; }
 
@@ -967,14 +986,30 @@ bool VulkanObjs::CreateShadowSingleRenderPass()
         std::nullopt,
         std::nullopt,
         1,
+        false,
         "ShadowSingle"
     );
 
-    return m_shadowSingleRenderPass != nullptr;
+    m_shadowSingleLoadRenderPass = CreateShadowRenderPass(
+        std::nullopt,
+        std::nullopt,
+        1,
+        true,
+        "ShadowSingleLoad"
+    );
+
+    return m_shadowSingleRenderPass != nullptr && m_shadowSingleLoadRenderPass != nullptr;
 }
 
-void VulkanObjs::DestroyShadowSingleRenderPass()
+void VulkanObjs::DestroyShadowSingleRenderPasses()
 {
+    if (m_shadowSingleLoadRenderPass != nullptr)
+    {
+        m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Destroying shadow single load render pass");
+        m_shadowSingleLoadRenderPass->Destroy();
+        m_shadowSingleLoadRenderPass = nullptr;
+    }
+
     if (m_shadowSingleRenderPass != nullptr)
     {
         m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Destroying shadow single render pass");
@@ -983,20 +1018,28 @@ void VulkanObjs::DestroyShadowSingleRenderPass()
     }
 }
 
-bool VulkanObjs::CreateShadowCubeRenderPass()
+bool VulkanObjs::CreateShadowCubeRenderPasses()
 {
-    m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Creating shadow cube render pass");
+    m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Creating shadow cube render passes");
 
     const std::vector<uint32_t> viewMasks = {0b00111111};
     const uint32_t correlationMask = 0b00111111;
 
-    m_shadowCubeRenderPass = CreateShadowRenderPass(viewMasks, correlationMask, 6, "ShadowCube");
+    m_shadowCubeRenderPass = CreateShadowRenderPass(viewMasks, correlationMask, 6, false, "ShadowCube");
+    m_shadowCubeLoadRenderPass = CreateShadowRenderPass(viewMasks, correlationMask, 6, true, "ShadowCubeLoad");
 
-    return m_shadowCubeRenderPass != nullptr;
+    return m_shadowCubeRenderPass != nullptr && m_shadowCubeLoadRenderPass != nullptr;
 }
 
-void VulkanObjs::DestroyShadowCubeRenderPass()
+void VulkanObjs::DestroyShadowCubeRenderPasses()
 {
+    if (m_shadowCubeLoadRenderPass != nullptr)
+    {
+        m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Destroying shadow cube load render pass");
+        m_shadowCubeLoadRenderPass->Destroy();
+        m_shadowCubeLoadRenderPass = nullptr;
+    }
+
     if (m_shadowCubeRenderPass != nullptr)
     {
         m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Destroying shadow cube render pass");
@@ -1008,6 +1051,7 @@ void VulkanObjs::DestroyShadowCubeRenderPass()
 VulkanRenderPassPtr VulkanObjs::CreateShadowRenderPass(const std::optional<std::vector<uint32_t>>& multiViewMasks,
                                                        const std::optional<uint32_t>& multiViewCorrelationMask,
                                                        unsigned int depthNumLayers,
+                                                       bool loadExistingDepth,
                                                        const std::string& tag)
 {
     m_logger->Log(Common::LogLevel::Info, "VulkanObjs: Creating {} render pass", tag);
@@ -1020,6 +1064,14 @@ VulkanRenderPassPtr VulkanObjs::CreateShadowRenderPass(const std::optional<std::
     depthAttachment.description.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
     depthAttachment.description.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
     depthAttachment.description.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    // Load passes render on top of depth that was previously copied into the attachment. The attachment is
+    // in the layout that RenderState transitions it to before the pass starts, the access's final layout.
+    if (loadExistingDepth)
+    {
+        depthAttachment.description.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+        depthAttachment.description.initialLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    }
     depthAttachment.description.finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
     const ImageAccess depthAttachmentAccess(
@@ -1050,12 +1102,30 @@ VulkanRenderPassPtr VulkanObjs::CreateShadowRenderPass(const std::optional<std::
     dependency_readShadowDepthOutput.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
     dependency_readShadowDepthOutput.dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
 
+    std::vector<VkSubpassDependency> dependencies = {dependency_readShadowDepthOutput};
+
+    // Load passes additionally depend on the barrier which RenderState inserts before the pass starts, so that the
+    // attachment's layout transition, and the load of its existing depth, happen after the depth was copied into it
+    if (loadExistingDepth)
+    {
+        VkSubpassDependency dependency_loadExistingDepth{};
+        dependency_loadExistingDepth.srcSubpass = VK_SUBPASS_EXTERNAL;
+        dependency_loadExistingDepth.dstSubpass = 0;
+        dependency_loadExistingDepth.srcStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+        dependency_loadExistingDepth.srcAccessMask = 0;
+        dependency_loadExistingDepth.dstStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+        dependency_loadExistingDepth.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
+        dependency_loadExistingDepth.dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
+
+        dependencies.push_back(dependency_loadExistingDepth);
+    }
+
     auto renderPass = std::make_shared<VulkanRenderPass>(m_logger, m_vulkanCalls, m_physicalDevice, m_device);
     if (!renderPass->Create(
         {depthAttachment},
         {depthAttachmentAccess},
         {shadowPass},
-        {dependency_readShadowDepthOutput},
+        dependencies,
         multiViewMasks,
         multiViewCorrelationMask,
         tag))
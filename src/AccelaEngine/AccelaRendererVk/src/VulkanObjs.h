@@ -66,6 +66,9 @@ namespace Accela::Render
             [[nodiscard]] VulkanRenderPassPtr GetShadowCascadedRenderPass() const noexcept;
             [[nodiscard]] VulkanRenderPassPtr GetShadowSingleRenderPass() const noexcept;
             [[nodiscard]] VulkanRenderPassPtr GetShadowCubeRenderPass() const noexcept;
+            [[nodiscard]] VulkanRenderPassPtr GetShadowCascadedLoadRenderPass() const noexcept;
+            [[nodiscard]] VulkanRenderPassPtr GetShadowSingleLoadRenderPass() const noexcept;
+            [[nodiscard]] VulkanRenderPassPtr GetShadowCubeLoadRenderPass() const noexcept;
 
         private:
 
@@ -96,12 +99,12 @@ namespace Accela::Render
             void DestroyScreenRenderPass();
             bool CreateSwapChainBlitRenderPass();
             void DestroySwapChainBlitRenderPass();
-            bool CreateShadowCascadedRenderPass();
-            void DestroyShadowCascadedRenderPass();
-            bool CreateShadowSingleRenderPass();
-            void DestroyShadowSingleRenderPass();
-            bool CreateShadowCubeRenderPass();
-            void DestroyShadowCubeRenderPass();
+            bool CreateShadowCascadedRenderPasses();
+            void DestroyShadowCascadedRenderPasses();
+            bool CreateShadowSingleRenderPasses();
+            void DestroyShadowSingleRenderPasses();
+            bool CreateShadowCubeRenderPasses();
+            void DestroyShadowCubeRenderPasses();
 
             bool CreateSwapChainFrameBuffers();
             void DestroySwapChainFrameBuffers();
@@ -111,6 +114,7 @@ namespace Accela::Render
             VulkanRenderPassPtr CreateShadowRenderPass(const std::optional<std::vector<uint32_t>>& multiViewMasks,
                                                        const std::optional<uint32_t>& multiViewCorrelationMask,
                                                        unsigned int depthNumLayers,
+                                                       bool loadExistingDepth,
                                                        const std::string& tag);
 
         private:
@@ -141,6 +145,9 @@ namespace Accela::Render
             VulkanRenderPassPtr m_shadowCascadedRenderPass; // Renders a cascaded directional shadow pass into a light framebuffer
             VulkanRenderPassPtr m_shadowSingleRenderPass; // Renders a single point shadow pass into a light framebuffer
             VulkanRenderPassPtr m_shadowCubeRenderPass; // Renders a cubic point shadow pass into a light framebuffer
+            VulkanRenderPassPtr m_shadowCascadedLoadRenderPass; // Renders a cascaded directional shadow pass on top of a light framebuffer's existing depth
+            VulkanRenderPassPtr m_shadowSingleLoadRenderPass; // Renders a single point shadow pass on top of a light framebuffer's existing depth
+            VulkanRenderPassPtr m_shadowCubeLoadRenderPass; // Renders a cubic point shadow pass on top of a light framebuffer's existing depth
     };
 }
 
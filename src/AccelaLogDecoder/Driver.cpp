@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Common/Log/BinaryLog.h>
+#include <Accela/Common/Log/LogRecord.h>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <optional>
+
+using namespace Accela;
+
+static void PrintUsage()
+{
+    std::cerr << "Usage: AccelaLogDecoder <binary log file> [binary log file...] [--min-level <debug|info|warning|error|fatal>]\n"
+              << "  Decodes binary log files, as written by a RotatingFileLogSink in binary format, and prints\n"
+              << "  them as text to stdout. Files are decoded in the order provided, so rotated files should be\n"
+              << "  listed oldest first (e.g. log.bin.2 log.bin.1 log.bin).\n";
+}
+
+static std::optional<Common::LogLevel> ParseLogLevel(const std::string& str)
+{
+    if (str == "debug") { return Common::LogLevel::Debug; }
+    if (str == "info") { return Common::LogLevel::Info; }
+    if (str == "warning") { return Common::LogLevel::Warning; }
+    if (str == "error") { return Common::LogLevel::Error; }
+    if (str == "fatal") { return Common::LogLevel::Fatal; }
+    return std::nullopt;
+}
+
+static bool DecodeFile(const std::string& filePath, Common::LogLevel minLogLevel)
+{
+    std::ifstream file(filePath, std::ios::in | std::ios::binary);
+    if (!file)
+    {
+        std::cerr << "Error: Failed to open file: " << filePath << '\n';
+        return false;
+    }
+
+    if (!Common::BinaryLog::ReadHeader(file))
+    {
+        std::cerr << "Error: Not a binary log file, or of an unsupported version: " << filePath << '\n';
+        return false;
+    }
+
+    while (const auto record = Common::BinaryLog::ReadRecord(file))
+    {
+        if (record->logLevel < minLogLevel) { continue; }
+
+        std::cout << Common::FormatLogRecord(*record) << '\n';
+    }
+
+    // A log which was being written when its process died can end in a partially written record
+    if (!file.eof() || file.gcount() != 0)
+    {
+        std::cerr << "Warning: File ends with a truncated record: " << filePath << '\n';
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> filePaths;
+    auto minLogLevel = Common::LogLevel::Debug;
+
+    for (int x = 1; x < argc; ++x)
+    {
+        const std::string arg = argv[x];
+
+        if (arg == "--min-level")
+        {
+            const auto logLevel = (x + 1 < argc) ? ParseLogLevel(argv[x + 1]) : std::nullopt;
+            if (!logLevel)
+            {
+                PrintUsage();
+                return 1;
+            }
+
+            minLogLevel = *logLevel;
+            ++x;
+        }
+        else
+        {
+            filePaths.push_back(arg);
+        }
+    }
+
+    if (filePaths.empty())
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    bool allSuccessful = true;
+
+    for (const auto& filePath : filePaths)
+    {
+        allSuccessful = DecodeFile(filePath, minLogLevel) && allSuccessful;
+    }
+
+    std::cout.flush();
+
+    return allSuccessful ? 0 : 1;
+}
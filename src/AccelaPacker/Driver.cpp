@@ -0,0 +1,310 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Accela/Platform/Package/PackedPackageWriter.h>
+#include <Accela/Platform/Package/PackedPackageSource.h>
+#include <Accela/Platform/File/SDLFiles.h>
+
+#include <Accela/Platform/File/IFiles.h>
+
+#include <Accela/Common/Image/KTX2.h>
+#include <Accela/Common/Image/TextureEncoder.h>
+#include <Accela/Common/Log/StdLogger.h>
+
+#include <iostream>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <span>
+#include <array>
+#include <algorithm>
+#include <cctype>
+
+using namespace Accela;
+
+/**
+ * Format package color textures are compressed to. Auto picks BC1 for opaque textures and BC3 for
+ * textures with transparency. Normal maps are always compressed to BC5.
+ */
+enum class TextureCompression
+{
+    Auto,
+    BC1,
+    BC3,
+    BC7
+};
+
+static void PrintUsage()
+{
+    std::cerr << "Usage: AccelaPacker <package manifest file> [output file] [--compress-textures <auto|bc1|bc3|bc7>]\n"
+              << "                    [--no-compress <pattern>]... [--normal-maps <pattern>]...\n"
+              << "  Packs a package directory into a single packed package file. If no output file is\n"
+              << "  provided, the packed file is written next to the package's directory, where the\n"
+              << "  engine will find it and prefer it over the package's directory.\n"
+              << "\n"
+              << "  --compress-textures: Bakes a full mip chain for each texture and model texture in the package,\n"
+              << "  block-compresses it, and packs it as a KTX2 texture under its original name.\n"
+              << "\n"
+              << "  --no-compress: Textures matching the pattern are packed as-is. Textures which are read on the\n"
+              << "  CPU, such as height maps, can't be block-compressed and must be excluded with this.\n"
+              << "\n"
+              << "  --normal-maps: Textures matching the pattern are normal maps, and are compressed to two\n"
+              << "  channel, linear, BC5 rather than to the color format.\n"
+              << "\n"
+              << "  Patterns may use '*' and '?' wildcards, and are matched against both a texture's path within\n"
+              << "  the package and its file name.\n";
+}
+
+static std::optional<TextureCompression> ParseTextureCompression(const std::string& str)
+{
+    if (str == "auto") { return TextureCompression::Auto; }
+    if (str == "bc1") { return TextureCompression::BC1; }
+    if (str == "bc3") { return TextureCompression::BC3; }
+    if (str == "bc7") { return TextureCompression::BC7; }
+    return std::nullopt;
+}
+
+/**
+ * @return Whether the string matches the pattern, where '*' in the pattern matches any run of
+ * characters and '?' matches any single character
+ */
+static bool GlobMatches(std::string_view pattern, std::string_view str)
+{
+    std::size_t p = 0;
+    std::size_t s = 0;
+
+    // Position in the pattern after the last '*' seen, and the position in the string it was matched from
+    std::optional<std::size_t> starP;
+    std::size_t starS = 0;
+
+    while (s < str.size())
+    {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == str[s]))
+        {
+            ++p;
+            ++s;
+        }
+        else if (p < pattern.size() && pattern[p] == '*')
+        {
+            starP = ++p;
+            starS = s;
+        }
+        else if (starP)
+        {
+            // Backtrack, letting the last '*' consume one more character
+            p = *starP;
+            s = ++starS;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while (p < pattern.size() && pattern[p] == '*') { ++p; }
+
+    return p == pattern.size();
+}
+
+static bool MatchesAnyPattern(const std::vector<std::string>& patterns, const std::string& entryPath)
+{
+    const auto fileName = std::filesystem::path(entryPath).filename().string();
+
+    return std::ranges::any_of(patterns, [&](const auto& pattern){
+        return GlobMatches(pattern, entryPath) || GlobMatches(pattern, fileName);
+    });
+}
+
+static bool IsCompressibleTexture(const std::string& entryPath)
+{
+    static const std::array<std::string, 5> textureExtensions = {".png", ".jpg", ".jpeg", ".tga", ".bmp"};
+
+    const auto texturesPrefix = std::string(Platform::ASSETS_DIR) + "/" + Platform::TEXTURES_SUBDIR + "/";
+    const auto modelsPrefix = std::string(Platform::ASSETS_DIR) + "/" + Platform::MODELS_SUBDIR + "/";
+
+    if (!entryPath.starts_with(texturesPrefix) && !entryPath.starts_with(modelsPrefix))
+    {
+        return false;
+    }
+
+    auto extension = std::filesystem::path(entryPath).extension().string();
+    std::ranges::transform(extension, extension.begin(), [](unsigned char c){ return (char)std::tolower(c); });
+
+    return std::ranges::find(textureExtensions, extension) != textureExtensions.cend();
+}
+
+/**
+ * Replaces an entry's image file data with KTX2 data containing a block-compressed, fully mipped, version of the image
+ */
+static bool CompressTexture(const Platform::SDLFiles& files,
+                            TextureCompression compression,
+                            bool isNormalMap,
+                            const std::string& entryPath,
+                            std::vector<char>& data)
+{
+    auto dataFormatHint = std::filesystem::path(entryPath).extension().string();
+    if (!dataFormatHint.empty()) { dataFormatHint.erase(0, 1); }
+
+    const auto imageData = files.LoadTexture(std::as_bytes(std::span(data)), dataFormatHint);
+    if (!imageData)
+    {
+        std::cerr << "Failed to load texture: " << entryPath << std::endl;
+        return false;
+    }
+
+    Common::ImageData::PixelFormat targetFormat{Common::ImageData::PixelFormat::BC1};
+
+    switch (compression)
+    {
+        case TextureCompression::Auto:
+            targetFormat = Common::TextureEncoder::HasTransparency(**imageData) ?
+                Common::ImageData::PixelFormat::BC3 : Common::ImageData::PixelFormat::BC1;
+        break;
+        case TextureCompression::BC1: targetFormat = Common::ImageData::PixelFormat::BC1; break;
+        case TextureCompression::BC3: targetFormat = Common::ImageData::PixelFormat::BC3; break;
+        case TextureCompression::BC7: targetFormat = Common::ImageData::PixelFormat::BC7; break;
+    }
+
+    if (isNormalMap)
+    {
+        targetFormat = Common::ImageData::PixelFormat::BC5;
+    }
+
+    // BC5 holds two channel non-color data, such as normals, which isn't sRGB encoded
+    const bool srgb = targetFormat != Common::ImageData::PixelFormat::BC5;
+
+    const auto mippedImageData = Common::TextureEncoder::GenerateMipChain(**imageData, srgb);
+    if (!mippedImageData)
+    {
+        std::cerr << "Failed to generate mips for texture: " << entryPath << std::endl;
+        return false;
+    }
+
+    const auto encodedImageData = Common::TextureEncoder::Encode(**mippedImageData, targetFormat);
+    if (!encodedImageData)
+    {
+        std::cerr << "Failed to encode texture: " << entryPath << std::endl;
+        return false;
+    }
+
+    const auto ktx2Data = Common::KTX2::Write(**encodedImageData, srgb);
+    if (!ktx2Data)
+    {
+        std::cerr << "Failed to write KTX2 data for texture: " << entryPath << std::endl;
+        return false;
+    }
+
+    std::cout << "Compressed texture " << entryPath << ": " << data.size() << " -> " << ktx2Data->size() << " bytes" << std::endl;
+
+    const auto* pKtx2Data = reinterpret_cast<const char*>(ktx2Data->data());
+    data.assign(pKtx2Data, pKtx2Data + ktx2Data->size());
+
+    return true;
+}
+
+static std::string WriteErrorToString(Platform::PackedPackageWriter::WriteError error)
+{
+    switch (error)
+    {
+        case Platform::PackedPackageWriter::WriteError::PackageInvalid: return "Package is invalid";
+        case Platform::PackedPackageWriter::WriteError::FailureReadingPackage: return "Failed to read package files";
+        case Platform::PackedPackageWriter::WriteError::FailureTransformingEntry: return "Failed to transform package file";
+        case Platform::PackedPackageWriter::WriteError::FailureWritingFile: return "Failed to write packed file";
+    }
+
+    return "Unknown error";
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> positionalArgs;
+    std::optional<TextureCompression> textureCompression;
+    std::vector<std::string> noCompressPatterns;
+    std::vector<std::string> normalMapPatterns;
+
+    for (int x = 1; x < argc; ++x)
+    {
+        const std::string arg(argv[x]);
+
+        if (arg == "--compress-textures")
+        {
+            if (x + 1 >= argc || !(textureCompression = ParseTextureCompression(argv[x + 1])))
+            {
+                PrintUsage();
+                return 1;
+            }
+
+            ++x;
+        }
+        else if (arg == "--no-compress" || arg == "--normal-maps")
+        {
+            if (x + 1 >= argc)
+            {
+                PrintUsage();
+                return 1;
+            }
+
+            (arg == "--no-compress" ? noCompressPatterns : normalMapPatterns).emplace_back(argv[x + 1]);
+
+            ++x;
+        }
+        else
+        {
+            positionalArgs.push_back(arg);
+        }
+    }
+
+    if (positionalArgs.empty() || positionalArgs.size() > 2)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    const auto manifestFile = std::filesystem::path(positionalArgs[0]);
+    const auto packageName = manifestFile.filename().replace_extension().string();
+
+    // Default to writing {packages dir}/{package name}.apak, alongside {packages dir}/{package name}/
+    const auto outputFile = positionalArgs.size() == 2 ?
+        std::filesystem::path(positionalArgs[1]) :
+        manifestFile.parent_path().parent_path() / (packageName + Platform::PACKED_PACKAGE_EXTENSION);
+
+    const auto files = Platform::SDLFiles(std::make_shared<Common::StdLogger>(Common::LogLevel::Warning));
+
+    Platform::PackedPackageWriter::EntryTransform entryTransform;
+
+    if (textureCompression)
+    {
+        entryTransform = [&](const std::string& entryPath, std::vector<char>& data){
+            if (!IsCompressibleTexture(entryPath) || MatchesAnyPattern(noCompressPatterns, entryPath)) { return true; }
+            return CompressTexture(files, *textureCompression, MatchesAnyPattern(normalMapPatterns, entryPath), entryPath, data);
+        };
+    }
+
+    std::cout << "Packing package " << packageName << " into " << outputFile.string() << std::endl;
+
+    const auto result = Platform::PackedPackageWriter::WritePackedPackage(manifestFile, outputFile, entryTransform);
+    if (!result)
+    {
+        std::cerr << "Failed to pack package: " << WriteErrorToString(result.error()) << std::endl;
+        return 1;
+    }
+
+    //
+    // Verify the written file can be opened
+    //
+    const auto packedPackage = Platform::PackedPackageSource::OpenPacked(outputFile, std::nullopt);
+    if (!packedPackage)
+    {
+        std::cerr << "Failed to open packed package, error code: " << (int)packedPackage.error() << std::endl;
+        return 1;
+    }
+
+    std::cout << "Packed " << result->entryCount << " files, " << result->fileByteSize << " bytes" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,361 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+//
+// Micro-benchmark of the renderer's spatial indices: compares the dynamic BVH (and a static BVH)
+// against the r-tree on insert, update and query workloads over synthetic boxes
+//
+
+#include <Util/RTree.h>
+#include <Util/DynamicBVH.h>
+
+#include <glm/glm.hpp>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <random>
+#include <charconv>
+#include <optional>
+#include <algorithm>
+#include <numeric>
+#include <format>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Accela;
+
+using BenchRTree = Render::RTree<uint32_t, float, 3>;
+using BenchBVH = Render::DynamicBVH<uint32_t>;
+
+// Margin the dynamic BVH's fat bounds are expanded by, relative to the boxes' typical half-size of 1
+static constexpr float DYNAMIC_FAT_MARGIN = 0.2f;
+
+// World space density the boxes are spread out at; the world grows with the box count
+static constexpr float WORLD_VOLUME_PER_BOX = 1000.0f;
+
+// Size of the region each query covers
+static constexpr float QUERY_SIZE = 50.0f;
+
+struct SpatialBenchmarkParams
+{
+    /** Number of boxes in the index */
+    std::size_t boxCount{10000};
+
+    /** Number of update/query steps to measure */
+    unsigned int steps{200};
+
+    /** Fraction [0..1] of boxes which move a small distance every step */
+    float movingFraction{0.5f};
+
+    /** Fraction [0..1] of boxes which jump to a random position every step */
+    float teleportFraction{0.001f};
+
+    /** Number of volume queries run every step */
+    unsigned int queriesPerStep{100};
+};
+
+struct Box
+{
+    glm::vec3 center{0.0f};
+    glm::vec3 halfSize{1.0f};
+    glm::vec3 velocity{0.0f};
+
+    [[nodiscard]] Render::Volume GetVolume() const { return {center - halfSize, center + halfSize}; }
+};
+
+/** Name -> one timing sample per measurement, in milliseconds */
+using Samples = std::map<std::string, std::vector<double>>;
+
+static void PrintUsage()
+{
+    std::cerr << "Usage: AccelaSpatialBenchmark [--steps N] [--move F] [--teleport F] [--queries N] [boxCount ...]\n"
+              << "  --steps N      Number of update/query steps to measure (default 200)\n"
+              << "  --move F       Fraction of boxes which move a small distance every step (default 0.5)\n"
+              << "  --teleport F   Fraction of boxes which jump to a random position every step (default 0.001)\n"
+              << "  --queries N    Number of volume queries run every step (default 100)\n"
+              << "  boxCount       One or more box counts to benchmark (default 1000 10000 100000)\n";
+}
+
+template <typename T>
+static std::optional<T> ParseNumber(const std::string& str)
+{
+    T value{};
+    const auto result = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (result.ec != std::errc{} || result.ptr != str.data() + str.size()) { return std::nullopt; }
+    return value;
+}
+
+static std::optional<std::pair<SpatialBenchmarkParams, std::vector<std::size_t>>> ParseArgs(int argc, char** argv)
+{
+    SpatialBenchmarkParams params{};
+    std::vector<std::size_t> boxCounts;
+
+    for (int x = 1; x < argc; ++x)
+    {
+        const std::string arg = argv[x];
+        const bool hasValue = x + 1 < argc;
+
+        if (arg == "--steps" && hasValue)
+        {
+            const auto value = ParseNumber<unsigned int>(argv[++x]);
+            if (!value) { return std::nullopt; }
+            params.steps = *value;
+        }
+        else if (arg == "--move" && hasValue)
+        {
+            const auto value = ParseNumber<float>(argv[++x]);
+            if (!value) { return std::nullopt; }
+            params.movingFraction = *value;
+        }
+        else if (arg == "--teleport" && hasValue)
+        {
+            const auto value = ParseNumber<float>(argv[++x]);
+            if (!value) { return std::nullopt; }
+            params.teleportFraction = *value;
+        }
+        else if (arg == "--queries" && hasValue)
+        {
+            const auto value = ParseNumber<unsigned int>(argv[++x]);
+            if (!value) { return std::nullopt; }
+            params.queriesPerStep = *value;
+        }
+        else
+        {
+            const auto value = ParseNumber<std::size_t>(arg);
+            if (!value) { return std::nullopt; }
+            boxCounts.push_back(*value);
+        }
+    }
+
+    if (boxCounts.empty())
+    {
+        boxCounts = {1000, 10000, 100000};
+    }
+
+    return std::make_pair(params, boxCounts);
+}
+
+template <typename Func>
+static double TimeMs(const Func& func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+static double Percentile(const std::vector<double>& sorted, double percentile)
+{
+    if (sorted.empty()) { return 0.0; }
+
+    const auto index = static_cast<std::size_t>(percentile * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+
+static void PrintSamples(std::ostream& out, const SpatialBenchmarkParams& params, const Samples& samples)
+{
+    out << std::format("--- {} boxes ---\n", params.boxCount);
+    out << std::format("{:<36}{:>10}{:>10}{:>10}{:>10}{:>10}\n", "Metric (ms)", "min", "avg", "p50", "p99", "max");
+
+    for (const auto& it : samples)
+    {
+        auto values = it.second;
+        if (values.empty()) { continue; }
+
+        std::ranges::sort(values);
+
+        const double avg = std::accumulate(values.cbegin(), values.cend(), 0.0) / static_cast<double>(values.size());
+
+        out << std::format("{:<36}{:>10.3f}{:>10.3f}{:>10.3f}{:>10.3f}{:>10.3f}\n",
+            it.first,
+            values.front(),
+            avg,
+            Percentile(values, 0.50),
+            Percentile(values, 0.99),
+            values.back()
+        );
+    }
+}
+
+static void RunBenchmark(const SpatialBenchmarkParams& params, std::ostream& out)
+{
+    std::mt19937 mt{1234};
+
+    const float worldHalfSize = std::cbrt(WORLD_VOLUME_PER_BOX * static_cast<float>(params.boxCount)) / 2.0f;
+
+    std::uniform_real_distribution<float> positionDist(-worldHalfSize, worldHalfSize);
+    std::uniform_real_distribution<float> sizeDist(0.5f, 2.0f);
+    std::uniform_real_distribution<float> velocityDist(-0.5f, 0.5f);
+
+    const auto randomPosition = [&](){ return glm::vec3(positionDist(mt), positionDist(mt), positionDist(mt)); };
+
+    std::vector<Box> boxes(params.boxCount);
+
+    for (auto& box : boxes)
+    {
+        box.center = randomPosition();
+        box.halfSize = glm::vec3(sizeDist(mt), sizeDist(mt), sizeDist(mt));
+        box.velocity = glm::vec3(velocityDist(mt), velocityDist(mt), velocityDist(mt));
+    }
+
+    Samples samples;
+
+    //
+    // Insert
+    //
+    BenchRTree rTree;
+    BenchBVH staticBVH(0.0f);
+    BenchBVH dynamicBVH(DYNAMIC_FAT_MARGIN);
+
+    std::vector<BenchBVH::ProxyId> proxyIds(boxes.size());
+
+    samples["Insert_RTree"].push_back(TimeMs([&](){
+        for (uint32_t x = 0; x < boxes.size(); ++x) { rTree.Insert(boxes[x].GetVolume(), x); }
+    }));
+    samples["Insert_StaticBVH"].push_back(TimeMs([&](){
+        for (uint32_t x = 0; x < boxes.size(); ++x) { staticBVH.Insert(boxes[x].GetVolume(), x); }
+    }));
+    samples["Insert_DynamicBVH"].push_back(TimeMs([&](){
+        for (uint32_t x = 0; x < boxes.size(); ++x) { proxyIds[x] = dynamicBVH.Insert(boxes[x].GetVolume(), x); }
+    }));
+
+    //
+    // Queries against the static indices, before anything has moved
+    //
+    std::vector<Render::Volume> queries(params.queriesPerStep);
+
+    const auto generateQueries = [&](){
+        for (auto& query : queries)
+        {
+            const auto min = randomPosition();
+            query = Render::Volume(min, min + glm::vec3(QUERY_SIZE));
+        }
+    };
+
+    // Accumulated query result counts, reported so that the queries can't be optimized out
+    std::size_t staticRTreeResults = 0;
+    std::size_t staticBVHResults = 0;
+    std::size_t dynamicRTreeResults = 0;
+    std::size_t dynamicBVHResults = 0;
+
+    for (unsigned int step = 0; step < params.steps; ++step)
+    {
+        generateQueries();
+
+        samples["Query_Static_RTree"].push_back(TimeMs([&](){
+            for (const auto& query : queries) { staticRTreeResults += rTree.FetchMatching(query).size(); }
+        }));
+        samples["Query_Static_StaticBVH"].push_back(TimeMs([&](){
+            for (const auto& query : queries) { staticBVHResults += staticBVH.FetchMatching(query).size(); }
+        }));
+    }
+
+    //
+    // Update and query as the boxes move
+    //
+    const auto numMoving = static_cast<std::size_t>(static_cast<float>(boxes.size()) * std::clamp(params.movingFraction, 0.0f, 1.0f));
+    const auto numTeleporting = static_cast<std::size_t>(static_cast<float>(boxes.size()) * std::clamp(params.teleportFraction, 0.0f, 1.0f));
+
+    std::vector<Render::Volume> oldVolumes(boxes.size());
+    std::vector<glm::vec3> displacements(boxes.size());
+    std::vector<uint32_t> movedIndices;
+    movedIndices.reserve(numMoving + numTeleporting);
+
+    std::size_t moveCursor = 0;
+
+    for (unsigned int step = 0; step < params.steps; ++step)
+    {
+        // Move a rolling window of boxes by their velocity, plus a few random boxes to random positions
+        movedIndices.clear();
+
+        for (std::size_t x = 0; x < numMoving; ++x)
+        {
+            const auto index = static_cast<uint32_t>((moveCursor + x) % boxes.size());
+            displacements[index] = boxes[index].velocity;
+            movedIndices.push_back(index);
+        }
+        moveCursor = (moveCursor + numMoving) % std::max<std::size_t>(boxes.size(), 1);
+
+        for (std::size_t x = 0; x < numTeleporting; ++x)
+        {
+            const auto index = static_cast<uint32_t>(mt() % boxes.size());
+            displacements[index] = randomPosition() - boxes[index].center;
+            movedIndices.push_back(index);
+        }
+
+        // A box can be picked to teleport more than once, or from within the moving window, but must only be moved,
+        // and updated within the indices, once; its last picked displacement wins
+        std::ranges::sort(movedIndices);
+        const auto duplicates = std::ranges::unique(movedIndices);
+        movedIndices.erase(duplicates.begin(), duplicates.end());
+
+        for (const auto& index : movedIndices)
+        {
+            oldVolumes[index] = boxes[index].GetVolume();
+        }
+        for (const auto& index : movedIndices)
+        {
+            boxes[index].center += displacements[index];
+        }
+
+        samples["Update_RTree"].push_back(TimeMs([&](){
+            for (const auto& index : movedIndices)
+            {
+                rTree.Remove(oldVolumes[index], index);
+                rTree.Insert(boxes[index].GetVolume(), index);
+            }
+        }));
+        samples["Update_DynamicBVH"].push_back(TimeMs([&](){
+            for (const auto& index : movedIndices)
+            {
+                dynamicBVH.Update(proxyIds[index], boxes[index].GetVolume(), displacements[index]);
+            }
+        }));
+
+        generateQueries();
+
+        samples["Query_Dynamic_RTree"].push_back(TimeMs([&](){
+            for (const auto& query : queries) { dynamicRTreeResults += rTree.FetchMatching(query).size(); }
+        }));
+        samples["Query_Dynamic_DynamicBVH"].push_back(TimeMs([&](){
+            for (const auto& query : queries) { dynamicBVHResults += dynamicBVH.FetchMatching(query).size(); }
+        }));
+    }
+
+    PrintSamples(out, params, samples);
+
+    out << std::format("Static BVH height: {}, area ratio: {:.2f}\n", staticBVH.GetHeight(), staticBVH.GetAreaRatio());
+    out << std::format("Dynamic BVH height: {}, area ratio: {:.2f}\n", dynamicBVH.GetHeight(), dynamicBVH.GetAreaRatio());
+
+    // The BVHs return entries whose fat bounds match, so can return more results than the r-tree
+    out << std::format("Static query results: RTree {}, StaticBVH {}\n", staticRTreeResults, staticBVHResults);
+    out << std::format("Dynamic query results: RTree {}, DynamicBVH {}\n", dynamicRTreeResults, dynamicBVHResults);
+}
+
+int main(int argc, char** argv)
+{
+    const auto args = ParseArgs(argc, argv);
+    if (!args)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    for (const auto& boxCount : args->second)
+    {
+        auto params = args->first;
+        params.boxCount = boxCount;
+
+        RunBenchmark(params, std::cout);
+    }
+
+    return 0;
+}
@@ -5,7 +5,8 @@
  */
  
 #include <Accela/Engine/EngineDesktop.h>
-#include <Accela/Common/Log/StdLogger.h>
+#include <Accela/Common/Log/AsyncLogger.h>
+#include <Accela/Common/Log/StdOutLogSink.h>
 #include <Accela/Common/Metrics/InMemoryMetrics.h>
 
 #include "TestScene.h"
@@ -15,7 +16,11 @@ int main()
 {
     using namespace Accela;
 
-    auto logger = std::make_shared<Common::StdLogger>(Common::LogLevel::Warning);
+    // Log asynchronously so that logging, and slow consumers of stdout, never stall the render thread
+    auto logger = std::make_shared<Common::AsyncLogger>(
+        std::vector<Common::ILogSink::Ptr>{std::make_shared<Common::StdOutLogSink>()},
+        Common::LogLevel::Warning
+    );
     auto metrics = std::make_shared<Common::InMemoryMetrics>();
 
     auto desktopEngine = Engine::EngineDesktop(logger, metrics);